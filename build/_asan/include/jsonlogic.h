@@ -0,0 +1,687 @@
+#ifndef JSONLOGIC_H
+#define JSONLOGIC_H
+#pragma once
+
+#include "jsonlogic_defs.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct JsonLogic_LineInfo {
+    size_t index;
+    size_t lineno;
+    size_t column;
+} JsonLogic_LineInfo;
+
+#define JSONLOGIC_LINEINFO_INIT (JsonLogic_LineInfo){ .index = 0, .lineno = 0, .column = 0 }
+
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_NaN;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Null;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_True;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_False;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_Success;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_OutOfMemory;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_IllegalOperation;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_IllegalArgument;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_InternalError;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_StopIteration;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_IOError;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_SyntaxError;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_UnicodeError;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Handle JsonLogic_Error_RecursionError;
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_incref(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_decref(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_dissolve(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT size_t           jsonlogic_get_refcount(JsonLogic_Handle handle);
+
+/**
+ * @brief Make @p handle and everything reachable from it immutable.
+ *
+ * Precomputes all string hashes and marks the values as frozen. Reference
+ * counting is a no-op for frozen values and evaluation never writes to them,
+ * so they can be shared by any number of threads. Freeze before sharing.
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_freeze(JsonLogic_Handle handle);
+
+/**
+ * @brief Undo jsonlogic_freeze(), restoring the refcounts from before.
+ *
+ * Only thaw when no other thread uses the value anymore and all results that
+ * may reference parts of it (including compiled programs) are released.
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_thaw(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool             jsonlogic_is_frozen(JsonLogic_Handle handle);
+
+/**
+ * @brief Like jsonlogic_freeze(), but for good.
+ *
+ * Immortal values are never thawed and never freed. Use this for values that
+ * live as long as the process, e.g. rules loaded at startup.
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_make_immortal(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool             jsonlogic_is_immortal(JsonLogic_Handle handle);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_parse(const char *str, JsonLogic_LineInfo *infoptr);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_LineInfo *infoptr);
+
+JSONLOGIC_EXPORT JsonLogic_LineInfo jsonlogic_get_lineinfo(const char *str, size_t size, size_t index);
+
+typedef struct JsonLogic_Parser JsonLogic_Parser;
+
+/**
+ * @brief Create a parser that is fed a JSON document in chunks.
+ *
+ * Feed the chunks as they arrive with jsonlogic_parser_feed(), the document is
+ * parsed as far as possible each time. Only a string, number or literal that
+ * continues in the next chunk is copied. jsonlogic_parser_finish() returns the
+ * parsed value (or error) and resets the parser for the next document.
+ *
+ * @return The parser or NULL if out of memory.
+ */
+JSONLOGIC_EXPORT JsonLogic_Parser *jsonlogic_parser_new(void);
+JSONLOGIC_EXPORT void jsonlogic_parser_free(JsonLogic_Parser *parser);
+
+/**
+ * @brief Parse the next chunk of the document.
+ *
+ * @return JSONLOGIC_ERROR_SUCCESS or the error that the document has, which is
+ *         returned again by every further call until the parser is finished.
+ */
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_parser_feed(JsonLogic_Parser *parser, const char *chunk, size_t size);
+
+/**
+ * @brief End the document and return its value like jsonlogic_parse_sized().
+ *
+ * The line info of an error counts from the start of the first chunk.
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_parser_finish(JsonLogic_Parser *parser, JsonLogic_LineInfo *infoptr);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_stringify(JsonLogic_Handle value);
+JSONLOGIC_EXPORT char *jsonlogic_stringify_utf8(JsonLogic_Handle value);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_stringify_file(FILE *file, JsonLogic_Handle value);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_string_from_latin1      (const char *str);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_string_from_latin1_sized(const char *str, size_t size);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_string_from_utf8        (const char *str);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_string_from_utf8_sized  (const char *str, size_t size);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_string_from_utf16       (const char16_t *str);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_string_from_utf16_sized (const char16_t *str, size_t size);
+
+JSONLOGIC_EXPORT bool jsonlogic_utf16_equals( const char16_t *a, size_t asize, const char16_t *b, size_t bsize);
+JSONLOGIC_EXPORT int  jsonlogic_utf16_compare(const char16_t *a, size_t asize, const char16_t *b, size_t bsize);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_number_from(double value);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_error_from(JsonLogic_Error error);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_empty_string(void);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_empty_array(void);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_empty_object(void);
+
+typedef struct JsonLogic_Object_Utf16Entry {
+    const char16_t *key;
+    JsonLogic_Handle value;
+} JsonLogic_Object_Utf16Entry;
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_array_from (const JsonLogic_Handle items[], size_t size);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_array_from_and_decref(const JsonLogic_Handle items[], size_t size);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_object_from(const JsonLogic_Object_Entry entries[], size_t size);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_object_from_and_decref(const JsonLogic_Object_Entry entries[], size_t size);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_object_from_utf16(const JsonLogic_Object_Utf16Entry entries[], size_t size);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_object_from_utf16_and_decref(const JsonLogic_Object_Utf16Entry entries[], size_t size);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_array_from_vararg (size_t count, ...);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_object_from_vararg(size_t count, ...);
+
+#define jsonlogic_count_values(...) (sizeof((JsonLogic_Handle[]){__VA_ARGS__} / sizeof(JsonLogic_Handle)))
+#define jsonlogic_array_build(...) jsonlogic_array_from((JsonLogic_Handle[]){ __VA_ARGS__ }, jsonlogic_count_values(__VA_ARGS__))
+#define jsonlogic_array_build_and_decref(...) jsonlogic_array_from_and_decref((JsonLogic_Handle[]){ __VA_ARGS__ }, jsonlogic_count_values(__VA_ARGS__))
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_to_array(JsonLogic_Handle handle);
+
+
+#define jsonlogic_count_entries(...) (sizeof((JsonLogic_Object_Entry[]){__VA_ARGS__}) / sizeof(JsonLogic_Object_Entry))
+#define jsonlogic_object_build(...) jsonlogic_object_from((JsonLogic_Object_Entry[]){ __VA_ARGS__ }, jsonlogic_count_entries(__VA_ARGS__))
+#define jsonlogic_object_build_and_decref(...) jsonlogic_object_from_and_decref((JsonLogic_Object_Entry[]){ __VA_ARGS__ }, jsonlogic_count_entries(__VA_ARGS__))
+
+#define jsonlogic_count_entries_utf16(...) (sizeof((JsonLogic_Object_Utf16Entry[]){__VA_ARGS__}) / sizeof(JsonLogic_Object_Utf16Entry))
+#define jsonlogic_object_build_utf16(...) jsonlogic_object_from_utf16((JsonLogic_Object_Utf16Entry[]){ __VA_ARGS__ }, jsonlogic_count_entries_utf16(__VA_ARGS__))
+#define jsonlogic_object_build_utf16_and_decref(...) jsonlogic_object_from_utf16_and_decref((JsonLogic_Object_Utf16Entry[]){ __VA_ARGS__ }, jsonlogic_count_entries_utf16(__VA_ARGS__))
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_to_string (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_to_number (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_to_boolean(JsonLogic_Handle handle);
+
+JSONLOGIC_EXPORT bool   jsonlogic_to_bool  (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT double jsonlogic_to_double(JsonLogic_Handle handle);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_substr(JsonLogic_Handle string, JsonLogic_Handle index, JsonLogic_Handle size);
+JSONLOGIC_EXPORT const char16_t *jsonlogic_get_string_content(JsonLogic_Handle string, size_t *sizeptr);
+
+JSONLOGIC_EXPORT size_t jsonlogic_utf16_len(const char16_t *key);
+JSONLOGIC_EXPORT char *jsonlogic_utf16_to_utf8(const char16_t *str, size_t size);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_print_utf16(FILE *stream, const char16_t *str, size_t size);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_println_utf16(FILE *stream, const char16_t *str, size_t size);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_print(FILE *stream, JsonLogic_Handle handle);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_println(FILE *stream, JsonLogic_Handle handle);
+
+JSONLOGIC_EXPORT JsonLogic_Type jsonlogic_get_type(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT const char    *jsonlogic_get_type_name(JsonLogic_Type type);
+
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_get_error(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT const char     *jsonlogic_get_error_message(JsonLogic_Error error);
+JSONLOGIC_EXPORT const char     *jsonlogic_get_linestart(const char *str, size_t index);
+JSONLOGIC_EXPORT void jsonlogic_print_parse_error(FILE *stream, const char *str, JsonLogic_Error error, JsonLogic_LineInfo info);
+JSONLOGIC_EXPORT void jsonlogic_print_parse_error_sized(FILE *stream, const char *str, size_t size, JsonLogic_Error error, JsonLogic_LineInfo info);
+
+JSONLOGIC_EXPORT bool jsonlogic_is_string (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool jsonlogic_is_error  (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool jsonlogic_is_null   (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool jsonlogic_is_number (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool jsonlogic_is_array  (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool jsonlogic_is_object (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool jsonlogic_is_boolean(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool jsonlogic_is_true   (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool jsonlogic_is_false  (JsonLogic_Handle handle);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_add(JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_sub(JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_mul(JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_div(JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_mod(JsonLogic_Handle a, JsonLogic_Handle b);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_negative(JsonLogic_Handle value);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_not(JsonLogic_Handle value);
+
+JSONLOGIC_EXPORT int jsonlogic_compare(JsonLogic_Handle a, JsonLogic_Handle b);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_lt(JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_gt(JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_le(JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_ge(JsonLogic_Handle a, JsonLogic_Handle b);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_equal    (JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_not_equal(JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_strict_equal    (JsonLogic_Handle a, JsonLogic_Handle b);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_strict_not_equal(JsonLogic_Handle a, JsonLogic_Handle b);
+
+/**
+ * @brief Check for deep equality.
+ * @warning Has no cycle detection!
+ * 
+ * @param a 
+ * @param b 
+ * @return 
+ */
+JSONLOGIC_EXPORT bool jsonlogic_deep_strict_equal(JsonLogic_Handle a, JsonLogic_Handle b);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_includes(JsonLogic_Handle list, JsonLogic_Handle item);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_get(JsonLogic_Handle object, JsonLogic_Handle key);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_get_index(JsonLogic_Handle handle, size_t index);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_get_utf16_sized(JsonLogic_Handle object, const char16_t *key, size_t size);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply(JsonLogic_Handle logic, JsonLogic_Handle input);
+
+typedef JsonLogic_Handle (*JsonLogic_Operation_Funct)(void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc);
+
+typedef struct JsonLogic_Evaluator JsonLogic_Evaluator;
+
+/**
+ * @brief An operation that gets its arguments unevaluated.
+ *
+ * args are the logic of the arguments. The operation evaluates only those
+ * it needs with jsonlogic_evaluate(), so it can short-circuit like the
+ * builtin if, and and or. The evaluator is only valid during the call.
+ */
+typedef JsonLogic_Handle (*JsonLogic_LazyOperation_Funct)(void *context, JsonLogic_Handle data, const JsonLogic_Handle args[], size_t argc, JsonLogic_Evaluator *evaluator);
+
+// Flags of an operation. Without any flags nothing is assumed about an
+// operation, it is always called when the logic says so.
+
+// No side effects. Calls may be skipped, shared between equal subtrees or
+// made from several threads at once.
+#define JSONLOGIC_OPERATION_NO_SIDE_EFFECTS 0x1u
+// The same arguments and data always give the same result (now doesn't).
+#define JSONLOGIC_OPERATION_DETERMINISTIC   0x2u
+// The result doesn't depend on data (var and missing do).
+#define JSONLOGIC_OPERATION_IGNORES_DATA    0x4u
+// The result doesn't depend on the order of the arguments.
+#define JSONLOGIC_OPERATION_COMMUTATIVE     0x8u
+// Costly compared to a comparison, e.g. it parses dates or builds arrays.
+#define JSONLOGIC_OPERATION_EXPENSIVE       0x10u
+
+// Only depends on the arguments, so calls with constant arguments can be
+// evaluated ahead of time.
+#define JSONLOGIC_OPERATION_PURE ( \
+    JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | \
+    JSONLOGIC_OPERATION_DETERMINISTIC   | \
+    JSONLOGIC_OPERATION_IGNORES_DATA)
+
+/**
+ * An operation sets either funct or lazy_funct, the other one is NULL.
+ * flags are a combination of the JSONLOGIC_OPERATION_* flags above. They are
+ * ignored for lazy operations.
+ */
+typedef struct JsonLogic_Operation {
+    void *context;
+    JsonLogic_Operation_Funct funct;
+    JsonLogic_LazyOperation_Funct lazy_funct;
+    unsigned int flags;
+} JsonLogic_Operation;
+
+typedef struct JsonLogic_Operation_Entry {
+    uint64_t hash;
+    const char16_t *key;
+    size_t key_size;
+    JsonLogic_Operation operation;
+} JsonLogic_Operation_Entry;
+
+typedef struct JsonLogic_Operations {
+    size_t capacity;
+    size_t used;
+    JsonLogic_Operation_Entry *entries;
+} JsonLogic_Operations;
+
+JSONLOGIC_EXPORT const JsonLogic_Operation *jsonlogic_operations_get_sized(const JsonLogic_Operations *operations, const char16_t *key, size_t key_size);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_operations_set_sized(JsonLogic_Operations *operations, const char16_t *key, size_t key_size, void *context, JsonLogic_Operation_Funct funct);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_operations_set_lazy_sized(JsonLogic_Operations *operations, const char16_t *key, size_t key_size, void *context, JsonLogic_LazyOperation_Funct lazy_funct);
+
+/**
+ * @brief Evaluate logic with data from within a lazy operation.
+ *
+ * Evaluation errors are returned as error values like any other result. If
+ * the whole evaluation is aborted (JsonLogic_Error_RecursionError or
+ * JsonLogic_Error_OutOfMemory) that is returned here and is the result of the
+ * evaluation, no matter what the operation returns.
+ *
+ * @return A new reference.
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_evaluate(JsonLogic_Evaluator *evaluator, JsonLogic_Handle logic, JsonLogic_Handle data);
+
+JSONLOGIC_EXPORT_CONST const JsonLogic_Operations JsonLogic_Builtins;
+JSONLOGIC_EXPORT_CONST const JsonLogic_Operations CertLogic_Builtins;
+
+typedef struct JsonLogic_Operations_BuildEntry {
+    const char16_t *key;
+    JsonLogic_Operation operation;
+} JsonLogic_Operations_BuildEntry;
+
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_operations_build(JsonLogic_Operations *operations, const JsonLogic_Operations_BuildEntry *build_operations);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_operations_extend(JsonLogic_Operations *operations, const JsonLogic_Operations *more_operations);
+JSONLOGIC_EXPORT void jsonlogic_operations_free(JsonLogic_Operations *operations);
+
+#define JSONLOGIC_OPERATIONS_INIT { .capacity = 0, .used = 0, .entries = NULL }
+
+typedef struct JsonLogic_Iterator {
+    JsonLogic_Handle handle;
+    size_t index;
+} JsonLogic_Iterator;
+
+#define JSONLOGIC_ITERATOR_INIT { .handle = JsonLogic_Null, .index = 0 }
+
+// can't get JSONLOGIC_EXPORT inline to work, so I its marcos
+#define jsonlogic_get_utf16(object, key) jsonlogic_get_utf16_sized((object), (key), jsonlogic_utf16_len((key)))
+#define jsonlogic_boolean_from(value) ((value) ? JsonLogic_True : JsonLogic_False)
+#define jsonlogic_iter(HANDLE) (JsonLogic_Iterator) { \
+        .handle = jsonlogic_incref((HANDLE)), \
+        .index  = 0, \
+    }
+#define jsonlogic_operations_get(operations, key) \
+    jsonlogic_operations_get_sized((operations), (key), jsonlogic_utf16_len((key)))
+
+#define jsonlogic_operations_set(operations, key, context, funct) \
+    jsonlogic_operations_set_sized((operations), (key), jsonlogic_utf16_len((key)), (context), (funct))
+
+#define jsonlogic_operations_set_lazy(operations, key, context, lazy_funct) \
+    jsonlogic_operations_set_lazy_sized((operations), (key), jsonlogic_utf16_len((key)), (context), (lazy_funct))
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_iter_next(JsonLogic_Iterator *iter);
+JSONLOGIC_EXPORT void             jsonlogic_iter_free(JsonLogic_Iterator *iter);
+
+/**
+ * @brief 
+ * 
+ * @param logic 
+ * @param input 
+ * @param operations need to be sorted because binaray search is performed on it
+ * @param operation_count 
+ * @return JSONLOGIC_EXPORT 
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply_custom(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations
+);
+
+/**
+ * @brief Like jsonlogic_apply_custom() with a limit for the nesting depth.
+ *
+ * Logic is evaluated without recursion in C, so deeply nested logic doesn't
+ * overflow the stack of the calling thread. Instead the evaluation stops with
+ * JsonLogic_Error_RecursionError if operations, arrays and lambdas are nested
+ * deeper than max_depth. jsonlogic_apply_custom() uses a max_depth of
+ * JSONLOGIC_MAX_DEPTH (4096 unless defined otherwise at build time).
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply_custom_max_depth(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations,
+    size_t max_depth
+);
+
+typedef struct JsonLogic_ThreadPool JsonLogic_ThreadPool;
+
+/**
+ * @brief Create a pool of worker threads for jsonlogic_apply_parallel().
+ *
+ * @param thread_count Number of worker threads. The thread that applies the
+ *                     logic takes part in the work, too.
+ * @param min_items Smallest array that is processed in parallel, 0 for the
+ *                  default (JSONLOGIC_PARALLEL_MIN_ITEMS, 1024).
+ * @return The pool or NULL if out of memory or no threads could be started.
+ */
+JSONLOGIC_EXPORT JsonLogic_ThreadPool *jsonlogic_thread_pool_new(size_t thread_count, size_t min_items);
+JSONLOGIC_EXPORT void jsonlogic_thread_pool_free(JsonLogic_ThreadPool *pool);
+JSONLOGIC_EXPORT size_t jsonlogic_thread_pool_get_thread_count(const JsonLogic_ThreadPool *pool);
+JSONLOGIC_EXPORT size_t jsonlogic_thread_pool_get_min_items(const JsonLogic_ThreadPool *pool);
+
+/**
+ * @brief Like jsonlogic_apply_custom(), but evaluates the lambdas of `map`,
+ * `filter`, `all`, `some` and `none` over large arrays on the threads of pool.
+ *
+ * The array is split into chunks that idle threads steal from busy ones. The
+ * order of the results is preserved and `all`, `some` and `none` stop all
+ * threads as soon as one item decides the result. This is only done if the
+ * lambda and the array are frozen (see jsonlogic_freeze()) and the lambda only
+ * uses `var`, the special forms and builtin operations without side effects.
+ * Everything else is evaluated on the calling thread, as is everything while
+ * the pool is used by another evaluation.
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply_custom_parallel(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations,
+    JsonLogic_ThreadPool *pool
+);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply_parallel(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_ThreadPool *pool);
+
+/**
+ * @brief Simplify logic without changing its result for any input.
+ *
+ * Operations of the builtin and extras tables that only depend on their
+ * arguments are evaluated if all arguments are constant, dead branches of
+ * `if` are removed, nested `and`/`or` are flattened and constant operands
+ * that don't decide their result are dropped. Operations that would yield an
+ * error are left in place.
+ *
+ * @return The optimized logic (which may be logic itself with an incremented
+ *         reference count) or an error if out of memory.
+ */
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_optimize(JsonLogic_Handle logic, const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_optimize(JsonLogic_Handle logic, const JsonLogic_Operations *operations);
+
+typedef struct JsonLogic_Program JsonLogic_Program;
+
+/**
+ * @brief Compile logic into a program that can be applied many times.
+ *
+ * Operations are resolved at compile time. The operations table may be
+ * freed afterwards, but the contexts of the operations have to outlive
+ * the program. The arguments of lazy operations are compiled, too. Other
+ * logic that a lazy operation evaluates is interpreted with a copy of the
+ * operations table, so then the keys have to outlive the program as well.
+ *
+ * @return The program or NULL if out of memory.
+ */
+JSONLOGIC_EXPORT JsonLogic_Program *jsonlogic_compile(JsonLogic_Handle logic, const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT JsonLogic_Program *certlogic_compile(JsonLogic_Handle logic, const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_program_apply(const JsonLogic_Program *program, JsonLogic_Handle input);
+JSONLOGIC_EXPORT void jsonlogic_program_free(JsonLogic_Program *program);
+
+/**
+ * @brief Apply the same logic to many inputs.
+ *
+ * The logic is compiled once and all evaluations share the same stack.
+ * results has to have space for count handles, each has to be released
+ * with jsonlogic_decref(). Errors of single evaluations are stored in
+ * results.
+ *
+ * The bitmap variants only store the truthiness of the results. Bit
+ * index % 8 of bitmap[index / 8] is set if the result for inputs[index]
+ * is truthy, errors are false. bitmap has to have space for (count + 7) / 8
+ * bytes.
+ *
+ * @return JSONLOGIC_ERROR_SUCCESS or JSONLOGIC_ERROR_OUT_OF_MEMORY if the
+ *         logic couldn't be compiled.
+ */
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_apply_batch(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, JsonLogic_Handle results[], const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_apply_batch_bitmap(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, uint8_t bitmap[], const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT JsonLogic_Error certlogic_apply_batch(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, JsonLogic_Handle results[], const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT JsonLogic_Error certlogic_apply_batch_bitmap(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, uint8_t bitmap[], const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_program_apply_batch(const JsonLogic_Program *program, const JsonLogic_Handle inputs[], size_t count, JsonLogic_Handle results[]);
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_program_apply_batch_bitmap(const JsonLogic_Program *program, const JsonLogic_Handle inputs[], size_t count, uint8_t bitmap[]);
+
+typedef struct JsonLogic_RuleSet JsonLogic_RuleSet;
+
+/**
+ * @brief Compile many rules that are applied to the same inputs.
+ *
+ * Subexpressions that occur in more than one place (in the same or in
+ * different rules) and only depend on the input are evaluated at most once
+ * per input. Subexpressions inside of lambdas and operations that might have
+ * side effects aren't shared. Like with jsonlogic_compile() the operations
+ * are resolved at compile time.
+ *
+ * Rules that are guarded by {"===":[{"var":PATH},CONSTANT]} or
+ * {"in":[{"var":PATH},[CONSTANTS...]]}, either as the whole rule or as the
+ * first argument of a top level "and", are indexed by PATH and CONSTANT.
+ * Per input each indexed PATH is looked up once and only the rules whose
+ * guards match are evaluated. The results of all others are false, just
+ * like their guards.
+ *
+ * Rules that only combine comparisons of a {"var":PATH} with a constant
+ * using "and", "or" and "!" are also compiled into one shared decision
+ * diagram. Each such comparison is then evaluated at most once per input,
+ * no matter how many rules use it. If a comparison doesn't evaluate to a
+ * boolean the rule is evaluated normally.
+ *
+ * @return The rule set or NULL if out of memory.
+ */
+JSONLOGIC_EXPORT JsonLogic_RuleSet *jsonlogic_ruleset_compile(const JsonLogic_Handle rules[], size_t rule_count, const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT JsonLogic_RuleSet *certlogic_ruleset_compile(const JsonLogic_Handle rules[], size_t rule_count, const JsonLogic_Operations *operations);
+JSONLOGIC_EXPORT void jsonlogic_ruleset_free(JsonLogic_RuleSet *ruleset);
+
+/**
+ * @brief Number of rules in the rule set.
+ */
+JSONLOGIC_EXPORT size_t jsonlogic_ruleset_get_size(const JsonLogic_RuleSet *ruleset);
+
+/**
+ * @brief Number of distinct subexpressions that are shared between rules.
+ */
+JSONLOGIC_EXPORT size_t jsonlogic_ruleset_get_shared_count(const JsonLogic_RuleSet *ruleset);
+
+/**
+ * @brief Number of rules that are part of the decision diagram.
+ */
+JSONLOGIC_EXPORT size_t jsonlogic_ruleset_get_diagram_size(const JsonLogic_RuleSet *ruleset);
+
+/**
+ * @brief Apply all rules to one input.
+ *
+ * results has to have space for jsonlogic_ruleset_get_size() handles, each
+ * has to be released with jsonlogic_decref(). Errors of single rules are
+ * stored in results.
+ *
+ * @return JSONLOGIC_ERROR_SUCCESS or JSONLOGIC_ERROR_OUT_OF_MEMORY.
+ */
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_ruleset_apply(const JsonLogic_RuleSet *ruleset, JsonLogic_Handle input, JsonLogic_Handle results[]);
+
+typedef enum JsonLogic_ColumnType {
+    JsonLogic_Column_Number = 0,
+    JsonLogic_Column_Boolean,
+    JsonLogic_Column_Dictionary,
+} JsonLogic_ColumnType;
+
+/**
+ * @brief A column of a table of flat records.
+ *
+ * Depending on type only one of numbers, booleans or codes is used. The
+ * values of a dictionary column are dictionary[codes[row]], every code has
+ * to be less than dictionary_size. Dictionary values are usually strings,
+ * but can be any value.
+ */
+typedef struct JsonLogic_Column {
+    const char16_t *name;
+    JsonLogic_ColumnType type;
+    const double   *numbers;
+    const bool     *booleans;
+    const uint32_t *codes;
+    const JsonLogic_Handle *dictionary;
+    size_t dictionary_size;
+} JsonLogic_Column;
+
+/**
+ * @brief Apply logic to every row of a table given as columns.
+ *
+ * Each row is treated like an object with one key per column name. Bit
+ * row % 8 of bitmap[row / 8] is set if the result for that row is truthy.
+ * bitmap has to have space for (row_count + 7) / 8 bytes.
+ *
+ * Rows are evaluated in blocks: `var` of a column name reads the column
+ * directly, arithmetic and comparisons of numbers run as vector kernels
+ * producing selection bitmaps and operations on boolean or dictionary
+ * columns are evaluated once per dictionary entry. Logic that isn't
+ * supported this way (e.g. nested paths, `map` or operations with side
+ * effects) is applied to one object per row instead, with the same result.
+ *
+ * @return JSONLOGIC_ERROR_SUCCESS or JSONLOGIC_ERROR_OUT_OF_MEMORY.
+ */
+JSONLOGIC_EXPORT JsonLogic_Error jsonlogic_apply_columnar(
+    JsonLogic_Handle logic,
+    const JsonLogic_Column columns[],
+    size_t column_count,
+    size_t row_count,
+    uint8_t bitmap[],
+    const JsonLogic_Operations *operations
+);
+
+typedef struct JsonLogic_Arena JsonLogic_Arena;
+
+/**
+ * @brief Create an arena for the temporary values of evaluations.
+ *
+ * Applying logic with an arena allocates all intermediate values from the
+ * arena and releases them in bulk at the end of the evaluation. Only the
+ * result is copied out to the heap (or to the arena of an enclosing
+ * evaluation). The memory of the arena is kept for the next evaluation.
+ *
+ * An arena may only be used by one thread at a time. Custom operations must
+ * not keep references to their arguments or to values they create beyond the
+ * call when applied with an arena. Applying logic with an arena that is
+ * already in use by an enclosing evaluation falls back to that arena.
+ *
+ * @param block_size Size of the memory blocks in bytes, 0 for the default.
+ * @return The arena or NULL if out of memory.
+ */
+JSONLOGIC_EXPORT JsonLogic_Arena *jsonlogic_arena_new(size_t block_size);
+JSONLOGIC_EXPORT void jsonlogic_arena_free(JsonLogic_Arena *arena);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply_arena(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_Arena *arena);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply_custom_arena(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations,
+    JsonLogic_Arena *arena
+);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_program_apply_arena(const JsonLogic_Program *program, JsonLogic_Handle input, JsonLogic_Arena *arena);
+
+typedef struct JsonLogic_Memo JsonLogic_Memo;
+
+/**
+ * @brief Create a memo for the results of expensive operations.
+ *
+ * Applying logic with a memo remembers the results of operations that have
+ * the flags JSONLOGIC_OPERATION_PURE and JSONLOGIC_OPERATION_EXPENSIVE, keyed
+ * by the operation and the values of its arguments. Calling such an operation
+ * again with equal arguments returns the remembered result, also in later
+ * evaluations of other logic and other input. Numbers are compared by their
+ * bits, so 0 and -0 are different arguments. Errors are not remembered.
+ *
+ * When the estimated size of the remembered arguments and results exceeds
+ * max_size the least recently used results are dropped. Compiled programs
+ * don't use a memo.
+ *
+ * A memo may only be used by one thread at a time and not together with an
+ * arena. It keeps references to arguments and results, so frozen values it
+ * might reference must not be thawed before the memo is cleared or freed.
+ *
+ * @param max_size Size limit in bytes, 0 for the default (1 MiB).
+ * @return The memo or NULL if out of memory.
+ */
+JSONLOGIC_EXPORT JsonLogic_Memo *jsonlogic_memo_new(size_t max_size);
+JSONLOGIC_EXPORT void jsonlogic_memo_free(JsonLogic_Memo *memo);
+
+/**
+ * @brief Drop all remembered results. The hit and miss counters are kept.
+ */
+JSONLOGIC_EXPORT void jsonlogic_memo_clear(JsonLogic_Memo *memo);
+JSONLOGIC_EXPORT size_t jsonlogic_memo_get_hits(const JsonLogic_Memo *memo);
+JSONLOGIC_EXPORT size_t jsonlogic_memo_get_misses(const JsonLogic_Memo *memo);
+JSONLOGIC_EXPORT size_t jsonlogic_memo_get_size(const JsonLogic_Memo *memo);
+JSONLOGIC_EXPORT size_t jsonlogic_memo_get_max_size(const JsonLogic_Memo *memo);
+
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply_memo(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_Memo *memo);
+JSONLOGIC_EXPORT JsonLogic_Handle jsonlogic_apply_custom_memo(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations,
+    JsonLogic_Memo *memo
+);
+
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_to_boolean(JsonLogic_Handle handle);
+JSONLOGIC_EXPORT bool             certlogic_to_bool   (JsonLogic_Handle handle);
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_not       (JsonLogic_Handle value);
+
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_apply(JsonLogic_Handle logic, JsonLogic_Handle input);
+
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_apply_custom(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations
+);
+
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_apply_custom_max_depth(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations,
+    size_t max_depth
+);
+
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_apply_arena(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_Arena *arena);
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_apply_custom_arena(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations,
+    JsonLogic_Arena *arena
+);
+
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_apply_memo(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_Memo *memo);
+JSONLOGIC_EXPORT JsonLogic_Handle certlogic_apply_custom_memo(
+    JsonLogic_Handle logic,
+    JsonLogic_Handle input,
+    const JsonLogic_Operations *operations,
+    JsonLogic_Memo *memo
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,265 @@
+#include "jsonlogic_intern.h"
+#include "jsonlogic_extras.h"
+
+const JsonLogic_Operations CertLogic_Extras = {
+    .capacity = 256,
+    .used     = 41,
+    .entries  = (JsonLogic_Operation_Entry[]) {
+        { .hash = 0x7b4ca07b4809b00, .key = u"%", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_MOD, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x809c007b4c8ca01, .key = u"<", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_LT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x57f0e6aafa2c3406, .key = u"format-time", .key_size = 11, .operation = { .context = NULL, .funct = jsonlogic_extra_FORMAT_TIME, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xdbca650dce4a2d08, .key = u"var", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_VAR, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x43bdd4be89c8e40e, .key = u"hours", .key_size = 5, .operation = { .context = NULL, .funct = jsonlogic_extra_HOURS, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xc39a14d074bd3810, .key = u"===", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_STRICT_EQ, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x598caed83d72a512, .key = u"plusTime", .key_size = 8, .operation = { .context = NULL, .funct = jsonlogic_extra_PLUS_TIME, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x8985300dc9ce241c, .key = u"!==", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_STRICT_NE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xc534607eea605a22, .key = u"missing_some", .key_size = 12, .operation = { .context = NULL, .funct = jsonlogic_op_MISSING_SOME, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x32a485c935d7762e, .key = u"zip", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_extra_ZIP, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x17149723724e943a, .key = u"days", .key_size = 4, .operation = { .context = NULL, .funct = jsonlogic_extra_DAYS, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7e45e07b4a9073e, .key = u"+", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_ADD, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x3708f0761dc10e44, .key = u"substr", .key_size = 6, .operation = { .context = NULL, .funct = jsonlogic_op_SUBSTR, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7cffa07b497b448, .key = u"-", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_SUB, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xad6bef6c8087434d, .key = u"!!", .key_size = 2, .operation = { .context = NULL, .funct = certlogic_op_TO_BOOL, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xfd50939ac8163651, .key = u"log", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_LOG, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_DETERMINISTIC | JSONLOGIC_OPERATION_IGNORES_DATA } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x8108c07b4ce9053, .key = u">", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_GT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xeb9cb1fa2d22c159, .key = u"not-after", .key_size = 9, .operation = { .context = NULL, .funct = jsonlogic_extra_NOT_AFTER, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xd75b90dc208a1565, .key = u"merge", .key_size = 5, .operation = { .context = NULL, .funct = jsonlogic_op_MERGE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7e7c407b4abea67, .key = u"*", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_MUL, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x33cea5f4d75a1f73, .key = u"now", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_extra_NOW, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_IGNORES_DATA } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x9fd9f2d6ab69827f, .key = u"min", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_MIN, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xadafe76c80c10281, .key = u"!=", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_NE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0xbcf27009431b6181, .key = u"after", .key_size = 5, .operation = { .context = NULL, .funct = jsonlogic_extra_AFTER, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x65bc81af4f4d9f8f, .key = u"time-since", .key_size = 10, .operation = { .context = NULL, .funct = jsonlogic_extra_TIME_SINCE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_IGNORES_DATA | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x9de7ef195b947f91, .key = u"max", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_MAX, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0xaca06fc4c03d5392, .key = u"in", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_IN, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x50e43ad5af41ad92, .key = u"to-array", .key_size = 8, .operation = { .context = NULL, .funct = jsonlogic_extra_TO_ARRAY, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x6f94f942f19da994, .key = u"before", .key_size = 6, .operation = { .context = NULL, .funct = jsonlogic_extra_BEFORE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x663224a7b46d0299, .key = u"missing", .key_size = 7, .operation = { .context = NULL, .funct = jsonlogic_op_MISSING, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC } },
+        { .hash = 0x7d6c607b49d7a9a, .key = u"/", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_DIV, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xce2de81b93f3979c, .key = u"<=", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_LE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xdb6802c4002ab9e, .key = u">=", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_GE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7c26207b48c27a4, .key = u"!", .key_size = 1, .operation = { .context = NULL, .funct = certlogic_op_NOT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x2d96e8133d3909ad, .key = u"==", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_EQ, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x7c9b3f559c5169ad, .key = u"add-years", .key_size = 9, .operation = { .context = NULL, .funct = jsonlogic_extra_ADD_YEARS, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0xc732f9926d2ebbaf, .key = u"extractFromUVCI", .key_size = 15, .operation = { .context = NULL, .funct = jsonlogic_extra_EXTRACT_FROM_UVCI, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xe57a9c9df1c2c3d3, .key = u"cat", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_CAT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xac30080c6bacc5d7, .key = u"combinations", .key_size = 12, .operation = { .context = NULL, .funct = jsonlogic_extra_COMBINATIONS, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xef229b7992ee42eb, .key = u"timestamp", .key_size = 9, .operation = { .context = NULL, .funct = jsonlogic_extra_PARSE_TIME, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x20a8d95b152a06fc, .key = u"not-before", .key_size = 10, .operation = { .context = NULL, .funct = jsonlogic_extra_NOT_BEFORE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+    }
+};
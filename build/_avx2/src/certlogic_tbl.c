@@ -0,0 +1,265 @@
+#include "jsonlogic_intern.h"
+#include "jsonlogic.h"
+
+const JsonLogic_Operations CertLogic_Builtins = {
+    .capacity = 256,
+    .used     = 15,
+    .entries  = (JsonLogic_Operation_Entry[]) {
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x809c007b4c8ca01, .key = u"<", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_LT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xdbca650dce4a2d08, .key = u"var", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_VAR, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xc39a14d074bd3810, .key = u"===", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_STRICT_EQ, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_COMMUTATIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x598caed83d72a512, .key = u"plusTime", .key_size = 8, .operation = { .context = NULL, .funct = jsonlogic_extra_PLUS_TIME, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7e45e07b4a9073e, .key = u"+", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_ADD, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x8108c07b4ce9053, .key = u">", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_GT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xeb9cb1fa2d22c159, .key = u"not-after", .key_size = 9, .operation = { .context = NULL, .funct = jsonlogic_extra_NOT_AFTER, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xbcf27009431b6181, .key = u"after", .key_size = 5, .operation = { .context = NULL, .funct = jsonlogic_extra_AFTER, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xaca06fc4c03d5392, .key = u"in", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_IN, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x6f94f942f19da994, .key = u"before", .key_size = 6, .operation = { .context = NULL, .funct = jsonlogic_extra_BEFORE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xce2de81b93f3979c, .key = u"<=", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_LE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xdb6802c4002ab9e, .key = u">=", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_GE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7c26207b48c27a4, .key = u"!", .key_size = 1, .operation = { .context = NULL, .funct = certlogic_op_NOT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xc732f9926d2ebbaf, .key = u"extractFromUVCI", .key_size = 15, .operation = { .context = NULL, .funct = jsonlogic_extra_EXTRACT_FROM_UVCI, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x20a8d95b152a06fc, .key = u"not-before", .key_size = 10, .operation = { .context = NULL, .funct = jsonlogic_extra_NOT_BEFORE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+    }
+};
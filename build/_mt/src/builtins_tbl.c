@@ -0,0 +1,521 @@
+#include "jsonlogic_intern.h"
+#include "jsonlogic.h"
+
+const JsonLogic_Operations JsonLogic_Builtins = {
+    .capacity = 512,
+    .used     = 25,
+    .entries  = (JsonLogic_Operation_Entry[]) {
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x809c007b4c8ca01, .key = u"<", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_LT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xc39a14d074bd3810, .key = u"===", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_STRICT_EQ, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x8985300dc9ce241c, .key = u"!==", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_STRICT_NE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xc534607eea605a22, .key = u"missing_some", .key_size = 12, .operation = { .context = NULL, .funct = jsonlogic_op_MISSING_SOME, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x3708f0761dc10e44, .key = u"substr", .key_size = 6, .operation = { .context = NULL, .funct = jsonlogic_op_SUBSTR, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7cffa07b497b448, .key = u"-", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_SUB, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xfd50939ac8163651, .key = u"log", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_LOG, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_DETERMINISTIC | JSONLOGIC_OPERATION_IGNORES_DATA } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x8108c07b4ce9053, .key = u">", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_GT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7e7c407b4abea67, .key = u"*", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_MUL, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x9fd9f2d6ab69827f, .key = u"min", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_MIN, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xadafe76c80c10281, .key = u"!=", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_NE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x663224a7b46d0299, .key = u"missing", .key_size = 7, .operation = { .context = NULL, .funct = jsonlogic_op_MISSING, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC } },
+        { .hash = 0x7d6c607b49d7a9a, .key = u"/", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_DIV, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7b4ca07b4809b00, .key = u"%", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_MOD, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xdbca650dce4a2d08, .key = u"var", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_VAR, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7e45e07b4a9073e, .key = u"+", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_ADD, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xad6bef6c8087434d, .key = u"!!", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_TO_BOOL, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xd75b90dc208a1565, .key = u"merge", .key_size = 5, .operation = { .context = NULL, .funct = jsonlogic_op_MERGE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x9de7ef195b947f91, .key = u"max", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_MAX, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0xaca06fc4c03d5392, .key = u"in", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_IN, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xce2de81b93f3979c, .key = u"<=", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_LE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xdb6802c4002ab9e, .key = u">=", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_GE, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x7c26207b48c27a4, .key = u"!", .key_size = 1, .operation = { .context = NULL, .funct = jsonlogic_op_NOT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x2d96e8133d3909ad, .key = u"==", .key_size = 2, .operation = { .context = NULL, .funct = jsonlogic_op_EQ, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0xe57a9c9df1c2c3d3, .key = u"cat", .key_size = 3, .operation = { .context = NULL, .funct = jsonlogic_op_CAT, .lazy_funct = NULL, .flags = JSONLOGIC_OPERATION_PURE } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },
+    }
+};
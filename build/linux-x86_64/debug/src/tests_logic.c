@@ -0,0 +1,7786 @@
+// generated by compile_logic from tests/tests.json, tests/tests-local.json, do not edit
+#include "jsonlogic_intern.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef JSONLOGIC_COMPILED_STRING
+    #define JSONLOGIC_COMPILED_STRING(NAME) (((JsonLogic_Handle)(uintptr_t)&(NAME)) | JsonLogic_Type_String)
+#endif
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str0 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x268829580629635), 5, {
+        0x0061, 0x0070, 0x0070, 0x006c, 0x0065,
+    }
+}; // "apple"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str1 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x89be207b544f1e4), 1, {
+        0x0061,
+    }
+}; // "a"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str2 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x8a61407b54d9b5f), 1, {
+        0x0062,
+    }
+}; // "b"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str3 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x7f8c207b4ba5a34), 1, {
+        0x0031,
+    }
+}; // "1"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str4 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x802f407b4c303af), 1, {
+        0x0032,
+    }
+}; // "2"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str5 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xd1d580a4c24368a8), 4, {
+        0x0042, 0x0061, 0x0072, 0x0074,
+    }
+}; // "Bart"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str6 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x32b0e122aadc74f8), 5, {
+        0x0048, 0x006f, 0x006d, 0x0065, 0x0072,
+    }
+}; // "Homer"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str7 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x3a89a8131dccfcf2), 4, {
+        0x004c, 0x0069, 0x0073, 0x0061,
+    }
+}; // "Lisa"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str8 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xfda41a89c0097141), 5, {
+        0x004d, 0x0061, 0x0072, 0x0067, 0x0065,
+    }
+}; // "Marge"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[6]; } jsonlogic_tests_logic_str9 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xac36dee230d1588d), 6, {
+        0x004d, 0x0061, 0x0067, 0x0067, 0x0069, 0x0065,
+    }
+}; // "Maggie"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[8]; } jsonlogic_tests_logic_str10 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xd092194962ddfc31), 8, {
+        0x004d, 0x0069, 0x006c, 0x0068, 0x006f, 0x0075, 0x0073, 0x0065,
+    }
+}; // "Milhouse"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[6]; } jsonlogic_tests_logic_str11 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xc2eb5596740a2f64), 6, {
+        0x0053, 0x0070, 0x0072, 0x0069, 0x006e, 0x0067,
+    }
+}; // "Spring"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[11]; } jsonlogic_tests_logic_str12 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x4cdeee84676505ce), 11, {
+        0x0053, 0x0070, 0x0072, 0x0069, 0x006e, 0x0067, 0x0066, 0x0069, 0x0065, 0x006c, 0x0064,
+    }
+}; // "Springfield"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str13 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x8b71207b55c0b2c), 1, {
+        0x0069,
+    }
+}; // "i"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str14 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x7bb0e2279ada0988), 4, {
+        0x0074, 0x0065, 0x0061, 0x006d,
+    }
+}; // "team"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str15 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x526f87e033196112), 3, {
+        0x0069, 0x0063, 0x0065,
+    }
+}; // "ice"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str16 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x5b414f0f14701c2d), 5, {
+        0x0063, 0x0072, 0x0065, 0x0061, 0x006d,
+    }
+}; // "cream"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[7]; } jsonlogic_tests_logic_str17 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x2e214d2b8584c839), 7, {
+        0x0052, 0x006f, 0x0062, 0x006f, 0x0063, 0x006f, 0x0070,
+    }
+}; // "Robocop"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[18]; } jsonlogic_tests_logic_str18 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xc59ea3efe07b925e), 18, {
+        0x0077, 0x0065, 0x0020, 0x0061, 0x006c, 0x006c, 0x0020, 0x0073, 0x0063, 0x0072, 0x0065, 0x0061,
+        0x006d, 0x0020, 0x0066, 0x006f, 0x0072, 0x0020,
+    }
+}; // "we all scream for "
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[9]; } jsonlogic_tests_logic_str19 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x9374656759ca7b3), 9, {
+        0x006a, 0x0073, 0x006f, 0x006e, 0x006c, 0x006f, 0x0067, 0x0069, 0x0063,
+    }
+}; // "jsonlogic"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[6]; } jsonlogic_tests_logic_str20 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xbc11e12b5b8cecce), 6, {
+        0x0062, 0x0061, 0x006e, 0x0061, 0x006e, 0x0061,
+    }
+}; // "banana"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str21 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xcbf29ce484222325), 0, { 0
+    }
+}; // ""
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[8]; } jsonlogic_tests_logic_str22 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x11a4af8a0888ef4c), 8, {
+        0x007a, 0x0075, 0x0063, 0x0063, 0x0068, 0x0069, 0x006e, 0x0069,
+    }
+}; // "zucchini"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str23 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x7fc2807b4bd3d5d), 1, {
+        0x0030,
+    }
+}; // "0"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[2]; } jsonlogic_tests_logic_str24 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xab706b820d68ecb4), 2, {
+        0x0061, 0x0070,
+    }
+}; // "ap"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str25 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xb3a8ab4311b2545c), 3, {
+        0x0070, 0x006c, 0x0065,
+    }
+}; // "ple"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[2]; } jsonlogic_tests_logic_str26 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x8c00299b1091d6ee), 2, {
+        0x0062, 0x0061,
+    }
+}; // "ba"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[2]; } jsonlogic_tests_logic_str27 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xd9dd9bc6ada5db2), 2, {
+        0x006e, 0x0061,
+    }
+}; // "na"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[6]; } jsonlogic_tests_logic_str28 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xec4a5b69578f4314), 6, {
+        0x0063, 0x0061, 0x0072, 0x0072, 0x006f, 0x0074,
+    }
+}; // "carrot"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str29 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xf8b5c37f2831e8e1), 4, {
+        0x0064, 0x0061, 0x0074, 0x0065,
+    }
+}; // "date"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[7]; } jsonlogic_tests_logic_str30 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x17d5900e36fcd663), 7, {
+        0x0076, 0x0069, 0x0073, 0x0069, 0x0062, 0x006c, 0x0065,
+    }
+}; // "visible"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[6]; } jsonlogic_tests_logic_str31 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x8541f7eba256ce87), 6, {
+        0x0068, 0x0069, 0x0064, 0x0064, 0x0065, 0x006e,
+    }
+}; // "hidden"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str32 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x4e321a4c380d1ff8), 3, {
+        0x0061, 0x002e, 0x0062,
+    }
+}; // "a.b"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str33 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x4e05ec4c37e796e3), 3, {
+        0x0061, 0x002e, 0x0071,
+    }
+}; // "a.q"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str34 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xf23fe2bf9aeed153), 3, {
+        0x0031, 0x002e, 0x0031,
+    }
+}; // "1.1"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str35 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xfbb03fc3901e56b1), 4, {
+        0x0074, 0x0065, 0x006d, 0x0070,
+    }
+}; // "temp"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[11]; } jsonlogic_tests_logic_str36 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xd91342b6110027e8), 11, {
+        0x0070, 0x0069, 0x0065, 0x002e, 0x0066, 0x0069, 0x006c, 0x006c, 0x0069, 0x006e, 0x0067,
+    }
+}; // "pie.filling"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[7]; } jsonlogic_tests_logic_str37 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x5f23a1ecca06ccf7), 7, {
+        0x0070, 0x0069, 0x0065, 0x002e, 0x0065, 0x0074, 0x0061,
+    }
+}; // "pie.eta"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[7]; } jsonlogic_tests_logic_str38 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x36a2ab5c3643f7a2), 7, {
+        0x0066, 0x0069, 0x006c, 0x006c, 0x0069, 0x006e, 0x0067,
+    }
+}; // "filling"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[6]; } jsonlogic_tests_logic_str39 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xf2349eed0559984a), 6, {
+        0x0063, 0x0068, 0x0065, 0x0072, 0x0072, 0x0079,
+    }
+}; // "cherry"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str40 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xb4a5826eddbee7ed), 5, {
+        0x0061, 0x002e, 0x0062, 0x002e, 0x0063,
+    }
+}; // "a.b.c"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str41 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x4e35804c38100321), 3, {
+        0x0061, 0x002e, 0x0063,
+    }
+}; // "a.c"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str42 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x8a2ae07b54ab836), 1, {
+        0x0063,
+    }
+}; // "c"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[9]; } jsonlogic_tests_logic_str43 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xfc16df46a3d3a5cd), 9, {
+        0x006d, 0x0069, 0x0073, 0x0073, 0x0065, 0x0064, 0x0020, 0x0069, 0x0074,
+    }
+}; // "missed it"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[8]; } jsonlogic_tests_logic_str44 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x155ce5df47854476), 8, {
+        0x0066, 0x006f, 0x0075, 0x006e, 0x0064, 0x0020, 0x0069, 0x0074,
+    }
+}; // "found it"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str45 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xdaa12ccb1b7b8c7c), 3, {
+        0x0076, 0x0069, 0x006e,
+    }
+}; // "vin"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[9]; } jsonlogic_tests_logic_str46 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x893585aaaea35200), 9, {
+        0x0066, 0x0069, 0x006e, 0x0061, 0x006e, 0x0063, 0x0069, 0x006e, 0x0067,
+    }
+}; // "financing"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str47 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x9002888a094d7db6), 3, {
+        0x0061, 0x0070, 0x0072,
+    }
+}; // "apr"
+
+static JsonLogic_Handle jsonlogic_compiled_filter(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items) || lambda == NULL) {
+        jsonlogic_decref(items);
+        return jsonlogic_empty_array();
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    JsonLogic_Array *filtered = jsonlogic_array_with_capacity(array->size);
+    if (filtered == NULL) {
+        jsonlogic_decref(items);
+        return JsonLogic_Error_OutOfMemory;
+    }
+    size_t filtered_index = 0;
+    for (size_t index = 0; index < array->size; ++ index) {
+        JsonLogic_Handle item = array->items[index];
+        JsonLogic_Handle condition = lambda(item);
+        if (jsonlogic_to_bool(condition)) {
+            jsonlogic_incref(item);
+            filtered->items[filtered_index ++] = item;
+        }
+        jsonlogic_decref(condition);
+    }
+    jsonlogic_decref(items);
+    filtered = jsonlogic_array_truncate(filtered, filtered_index);
+    return jsonlogic_array_into_handle(filtered);
+}
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[8]; } jsonlogic_tests_logic_str48 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x75378b92d097008), 8, {
+        0x0069, 0x006e, 0x0074, 0x0065, 0x0067, 0x0065, 0x0072, 0x0073,
+    }
+}; // "integers"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda0(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda1(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda2(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_compiled_map(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items)) {
+        jsonlogic_decref(items);
+        return jsonlogic_empty_array();
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    JsonLogic_Array *mapped = jsonlogic_array_with_capacity(array->size);
+    if (mapped == NULL) {
+        jsonlogic_decref(items);
+        return JsonLogic_Error_OutOfMemory;
+    }
+    for (size_t index = 0; index < array->size; ++ index) {
+        mapped->items[index] = lambda(array->items[index]);
+    }
+    jsonlogic_decref(items);
+    return jsonlogic_array_into_handle(mapped);
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda3(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda4(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[8]; } jsonlogic_tests_logic_str49 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x9bdeeb5d5f690cac), 8, {
+        0x0064, 0x0065, 0x0073, 0x0073, 0x0065, 0x0072, 0x0074, 0x0073,
+    }
+}; // "desserts"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda5(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str50 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xdb86a48cca04c261), 3, {
+        0x0071, 0x0074, 0x0079,
+    }
+}; // "qty"
+
+static JsonLogic_Handle jsonlogic_compiled_reduce_scope(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data), JsonLogic_Handle init, JsonLogic_Handle data) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        jsonlogic_decref(init);
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items)) {
+        jsonlogic_decref(items);
+        return init;
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    JsonLogic_Handle accumulator = init;
+    for (size_t index = 0; index < array->size; ++ index) {
+        JsonLogic_Handle new_accumulator = lambda(accumulator, array->items[index], data);
+        jsonlogic_decref(accumulator);
+        accumulator = new_accumulator;
+    }
+    jsonlogic_decref(items);
+    return accumulator;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda6(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_compiled_scope_var(JsonLogic_Handle value, const char16_t *path, size_t size, JsonLogic_Handle default_value) {
+    if (JSONLOGIC_IS_NULL(value)) {
+        return jsonlogic_incref(default_value);
+    }
+    return jsonlogic_get_path_utf16(value, path, size, default_value);
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda7(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda8(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda9(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda10(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_compiled_all(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {
+        jsonlogic_decref(items);
+        return JsonLogic_False;
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    for (size_t index = 0; index < array->size; ++ index) {
+        JsonLogic_Handle condition = lambda(array->items[index]);
+        bool value = jsonlogic_to_bool(condition);
+        jsonlogic_decref(condition);
+        if (!value) {
+            jsonlogic_decref(items);
+            return JsonLogic_False;
+        }
+    }
+    jsonlogic_decref(items);
+    return JsonLogic_True;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda11(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda12(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda13(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda14(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str51 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x6408a6343b0b4813), 5, {
+        0x0069, 0x0074, 0x0065, 0x006d, 0x0073,
+    }
+}; // "items"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda15(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda16(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda17(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda18(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_compiled_none(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {
+        jsonlogic_decref(items);
+        return JsonLogic_True;
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    for (size_t index = 0; index < array->size; ++ index) {
+        JsonLogic_Handle condition = lambda(array->items[index]);
+        bool value = jsonlogic_to_bool(condition);
+        jsonlogic_decref(condition);
+        if (value) {
+            jsonlogic_decref(items);
+            return JsonLogic_False;
+        }
+    }
+    jsonlogic_decref(items);
+    return JsonLogic_True;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda19(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda20(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda21(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda22(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda23(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda24(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda25(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda26(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_compiled_some(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {
+        jsonlogic_decref(items);
+        return JsonLogic_False;
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    for (size_t index = 0; index < array->size; ++ index) {
+        JsonLogic_Handle condition = lambda(array->items[index]);
+        bool value = jsonlogic_to_bool(condition);
+        jsonlogic_decref(condition);
+        if (value) {
+            jsonlogic_decref(items);
+            return JsonLogic_True;
+        }
+    }
+    jsonlogic_decref(items);
+    return JsonLogic_False;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda27(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda28(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda29(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda30(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda31(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda32(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda33(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda34(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda35(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str52 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xca9f454de6ae9ca0), 5, {
+        0x0070, 0x0072, 0x0069, 0x0063, 0x0065,
+    }
+}; // "price"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda36(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str53 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x6024280db6239fee), 5, {
+        0x0063, 0x006f, 0x0075, 0x006e, 0x0074,
+    }
+}; // "count"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda37(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str54 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x3d3cb1e73c17e4a2), 4, {
+        0x006e, 0x0061, 0x006d, 0x0065,
+    }
+}; // "name"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda38(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str55 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x7b5b210f39f1d8af), 4, {
+        0x006e, 0x006f, 0x006e, 0x0065,
+    }
+}; // "none"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda39(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda40(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[7]; } jsonlogic_tests_logic_str56 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x1e84ef3a9c8034b4), 7, {
+        0x0063, 0x0075, 0x0072, 0x0072, 0x0065, 0x006e, 0x0074,
+    }
+}; // "current"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda41(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[5]; } jsonlogic_tests_logic_str57 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x19dda1eb710a1200), 5, {
+        0x006c, 0x0069, 0x006d, 0x0069, 0x0074,
+    }
+}; // "limit"
+
+static JsonLogic_Handle jsonlogic_compiled_reduce(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data), JsonLogic_Handle init) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        jsonlogic_decref(init);
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items)) {
+        jsonlogic_decref(items);
+        return init;
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    JsonLogic_Handle str_accumulator = jsonlogic_string_from_utf16_sized(JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);
+    JsonLogic_Handle str_current     = jsonlogic_string_from_utf16_sized(JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);
+    JsonLogic_Handle reduce_context  = jsonlogic_object_build(
+        { .key = str_accumulator, .value = JsonLogic_Null },
+        { .key = str_current,     .value = JsonLogic_Null },
+    );
+    jsonlogic_decref(str_accumulator);
+    jsonlogic_decref(str_current);
+    if (JSONLOGIC_IS_ERROR(reduce_context)) {
+        jsonlogic_decref(items);
+        jsonlogic_decref(init);
+        return reduce_context;
+    }
+    JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(reduce_context);
+    size_t accumulator_index = jsonlogic_object_get_index_utf16_with_hash(
+        reduce_context_object, JSONLOGIC_ACCUMULATOR_HASH, JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);
+    size_t current_index = jsonlogic_object_get_index_utf16_with_hash(
+        reduce_context_object, JSONLOGIC_CURRENT_HASH, JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);
+    JsonLogic_Handle accumulator = init;
+    for (size_t index = 0; index < array->size; ++ index) {
+        reduce_context_object->entries[accumulator_index].value = accumulator;
+        reduce_context_object->entries[current_index].value     = array->items[index];
+        JsonLogic_Handle new_accumulator = lambda(reduce_context);
+        jsonlogic_decref(accumulator);
+        accumulator = new_accumulator;
+        reduce_context_object->entries[accumulator_index].value = JsonLogic_Null;
+        reduce_context_object->entries[current_index].value     = JsonLogic_Null;
+    }
+    jsonlogic_decref(reduce_context);
+    jsonlogic_decref(items);
+    return accumulator;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda42(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str58 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x9ab14b675d5e21bb), 4, {
+        0x0063, 0x0075, 0x0072, 0x0072,
+    }
+}; // "curr"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[3]; } jsonlogic_tests_logic_str59 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xdb70bdc331bff2ba), 3, {
+        0x0065, 0x006e, 0x0074,
+    }
+}; // "ent"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda43(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda44(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str60 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xc87117a3763dc504), 4, {
+        0x0074, 0x0061, 0x0067, 0x0073,
+    }
+}; // "tags"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda45(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda46(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda47(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda48(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda49(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda50(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda51(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda52(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda53(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda54(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda55(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda56(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda57(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda58(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda59(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda60(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda61(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda62(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda63(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda64(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str61 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x7c26207b48c27a4), 1, {
+        0x0021,
+    }
+}; // "!"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda65(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda66(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[7]; } jsonlogic_tests_logic_str62 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x535663363d40f9e5), 7, {
+        0x006e, 0x0075, 0x006d, 0x0062, 0x0065, 0x0072, 0x0073,
+    }
+}; // "numbers"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda67(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda68(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda69(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda70(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda71(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda72(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda73(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str63 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x7c92e07b491edf6), 1, {
+        0x0023,
+    }
+}; // "#"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda74(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda75(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda76(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda77(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda78(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda79(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda80(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda81(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[1]; } jsonlogic_tests_logic_str64 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x8f0d807b58d20e5), 1, {
+        0x0078,
+    }
+}; // "x"
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[2]; } jsonlogic_tests_logic_str65 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x8cd9a99b114aa12e), 2, {
+        0x0062, 0x0021,
+    }
+}; // "b!"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda82(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda83(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda84(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[7]; } jsonlogic_tests_logic_str66 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x14bbf2b9a8b64900), 7, {
+        0x006e, 0x006f, 0x0074, 0x0068, 0x0069, 0x006e, 0x0067,
+    }
+}; // "nothing"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda85(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda86(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda87(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda88(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda89(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[7]; } jsonlogic_tests_logic_str67 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x663224a7b46d0299), 7, {
+        0x006d, 0x0069, 0x0073, 0x0073, 0x0069, 0x006e, 0x0067,
+    }
+}; // "missing"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda90(JsonLogic_Handle data);
+
+static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[4]; } jsonlogic_tests_logic_str68 = {
+    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0xf3fd6e5ea199a45f), 4, {
+        0x0069, 0x006e, 0x0069, 0x0074,
+    }
+}; // "init"
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda91(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda92(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda93(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda94(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda95(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda96(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda97(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda98(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda99(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda100(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda101(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda102(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda103(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_tests_logic_0(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_True;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_1(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_False;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_2(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = (JsonLogic_Handle)UINT64_C(0x4031000000000000); // 17
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_3(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = (JsonLogic_Handle)UINT64_C(0x40091eb851eb851f); // 3.1400000000000001
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_4(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_5(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_Null;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_6(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Array *array0 = jsonlogic_array_with_capacity(2);
+        if (array0 == NULL) {
+            result = JsonLogic_Error_OutOfMemory;
+        } else {
+            array0->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+            array0->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+            result = jsonlogic_array_into_handle(array0);
+        }
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_7(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args1[2];
+        args1[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args1[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_EQ(NULL, data, args1, 2);
+        jsonlogic_decref(args1[0]);
+        jsonlogic_decref(args1[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_8(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args2[2];
+        args2[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args2[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        result = jsonlogic_op_EQ(NULL, data, args2, 2);
+        jsonlogic_decref(args2[0]);
+        jsonlogic_decref(args2[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_9(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args3[2];
+        args3[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args3[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_EQ(NULL, data, args3, 2);
+        jsonlogic_decref(args3[0]);
+        jsonlogic_decref(args3[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_10(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args4[2];
+        args4[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args4[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_STRICT_EQ(NULL, data, args4, 2);
+        jsonlogic_decref(args4[0]);
+        jsonlogic_decref(args4[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_11(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args5[2];
+        args5[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args5[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        result = jsonlogic_op_STRICT_EQ(NULL, data, args5, 2);
+        jsonlogic_decref(args5[0]);
+        jsonlogic_decref(args5[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_12(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args6[2];
+        args6[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args6[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_STRICT_EQ(NULL, data, args6, 2);
+        jsonlogic_decref(args6[0]);
+        jsonlogic_decref(args6[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_13(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args7[2];
+        args7[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args7[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_NE(NULL, data, args7, 2);
+        jsonlogic_decref(args7[0]);
+        jsonlogic_decref(args7[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_14(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args8[2];
+        args8[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args8[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_NE(NULL, data, args8, 2);
+        jsonlogic_decref(args8[0]);
+        jsonlogic_decref(args8[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_15(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args9[2];
+        args9[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args9[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        result = jsonlogic_op_NE(NULL, data, args9, 2);
+        jsonlogic_decref(args9[0]);
+        jsonlogic_decref(args9[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_16(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args10[2];
+        args10[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args10[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_STRICT_NE(NULL, data, args10, 2);
+        jsonlogic_decref(args10[0]);
+        jsonlogic_decref(args10[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_17(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args11[2];
+        args11[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args11[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_STRICT_NE(NULL, data, args11, 2);
+        jsonlogic_decref(args11[0]);
+        jsonlogic_decref(args11[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_18(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args12[2];
+        args12[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args12[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        result = jsonlogic_op_STRICT_NE(NULL, data, args12, 2);
+        jsonlogic_decref(args12[0]);
+        jsonlogic_decref(args12[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_19(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args13[2];
+        args13[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args13[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GT(NULL, data, args13, 2);
+        jsonlogic_decref(args13[0]);
+        jsonlogic_decref(args13[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_20(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args14[2];
+        args14[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args14[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GT(NULL, data, args14, 2);
+        jsonlogic_decref(args14[0]);
+        jsonlogic_decref(args14[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_21(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args15[2];
+        args15[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args15[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_GT(NULL, data, args15, 2);
+        jsonlogic_decref(args15[0]);
+        jsonlogic_decref(args15[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_22(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args16[2];
+        args16[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str4);
+        args16[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GT(NULL, data, args16, 2);
+        jsonlogic_decref(args16[0]);
+        jsonlogic_decref(args16[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_23(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args17[2];
+        args17[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args17[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args17, 2);
+        jsonlogic_decref(args17[0]);
+        jsonlogic_decref(args17[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_24(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args18[2];
+        args18[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args18[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args18, 2);
+        jsonlogic_decref(args18[0]);
+        jsonlogic_decref(args18[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_25(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args19[2];
+        args19[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args19[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_GE(NULL, data, args19, 2);
+        jsonlogic_decref(args19[0]);
+        jsonlogic_decref(args19[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_26(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args20[2];
+        args20[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str4);
+        args20[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args20, 2);
+        jsonlogic_decref(args20[0]);
+        jsonlogic_decref(args20[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_27(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args21[2];
+        args21[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args21[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args21, 2);
+        jsonlogic_decref(args21[0]);
+        jsonlogic_decref(args21[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_28(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args22[2];
+        args22[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args22[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args22, 2);
+        jsonlogic_decref(args22[0]);
+        jsonlogic_decref(args22[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_29(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args23[2];
+        args23[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args23[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_LT(NULL, data, args23, 2);
+        jsonlogic_decref(args23[0]);
+        jsonlogic_decref(args23[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_30(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args24[2];
+        args24[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        args24[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_LT(NULL, data, args24, 2);
+        jsonlogic_decref(args24[0]);
+        jsonlogic_decref(args24[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_31(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args25[3];
+        args25[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args25[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args25[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_LT(NULL, data, args25, 3);
+        jsonlogic_decref(args25[0]);
+        jsonlogic_decref(args25[1]);
+        jsonlogic_decref(args25[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_32(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args26[3];
+        args26[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args26[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args26[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_LT(NULL, data, args26, 3);
+        jsonlogic_decref(args26[0]);
+        jsonlogic_decref(args26[1]);
+        jsonlogic_decref(args26[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_33(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args27[3];
+        args27[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args27[1] = (JsonLogic_Handle)UINT64_C(0x4010000000000000); // 4
+        args27[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_LT(NULL, data, args27, 3);
+        jsonlogic_decref(args27[0]);
+        jsonlogic_decref(args27[1]);
+        jsonlogic_decref(args27[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_34(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args28[2];
+        args28[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args28[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LE(NULL, data, args28, 2);
+        jsonlogic_decref(args28[0]);
+        jsonlogic_decref(args28[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_35(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args29[2];
+        args29[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args29[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LE(NULL, data, args29, 2);
+        jsonlogic_decref(args29[0]);
+        jsonlogic_decref(args29[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_36(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args30[2];
+        args30[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args30[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_LE(NULL, data, args30, 2);
+        jsonlogic_decref(args30[0]);
+        jsonlogic_decref(args30[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_37(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args31[2];
+        args31[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        args31[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_LE(NULL, data, args31, 2);
+        jsonlogic_decref(args31[0]);
+        jsonlogic_decref(args31[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_38(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args32[3];
+        args32[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args32[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args32[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_LE(NULL, data, args32, 3);
+        jsonlogic_decref(args32[0]);
+        jsonlogic_decref(args32[1]);
+        jsonlogic_decref(args32[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_39(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args33[3];
+        args33[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args33[1] = (JsonLogic_Handle)UINT64_C(0x4010000000000000); // 4
+        args33[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_LE(NULL, data, args33, 3);
+        jsonlogic_decref(args33[0]);
+        jsonlogic_decref(args33[1]);
+        jsonlogic_decref(args33[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_40(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args34[1];
+        args34[0] = JsonLogic_False;
+        result = jsonlogic_op_NOT(NULL, data, args34, 1);
+        jsonlogic_decref(args34[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_41(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args35[1];
+        args35[0] = JsonLogic_False;
+        result = jsonlogic_op_NOT(NULL, data, args35, 1);
+        jsonlogic_decref(args35[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_42(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args36[1];
+        args36[0] = JsonLogic_True;
+        result = jsonlogic_op_NOT(NULL, data, args36, 1);
+        jsonlogic_decref(args36[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_43(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args37[1];
+        args37[0] = JsonLogic_True;
+        result = jsonlogic_op_NOT(NULL, data, args37, 1);
+        jsonlogic_decref(args37[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_44(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args38[1];
+        args38[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_op_NOT(NULL, data, args38, 1);
+        jsonlogic_decref(args38[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_45(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args39[1];
+        args39[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_NOT(NULL, data, args39, 1);
+        jsonlogic_decref(args39[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_46(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_47(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_48(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_49(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_50(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_51(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_52(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_53(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_54(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_55(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_56(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_57(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_58(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_59(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_60(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_61(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_62(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_63(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_64(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_65(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_66(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_67(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_68(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value40;
+        bool condition40;
+        value40 = JsonLogic_True;
+        condition40 = jsonlogic_to_bool(value40);
+        jsonlogic_decref(value40);
+        if (condition40) {
+            result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            break;
+        }
+        result = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_69(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value41;
+        bool condition41;
+        value41 = JsonLogic_False;
+        condition41 = jsonlogic_to_bool(value41);
+        jsonlogic_decref(value41);
+        if (condition41) {
+            result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            break;
+        }
+        result = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_70(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args42[2];
+        args42[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str5);
+        {
+            JsonLogic_Array *array43 = jsonlogic_array_with_capacity(5);
+            if (array43 == NULL) {
+                args42[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array43->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str5);
+                array43->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str6);
+                array43->items[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str7);
+                array43->items[3] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str8);
+                array43->items[4] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str9);
+                args42[1] = jsonlogic_array_into_handle(array43);
+            }
+        }
+        result = jsonlogic_op_IN(NULL, data, args42, 2);
+        jsonlogic_decref(args42[0]);
+        jsonlogic_decref(args42[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_71(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args44[2];
+        args44[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str10);
+        {
+            JsonLogic_Array *array45 = jsonlogic_array_with_capacity(5);
+            if (array45 == NULL) {
+                args44[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array45->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str5);
+                array45->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str6);
+                array45->items[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str7);
+                array45->items[3] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str8);
+                array45->items[4] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str9);
+                args44[1] = jsonlogic_array_into_handle(array45);
+            }
+        }
+        result = jsonlogic_op_IN(NULL, data, args44, 2);
+        jsonlogic_decref(args44[0]);
+        jsonlogic_decref(args44[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_72(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args46[2];
+        args46[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str11);
+        args46[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str12);
+        result = jsonlogic_op_IN(NULL, data, args46, 2);
+        jsonlogic_decref(args46[0]);
+        jsonlogic_decref(args46[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_73(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args47[2];
+        args47[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str13);
+        args47[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str14);
+        result = jsonlogic_op_IN(NULL, data, args47, 2);
+        jsonlogic_decref(args47[0]);
+        jsonlogic_decref(args47[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_74(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args48[1];
+        args48[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str15);
+        result = jsonlogic_op_CAT(NULL, data, args48, 1);
+        jsonlogic_decref(args48[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_75(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args49[1];
+        args49[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str15);
+        result = jsonlogic_op_CAT(NULL, data, args49, 1);
+        jsonlogic_decref(args49[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_76(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args50[2];
+        args50[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str15);
+        args50[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str16);
+        result = jsonlogic_op_CAT(NULL, data, args50, 2);
+        jsonlogic_decref(args50[0]);
+        jsonlogic_decref(args50[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_77(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args51[2];
+        args51[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args51[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_CAT(NULL, data, args51, 2);
+        jsonlogic_decref(args51[0]);
+        jsonlogic_decref(args51[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_78(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args52[2];
+        args52[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str17);
+        args52[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_CAT(NULL, data, args52, 2);
+        jsonlogic_decref(args52[0]);
+        jsonlogic_decref(args52[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_79(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args53[3];
+        args53[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str18);
+        args53[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str15);
+        args53[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str16);
+        result = jsonlogic_op_CAT(NULL, data, args53, 3);
+        jsonlogic_decref(args53[0]);
+        jsonlogic_decref(args53[1]);
+        jsonlogic_decref(args53[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_80(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args54[2];
+        args54[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args54[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MOD(NULL, data, args54, 2);
+        jsonlogic_decref(args54[0]);
+        jsonlogic_decref(args54[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_81(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args55[2];
+        args55[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args55[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MOD(NULL, data, args55, 2);
+        jsonlogic_decref(args55[0]);
+        jsonlogic_decref(args55[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_82(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args56[2];
+        args56[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        args56[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MOD(NULL, data, args56, 2);
+        jsonlogic_decref(args56[0]);
+        jsonlogic_decref(args56[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_83(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args57[3];
+        args57[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args57[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args57[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_MAX(NULL, data, args57, 3);
+        jsonlogic_decref(args57[0]);
+        jsonlogic_decref(args57[1]);
+        jsonlogic_decref(args57[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_84(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args58[3];
+        args58[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args58[1] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        args58[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_MAX(NULL, data, args58, 3);
+        jsonlogic_decref(args58[0]);
+        jsonlogic_decref(args58[1]);
+        jsonlogic_decref(args58[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_85(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args59[3];
+        args59[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        args59[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args59[2] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_MAX(NULL, data, args59, 3);
+        jsonlogic_decref(args59[0]);
+        jsonlogic_decref(args59[1]);
+        jsonlogic_decref(args59[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_86(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args60[1];
+        args60[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_MAX(NULL, data, args60, 1);
+        jsonlogic_decref(args60[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_87(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args61[3];
+        args61[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args61[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args61[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_MIN(NULL, data, args61, 3);
+        jsonlogic_decref(args61[0]);
+        jsonlogic_decref(args61[1]);
+        jsonlogic_decref(args61[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_88(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args62[3];
+        args62[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args62[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args62[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_MIN(NULL, data, args62, 3);
+        jsonlogic_decref(args62[0]);
+        jsonlogic_decref(args62[1]);
+        jsonlogic_decref(args62[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_89(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args63[3];
+        args63[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        args63[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args63[2] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_MIN(NULL, data, args63, 3);
+        jsonlogic_decref(args63[0]);
+        jsonlogic_decref(args63[1]);
+        jsonlogic_decref(args63[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_90(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args64[1];
+        args64[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_MIN(NULL, data, args64, 1);
+        jsonlogic_decref(args64[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_91(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args65[2];
+        args65[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args65[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_ADD(NULL, data, args65, 2);
+        jsonlogic_decref(args65[0]);
+        jsonlogic_decref(args65[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_92(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args66[3];
+        args66[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args66[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args66[2] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_ADD(NULL, data, args66, 3);
+        jsonlogic_decref(args66[0]);
+        jsonlogic_decref(args66[1]);
+        jsonlogic_decref(args66[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_93(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args67[1];
+        args67[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_ADD(NULL, data, args67, 1);
+        jsonlogic_decref(args67[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_94(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args68[2];
+        args68[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        args68[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_ADD(NULL, data, args68, 2);
+        jsonlogic_decref(args68[0]);
+        jsonlogic_decref(args68[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_95(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args69[2];
+        args69[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        args69[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MUL(NULL, data, args69, 2);
+        jsonlogic_decref(args69[0]);
+        jsonlogic_decref(args69[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_96(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args70[3];
+        args70[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args70[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args70[2] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MUL(NULL, data, args70, 3);
+        jsonlogic_decref(args70[0]);
+        jsonlogic_decref(args70[1]);
+        jsonlogic_decref(args70[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_97(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args71[1];
+        args71[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_MUL(NULL, data, args71, 1);
+        jsonlogic_decref(args71[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_98(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args72[2];
+        args72[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        args72[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_MUL(NULL, data, args72, 2);
+        jsonlogic_decref(args72[0]);
+        jsonlogic_decref(args72[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_99(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args73[2];
+        args73[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args73[1] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_SUB(NULL, data, args73, 2);
+        jsonlogic_decref(args73[0]);
+        jsonlogic_decref(args73[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_100(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args74[2];
+        args74[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        args74[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_SUB(NULL, data, args74, 2);
+        jsonlogic_decref(args74[0]);
+        jsonlogic_decref(args74[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_101(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args75[1];
+        args75[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_SUB(NULL, data, args75, 1);
+        jsonlogic_decref(args75[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_102(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args76[2];
+        args76[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        args76[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_SUB(NULL, data, args76, 2);
+        jsonlogic_decref(args76[0]);
+        jsonlogic_decref(args76[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_103(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args77[2];
+        args77[0] = (JsonLogic_Handle)UINT64_C(0x4010000000000000); // 4
+        args77[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_DIV(NULL, data, args77, 2);
+        jsonlogic_decref(args77[0]);
+        jsonlogic_decref(args77[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_104(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args78[2];
+        args78[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        args78[1] = (JsonLogic_Handle)UINT64_C(0x4010000000000000); // 4
+        result = jsonlogic_op_DIV(NULL, data, args78, 2);
+        jsonlogic_decref(args78[0]);
+        jsonlogic_decref(args78[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_105(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args79[2];
+        args79[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        args79[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_DIV(NULL, data, args79, 2);
+        jsonlogic_decref(args79[0]);
+        jsonlogic_decref(args79[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_106(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args80[2];
+        args80[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str19);
+        args80[1] = (JsonLogic_Handle)UINT64_C(0x4010000000000000); // 4
+        result = jsonlogic_op_SUBSTR(NULL, data, args80, 2);
+        jsonlogic_decref(args80[0]);
+        jsonlogic_decref(args80[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_107(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args81[2];
+        args81[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str19);
+        args81[1] = (JsonLogic_Handle)UINT64_C(0xc014000000000000); // -5
+        result = jsonlogic_op_SUBSTR(NULL, data, args81, 2);
+        jsonlogic_decref(args81[0]);
+        jsonlogic_decref(args81[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_108(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args82[3];
+        args82[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str19);
+        args82[1] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        args82[2] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_SUBSTR(NULL, data, args82, 3);
+        jsonlogic_decref(args82[0]);
+        jsonlogic_decref(args82[1]);
+        jsonlogic_decref(args82[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_109(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args83[3];
+        args83[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str19);
+        args83[1] = (JsonLogic_Handle)UINT64_C(0xbff0000000000000); // -1
+        args83[2] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_SUBSTR(NULL, data, args83, 3);
+        jsonlogic_decref(args83[0]);
+        jsonlogic_decref(args83[1]);
+        jsonlogic_decref(args83[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_110(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args84[3];
+        args84[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str19);
+        args84[1] = (JsonLogic_Handle)UINT64_C(0x4010000000000000); // 4
+        args84[2] = (JsonLogic_Handle)UINT64_C(0x4014000000000000); // 5
+        result = jsonlogic_op_SUBSTR(NULL, data, args84, 3);
+        jsonlogic_decref(args84[0]);
+        jsonlogic_decref(args84[1]);
+        jsonlogic_decref(args84[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_111(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args85[3];
+        args85[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str19);
+        args85[1] = (JsonLogic_Handle)UINT64_C(0xc014000000000000); // -5
+        args85[2] = (JsonLogic_Handle)UINT64_C(0x4014000000000000); // 5
+        result = jsonlogic_op_SUBSTR(NULL, data, args85, 3);
+        jsonlogic_decref(args85[0]);
+        jsonlogic_decref(args85[1]);
+        jsonlogic_decref(args85[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_112(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args86[3];
+        args86[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str19);
+        args86[1] = (JsonLogic_Handle)UINT64_C(0xc014000000000000); // -5
+        args86[2] = (JsonLogic_Handle)UINT64_C(0xc000000000000000); // -2
+        result = jsonlogic_op_SUBSTR(NULL, data, args86, 3);
+        jsonlogic_decref(args86[0]);
+        jsonlogic_decref(args86[1]);
+        jsonlogic_decref(args86[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_113(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args87[3];
+        args87[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str19);
+        args87[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args87[2] = (JsonLogic_Handle)UINT64_C(0xc014000000000000); // -5
+        result = jsonlogic_op_SUBSTR(NULL, data, args87, 3);
+        jsonlogic_decref(args87[0]);
+        jsonlogic_decref(args87[1]);
+        jsonlogic_decref(args87[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_114(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = jsonlogic_op_MERGE(NULL, data, NULL, 0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_115(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args88[1];
+        {
+            JsonLogic_Array *array89 = jsonlogic_array_with_capacity(1);
+            if (array89 == NULL) {
+                args88[0] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array89->items[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                args88[0] = jsonlogic_array_into_handle(array89);
+            }
+        }
+        result = jsonlogic_op_MERGE(NULL, data, args88, 1);
+        jsonlogic_decref(args88[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_116(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args90[2];
+        {
+            JsonLogic_Array *array91 = jsonlogic_array_with_capacity(1);
+            if (array91 == NULL) {
+                args90[0] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array91->items[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                args90[0] = jsonlogic_array_into_handle(array91);
+            }
+        }
+        {
+            JsonLogic_Array *array92 = jsonlogic_array_with_capacity(0);
+            if (array92 == NULL) {
+                args90[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                args90[1] = jsonlogic_array_into_handle(array92);
+            }
+        }
+        result = jsonlogic_op_MERGE(NULL, data, args90, 2);
+        jsonlogic_decref(args90[0]);
+        jsonlogic_decref(args90[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_117(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args93[2];
+        {
+            JsonLogic_Array *array94 = jsonlogic_array_with_capacity(1);
+            if (array94 == NULL) {
+                args93[0] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array94->items[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                args93[0] = jsonlogic_array_into_handle(array94);
+            }
+        }
+        {
+            JsonLogic_Array *array95 = jsonlogic_array_with_capacity(1);
+            if (array95 == NULL) {
+                args93[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array95->items[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+                args93[1] = jsonlogic_array_into_handle(array95);
+            }
+        }
+        result = jsonlogic_op_MERGE(NULL, data, args93, 2);
+        jsonlogic_decref(args93[0]);
+        jsonlogic_decref(args93[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_118(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args96[3];
+        {
+            JsonLogic_Array *array97 = jsonlogic_array_with_capacity(1);
+            if (array97 == NULL) {
+                args96[0] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array97->items[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                args96[0] = jsonlogic_array_into_handle(array97);
+            }
+        }
+        {
+            JsonLogic_Array *array98 = jsonlogic_array_with_capacity(1);
+            if (array98 == NULL) {
+                args96[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array98->items[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+                args96[1] = jsonlogic_array_into_handle(array98);
+            }
+        }
+        {
+            JsonLogic_Array *array99 = jsonlogic_array_with_capacity(1);
+            if (array99 == NULL) {
+                args96[2] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array99->items[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+                args96[2] = jsonlogic_array_into_handle(array99);
+            }
+        }
+        result = jsonlogic_op_MERGE(NULL, data, args96, 3);
+        jsonlogic_decref(args96[0]);
+        jsonlogic_decref(args96[1]);
+        jsonlogic_decref(args96[2]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_119(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args100[2];
+        {
+            JsonLogic_Array *array101 = jsonlogic_array_with_capacity(2);
+            if (array101 == NULL) {
+                args100[0] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array101->items[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                array101->items[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+                args100[0] = jsonlogic_array_into_handle(array101);
+            }
+        }
+        {
+            JsonLogic_Array *array102 = jsonlogic_array_with_capacity(1);
+            if (array102 == NULL) {
+                args100[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array102->items[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+                args100[1] = jsonlogic_array_into_handle(array102);
+            }
+        }
+        result = jsonlogic_op_MERGE(NULL, data, args100, 2);
+        jsonlogic_decref(args100[0]);
+        jsonlogic_decref(args100[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_120(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args103[2];
+        {
+            JsonLogic_Array *array104 = jsonlogic_array_with_capacity(1);
+            if (array104 == NULL) {
+                args103[0] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array104->items[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                args103[0] = jsonlogic_array_into_handle(array104);
+            }
+        }
+        {
+            JsonLogic_Array *array105 = jsonlogic_array_with_capacity(2);
+            if (array105 == NULL) {
+                args103[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array105->items[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+                array105->items[1] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+                args103[1] = jsonlogic_array_into_handle(array105);
+            }
+        }
+        result = jsonlogic_op_MERGE(NULL, data, args103, 2);
+        jsonlogic_decref(args103[0]);
+        jsonlogic_decref(args103[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_121(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args106[1];
+        args106[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_MERGE(NULL, data, args106, 1);
+        jsonlogic_decref(args106[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_122(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args107[2];
+        args107[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        args107[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MERGE(NULL, data, args107, 2);
+        jsonlogic_decref(args107[0]);
+        jsonlogic_decref(args107[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_123(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args108[2];
+        args108[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        {
+            JsonLogic_Array *array109 = jsonlogic_array_with_capacity(1);
+            if (array109 == NULL) {
+                args108[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array109->items[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+                args108[1] = jsonlogic_array_into_handle(array109);
+            }
+        }
+        result = jsonlogic_op_MERGE(NULL, data, args108, 2);
+        jsonlogic_decref(args108[0]);
+        jsonlogic_decref(args108[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_124(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_Null;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_125(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_126(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_127(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_128(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value113;
+        bool condition113;
+        value113 = JsonLogic_True;
+        condition113 = jsonlogic_to_bool(value113);
+        jsonlogic_decref(value113);
+        if (condition113) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JsonLogic_Null;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_129(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value114;
+        bool condition114;
+        value114 = JsonLogic_False;
+        condition114 = jsonlogic_to_bool(value114);
+        jsonlogic_decref(value114);
+        if (condition114) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JsonLogic_Null;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_130(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value115;
+        bool condition115;
+        value115 = JsonLogic_True;
+        condition115 = jsonlogic_to_bool(value115);
+        jsonlogic_decref(value115);
+        if (condition115) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_131(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value116;
+        bool condition116;
+        value116 = JsonLogic_False;
+        condition116 = jsonlogic_to_bool(value116);
+        jsonlogic_decref(value116);
+        if (condition116) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_132(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value117;
+        bool condition117;
+        {
+            JsonLogic_Array *array118 = jsonlogic_array_with_capacity(0);
+            if (array118 == NULL) {
+                value117 = JsonLogic_Error_OutOfMemory;
+            } else {
+                value117 = jsonlogic_array_into_handle(array118);
+            }
+        }
+        condition117 = jsonlogic_to_bool(value117);
+        jsonlogic_decref(value117);
+        if (condition117) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_133(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value119;
+        bool condition119;
+        {
+            JsonLogic_Array *array120 = jsonlogic_array_with_capacity(1);
+            if (array120 == NULL) {
+                value119 = JsonLogic_Error_OutOfMemory;
+            } else {
+                array120->items[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                value119 = jsonlogic_array_into_handle(array120);
+            }
+        }
+        condition119 = jsonlogic_to_bool(value119);
+        jsonlogic_decref(value119);
+        if (condition119) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_134(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value121;
+        bool condition121;
+        {
+            JsonLogic_Array *array122 = jsonlogic_array_with_capacity(4);
+            if (array122 == NULL) {
+                value121 = JsonLogic_Error_OutOfMemory;
+            } else {
+                array122->items[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                array122->items[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+                array122->items[2] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+                array122->items[3] = (JsonLogic_Handle)UINT64_C(0x4010000000000000); // 4
+                value121 = jsonlogic_array_into_handle(array122);
+            }
+        }
+        condition121 = jsonlogic_to_bool(value121);
+        jsonlogic_decref(value121);
+        if (condition121) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_135(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value123;
+        bool condition123;
+        value123 = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+        condition123 = jsonlogic_to_bool(value123);
+        jsonlogic_decref(value123);
+        if (condition123) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_136(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value124;
+        bool condition124;
+        value124 = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str22);
+        condition124 = jsonlogic_to_bool(value124);
+        jsonlogic_decref(value124);
+        if (condition124) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_137(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value125;
+        bool condition125;
+        value125 = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+        condition125 = jsonlogic_to_bool(value125);
+        jsonlogic_decref(value125);
+        if (condition125) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_138(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args126[2];
+        args126[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        args126[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+        result = jsonlogic_op_STRICT_EQ(NULL, data, args126, 2);
+        jsonlogic_decref(args126[0]);
+        jsonlogic_decref(args126[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_139(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args127[2];
+        args127[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        {
+            JsonLogic_Handle args128[1];
+            args128[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+            args127[1] = jsonlogic_op_ADD(NULL, data, args128, 1);
+            jsonlogic_decref(args128[0]);
+        }
+        result = jsonlogic_op_STRICT_EQ(NULL, data, args127, 2);
+        jsonlogic_decref(args127[0]);
+        jsonlogic_decref(args127[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_140(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value129;
+        bool condition129;
+        {
+            JsonLogic_Handle args130[1];
+            args130[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+            value129 = jsonlogic_op_ADD(NULL, data, args130, 1);
+            jsonlogic_decref(args130[0]);
+        }
+        condition129 = jsonlogic_to_bool(value129);
+        jsonlogic_decref(value129);
+        if (condition129) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_141(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value131;
+        bool condition131;
+        {
+            JsonLogic_Handle args132[1];
+            args132[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+            value131 = jsonlogic_op_ADD(NULL, data, args132, 1);
+            jsonlogic_decref(args132[0]);
+        }
+        condition131 = jsonlogic_to_bool(value131);
+        jsonlogic_decref(value131);
+        if (condition131) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_142(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value133;
+        bool condition133;
+        value133 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        condition133 = jsonlogic_to_bool(value133);
+        jsonlogic_decref(value133);
+        if (condition133) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_143(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value134;
+        bool condition134;
+        value134 = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        condition134 = jsonlogic_to_bool(value134);
+        jsonlogic_decref(value134);
+        if (condition134) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_144(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value135;
+        bool condition135;
+        value135 = (JsonLogic_Handle)UINT64_C(0x400921ff2e48e8a7); // 3.1415999999999999
+        condition135 = jsonlogic_to_bool(value135);
+        jsonlogic_decref(value135);
+        if (condition135) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_145(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value136;
+        bool condition136;
+        value136 = (JsonLogic_Handle)UINT64_C(0xbff0000000000000); // -1
+        condition136 = jsonlogic_to_bool(value136);
+        jsonlogic_decref(value136);
+        if (condition136) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_146(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args137[1];
+        {
+            JsonLogic_Array *array138 = jsonlogic_array_with_capacity(0);
+            if (array138 == NULL) {
+                args137[0] = JsonLogic_Error_OutOfMemory;
+            } else {
+                args137[0] = jsonlogic_array_into_handle(array138);
+            }
+        }
+        result = jsonlogic_op_NOT(NULL, data, args137, 1);
+        jsonlogic_decref(args137[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_147(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args139[1];
+        {
+            JsonLogic_Array *array140 = jsonlogic_array_with_capacity(0);
+            if (array140 == NULL) {
+                args139[0] = JsonLogic_Error_OutOfMemory;
+            } else {
+                args139[0] = jsonlogic_array_into_handle(array140);
+            }
+        }
+        result = jsonlogic_op_TO_BOOL(NULL, data, args139, 1);
+        jsonlogic_decref(args139[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_148(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Array *array141 = jsonlogic_array_with_capacity(0);
+            if (array141 == NULL) {
+                result = JsonLogic_Error_OutOfMemory;
+            } else {
+                result = jsonlogic_array_into_handle(array141);
+            }
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_149(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Array *array142 = jsonlogic_array_with_capacity(0);
+            if (array142 == NULL) {
+                result = JsonLogic_Error_OutOfMemory;
+            } else {
+                result = jsonlogic_array_into_handle(array142);
+            }
+        }
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_150(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args143[1];
+        args143[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_op_NOT(NULL, data, args143, 1);
+        jsonlogic_decref(args143[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_151(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args144[1];
+        args144[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_op_TO_BOOL(NULL, data, args144, 1);
+        jsonlogic_decref(args144[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_152(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_153(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_154(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args145[1];
+        args145[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+        result = jsonlogic_op_NOT(NULL, data, args145, 1);
+        jsonlogic_decref(args145[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_155(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args146[1];
+        args146[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+        result = jsonlogic_op_TO_BOOL(NULL, data, args146, 1);
+        jsonlogic_decref(args146[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_156(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_157(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_158(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args147[1];
+        args147[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+        result = jsonlogic_op_NOT(NULL, data, args147, 1);
+        jsonlogic_decref(args147[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_159(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args148[1];
+        args148[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+        result = jsonlogic_op_TO_BOOL(NULL, data, args148, 1);
+        jsonlogic_decref(args148[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_160(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_161(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_162(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value149;
+        bool condition149;
+        {
+            JsonLogic_Handle args150[2];
+            args150[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+            args150[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            value149 = jsonlogic_op_GT(NULL, data, args150, 2);
+            jsonlogic_decref(args150[0]);
+            jsonlogic_decref(args150[1]);
+        }
+        condition149 = jsonlogic_to_bool(value149);
+        jsonlogic_decref(value149);
+        if (condition149) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_163(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value151;
+        bool condition151;
+        {
+            JsonLogic_Handle args152[2];
+            args152[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            args152[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+            value151 = jsonlogic_op_GT(NULL, data, args152, 2);
+            jsonlogic_decref(args152[0]);
+            jsonlogic_decref(args152[1]);
+        }
+        condition151 = jsonlogic_to_bool(value151);
+        jsonlogic_decref(value151);
+        if (condition151) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_164(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value153;
+        bool condition153;
+        value153 = JsonLogic_True;
+        condition153 = jsonlogic_to_bool(value153);
+        jsonlogic_decref(value153);
+        if (condition153) {
+            {
+                JsonLogic_Handle args154[2];
+                args154[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str24);
+                args154[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str25);
+                result = jsonlogic_op_CAT(NULL, data, args154, 2);
+                jsonlogic_decref(args154[0]);
+                jsonlogic_decref(args154[1]);
+            }
+            break;
+        }
+        {
+            JsonLogic_Handle args155[3];
+            args155[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str26);
+            args155[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str27);
+            args155[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str27);
+            result = jsonlogic_op_CAT(NULL, data, args155, 3);
+            jsonlogic_decref(args155[0]);
+            jsonlogic_decref(args155[1]);
+            jsonlogic_decref(args155[2]);
+        }
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_165(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value156;
+        bool condition156;
+        value156 = JsonLogic_False;
+        condition156 = jsonlogic_to_bool(value156);
+        jsonlogic_decref(value156);
+        if (condition156) {
+            {
+                JsonLogic_Handle args157[2];
+                args157[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str24);
+                args157[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str25);
+                result = jsonlogic_op_CAT(NULL, data, args157, 2);
+                jsonlogic_decref(args157[0]);
+                jsonlogic_decref(args157[1]);
+            }
+            break;
+        }
+        {
+            JsonLogic_Handle args158[3];
+            args158[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str26);
+            args158[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str27);
+            args158[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str27);
+            result = jsonlogic_op_CAT(NULL, data, args158, 3);
+            jsonlogic_decref(args158[0]);
+            jsonlogic_decref(args158[1]);
+            jsonlogic_decref(args158[2]);
+        }
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_166(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value159;
+        bool condition159;
+        value159 = JsonLogic_True;
+        condition159 = jsonlogic_to_bool(value159);
+        jsonlogic_decref(value159);
+        if (condition159) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value159 = JsonLogic_True;
+        condition159 = jsonlogic_to_bool(value159);
+        jsonlogic_decref(value159);
+        if (condition159) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        result = JsonLogic_Null;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_167(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value160;
+        bool condition160;
+        value160 = JsonLogic_True;
+        condition160 = jsonlogic_to_bool(value160);
+        jsonlogic_decref(value160);
+        if (condition160) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value160 = JsonLogic_False;
+        condition160 = jsonlogic_to_bool(value160);
+        jsonlogic_decref(value160);
+        if (condition160) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        result = JsonLogic_Null;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_168(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value161;
+        bool condition161;
+        value161 = JsonLogic_False;
+        condition161 = jsonlogic_to_bool(value161);
+        jsonlogic_decref(value161);
+        if (condition161) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value161 = JsonLogic_True;
+        condition161 = jsonlogic_to_bool(value161);
+        jsonlogic_decref(value161);
+        if (condition161) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        result = JsonLogic_Null;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_169(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value162;
+        bool condition162;
+        value162 = JsonLogic_False;
+        condition162 = jsonlogic_to_bool(value162);
+        jsonlogic_decref(value162);
+        if (condition162) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value162 = JsonLogic_False;
+        condition162 = jsonlogic_to_bool(value162);
+        jsonlogic_decref(value162);
+        if (condition162) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        result = JsonLogic_Null;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_170(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value163;
+        bool condition163;
+        value163 = JsonLogic_True;
+        condition163 = jsonlogic_to_bool(value163);
+        jsonlogic_decref(value163);
+        if (condition163) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value163 = JsonLogic_True;
+        condition163 = jsonlogic_to_bool(value163);
+        jsonlogic_decref(value163);
+        if (condition163) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_171(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value164;
+        bool condition164;
+        value164 = JsonLogic_True;
+        condition164 = jsonlogic_to_bool(value164);
+        jsonlogic_decref(value164);
+        if (condition164) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value164 = JsonLogic_False;
+        condition164 = jsonlogic_to_bool(value164);
+        jsonlogic_decref(value164);
+        if (condition164) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_172(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value165;
+        bool condition165;
+        value165 = JsonLogic_False;
+        condition165 = jsonlogic_to_bool(value165);
+        jsonlogic_decref(value165);
+        if (condition165) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value165 = JsonLogic_True;
+        condition165 = jsonlogic_to_bool(value165);
+        jsonlogic_decref(value165);
+        if (condition165) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_173(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value166;
+        bool condition166;
+        value166 = JsonLogic_False;
+        condition166 = jsonlogic_to_bool(value166);
+        jsonlogic_decref(value166);
+        if (condition166) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value166 = JsonLogic_False;
+        condition166 = jsonlogic_to_bool(value166);
+        jsonlogic_decref(value166);
+        if (condition166) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_174(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value167;
+        bool condition167;
+        value167 = JsonLogic_False;
+        condition167 = jsonlogic_to_bool(value167);
+        jsonlogic_decref(value167);
+        if (condition167) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value167 = JsonLogic_False;
+        condition167 = jsonlogic_to_bool(value167);
+        jsonlogic_decref(value167);
+        if (condition167) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value167 = JsonLogic_False;
+        condition167 = jsonlogic_to_bool(value167);
+        jsonlogic_decref(value167);
+        if (condition167) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JsonLogic_Null;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_175(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value168;
+        bool condition168;
+        value168 = JsonLogic_False;
+        condition168 = jsonlogic_to_bool(value168);
+        jsonlogic_decref(value168);
+        if (condition168) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value168 = JsonLogic_False;
+        condition168 = jsonlogic_to_bool(value168);
+        jsonlogic_decref(value168);
+        if (condition168) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value168 = JsonLogic_False;
+        condition168 = jsonlogic_to_bool(value168);
+        jsonlogic_decref(value168);
+        if (condition168) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str29);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_176(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value169;
+        bool condition169;
+        value169 = JsonLogic_False;
+        condition169 = jsonlogic_to_bool(value169);
+        jsonlogic_decref(value169);
+        if (condition169) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value169 = JsonLogic_False;
+        condition169 = jsonlogic_to_bool(value169);
+        jsonlogic_decref(value169);
+        if (condition169) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value169 = JsonLogic_True;
+        condition169 = jsonlogic_to_bool(value169);
+        jsonlogic_decref(value169);
+        if (condition169) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str29);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_177(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value170;
+        bool condition170;
+        value170 = JsonLogic_False;
+        condition170 = jsonlogic_to_bool(value170);
+        jsonlogic_decref(value170);
+        if (condition170) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value170 = JsonLogic_True;
+        condition170 = jsonlogic_to_bool(value170);
+        jsonlogic_decref(value170);
+        if (condition170) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value170 = JsonLogic_False;
+        condition170 = jsonlogic_to_bool(value170);
+        jsonlogic_decref(value170);
+        if (condition170) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str29);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_178(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value171;
+        bool condition171;
+        value171 = JsonLogic_False;
+        condition171 = jsonlogic_to_bool(value171);
+        jsonlogic_decref(value171);
+        if (condition171) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value171 = JsonLogic_True;
+        condition171 = jsonlogic_to_bool(value171);
+        jsonlogic_decref(value171);
+        if (condition171) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value171 = JsonLogic_True;
+        condition171 = jsonlogic_to_bool(value171);
+        jsonlogic_decref(value171);
+        if (condition171) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str29);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_179(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value172;
+        bool condition172;
+        value172 = JsonLogic_True;
+        condition172 = jsonlogic_to_bool(value172);
+        jsonlogic_decref(value172);
+        if (condition172) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value172 = JsonLogic_False;
+        condition172 = jsonlogic_to_bool(value172);
+        jsonlogic_decref(value172);
+        if (condition172) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value172 = JsonLogic_False;
+        condition172 = jsonlogic_to_bool(value172);
+        jsonlogic_decref(value172);
+        if (condition172) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str29);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_180(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value173;
+        bool condition173;
+        value173 = JsonLogic_True;
+        condition173 = jsonlogic_to_bool(value173);
+        jsonlogic_decref(value173);
+        if (condition173) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value173 = JsonLogic_False;
+        condition173 = jsonlogic_to_bool(value173);
+        jsonlogic_decref(value173);
+        if (condition173) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value173 = JsonLogic_True;
+        condition173 = jsonlogic_to_bool(value173);
+        jsonlogic_decref(value173);
+        if (condition173) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str29);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_181(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value174;
+        bool condition174;
+        value174 = JsonLogic_True;
+        condition174 = jsonlogic_to_bool(value174);
+        jsonlogic_decref(value174);
+        if (condition174) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value174 = JsonLogic_True;
+        condition174 = jsonlogic_to_bool(value174);
+        jsonlogic_decref(value174);
+        if (condition174) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value174 = JsonLogic_False;
+        condition174 = jsonlogic_to_bool(value174);
+        jsonlogic_decref(value174);
+        if (condition174) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str29);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_182(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value175;
+        bool condition175;
+        value175 = JsonLogic_True;
+        condition175 = jsonlogic_to_bool(value175);
+        jsonlogic_decref(value175);
+        if (condition175) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            break;
+        }
+        value175 = JsonLogic_True;
+        condition175 = jsonlogic_to_bool(value175);
+        jsonlogic_decref(value175);
+        if (condition175) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str20);
+            break;
+        }
+        value175 = JsonLogic_True;
+        condition175 = jsonlogic_to_bool(value175);
+        jsonlogic_decref(value175);
+        if (condition175) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str28);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str29);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_183(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Handle args176[2];
+            args176[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+            args176[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            result = jsonlogic_op_GT(NULL, data, args176, 2);
+            jsonlogic_decref(args176[0]);
+            jsonlogic_decref(args176[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_True;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_184(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Handle args177[2];
+            args177[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+            args177[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            result = jsonlogic_op_GT(NULL, data, args177, 2);
+            jsonlogic_decref(args177[0]);
+            jsonlogic_decref(args177[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = JsonLogic_False;
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_185(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Handle args178[2];
+            args178[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+            args178[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            result = jsonlogic_op_GT(NULL, data, args178, 2);
+            jsonlogic_decref(args178[0]);
+            jsonlogic_decref(args178[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle args179[1];
+            args179[0] = JsonLogic_True;
+            result = jsonlogic_op_NOT(NULL, data, args179, 1);
+            jsonlogic_decref(args179[0]);
+        }
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_186(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Handle args180[2];
+            args180[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+            args180[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            result = jsonlogic_op_GT(NULL, data, args180, 2);
+            jsonlogic_decref(args180[0]);
+            jsonlogic_decref(args180[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle args181[2];
+            args181[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            args181[1] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+            result = jsonlogic_op_LT(NULL, data, args181, 2);
+            jsonlogic_decref(args181[0]);
+            jsonlogic_decref(args181[1]);
+        }
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_187(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value182;
+        bool condition182;
+        {
+            JsonLogic_Handle args183[2];
+            args183[0] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+            args183[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            value182 = jsonlogic_op_GT(NULL, data, args183, 2);
+            jsonlogic_decref(args183[0]);
+            jsonlogic_decref(args183[1]);
+        }
+        condition182 = jsonlogic_to_bool(value182);
+        jsonlogic_decref(value182);
+        if (condition182) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str30);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str31);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_188(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args184[1];
+        args184[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_VAR(NULL, data, args184, 1);
+        jsonlogic_decref(args184[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_189(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args185[1];
+        args185[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        result = jsonlogic_op_VAR(NULL, data, args185, 1);
+        jsonlogic_decref(args185[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_190(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args186[1];
+        args186[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_VAR(NULL, data, args186, 1);
+        jsonlogic_decref(args186[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_191(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args187[1];
+        args187[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_VAR(NULL, data, args187, 1);
+        jsonlogic_decref(args187[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_192(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args188[1];
+        args188[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        result = jsonlogic_op_VAR(NULL, data, args188, 1);
+        jsonlogic_decref(args188[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_193(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args189[1];
+        args189[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_VAR(NULL, data, args189, 1);
+        jsonlogic_decref(args189[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_194(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args190[2];
+        args190[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        args190[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_VAR(NULL, data, args190, 2);
+        jsonlogic_decref(args190[0]);
+        jsonlogic_decref(args190[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_195(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args191[2];
+        args191[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        args191[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_VAR(NULL, data, args191, 2);
+        jsonlogic_decref(args191[0]);
+        jsonlogic_decref(args191[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_196(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args192[1];
+        args192[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str32);
+        result = jsonlogic_op_VAR(NULL, data, args192, 1);
+        jsonlogic_decref(args192[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_197(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args193[1];
+        args193[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str33);
+        result = jsonlogic_op_VAR(NULL, data, args193, 1);
+        jsonlogic_decref(args193[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_198(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args194[2];
+        args194[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str33);
+        args194[1] = (JsonLogic_Handle)UINT64_C(0x4022000000000000); // 9
+        result = jsonlogic_op_VAR(NULL, data, args194, 2);
+        jsonlogic_decref(args194[0]);
+        jsonlogic_decref(args194[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_199(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args195[1];
+        args195[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_VAR(NULL, data, args195, 1);
+        jsonlogic_decref(args195[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_200(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args196[1];
+        args196[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str3);
+        result = jsonlogic_op_VAR(NULL, data, args196, 1);
+        jsonlogic_decref(args196[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_201(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args197[1];
+        args197[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str34);
+        result = jsonlogic_op_VAR(NULL, data, args197, 1);
+        jsonlogic_decref(args197[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_202(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Handle args198[2];
+            {
+                JsonLogic_Handle args199[1];
+                args199[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str35);
+                args198[0] = jsonlogic_op_VAR(NULL, data, args199, 1);
+                jsonlogic_decref(args199[0]);
+            }
+            args198[1] = (JsonLogic_Handle)UINT64_C(0x405b800000000000); // 110
+            result = jsonlogic_op_LT(NULL, data, args198, 2);
+            jsonlogic_decref(args198[0]);
+            jsonlogic_decref(args198[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle args200[2];
+            {
+                JsonLogic_Handle args201[1];
+                args201[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str36);
+                args200[0] = jsonlogic_op_VAR(NULL, data, args201, 1);
+                jsonlogic_decref(args201[0]);
+            }
+            args200[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+            result = jsonlogic_op_EQ(NULL, data, args200, 2);
+            jsonlogic_decref(args200[0]);
+            jsonlogic_decref(args200[1]);
+        }
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_203(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args202[1];
+        do {
+            JsonLogic_Handle value203;
+            bool condition203;
+            {
+                JsonLogic_Handle args204[2];
+                {
+                    JsonLogic_Handle args205[1];
+                    args205[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str35);
+                    args204[0] = jsonlogic_op_VAR(NULL, data, args205, 1);
+                    jsonlogic_decref(args205[0]);
+                }
+                args204[1] = (JsonLogic_Handle)UINT64_C(0x405b800000000000); // 110
+                value203 = jsonlogic_op_LT(NULL, data, args204, 2);
+                jsonlogic_decref(args204[0]);
+                jsonlogic_decref(args204[1]);
+            }
+            condition203 = jsonlogic_to_bool(value203);
+            jsonlogic_decref(value203);
+            if (condition203) {
+                args202[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str36);
+                break;
+            }
+            args202[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str37);
+        } while (0);
+        result = jsonlogic_op_VAR(NULL, data, args202, 1);
+        jsonlogic_decref(args202[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_204(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args206[2];
+        {
+            JsonLogic_Handle args207[1];
+            args207[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str38);
+            args206[0] = jsonlogic_op_VAR(NULL, data, args207, 1);
+            jsonlogic_decref(args207[0]);
+        }
+        {
+            JsonLogic_Array *array208 = jsonlogic_array_with_capacity(2);
+            if (array208 == NULL) {
+                args206[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array208->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str0);
+                array208->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str39);
+                args206[1] = jsonlogic_array_into_handle(array208);
+            }
+        }
+        result = jsonlogic_op_IN(NULL, data, args206, 2);
+        jsonlogic_decref(args206[0]);
+        jsonlogic_decref(args206[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_205(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args209[1];
+        args209[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str40);
+        result = jsonlogic_op_VAR(NULL, data, args209, 1);
+        jsonlogic_decref(args209[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_206(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args210[1];
+        args210[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str40);
+        result = jsonlogic_op_VAR(NULL, data, args210, 1);
+        jsonlogic_decref(args210[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_207(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args211[1];
+        args211[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str40);
+        result = jsonlogic_op_VAR(NULL, data, args211, 1);
+        jsonlogic_decref(args211[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_208(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args212[1];
+        args212[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+        result = jsonlogic_op_VAR(NULL, data, args212, 1);
+        jsonlogic_decref(args212[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_209(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args213[1];
+        args213[0] = JsonLogic_Null;
+        result = jsonlogic_op_VAR(NULL, data, args213, 1);
+        jsonlogic_decref(args213[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_210(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = jsonlogic_op_VAR(NULL, data, NULL, 0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_211(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = jsonlogic_op_MISSING(NULL, data, NULL, 0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_212(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args214[1];
+        args214[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_MISSING(NULL, data, args214, 1);
+        jsonlogic_decref(args214[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_213(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args215[1];
+        args215[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_MISSING(NULL, data, args215, 1);
+        jsonlogic_decref(args215[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_214(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args216[1];
+        args216[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_MISSING(NULL, data, args216, 1);
+        jsonlogic_decref(args216[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_215(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args217[1];
+        args217[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_MISSING(NULL, data, args217, 1);
+        jsonlogic_decref(args217[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_216(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args218[2];
+        args218[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        args218[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        result = jsonlogic_op_MISSING(NULL, data, args218, 2);
+        jsonlogic_decref(args218[0]);
+        jsonlogic_decref(args218[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_217(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args219[2];
+        args219[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        args219[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        result = jsonlogic_op_MISSING(NULL, data, args219, 2);
+        jsonlogic_decref(args219[0]);
+        jsonlogic_decref(args219[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_218(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args220[2];
+        args220[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        args220[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        result = jsonlogic_op_MISSING(NULL, data, args220, 2);
+        jsonlogic_decref(args220[0]);
+        jsonlogic_decref(args220[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_219(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args221[2];
+        args221[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        args221[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        result = jsonlogic_op_MISSING(NULL, data, args221, 2);
+        jsonlogic_decref(args221[0]);
+        jsonlogic_decref(args221[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_220(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args222[2];
+        args222[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        args222[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        result = jsonlogic_op_MISSING(NULL, data, args222, 2);
+        jsonlogic_decref(args222[0]);
+        jsonlogic_decref(args222[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_221(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args223[1];
+        args223[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str32);
+        result = jsonlogic_op_MISSING(NULL, data, args223, 1);
+        jsonlogic_decref(args223[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_222(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args224[1];
+        args224[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str32);
+        result = jsonlogic_op_MISSING(NULL, data, args224, 1);
+        jsonlogic_decref(args224[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_223(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args225[1];
+        args225[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str32);
+        result = jsonlogic_op_MISSING(NULL, data, args225, 1);
+        jsonlogic_decref(args225[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_224(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args226[1];
+        args226[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str32);
+        result = jsonlogic_op_MISSING(NULL, data, args226, 1);
+        jsonlogic_decref(args226[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_225(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args227[2];
+        args227[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str32);
+        args227[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str41);
+        result = jsonlogic_op_MISSING(NULL, data, args227, 2);
+        jsonlogic_decref(args227[0]);
+        jsonlogic_decref(args227[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_226(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args228[2];
+        args228[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        {
+            JsonLogic_Array *array229 = jsonlogic_array_with_capacity(2);
+            if (array229 == NULL) {
+                args228[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array229->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array229->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                args228[1] = jsonlogic_array_into_handle(array229);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args228, 2);
+        jsonlogic_decref(args228[0]);
+        jsonlogic_decref(args228[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_227(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args230[2];
+        args230[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        {
+            JsonLogic_Array *array231 = jsonlogic_array_with_capacity(2);
+            if (array231 == NULL) {
+                args230[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array231->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array231->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                args230[1] = jsonlogic_array_into_handle(array231);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args230, 2);
+        jsonlogic_decref(args230[0]);
+        jsonlogic_decref(args230[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_228(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args232[2];
+        args232[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        {
+            JsonLogic_Array *array233 = jsonlogic_array_with_capacity(2);
+            if (array233 == NULL) {
+                args232[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array233->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array233->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                args232[1] = jsonlogic_array_into_handle(array233);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args232, 2);
+        jsonlogic_decref(args232[0]);
+        jsonlogic_decref(args232[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_229(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args234[2];
+        args234[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        {
+            JsonLogic_Array *array235 = jsonlogic_array_with_capacity(2);
+            if (array235 == NULL) {
+                args234[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array235->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array235->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                args234[1] = jsonlogic_array_into_handle(array235);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args234, 2);
+        jsonlogic_decref(args234[0]);
+        jsonlogic_decref(args234[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_230(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args236[2];
+        args236[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        {
+            JsonLogic_Array *array237 = jsonlogic_array_with_capacity(3);
+            if (array237 == NULL) {
+                args236[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array237->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array237->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                array237->items[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str42);
+                args236[1] = jsonlogic_array_into_handle(array237);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args236, 2);
+        jsonlogic_decref(args236[0]);
+        jsonlogic_decref(args236[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_231(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args238[2];
+        args238[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        {
+            JsonLogic_Array *array239 = jsonlogic_array_with_capacity(3);
+            if (array239 == NULL) {
+                args238[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array239->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array239->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                array239->items[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str42);
+                args238[1] = jsonlogic_array_into_handle(array239);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args238, 2);
+        jsonlogic_decref(args238[0]);
+        jsonlogic_decref(args238[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_232(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args240[2];
+        args240[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        {
+            JsonLogic_Array *array241 = jsonlogic_array_with_capacity(3);
+            if (array241 == NULL) {
+                args240[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array241->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array241->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                array241->items[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str42);
+                args240[1] = jsonlogic_array_into_handle(array241);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args240, 2);
+        jsonlogic_decref(args240[0]);
+        jsonlogic_decref(args240[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_233(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args242[2];
+        args242[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        {
+            JsonLogic_Array *array243 = jsonlogic_array_with_capacity(3);
+            if (array243 == NULL) {
+                args242[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array243->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array243->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                array243->items[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str42);
+                args242[1] = jsonlogic_array_into_handle(array243);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args242, 2);
+        jsonlogic_decref(args242[0]);
+        jsonlogic_decref(args242[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_234(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args244[2];
+        args244[0] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        {
+            JsonLogic_Array *array245 = jsonlogic_array_with_capacity(3);
+            if (array245 == NULL) {
+                args244[1] = JsonLogic_Error_OutOfMemory;
+            } else {
+                array245->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+                array245->items[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+                array245->items[2] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str42);
+                args244[1] = jsonlogic_array_into_handle(array245);
+            }
+        }
+        result = jsonlogic_op_MISSING_SOME(NULL, data, args244, 2);
+        jsonlogic_decref(args244[0]);
+        jsonlogic_decref(args244[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_235(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value246;
+        bool condition246;
+        {
+            JsonLogic_Handle args247[1];
+            args247[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+            value246 = jsonlogic_op_MISSING(NULL, data, args247, 1);
+            jsonlogic_decref(args247[0]);
+        }
+        condition246 = jsonlogic_to_bool(value246);
+        jsonlogic_decref(value246);
+        if (condition246) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str43);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str44);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_236(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value248;
+        bool condition248;
+        {
+            JsonLogic_Handle args249[1];
+            args249[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+            value248 = jsonlogic_op_MISSING(NULL, data, args249, 1);
+            jsonlogic_decref(args249[0]);
+        }
+        condition248 = jsonlogic_to_bool(value248);
+        jsonlogic_decref(value248);
+        if (condition248) {
+            result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str43);
+            break;
+        }
+        result = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str44);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_237(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args250[1];
+        {
+            JsonLogic_Handle args251[2];
+            args251[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str45);
+            do {
+                JsonLogic_Handle value252;
+                bool condition252;
+                {
+                    JsonLogic_Handle args253[1];
+                    args253[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str46);
+                    value252 = jsonlogic_op_VAR(NULL, data, args253, 1);
+                    jsonlogic_decref(args253[0]);
+                }
+                condition252 = jsonlogic_to_bool(value252);
+                jsonlogic_decref(value252);
+                if (condition252) {
+                    {
+                        JsonLogic_Array *array254 = jsonlogic_array_with_capacity(1);
+                        if (array254 == NULL) {
+                            args251[1] = JsonLogic_Error_OutOfMemory;
+                        } else {
+                            array254->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str47);
+                            args251[1] = jsonlogic_array_into_handle(array254);
+                        }
+                    }
+                    break;
+                }
+                {
+                    JsonLogic_Array *array255 = jsonlogic_array_with_capacity(0);
+                    if (array255 == NULL) {
+                        args251[1] = JsonLogic_Error_OutOfMemory;
+                    } else {
+                        args251[1] = jsonlogic_array_into_handle(array255);
+                    }
+                }
+            } while (0);
+            args250[0] = jsonlogic_op_MERGE(NULL, data, args251, 2);
+            jsonlogic_decref(args251[0]);
+            jsonlogic_decref(args251[1]);
+        }
+        result = jsonlogic_op_MISSING(NULL, data, args250, 1);
+        jsonlogic_decref(args250[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_238(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args256[1];
+        {
+            JsonLogic_Handle args257[2];
+            args257[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str45);
+            do {
+                JsonLogic_Handle value258;
+                bool condition258;
+                {
+                    JsonLogic_Handle args259[1];
+                    args259[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str46);
+                    value258 = jsonlogic_op_VAR(NULL, data, args259, 1);
+                    jsonlogic_decref(args259[0]);
+                }
+                condition258 = jsonlogic_to_bool(value258);
+                jsonlogic_decref(value258);
+                if (condition258) {
+                    {
+                        JsonLogic_Array *array260 = jsonlogic_array_with_capacity(1);
+                        if (array260 == NULL) {
+                            args257[1] = JsonLogic_Error_OutOfMemory;
+                        } else {
+                            array260->items[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str47);
+                            args257[1] = jsonlogic_array_into_handle(array260);
+                        }
+                    }
+                    break;
+                }
+                {
+                    JsonLogic_Array *array261 = jsonlogic_array_with_capacity(0);
+                    if (array261 == NULL) {
+                        args257[1] = JsonLogic_Error_OutOfMemory;
+                    } else {
+                        args257[1] = jsonlogic_array_into_handle(array261);
+                    }
+                }
+            } while (0);
+            args256[0] = jsonlogic_op_MERGE(NULL, data, args257, 2);
+            jsonlogic_decref(args257[0]);
+            jsonlogic_decref(args257[1]);
+        }
+        result = jsonlogic_op_MISSING(NULL, data, args256, 1);
+        jsonlogic_decref(args256[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_239(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items262;
+        {
+            JsonLogic_Handle args263[1];
+            args263[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items262 = jsonlogic_op_VAR(NULL, data, args263, 1);
+            jsonlogic_decref(args263[0]);
+        }
+        result = jsonlogic_compiled_filter(items262, jsonlogic_tests_logic_lambda0);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda0(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_True;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_240(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items264;
+        {
+            JsonLogic_Handle args265[1];
+            args265[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items264 = jsonlogic_op_VAR(NULL, data, args265, 1);
+            jsonlogic_decref(args265[0]);
+        }
+        result = jsonlogic_compiled_filter(items264, NULL);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_241(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items266;
+        {
+            JsonLogic_Handle args267[1];
+            args267[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items266 = jsonlogic_op_VAR(NULL, data, args267, 1);
+            jsonlogic_decref(args267[0]);
+        }
+        result = jsonlogic_compiled_filter(items266, jsonlogic_tests_logic_lambda1);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda1(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args268[2];
+        {
+            JsonLogic_Handle args269[1];
+            args269[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args268[0] = jsonlogic_op_VAR(NULL, data, args269, 1);
+            jsonlogic_decref(args269[0]);
+        }
+        args268[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_GE(NULL, data, args268, 2);
+        jsonlogic_decref(args268[0]);
+        jsonlogic_decref(args268[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_242(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items270;
+        {
+            JsonLogic_Handle args271[1];
+            args271[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items270 = jsonlogic_op_VAR(NULL, data, args271, 1);
+            jsonlogic_decref(args271[0]);
+        }
+        result = jsonlogic_compiled_filter(items270, jsonlogic_tests_logic_lambda2);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda2(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args272[2];
+        {
+            JsonLogic_Handle args273[1];
+            args273[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args272[0] = jsonlogic_op_VAR(NULL, data, args273, 1);
+            jsonlogic_decref(args273[0]);
+        }
+        args272[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MOD(NULL, data, args272, 2);
+        jsonlogic_decref(args272[0]);
+        jsonlogic_decref(args272[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_243(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items274;
+        {
+            JsonLogic_Handle args275[1];
+            args275[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items274 = jsonlogic_op_VAR(NULL, data, args275, 1);
+            jsonlogic_decref(args275[0]);
+        }
+        result = jsonlogic_compiled_map(items274, jsonlogic_tests_logic_lambda3);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda3(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args276[2];
+        {
+            JsonLogic_Handle args277[1];
+            args277[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args276[0] = jsonlogic_op_VAR(NULL, data, args277, 1);
+            jsonlogic_decref(args277[0]);
+        }
+        args276[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MUL(NULL, data, args276, 2);
+        jsonlogic_decref(args276[0]);
+        jsonlogic_decref(args276[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_244(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items278;
+        {
+            JsonLogic_Handle args279[1];
+            args279[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items278 = jsonlogic_op_VAR(NULL, data, args279, 1);
+            jsonlogic_decref(args279[0]);
+        }
+        result = jsonlogic_compiled_map(items278, jsonlogic_tests_logic_lambda4);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda4(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args280[2];
+        {
+            JsonLogic_Handle args281[1];
+            args281[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args280[0] = jsonlogic_op_VAR(NULL, data, args281, 1);
+            jsonlogic_decref(args281[0]);
+        }
+        args280[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MUL(NULL, data, args280, 2);
+        jsonlogic_decref(args280[0]);
+        jsonlogic_decref(args280[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_245(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items282;
+        {
+            JsonLogic_Handle args283[1];
+            args283[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str49);
+            items282 = jsonlogic_op_VAR(NULL, data, args283, 1);
+            jsonlogic_decref(args283[0]);
+        }
+        result = jsonlogic_compiled_map(items282, jsonlogic_tests_logic_lambda5);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda5(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args284[1];
+        args284[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+        result = jsonlogic_op_VAR(NULL, data, args284, 1);
+        jsonlogic_decref(args284[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_246(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items285;
+        JsonLogic_Handle init285;
+        {
+            JsonLogic_Handle args286[1];
+            args286[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items285 = jsonlogic_op_VAR(NULL, data, args286, 1);
+            jsonlogic_decref(args286[0]);
+        }
+        init285 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items285, jsonlogic_tests_logic_lambda6, init285, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda6(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args287[2];
+        args287[0] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        args287[1] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_ADD(NULL, data, args287, 2);
+        jsonlogic_decref(args287[0]);
+        jsonlogic_decref(args287[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_247(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items288;
+        JsonLogic_Handle init288;
+        {
+            JsonLogic_Handle args289[1];
+            args289[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items288 = jsonlogic_op_VAR(NULL, data, args289, 1);
+            jsonlogic_decref(args289[0]);
+        }
+        init288 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items288, jsonlogic_tests_logic_lambda7, init288, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda7(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args290[2];
+        args290[0] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        args290[1] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_ADD(NULL, data, args290, 2);
+        jsonlogic_decref(args290[0]);
+        jsonlogic_decref(args290[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_248(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items291;
+        JsonLogic_Handle init291;
+        {
+            JsonLogic_Handle args292[1];
+            args292[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items291 = jsonlogic_op_VAR(NULL, data, args292, 1);
+            jsonlogic_decref(args292[0]);
+        }
+        init291 = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_compiled_reduce_scope(items291, jsonlogic_tests_logic_lambda8, init291, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda8(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args293[2];
+        args293[0] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        args293[1] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_MUL(NULL, data, args293, 2);
+        jsonlogic_decref(args293[0]);
+        jsonlogic_decref(args293[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_249(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items294;
+        JsonLogic_Handle init294;
+        {
+            JsonLogic_Handle args295[1];
+            args295[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items294 = jsonlogic_op_VAR(NULL, data, args295, 1);
+            jsonlogic_decref(args295[0]);
+        }
+        init294 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items294, jsonlogic_tests_logic_lambda9, init294, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda9(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args296[2];
+        args296[0] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        args296[1] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_MUL(NULL, data, args296, 2);
+        jsonlogic_decref(args296[0]);
+        jsonlogic_decref(args296[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_250(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items297;
+        JsonLogic_Handle init297;
+        {
+            JsonLogic_Handle args298[1];
+            args298[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str49);
+            items297 = jsonlogic_op_VAR(NULL, data, args298, 1);
+            jsonlogic_decref(args298[0]);
+        }
+        init297 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items297, jsonlogic_tests_logic_lambda10, init297, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda10(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args299[2];
+        args299[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        args299[1] = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str50.str, 3, JsonLogic_Null);
+        result = jsonlogic_op_ADD(NULL, data, args299, 2);
+        jsonlogic_decref(args299[0]);
+        jsonlogic_decref(args299[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_251(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items300;
+        {
+            JsonLogic_Handle args301[1];
+            args301[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items300 = jsonlogic_op_VAR(NULL, data, args301, 1);
+            jsonlogic_decref(args301[0]);
+        }
+        result = jsonlogic_compiled_all(items300, jsonlogic_tests_logic_lambda11);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda11(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args302[2];
+        {
+            JsonLogic_Handle args303[1];
+            args303[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args302[0] = jsonlogic_op_VAR(NULL, data, args303, 1);
+            jsonlogic_decref(args303[0]);
+        }
+        args302[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args302, 2);
+        jsonlogic_decref(args302[0]);
+        jsonlogic_decref(args302[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_252(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items304;
+        {
+            JsonLogic_Handle args305[1];
+            args305[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items304 = jsonlogic_op_VAR(NULL, data, args305, 1);
+            jsonlogic_decref(args305[0]);
+        }
+        result = jsonlogic_compiled_all(items304, jsonlogic_tests_logic_lambda12);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda12(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args306[2];
+        {
+            JsonLogic_Handle args307[1];
+            args307[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args306[0] = jsonlogic_op_VAR(NULL, data, args307, 1);
+            jsonlogic_decref(args307[0]);
+        }
+        args306[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_EQ(NULL, data, args306, 2);
+        jsonlogic_decref(args306[0]);
+        jsonlogic_decref(args306[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_253(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items308;
+        {
+            JsonLogic_Handle args309[1];
+            args309[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items308 = jsonlogic_op_VAR(NULL, data, args309, 1);
+            jsonlogic_decref(args309[0]);
+        }
+        result = jsonlogic_compiled_all(items308, jsonlogic_tests_logic_lambda13);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda13(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args310[2];
+        {
+            JsonLogic_Handle args311[1];
+            args311[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args310[0] = jsonlogic_op_VAR(NULL, data, args311, 1);
+            jsonlogic_decref(args311[0]);
+        }
+        args310[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args310, 2);
+        jsonlogic_decref(args310[0]);
+        jsonlogic_decref(args310[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_254(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items312;
+        {
+            JsonLogic_Handle args313[1];
+            args313[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items312 = jsonlogic_op_VAR(NULL, data, args313, 1);
+            jsonlogic_decref(args313[0]);
+        }
+        result = jsonlogic_compiled_all(items312, jsonlogic_tests_logic_lambda14);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda14(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args314[2];
+        {
+            JsonLogic_Handle args315[1];
+            args315[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args314[0] = jsonlogic_op_VAR(NULL, data, args315, 1);
+            jsonlogic_decref(args315[0]);
+        }
+        args314[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args314, 2);
+        jsonlogic_decref(args314[0]);
+        jsonlogic_decref(args314[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_255(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items316;
+        {
+            JsonLogic_Handle args317[1];
+            args317[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items316 = jsonlogic_op_VAR(NULL, data, args317, 1);
+            jsonlogic_decref(args317[0]);
+        }
+        result = jsonlogic_compiled_all(items316, jsonlogic_tests_logic_lambda15);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda15(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args318[2];
+        {
+            JsonLogic_Handle args319[1];
+            args319[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args318[0] = jsonlogic_op_VAR(NULL, data, args319, 1);
+            jsonlogic_decref(args319[0]);
+        }
+        args318[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args318, 2);
+        jsonlogic_decref(args318[0]);
+        jsonlogic_decref(args318[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_256(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items320;
+        {
+            JsonLogic_Handle args321[1];
+            args321[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items320 = jsonlogic_op_VAR(NULL, data, args321, 1);
+            jsonlogic_decref(args321[0]);
+        }
+        result = jsonlogic_compiled_all(items320, jsonlogic_tests_logic_lambda16);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda16(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args322[2];
+        {
+            JsonLogic_Handle args323[1];
+            args323[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args322[0] = jsonlogic_op_VAR(NULL, data, args323, 1);
+            jsonlogic_decref(args323[0]);
+        }
+        args322[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GT(NULL, data, args322, 2);
+        jsonlogic_decref(args322[0]);
+        jsonlogic_decref(args322[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_257(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items324;
+        {
+            JsonLogic_Handle args325[1];
+            args325[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items324 = jsonlogic_op_VAR(NULL, data, args325, 1);
+            jsonlogic_decref(args325[0]);
+        }
+        result = jsonlogic_compiled_all(items324, jsonlogic_tests_logic_lambda17);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda17(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args326[2];
+        {
+            JsonLogic_Handle args327[1];
+            args327[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args326[0] = jsonlogic_op_VAR(NULL, data, args327, 1);
+            jsonlogic_decref(args327[0]);
+        }
+        args326[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args326, 2);
+        jsonlogic_decref(args326[0]);
+        jsonlogic_decref(args326[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_258(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items328;
+        {
+            JsonLogic_Handle args329[1];
+            args329[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items328 = jsonlogic_op_VAR(NULL, data, args329, 1);
+            jsonlogic_decref(args329[0]);
+        }
+        result = jsonlogic_compiled_all(items328, jsonlogic_tests_logic_lambda18);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda18(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args330[2];
+        {
+            JsonLogic_Handle args331[1];
+            args331[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args330[0] = jsonlogic_op_VAR(NULL, data, args331, 1);
+            jsonlogic_decref(args331[0]);
+        }
+        args330[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args330, 2);
+        jsonlogic_decref(args330[0]);
+        jsonlogic_decref(args330[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_259(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items332;
+        {
+            JsonLogic_Handle args333[1];
+            args333[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items332 = jsonlogic_op_VAR(NULL, data, args333, 1);
+            jsonlogic_decref(args333[0]);
+        }
+        result = jsonlogic_compiled_none(items332, jsonlogic_tests_logic_lambda19);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda19(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args334[2];
+        {
+            JsonLogic_Handle args335[1];
+            args335[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args334[0] = jsonlogic_op_VAR(NULL, data, args335, 1);
+            jsonlogic_decref(args335[0]);
+        }
+        args334[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args334, 2);
+        jsonlogic_decref(args334[0]);
+        jsonlogic_decref(args334[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_260(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items336;
+        {
+            JsonLogic_Handle args337[1];
+            args337[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items336 = jsonlogic_op_VAR(NULL, data, args337, 1);
+            jsonlogic_decref(args337[0]);
+        }
+        result = jsonlogic_compiled_none(items336, jsonlogic_tests_logic_lambda20);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda20(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args338[2];
+        {
+            JsonLogic_Handle args339[1];
+            args339[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args338[0] = jsonlogic_op_VAR(NULL, data, args339, 1);
+            jsonlogic_decref(args339[0]);
+        }
+        args338[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_EQ(NULL, data, args338, 2);
+        jsonlogic_decref(args338[0]);
+        jsonlogic_decref(args338[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_261(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items340;
+        {
+            JsonLogic_Handle args341[1];
+            args341[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items340 = jsonlogic_op_VAR(NULL, data, args341, 1);
+            jsonlogic_decref(args341[0]);
+        }
+        result = jsonlogic_compiled_none(items340, jsonlogic_tests_logic_lambda21);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda21(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args342[2];
+        {
+            JsonLogic_Handle args343[1];
+            args343[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args342[0] = jsonlogic_op_VAR(NULL, data, args343, 1);
+            jsonlogic_decref(args343[0]);
+        }
+        args342[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args342, 2);
+        jsonlogic_decref(args342[0]);
+        jsonlogic_decref(args342[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_262(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items344;
+        {
+            JsonLogic_Handle args345[1];
+            args345[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items344 = jsonlogic_op_VAR(NULL, data, args345, 1);
+            jsonlogic_decref(args345[0]);
+        }
+        result = jsonlogic_compiled_none(items344, jsonlogic_tests_logic_lambda22);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda22(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args346[2];
+        {
+            JsonLogic_Handle args347[1];
+            args347[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args346[0] = jsonlogic_op_VAR(NULL, data, args347, 1);
+            jsonlogic_decref(args347[0]);
+        }
+        args346[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args346, 2);
+        jsonlogic_decref(args346[0]);
+        jsonlogic_decref(args346[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_263(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items348;
+        {
+            JsonLogic_Handle args349[1];
+            args349[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items348 = jsonlogic_op_VAR(NULL, data, args349, 1);
+            jsonlogic_decref(args349[0]);
+        }
+        result = jsonlogic_compiled_none(items348, jsonlogic_tests_logic_lambda23);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda23(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args350[2];
+        {
+            JsonLogic_Handle args351[1];
+            args351[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args350[0] = jsonlogic_op_VAR(NULL, data, args351, 1);
+            jsonlogic_decref(args351[0]);
+        }
+        args350[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args350, 2);
+        jsonlogic_decref(args350[0]);
+        jsonlogic_decref(args350[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_264(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items352;
+        {
+            JsonLogic_Handle args353[1];
+            args353[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items352 = jsonlogic_op_VAR(NULL, data, args353, 1);
+            jsonlogic_decref(args353[0]);
+        }
+        result = jsonlogic_compiled_none(items352, jsonlogic_tests_logic_lambda24);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda24(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args354[2];
+        {
+            JsonLogic_Handle args355[1];
+            args355[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args354[0] = jsonlogic_op_VAR(NULL, data, args355, 1);
+            jsonlogic_decref(args355[0]);
+        }
+        args354[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GT(NULL, data, args354, 2);
+        jsonlogic_decref(args354[0]);
+        jsonlogic_decref(args354[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_265(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items356;
+        {
+            JsonLogic_Handle args357[1];
+            args357[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items356 = jsonlogic_op_VAR(NULL, data, args357, 1);
+            jsonlogic_decref(args357[0]);
+        }
+        result = jsonlogic_compiled_none(items356, jsonlogic_tests_logic_lambda25);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda25(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args358[2];
+        {
+            JsonLogic_Handle args359[1];
+            args359[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args358[0] = jsonlogic_op_VAR(NULL, data, args359, 1);
+            jsonlogic_decref(args359[0]);
+        }
+        args358[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args358, 2);
+        jsonlogic_decref(args358[0]);
+        jsonlogic_decref(args358[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_266(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items360;
+        {
+            JsonLogic_Handle args361[1];
+            args361[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items360 = jsonlogic_op_VAR(NULL, data, args361, 1);
+            jsonlogic_decref(args361[0]);
+        }
+        result = jsonlogic_compiled_none(items360, jsonlogic_tests_logic_lambda26);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda26(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args362[2];
+        {
+            JsonLogic_Handle args363[1];
+            args363[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args362[0] = jsonlogic_op_VAR(NULL, data, args363, 1);
+            jsonlogic_decref(args363[0]);
+        }
+        args362[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args362, 2);
+        jsonlogic_decref(args362[0]);
+        jsonlogic_decref(args362[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_267(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items364;
+        {
+            JsonLogic_Handle args365[1];
+            args365[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items364 = jsonlogic_op_VAR(NULL, data, args365, 1);
+            jsonlogic_decref(args365[0]);
+        }
+        result = jsonlogic_compiled_some(items364, jsonlogic_tests_logic_lambda27);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda27(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args366[2];
+        {
+            JsonLogic_Handle args367[1];
+            args367[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args366[0] = jsonlogic_op_VAR(NULL, data, args367, 1);
+            jsonlogic_decref(args367[0]);
+        }
+        args366[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args366, 2);
+        jsonlogic_decref(args366[0]);
+        jsonlogic_decref(args366[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_268(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items368;
+        {
+            JsonLogic_Handle args369[1];
+            args369[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items368 = jsonlogic_op_VAR(NULL, data, args369, 1);
+            jsonlogic_decref(args369[0]);
+        }
+        result = jsonlogic_compiled_some(items368, jsonlogic_tests_logic_lambda28);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda28(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args370[2];
+        {
+            JsonLogic_Handle args371[1];
+            args371[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args370[0] = jsonlogic_op_VAR(NULL, data, args371, 1);
+            jsonlogic_decref(args371[0]);
+        }
+        args370[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_EQ(NULL, data, args370, 2);
+        jsonlogic_decref(args370[0]);
+        jsonlogic_decref(args370[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_269(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items372;
+        {
+            JsonLogic_Handle args373[1];
+            args373[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items372 = jsonlogic_op_VAR(NULL, data, args373, 1);
+            jsonlogic_decref(args373[0]);
+        }
+        result = jsonlogic_compiled_some(items372, jsonlogic_tests_logic_lambda29);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda29(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args374[2];
+        {
+            JsonLogic_Handle args375[1];
+            args375[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args374[0] = jsonlogic_op_VAR(NULL, data, args375, 1);
+            jsonlogic_decref(args375[0]);
+        }
+        args374[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args374, 2);
+        jsonlogic_decref(args374[0]);
+        jsonlogic_decref(args374[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_270(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items376;
+        {
+            JsonLogic_Handle args377[1];
+            args377[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str48);
+            items376 = jsonlogic_op_VAR(NULL, data, args377, 1);
+            jsonlogic_decref(args377[0]);
+        }
+        result = jsonlogic_compiled_some(items376, jsonlogic_tests_logic_lambda30);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda30(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args378[2];
+        {
+            JsonLogic_Handle args379[1];
+            args379[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args378[0] = jsonlogic_op_VAR(NULL, data, args379, 1);
+            jsonlogic_decref(args379[0]);
+        }
+        args378[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args378, 2);
+        jsonlogic_decref(args378[0]);
+        jsonlogic_decref(args378[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_271(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items380;
+        {
+            JsonLogic_Handle args381[1];
+            args381[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items380 = jsonlogic_op_VAR(NULL, data, args381, 1);
+            jsonlogic_decref(args381[0]);
+        }
+        result = jsonlogic_compiled_some(items380, jsonlogic_tests_logic_lambda31);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda31(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args382[2];
+        {
+            JsonLogic_Handle args383[1];
+            args383[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args382[0] = jsonlogic_op_VAR(NULL, data, args383, 1);
+            jsonlogic_decref(args383[0]);
+        }
+        args382[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args382, 2);
+        jsonlogic_decref(args382[0]);
+        jsonlogic_decref(args382[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_272(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items384;
+        {
+            JsonLogic_Handle args385[1];
+            args385[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items384 = jsonlogic_op_VAR(NULL, data, args385, 1);
+            jsonlogic_decref(args385[0]);
+        }
+        result = jsonlogic_compiled_some(items384, jsonlogic_tests_logic_lambda32);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda32(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args386[2];
+        {
+            JsonLogic_Handle args387[1];
+            args387[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args386[0] = jsonlogic_op_VAR(NULL, data, args387, 1);
+            jsonlogic_decref(args387[0]);
+        }
+        args386[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GT(NULL, data, args386, 2);
+        jsonlogic_decref(args386[0]);
+        jsonlogic_decref(args386[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_273(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items388;
+        {
+            JsonLogic_Handle args389[1];
+            args389[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items388 = jsonlogic_op_VAR(NULL, data, args389, 1);
+            jsonlogic_decref(args389[0]);
+        }
+        result = jsonlogic_compiled_some(items388, jsonlogic_tests_logic_lambda33);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda33(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args390[2];
+        {
+            JsonLogic_Handle args391[1];
+            args391[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args390[0] = jsonlogic_op_VAR(NULL, data, args391, 1);
+            jsonlogic_decref(args391[0]);
+        }
+        args390[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_LT(NULL, data, args390, 2);
+        jsonlogic_decref(args390[0]);
+        jsonlogic_decref(args390[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_274(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items392;
+        {
+            JsonLogic_Handle args393[1];
+            args393[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items392 = jsonlogic_op_VAR(NULL, data, args393, 1);
+            jsonlogic_decref(args393[0]);
+        }
+        result = jsonlogic_compiled_some(items392, jsonlogic_tests_logic_lambda34);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda34(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args394[2];
+        {
+            JsonLogic_Handle args395[1];
+            args395[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str50);
+            args394[0] = jsonlogic_op_VAR(NULL, data, args395, 1);
+            jsonlogic_decref(args395[0]);
+        }
+        args394[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_GE(NULL, data, args394, 2);
+        jsonlogic_decref(args394[0]);
+        jsonlogic_decref(args394[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_275(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items396;
+        JsonLogic_Handle init396;
+        {
+            JsonLogic_Handle args397[1];
+            args397[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items396 = jsonlogic_op_VAR(NULL, data, args397, 1);
+            jsonlogic_decref(args397[0]);
+        }
+        init396 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items396, jsonlogic_tests_logic_lambda35, init396, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda35(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args398[2];
+        args398[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        args398[1] = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str52.str, 5, JsonLogic_Null);
+        result = jsonlogic_op_ADD(NULL, data, args398, 2);
+        jsonlogic_decref(args398[0]);
+        jsonlogic_decref(args398[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_276(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items399;
+        JsonLogic_Handle init399;
+        {
+            JsonLogic_Handle args400[1];
+            args400[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items399 = jsonlogic_op_VAR(NULL, data, args400, 1);
+            jsonlogic_decref(args400[0]);
+        }
+        init399 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items399, jsonlogic_tests_logic_lambda36, init399, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda36(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args401[2];
+        args401[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        {
+            JsonLogic_Handle args402[1];
+            args402[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            args401[1] = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str53.str, 5, args402[0]);
+            jsonlogic_decref(args402[0]);
+        }
+        result = jsonlogic_op_ADD(NULL, data, args401, 2);
+        jsonlogic_decref(args401[0]);
+        jsonlogic_decref(args401[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_277(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items403;
+        JsonLogic_Handle init403;
+        {
+            JsonLogic_Handle args404[1];
+            args404[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items403 = jsonlogic_op_VAR(NULL, data, args404, 1);
+            jsonlogic_decref(args404[0]);
+        }
+        init403 = JsonLogic_Null;
+        result = jsonlogic_compiled_reduce_scope(items403, jsonlogic_tests_logic_lambda37, init403, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda37(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        JsonLogic_Handle value405;
+        bool condition405;
+        {
+            JsonLogic_Handle args406[2];
+            args406[0] = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str52.str, 5, JsonLogic_Null);
+            args406[1] = (JsonLogic_Handle)UINT64_C(0x4024000000000000); // 10
+            value405 = jsonlogic_op_LT(NULL, data, args406, 2);
+            jsonlogic_decref(args406[0]);
+            jsonlogic_decref(args406[1]);
+        }
+        condition405 = jsonlogic_to_bool(value405);
+        jsonlogic_decref(value405);
+        if (condition405) {
+            result = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+            break;
+        }
+        result = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str54.str, 4, JsonLogic_Null);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_278(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items407;
+        JsonLogic_Handle init407;
+        {
+            JsonLogic_Handle args408[1];
+            args408[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items407 = jsonlogic_op_VAR(NULL, data, args408, 1);
+            jsonlogic_decref(args408[0]);
+        }
+        init407 = JsonLogic_Null;
+        result = jsonlogic_compiled_reduce_scope(items407, jsonlogic_tests_logic_lambda38, init407, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda38(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args409[1];
+        args409[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str55);
+        result = jsonlogic_compiled_scope_var(accumulator, NULL, 0, args409[0]);
+        jsonlogic_decref(args409[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_279(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items410;
+        JsonLogic_Handle init410;
+        {
+            JsonLogic_Handle args411[1];
+            args411[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items410 = jsonlogic_op_VAR(NULL, data, args411, 1);
+            jsonlogic_decref(args411[0]);
+        }
+        init410 = JsonLogic_Null;
+        result = jsonlogic_compiled_reduce_scope(items410, jsonlogic_tests_logic_lambda39, init410, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda39(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_280(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items412;
+        JsonLogic_Handle init412;
+        {
+            JsonLogic_Handle args413[1];
+            args413[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items412 = jsonlogic_op_VAR(NULL, data, args413, 1);
+            jsonlogic_decref(args413[0]);
+        }
+        init412 = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_compiled_reduce_scope(items412, jsonlogic_tests_logic_lambda40, init412, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda40(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = jsonlogic_compiled_scope_var(JsonLogic_Null, jsonlogic_tests_logic_str56.str, 7, JsonLogic_Null);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_281(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items414;
+        JsonLogic_Handle init414;
+        {
+            JsonLogic_Handle args415[1];
+            args415[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items414 = jsonlogic_op_VAR(NULL, data, args415, 1);
+            jsonlogic_decref(args415[0]);
+        }
+        init414 = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_compiled_reduce_scope(items414, jsonlogic_tests_logic_lambda41, init414, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda41(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = jsonlogic_compiled_scope_var(JsonLogic_Null, jsonlogic_tests_logic_str57.str, 5, JsonLogic_Null);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_282(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items416;
+        JsonLogic_Handle init416;
+        {
+            JsonLogic_Handle args417[1];
+            args417[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items416 = jsonlogic_op_VAR(NULL, data, args417, 1);
+            jsonlogic_decref(args417[0]);
+        }
+        init416 = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_compiled_reduce(items416, jsonlogic_tests_logic_lambda42, init416);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda42(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args418[1];
+        {
+            JsonLogic_Handle args419[2];
+            args419[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str58);
+            args419[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str59);
+            args418[0] = jsonlogic_op_CAT(NULL, data, args419, 2);
+            jsonlogic_decref(args419[0]);
+            jsonlogic_decref(args419[1]);
+        }
+        result = jsonlogic_op_VAR(NULL, data, args418, 1);
+        jsonlogic_decref(args418[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_283(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items420;
+        JsonLogic_Handle init420;
+        {
+            JsonLogic_Handle args421[1];
+            args421[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items420 = jsonlogic_op_VAR(NULL, data, args421, 1);
+            jsonlogic_decref(args421[0]);
+        }
+        init420 = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_compiled_reduce(items420, jsonlogic_tests_logic_lambda43, init420);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda43(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args422[1];
+        args422[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str56);
+        result = jsonlogic_op_MISSING(NULL, data, args422, 1);
+        jsonlogic_decref(args422[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_284(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items423;
+        JsonLogic_Handle init423;
+        {
+            JsonLogic_Handle args424[1];
+            args424[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items423 = jsonlogic_op_VAR(NULL, data, args424, 1);
+            jsonlogic_decref(args424[0]);
+        }
+        init423 = jsonlogic_empty_array();
+        result = jsonlogic_compiled_reduce_scope(items423, jsonlogic_tests_logic_lambda44, init423, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda44(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args425[2];
+        args425[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        {
+            JsonLogic_Handle items426;
+            JsonLogic_Handle init426;
+            items426 = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str60.str, 4, JsonLogic_Null);
+            init426 = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args425[1] = jsonlogic_compiled_reduce_scope(items426, jsonlogic_tests_logic_lambda45, init426, data);
+        }
+        result = jsonlogic_op_MERGE(NULL, data, args425, 2);
+        jsonlogic_decref(args425[0]);
+        jsonlogic_decref(args425[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda45(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args427[2];
+        args427[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        args427[1] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_CAT(NULL, data, args427, 2);
+        jsonlogic_decref(args427[0]);
+        jsonlogic_decref(args427[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_285(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items428;
+        JsonLogic_Handle init428;
+        {
+            JsonLogic_Handle args429[1];
+            args429[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items428 = jsonlogic_op_VAR(NULL, data, args429, 1);
+            jsonlogic_decref(args429[0]);
+        }
+        init428 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items428, jsonlogic_tests_logic_lambda46, init428, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda46(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args430[2];
+        args430[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        {
+            JsonLogic_Handle items431;
+            JsonLogic_Handle init431;
+            items431 = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str60.str, 4, JsonLogic_Null);
+            init431 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+            args430[1] = jsonlogic_compiled_reduce_scope(items431, jsonlogic_tests_logic_lambda47, init431, data);
+        }
+        result = jsonlogic_op_ADD(NULL, data, args430, 2);
+        jsonlogic_decref(args430[0]);
+        jsonlogic_decref(args430[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda47(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args432[2];
+        args432[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        args432[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_ADD(NULL, data, args432, 2);
+        jsonlogic_decref(args432[0]);
+        jsonlogic_decref(args432[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_286(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items433;
+        {
+            JsonLogic_Handle args434[1];
+            args434[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items433 = jsonlogic_op_VAR(NULL, data, args434, 1);
+            jsonlogic_decref(args434[0]);
+        }
+        result = jsonlogic_compiled_map(items433, jsonlogic_tests_logic_lambda48);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda48(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items435;
+        JsonLogic_Handle init435;
+        {
+            JsonLogic_Handle args436[1];
+            args436[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str60);
+            items435 = jsonlogic_op_VAR(NULL, data, args436, 1);
+            jsonlogic_decref(args436[0]);
+        }
+        init435 = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+        result = jsonlogic_compiled_reduce_scope(items435, jsonlogic_tests_logic_lambda49, init435, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda49(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args437[2];
+        args437[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        args437[1] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_CAT(NULL, data, args437, 2);
+        jsonlogic_decref(args437[0]);
+        jsonlogic_decref(args437[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_287(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items438;
+        JsonLogic_Handle init438;
+        {
+            JsonLogic_Handle args439[1];
+            args439[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items438 = jsonlogic_op_VAR(NULL, data, args439, 1);
+            jsonlogic_decref(args439[0]);
+        }
+        init438 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items438, jsonlogic_tests_logic_lambda50, init438, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda50(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args440[2];
+        args440[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        {
+            JsonLogic_Handle items441;
+            JsonLogic_Handle init441;
+            {
+                JsonLogic_Handle items442;
+                items442 = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str60.str, 4, JsonLogic_Null);
+                items441 = jsonlogic_compiled_map(items442, jsonlogic_tests_logic_lambda51);
+            }
+            init441 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+            args440[1] = jsonlogic_compiled_reduce_scope(items441, jsonlogic_tests_logic_lambda52, init441, data);
+        }
+        result = jsonlogic_op_ADD(NULL, data, args440, 2);
+        jsonlogic_decref(args440[0]);
+        jsonlogic_decref(args440[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda51(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda52(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args443[2];
+        args443[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        args443[1] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_ADD(NULL, data, args443, 2);
+        jsonlogic_decref(args443[0]);
+        jsonlogic_decref(args443[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_288(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items444;
+        JsonLogic_Handle init444;
+        {
+            JsonLogic_Handle args445[1];
+            args445[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items444 = jsonlogic_op_VAR(NULL, data, args445, 1);
+            jsonlogic_decref(args445[0]);
+        }
+        init444 = JsonLogic_False;
+        result = jsonlogic_compiled_reduce_scope(items444, jsonlogic_tests_logic_lambda53, init444, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda53(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items446;
+        items446 = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str60.str, 4, JsonLogic_Null);
+        result = jsonlogic_compiled_some(items446, jsonlogic_tests_logic_lambda54);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda54(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args447[2];
+        {
+            JsonLogic_Handle args448[1];
+            args448[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args447[0] = jsonlogic_op_VAR(NULL, data, args448, 1);
+            jsonlogic_decref(args448[0]);
+        }
+        args447[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str2);
+        result = jsonlogic_op_EQ(NULL, data, args447, 2);
+        jsonlogic_decref(args447[0]);
+        jsonlogic_decref(args447[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_289(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items449;
+        JsonLogic_Handle init449;
+        {
+            JsonLogic_Handle args450[1];
+            args450[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items449 = jsonlogic_op_VAR(NULL, data, args450, 1);
+            jsonlogic_decref(args450[0]);
+        }
+        init449 = JsonLogic_True;
+        result = jsonlogic_compiled_reduce_scope(items449, jsonlogic_tests_logic_lambda55, init449, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda55(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        result = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        result = jsonlogic_compiled_scope_var(current, jsonlogic_tests_logic_str52.str, 5, JsonLogic_Null);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_290(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items451;
+        JsonLogic_Handle init451;
+        {
+            JsonLogic_Handle args452[1];
+            args452[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items451 = jsonlogic_op_VAR(NULL, data, args452, 1);
+            jsonlogic_decref(args452[0]);
+        }
+        init451 = JsonLogic_Null;
+        result = jsonlogic_compiled_reduce_scope(items451, jsonlogic_tests_logic_lambda56, init451, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda56(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_291(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items453;
+        JsonLogic_Handle init453;
+        {
+            JsonLogic_Handle args454[1];
+            args454[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+            items453 = jsonlogic_op_VAR(NULL, data, args454, 1);
+            jsonlogic_decref(args454[0]);
+        }
+        init453 = JsonLogic_Null;
+        result = jsonlogic_compiled_reduce_scope(items453, jsonlogic_tests_logic_lambda57, init453, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda57(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_Null;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_292(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items455;
+        JsonLogic_Handle init455;
+        {
+            JsonLogic_Handle items456;
+            {
+                JsonLogic_Handle items457;
+                {
+                    JsonLogic_Handle args458[1];
+                    args458[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                    items457 = jsonlogic_op_VAR(NULL, data, args458, 1);
+                    jsonlogic_decref(args458[0]);
+                }
+                items456 = jsonlogic_compiled_filter(items457, jsonlogic_tests_logic_lambda58);
+            }
+            items455 = jsonlogic_compiled_map(items456, jsonlogic_tests_logic_lambda59);
+        }
+        init455 = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_compiled_reduce_scope(items455, jsonlogic_tests_logic_lambda60, init455, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda58(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args459[2];
+        {
+            JsonLogic_Handle args460[1];
+            args460[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str52);
+            args459[0] = jsonlogic_op_VAR(NULL, data, args460, 1);
+            jsonlogic_decref(args460[0]);
+        }
+        args459[1] = (JsonLogic_Handle)UINT64_C(0x4024000000000000); // 10
+        result = jsonlogic_op_LT(NULL, data, args459, 2);
+        jsonlogic_decref(args459[0]);
+        jsonlogic_decref(args459[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda59(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args461[1];
+        args461[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str52);
+        result = jsonlogic_op_VAR(NULL, data, args461, 1);
+        jsonlogic_decref(args461[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda60(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args462[2];
+        args462[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        args462[1] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_ADD(NULL, data, args462, 2);
+        jsonlogic_decref(args462[0]);
+        jsonlogic_decref(args462[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_293(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items463;
+        JsonLogic_Handle init463;
+        {
+            JsonLogic_Handle items464;
+            {
+                JsonLogic_Handle args465[1];
+                args465[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items464 = jsonlogic_op_VAR(NULL, data, args465, 1);
+                jsonlogic_decref(args465[0]);
+            }
+            items463 = jsonlogic_compiled_map(items464, jsonlogic_tests_logic_lambda61);
+        }
+        init463 = jsonlogic_empty_array();
+        result = jsonlogic_compiled_reduce_scope(items463, jsonlogic_tests_logic_lambda62, init463, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda61(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args466[1];
+        args466[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str60);
+        result = jsonlogic_op_VAR(NULL, data, args466, 1);
+        jsonlogic_decref(args466[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda62(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args467[2];
+        args467[0] = jsonlogic_compiled_scope_var(accumulator, NULL, 0, JsonLogic_Null);
+        args467[1] = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+        result = jsonlogic_op_MERGE(NULL, data, args467, 2);
+        jsonlogic_decref(args467[0]);
+        jsonlogic_decref(args467[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_294(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items468;
+        {
+            JsonLogic_Handle items469;
+            {
+                JsonLogic_Handle args470[1];
+                args470[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items469 = jsonlogic_op_VAR(NULL, data, args470, 1);
+                jsonlogic_decref(args470[0]);
+            }
+            items468 = jsonlogic_compiled_filter(items469, jsonlogic_tests_logic_lambda63);
+        }
+        result = jsonlogic_compiled_map(items468, jsonlogic_tests_logic_lambda64);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda63(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args471[1];
+        args471[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str52);
+        result = jsonlogic_op_VAR(NULL, data, args471, 1);
+        jsonlogic_decref(args471[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda64(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args472[2];
+        {
+            JsonLogic_Handle args473[1];
+            args473[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str54);
+            args472[0] = jsonlogic_op_VAR(NULL, data, args473, 1);
+            jsonlogic_decref(args473[0]);
+        }
+        args472[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str61);
+        result = jsonlogic_op_CAT(NULL, data, args472, 2);
+        jsonlogic_decref(args472[0]);
+        jsonlogic_decref(args472[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_295(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items474;
+        {
+            JsonLogic_Handle items475;
+            {
+                JsonLogic_Handle args476[1];
+                args476[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items475 = jsonlogic_op_VAR(NULL, data, args476, 1);
+                jsonlogic_decref(args476[0]);
+            }
+            items474 = jsonlogic_compiled_map(items475, jsonlogic_tests_logic_lambda65);
+        }
+        result = jsonlogic_compiled_filter(items474, jsonlogic_tests_logic_lambda66);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda65(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args477[1];
+        args477[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str52);
+        result = jsonlogic_op_VAR(NULL, data, args477, 1);
+        jsonlogic_decref(args477[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda66(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args478[2];
+        {
+            JsonLogic_Handle args479[1];
+            args479[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args478[0] = jsonlogic_op_VAR(NULL, data, args479, 1);
+            jsonlogic_decref(args479[0]);
+        }
+        args478[1] = (JsonLogic_Handle)UINT64_C(0x4014000000000000); // 5
+        result = jsonlogic_op_GT(NULL, data, args478, 2);
+        jsonlogic_decref(args478[0]);
+        jsonlogic_decref(args478[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_296(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items480;
+        {
+            JsonLogic_Handle items481;
+            {
+                JsonLogic_Handle args482[1];
+                args482[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                items481 = jsonlogic_op_VAR(NULL, data, args482, 1);
+                jsonlogic_decref(args482[0]);
+            }
+            items480 = jsonlogic_compiled_filter(items481, jsonlogic_tests_logic_lambda67);
+        }
+        result = jsonlogic_compiled_filter(items480, jsonlogic_tests_logic_lambda68);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda67(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args483[2];
+        {
+            JsonLogic_Handle args484[1];
+            args484[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args483[0] = jsonlogic_op_VAR(NULL, data, args484, 1);
+            jsonlogic_decref(args484[0]);
+        }
+        args483[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MOD(NULL, data, args483, 2);
+        jsonlogic_decref(args483[0]);
+        jsonlogic_decref(args483[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda68(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args485[2];
+        {
+            JsonLogic_Handle args486[1];
+            args486[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args485[0] = jsonlogic_op_VAR(NULL, data, args486, 1);
+            jsonlogic_decref(args486[0]);
+        }
+        args485[1] = (JsonLogic_Handle)UINT64_C(0x4008000000000000); // 3
+        result = jsonlogic_op_MOD(NULL, data, args485, 2);
+        jsonlogic_decref(args485[0]);
+        jsonlogic_decref(args485[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_297(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items487;
+        {
+            JsonLogic_Handle items488;
+            {
+                JsonLogic_Handle items489;
+                {
+                    JsonLogic_Handle items490;
+                    {
+                        JsonLogic_Handle items491;
+                        {
+                            JsonLogic_Handle args492[1];
+                            args492[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                            items491 = jsonlogic_op_VAR(NULL, data, args492, 1);
+                            jsonlogic_decref(args492[0]);
+                        }
+                        items490 = jsonlogic_compiled_map(items491, jsonlogic_tests_logic_lambda69);
+                    }
+                    items489 = jsonlogic_compiled_map(items490, jsonlogic_tests_logic_lambda70);
+                }
+                items488 = jsonlogic_compiled_map(items489, jsonlogic_tests_logic_lambda71);
+            }
+            items487 = jsonlogic_compiled_map(items488, jsonlogic_tests_logic_lambda72);
+        }
+        result = jsonlogic_compiled_map(items487, jsonlogic_tests_logic_lambda73);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda69(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args493[2];
+        {
+            JsonLogic_Handle args494[1];
+            args494[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args493[0] = jsonlogic_op_VAR(NULL, data, args494, 1);
+            jsonlogic_decref(args494[0]);
+        }
+        args493[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_ADD(NULL, data, args493, 2);
+        jsonlogic_decref(args493[0]);
+        jsonlogic_decref(args493[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda70(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args495[2];
+        {
+            JsonLogic_Handle args496[1];
+            args496[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args495[0] = jsonlogic_op_VAR(NULL, data, args496, 1);
+            jsonlogic_decref(args496[0]);
+        }
+        args495[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MUL(NULL, data, args495, 2);
+        jsonlogic_decref(args495[0]);
+        jsonlogic_decref(args495[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda71(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args497[2];
+        {
+            JsonLogic_Handle args498[1];
+            args498[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args497[0] = jsonlogic_op_VAR(NULL, data, args498, 1);
+            jsonlogic_decref(args498[0]);
+        }
+        args497[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        result = jsonlogic_op_SUB(NULL, data, args497, 2);
+        jsonlogic_decref(args497[0]);
+        jsonlogic_decref(args497[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda72(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args499[2];
+        {
+            JsonLogic_Handle args500[1];
+            args500[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args499[0] = jsonlogic_op_VAR(NULL, data, args500, 1);
+            jsonlogic_decref(args500[0]);
+        }
+        args499[1] = (JsonLogic_Handle)UINT64_C(0x401c000000000000); // 7
+        result = jsonlogic_op_MOD(NULL, data, args499, 2);
+        jsonlogic_decref(args499[0]);
+        jsonlogic_decref(args499[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda73(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args501[2];
+        args501[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str63);
+        {
+            JsonLogic_Handle args502[1];
+            args502[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args501[1] = jsonlogic_op_VAR(NULL, data, args502, 1);
+            jsonlogic_decref(args502[0]);
+        }
+        result = jsonlogic_op_CAT(NULL, data, args501, 2);
+        jsonlogic_decref(args501[0]);
+        jsonlogic_decref(args501[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_298(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items503;
+        {
+            JsonLogic_Handle items504;
+            {
+                JsonLogic_Handle args505[1];
+                args505[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                items504 = jsonlogic_op_VAR(NULL, data, args505, 1);
+                jsonlogic_decref(args505[0]);
+            }
+            items503 = jsonlogic_compiled_map(items504, jsonlogic_tests_logic_lambda74);
+        }
+        result = jsonlogic_compiled_all(items503, jsonlogic_tests_logic_lambda75);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda74(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args506[2];
+        {
+            JsonLogic_Handle args507[1];
+            args507[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args506[0] = jsonlogic_op_VAR(NULL, data, args507, 1);
+            jsonlogic_decref(args507[0]);
+        }
+        args506[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+        result = jsonlogic_op_MUL(NULL, data, args506, 2);
+        jsonlogic_decref(args506[0]);
+        jsonlogic_decref(args506[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda75(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args508[2];
+        {
+            JsonLogic_Handle args509[1];
+            args509[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args508[0] = jsonlogic_op_VAR(NULL, data, args509, 1);
+            jsonlogic_decref(args509[0]);
+        }
+        args508[1] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+        result = jsonlogic_op_GT(NULL, data, args508, 2);
+        jsonlogic_decref(args508[0]);
+        jsonlogic_decref(args508[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_299(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items510;
+        {
+            JsonLogic_Handle items511;
+            {
+                JsonLogic_Handle args512[1];
+                args512[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                items511 = jsonlogic_op_VAR(NULL, data, args512, 1);
+                jsonlogic_decref(args512[0]);
+            }
+            items510 = jsonlogic_compiled_filter(items511, jsonlogic_tests_logic_lambda76);
+        }
+        result = jsonlogic_compiled_all(items510, jsonlogic_tests_logic_lambda77);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda76(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args513[2];
+        {
+            JsonLogic_Handle args514[1];
+            args514[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args513[0] = jsonlogic_op_VAR(NULL, data, args514, 1);
+            jsonlogic_decref(args514[0]);
+        }
+        args513[1] = (JsonLogic_Handle)UINT64_C(0x4059000000000000); // 100
+        result = jsonlogic_op_GT(NULL, data, args513, 2);
+        jsonlogic_decref(args513[0]);
+        jsonlogic_decref(args513[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda77(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_True;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_300(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items515;
+        {
+            JsonLogic_Handle items516;
+            {
+                JsonLogic_Handle args517[1];
+                args517[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                items516 = jsonlogic_op_VAR(NULL, data, args517, 1);
+                jsonlogic_decref(args517[0]);
+            }
+            items515 = jsonlogic_compiled_filter(items516, jsonlogic_tests_logic_lambda78);
+        }
+        result = jsonlogic_compiled_some(items515, jsonlogic_tests_logic_lambda79);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda78(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args518[2];
+        {
+            JsonLogic_Handle args519[1];
+            args519[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args518[0] = jsonlogic_op_VAR(NULL, data, args519, 1);
+            jsonlogic_decref(args519[0]);
+        }
+        args518[1] = (JsonLogic_Handle)UINT64_C(0x4014000000000000); // 5
+        result = jsonlogic_op_GT(NULL, data, args518, 2);
+        jsonlogic_decref(args518[0]);
+        jsonlogic_decref(args518[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda79(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args520[2];
+        {
+            JsonLogic_Handle args521[1];
+            args521[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args520[0] = jsonlogic_op_VAR(NULL, data, args521, 1);
+            jsonlogic_decref(args521[0]);
+        }
+        args520[1] = (JsonLogic_Handle)UINT64_C(0x401c000000000000); // 7
+        result = jsonlogic_op_EQ(NULL, data, args520, 2);
+        jsonlogic_decref(args520[0]);
+        jsonlogic_decref(args520[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_301(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items522;
+        {
+            JsonLogic_Handle items523;
+            {
+                JsonLogic_Handle args524[1];
+                args524[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items523 = jsonlogic_op_VAR(NULL, data, args524, 1);
+                jsonlogic_decref(args524[0]);
+            }
+            items522 = jsonlogic_compiled_map(items523, jsonlogic_tests_logic_lambda80);
+        }
+        result = jsonlogic_compiled_none(items522, jsonlogic_tests_logic_lambda81);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda80(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args525[1];
+        args525[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str54);
+        result = jsonlogic_op_VAR(NULL, data, args525, 1);
+        jsonlogic_decref(args525[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda81(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args526[2];
+        {
+            JsonLogic_Handle args527[1];
+            args527[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args526[0] = jsonlogic_op_VAR(NULL, data, args527, 1);
+            jsonlogic_decref(args527[0]);
+        }
+        args526[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str64);
+        result = jsonlogic_op_EQ(NULL, data, args526, 2);
+        jsonlogic_decref(args526[0]);
+        jsonlogic_decref(args526[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_302(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args528[2];
+        args528[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str65);
+        {
+            JsonLogic_Handle items529;
+            {
+                JsonLogic_Handle args530[1];
+                args530[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items529 = jsonlogic_op_VAR(NULL, data, args530, 1);
+                jsonlogic_decref(args530[0]);
+            }
+            args528[1] = jsonlogic_compiled_map(items529, jsonlogic_tests_logic_lambda82);
+        }
+        result = jsonlogic_op_IN(NULL, data, args528, 2);
+        jsonlogic_decref(args528[0]);
+        jsonlogic_decref(args528[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda82(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args531[2];
+        {
+            JsonLogic_Handle args532[1];
+            args532[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str54);
+            args531[0] = jsonlogic_op_VAR(NULL, data, args532, 1);
+            jsonlogic_decref(args532[0]);
+        }
+        args531[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str61);
+        result = jsonlogic_op_CAT(NULL, data, args531, 2);
+        jsonlogic_decref(args531[0]);
+        jsonlogic_decref(args531[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_303(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args533[2];
+        args533[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str42);
+        {
+            JsonLogic_Handle items534;
+            {
+                JsonLogic_Handle items535;
+                {
+                    JsonLogic_Handle args536[1];
+                    args536[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                    items535 = jsonlogic_op_VAR(NULL, data, args536, 1);
+                    jsonlogic_decref(args536[0]);
+                }
+                items534 = jsonlogic_compiled_filter(items535, jsonlogic_tests_logic_lambda83);
+            }
+            args533[1] = jsonlogic_compiled_map(items534, jsonlogic_tests_logic_lambda84);
+        }
+        result = jsonlogic_op_IN(NULL, data, args533, 2);
+        jsonlogic_decref(args533[0]);
+        jsonlogic_decref(args533[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda83(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args537[1];
+        args537[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str52);
+        result = jsonlogic_op_VAR(NULL, data, args537, 1);
+        jsonlogic_decref(args537[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda84(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args538[1];
+        args538[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str54);
+        result = jsonlogic_op_VAR(NULL, data, args538, 1);
+        jsonlogic_decref(args538[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_304(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args539[2];
+        {
+            JsonLogic_Handle args540[1];
+            args540[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str66);
+            args539[0] = jsonlogic_op_VAR(NULL, data, args540, 1);
+            jsonlogic_decref(args540[0]);
+        }
+        {
+            JsonLogic_Handle items541;
+            {
+                JsonLogic_Handle args542[1];
+                args542[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items541 = jsonlogic_op_VAR(NULL, data, args542, 1);
+                jsonlogic_decref(args542[0]);
+            }
+            args539[1] = jsonlogic_compiled_map(items541, jsonlogic_tests_logic_lambda85);
+        }
+        result = jsonlogic_op_IN(NULL, data, args539, 2);
+        jsonlogic_decref(args539[0]);
+        jsonlogic_decref(args539[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda85(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args543[1];
+        args543[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str53);
+        result = jsonlogic_op_VAR(NULL, data, args543, 1);
+        jsonlogic_decref(args543[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_305(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args544[2];
+        args544[0] = jsonlogic_op_VAR(NULL, data, NULL, 0);
+        {
+            JsonLogic_Handle items545;
+            {
+                JsonLogic_Handle args546[1];
+                args546[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                items545 = jsonlogic_op_VAR(NULL, data, args546, 1);
+                jsonlogic_decref(args546[0]);
+            }
+            args544[1] = jsonlogic_compiled_map(items545, jsonlogic_tests_logic_lambda86);
+        }
+        result = jsonlogic_op_IN(NULL, data, args544, 2);
+        jsonlogic_decref(args544[0]);
+        jsonlogic_decref(args544[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda86(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_306(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args547[2];
+        args547[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+        {
+            JsonLogic_Handle items548;
+            {
+                JsonLogic_Handle args549[1];
+                args549[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str57);
+                items548 = jsonlogic_op_VAR(NULL, data, args549, 1);
+                jsonlogic_decref(args549[0]);
+            }
+            args547[1] = jsonlogic_compiled_filter(items548, jsonlogic_tests_logic_lambda87);
+        }
+        result = jsonlogic_op_IN(NULL, data, args547, 2);
+        jsonlogic_decref(args547[0]);
+        jsonlogic_decref(args547[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda87(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_True;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_307(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items550;
+        {
+            JsonLogic_Handle items551;
+            {
+                JsonLogic_Handle args552[1];
+                args552[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str57);
+                items551 = jsonlogic_op_VAR(NULL, data, args552, 1);
+                jsonlogic_decref(args552[0]);
+            }
+            items550 = jsonlogic_compiled_filter(items551, jsonlogic_tests_logic_lambda88);
+        }
+        result = jsonlogic_compiled_map(items550, jsonlogic_tests_logic_lambda89);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda88(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_True;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda89(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_308(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items553;
+        JsonLogic_Handle init553;
+        {
+            JsonLogic_Handle items554;
+            {
+                JsonLogic_Handle args555[1];
+                args555[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str67);
+                items554 = jsonlogic_op_VAR(NULL, data, args555, 1);
+                jsonlogic_decref(args555[0]);
+            }
+            items553 = jsonlogic_compiled_filter(items554, jsonlogic_tests_logic_lambda90);
+        }
+        init553 = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str68);
+        result = jsonlogic_compiled_reduce_scope(items553, jsonlogic_tests_logic_lambda91, init553, data);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda90(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_True;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda91(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = jsonlogic_compiled_scope_var(current, NULL, 0, JsonLogic_Null);
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_309(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items556;
+        {
+            JsonLogic_Handle items557;
+            {
+                JsonLogic_Handle args558[1];
+                args558[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                items557 = jsonlogic_op_VAR(NULL, data, args558, 1);
+                jsonlogic_decref(args558[0]);
+            }
+            items556 = jsonlogic_compiled_filter(items557, NULL);
+        }
+        result = jsonlogic_compiled_map(items556, jsonlogic_tests_logic_lambda92);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda92(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_310(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items559;
+        {
+            JsonLogic_Handle items560;
+            {
+                JsonLogic_Handle args561[1];
+                args561[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                items560 = jsonlogic_op_VAR(NULL, data, args561, 1);
+                jsonlogic_decref(args561[0]);
+            }
+            items559 = jsonlogic_compiled_filter(items560, NULL);
+        }
+        result = jsonlogic_compiled_map(items559, jsonlogic_tests_logic_lambda93);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda93(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_311(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items562;
+        {
+            JsonLogic_Handle items563;
+            {
+                JsonLogic_Handle args564[1];
+                args564[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str62);
+                items563 = jsonlogic_op_VAR(NULL, data, args564, 1);
+                jsonlogic_decref(args564[0]);
+            }
+            items562 = jsonlogic_compiled_map(items563, jsonlogic_tests_logic_lambda94);
+        }
+        result = jsonlogic_compiled_map(items562, jsonlogic_tests_logic_lambda95);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda94(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = JsonLogic_Null;
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda95(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    result = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_312(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items565;
+        {
+            JsonLogic_Handle items566;
+            {
+                JsonLogic_Handle args567[1];
+                args567[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items566 = jsonlogic_op_VAR(NULL, data, args567, 1);
+                jsonlogic_decref(args567[0]);
+            }
+            items565 = jsonlogic_compiled_map(items566, jsonlogic_tests_logic_lambda96);
+        }
+        result = jsonlogic_compiled_map(items565, jsonlogic_tests_logic_lambda97);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda96(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args568[1];
+        args568[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str53);
+        result = jsonlogic_op_MISSING(NULL, data, args568, 1);
+        jsonlogic_decref(args568[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda97(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args569[1];
+        args569[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str23);
+        result = jsonlogic_op_VAR(NULL, data, args569, 1);
+        jsonlogic_decref(args569[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_313(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items570;
+        {
+            JsonLogic_Handle items571;
+            {
+                JsonLogic_Handle args572[1];
+                args572[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items571 = jsonlogic_op_VAR(NULL, data, args572, 1);
+                jsonlogic_decref(args572[0]);
+            }
+            items570 = jsonlogic_compiled_map(items571, jsonlogic_tests_logic_lambda98);
+        }
+        result = jsonlogic_compiled_map(items570, jsonlogic_tests_logic_lambda99);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda98(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items573;
+        {
+            JsonLogic_Handle args574[1];
+            args574[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str60);
+            items573 = jsonlogic_op_VAR(NULL, data, args574, 1);
+            jsonlogic_decref(args574[0]);
+        }
+        result = jsonlogic_compiled_filter(items573, jsonlogic_tests_logic_lambda100);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda99(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items575;
+        {
+            JsonLogic_Handle args576[1];
+            args576[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            items575 = jsonlogic_op_VAR(NULL, data, args576, 1);
+            jsonlogic_decref(args576[0]);
+        }
+        result = jsonlogic_compiled_map(items575, jsonlogic_tests_logic_lambda101);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda100(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args577[2];
+        {
+            JsonLogic_Handle args578[1];
+            args578[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args577[0] = jsonlogic_op_VAR(NULL, data, args578, 1);
+            jsonlogic_decref(args578[0]);
+        }
+        args577[1] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str1);
+        result = jsonlogic_op_NE(NULL, data, args577, 2);
+        jsonlogic_decref(args577[0]);
+        jsonlogic_decref(args577[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda101(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args579[2];
+        {
+            JsonLogic_Handle args580[1];
+            args580[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args579[0] = jsonlogic_op_VAR(NULL, data, args580, 1);
+            jsonlogic_decref(args580[0]);
+        }
+        {
+            JsonLogic_Handle args581[1];
+            args581[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+            args579[1] = jsonlogic_op_VAR(NULL, data, args581, 1);
+            jsonlogic_decref(args581[0]);
+        }
+        result = jsonlogic_op_CAT(NULL, data, args579, 2);
+        jsonlogic_decref(args579[0]);
+        jsonlogic_decref(args579[1]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_314(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle items582;
+        {
+            JsonLogic_Handle items583;
+            {
+                JsonLogic_Handle args584[1];
+                args584[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str51);
+                items583 = jsonlogic_op_VAR(NULL, data, args584, 1);
+                jsonlogic_decref(args584[0]);
+            }
+            items582 = jsonlogic_compiled_map(items583, jsonlogic_tests_logic_lambda102);
+        }
+        result = jsonlogic_compiled_filter(items582, jsonlogic_tests_logic_lambda103);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda102(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args585[1];
+        args585[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str52);
+        result = jsonlogic_op_VAR(NULL, data, args585, 1);
+        jsonlogic_decref(args585[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle jsonlogic_tests_logic_lambda103(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args586[1];
+        args586[0] = JSONLOGIC_COMPILED_STRING(jsonlogic_tests_logic_str21);
+        result = jsonlogic_op_VAR(NULL, data, args586, 1);
+        jsonlogic_decref(args586[0]);
+    }
+    return result;
+}
+
+JsonLogic_Handle (*const jsonlogic_tests_logic[])(JsonLogic_Handle data) = {
+    jsonlogic_tests_logic_0,
+    jsonlogic_tests_logic_1,
+    jsonlogic_tests_logic_2,
+    jsonlogic_tests_logic_3,
+    jsonlogic_tests_logic_4,
+    jsonlogic_tests_logic_5,
+    jsonlogic_tests_logic_6,
+    jsonlogic_tests_logic_7,
+    jsonlogic_tests_logic_8,
+    jsonlogic_tests_logic_9,
+    jsonlogic_tests_logic_10,
+    jsonlogic_tests_logic_11,
+    jsonlogic_tests_logic_12,
+    jsonlogic_tests_logic_13,
+    jsonlogic_tests_logic_14,
+    jsonlogic_tests_logic_15,
+    jsonlogic_tests_logic_16,
+    jsonlogic_tests_logic_17,
+    jsonlogic_tests_logic_18,
+    jsonlogic_tests_logic_19,
+    jsonlogic_tests_logic_20,
+    jsonlogic_tests_logic_21,
+    jsonlogic_tests_logic_22,
+    jsonlogic_tests_logic_23,
+    jsonlogic_tests_logic_24,
+    jsonlogic_tests_logic_25,
+    jsonlogic_tests_logic_26,
+    jsonlogic_tests_logic_27,
+    jsonlogic_tests_logic_28,
+    jsonlogic_tests_logic_29,
+    jsonlogic_tests_logic_30,
+    jsonlogic_tests_logic_31,
+    jsonlogic_tests_logic_32,
+    jsonlogic_tests_logic_33,
+    jsonlogic_tests_logic_34,
+    jsonlogic_tests_logic_35,
+    jsonlogic_tests_logic_36,
+    jsonlogic_tests_logic_37,
+    jsonlogic_tests_logic_38,
+    jsonlogic_tests_logic_39,
+    jsonlogic_tests_logic_40,
+    jsonlogic_tests_logic_41,
+    jsonlogic_tests_logic_42,
+    jsonlogic_tests_logic_43,
+    jsonlogic_tests_logic_44,
+    jsonlogic_tests_logic_45,
+    jsonlogic_tests_logic_46,
+    jsonlogic_tests_logic_47,
+    jsonlogic_tests_logic_48,
+    jsonlogic_tests_logic_49,
+    jsonlogic_tests_logic_50,
+    jsonlogic_tests_logic_51,
+    jsonlogic_tests_logic_52,
+    jsonlogic_tests_logic_53,
+    jsonlogic_tests_logic_54,
+    jsonlogic_tests_logic_55,
+    jsonlogic_tests_logic_56,
+    jsonlogic_tests_logic_57,
+    jsonlogic_tests_logic_58,
+    jsonlogic_tests_logic_59,
+    jsonlogic_tests_logic_60,
+    jsonlogic_tests_logic_61,
+    jsonlogic_tests_logic_62,
+    jsonlogic_tests_logic_63,
+    jsonlogic_tests_logic_64,
+    jsonlogic_tests_logic_65,
+    jsonlogic_tests_logic_66,
+    jsonlogic_tests_logic_67,
+    jsonlogic_tests_logic_68,
+    jsonlogic_tests_logic_69,
+    jsonlogic_tests_logic_70,
+    jsonlogic_tests_logic_71,
+    jsonlogic_tests_logic_72,
+    jsonlogic_tests_logic_73,
+    jsonlogic_tests_logic_74,
+    jsonlogic_tests_logic_75,
+    jsonlogic_tests_logic_76,
+    jsonlogic_tests_logic_77,
+    jsonlogic_tests_logic_78,
+    jsonlogic_tests_logic_79,
+    jsonlogic_tests_logic_80,
+    jsonlogic_tests_logic_81,
+    jsonlogic_tests_logic_82,
+    jsonlogic_tests_logic_83,
+    jsonlogic_tests_logic_84,
+    jsonlogic_tests_logic_85,
+    jsonlogic_tests_logic_86,
+    jsonlogic_tests_logic_87,
+    jsonlogic_tests_logic_88,
+    jsonlogic_tests_logic_89,
+    jsonlogic_tests_logic_90,
+    jsonlogic_tests_logic_91,
+    jsonlogic_tests_logic_92,
+    jsonlogic_tests_logic_93,
+    jsonlogic_tests_logic_94,
+    jsonlogic_tests_logic_95,
+    jsonlogic_tests_logic_96,
+    jsonlogic_tests_logic_97,
+    jsonlogic_tests_logic_98,
+    jsonlogic_tests_logic_99,
+    jsonlogic_tests_logic_100,
+    jsonlogic_tests_logic_101,
+    jsonlogic_tests_logic_102,
+    jsonlogic_tests_logic_103,
+    jsonlogic_tests_logic_104,
+    jsonlogic_tests_logic_105,
+    jsonlogic_tests_logic_106,
+    jsonlogic_tests_logic_107,
+    jsonlogic_tests_logic_108,
+    jsonlogic_tests_logic_109,
+    jsonlogic_tests_logic_110,
+    jsonlogic_tests_logic_111,
+    jsonlogic_tests_logic_112,
+    jsonlogic_tests_logic_113,
+    jsonlogic_tests_logic_114,
+    jsonlogic_tests_logic_115,
+    jsonlogic_tests_logic_116,
+    jsonlogic_tests_logic_117,
+    jsonlogic_tests_logic_118,
+    jsonlogic_tests_logic_119,
+    jsonlogic_tests_logic_120,
+    jsonlogic_tests_logic_121,
+    jsonlogic_tests_logic_122,
+    jsonlogic_tests_logic_123,
+    jsonlogic_tests_logic_124,
+    jsonlogic_tests_logic_125,
+    jsonlogic_tests_logic_126,
+    jsonlogic_tests_logic_127,
+    jsonlogic_tests_logic_128,
+    jsonlogic_tests_logic_129,
+    jsonlogic_tests_logic_130,
+    jsonlogic_tests_logic_131,
+    jsonlogic_tests_logic_132,
+    jsonlogic_tests_logic_133,
+    jsonlogic_tests_logic_134,
+    jsonlogic_tests_logic_135,
+    jsonlogic_tests_logic_136,
+    jsonlogic_tests_logic_137,
+    jsonlogic_tests_logic_138,
+    jsonlogic_tests_logic_139,
+    jsonlogic_tests_logic_140,
+    jsonlogic_tests_logic_141,
+    jsonlogic_tests_logic_142,
+    jsonlogic_tests_logic_143,
+    jsonlogic_tests_logic_144,
+    jsonlogic_tests_logic_145,
+    jsonlogic_tests_logic_146,
+    jsonlogic_tests_logic_147,
+    jsonlogic_tests_logic_148,
+    jsonlogic_tests_logic_149,
+    jsonlogic_tests_logic_150,
+    jsonlogic_tests_logic_151,
+    jsonlogic_tests_logic_152,
+    jsonlogic_tests_logic_153,
+    jsonlogic_tests_logic_154,
+    jsonlogic_tests_logic_155,
+    jsonlogic_tests_logic_156,
+    jsonlogic_tests_logic_157,
+    jsonlogic_tests_logic_158,
+    jsonlogic_tests_logic_159,
+    jsonlogic_tests_logic_160,
+    jsonlogic_tests_logic_161,
+    jsonlogic_tests_logic_162,
+    jsonlogic_tests_logic_163,
+    jsonlogic_tests_logic_164,
+    jsonlogic_tests_logic_165,
+    jsonlogic_tests_logic_166,
+    jsonlogic_tests_logic_167,
+    jsonlogic_tests_logic_168,
+    jsonlogic_tests_logic_169,
+    jsonlogic_tests_logic_170,
+    jsonlogic_tests_logic_171,
+    jsonlogic_tests_logic_172,
+    jsonlogic_tests_logic_173,
+    jsonlogic_tests_logic_174,
+    jsonlogic_tests_logic_175,
+    jsonlogic_tests_logic_176,
+    jsonlogic_tests_logic_177,
+    jsonlogic_tests_logic_178,
+    jsonlogic_tests_logic_179,
+    jsonlogic_tests_logic_180,
+    jsonlogic_tests_logic_181,
+    jsonlogic_tests_logic_182,
+    jsonlogic_tests_logic_183,
+    jsonlogic_tests_logic_184,
+    jsonlogic_tests_logic_185,
+    jsonlogic_tests_logic_186,
+    jsonlogic_tests_logic_187,
+    jsonlogic_tests_logic_188,
+    jsonlogic_tests_logic_189,
+    jsonlogic_tests_logic_190,
+    jsonlogic_tests_logic_191,
+    jsonlogic_tests_logic_192,
+    jsonlogic_tests_logic_193,
+    jsonlogic_tests_logic_194,
+    jsonlogic_tests_logic_195,
+    jsonlogic_tests_logic_196,
+    jsonlogic_tests_logic_197,
+    jsonlogic_tests_logic_198,
+    jsonlogic_tests_logic_199,
+    jsonlogic_tests_logic_200,
+    jsonlogic_tests_logic_201,
+    jsonlogic_tests_logic_202,
+    jsonlogic_tests_logic_203,
+    jsonlogic_tests_logic_204,
+    jsonlogic_tests_logic_205,
+    jsonlogic_tests_logic_206,
+    jsonlogic_tests_logic_207,
+    jsonlogic_tests_logic_208,
+    jsonlogic_tests_logic_209,
+    jsonlogic_tests_logic_210,
+    jsonlogic_tests_logic_211,
+    jsonlogic_tests_logic_212,
+    jsonlogic_tests_logic_213,
+    jsonlogic_tests_logic_214,
+    jsonlogic_tests_logic_215,
+    jsonlogic_tests_logic_216,
+    jsonlogic_tests_logic_217,
+    jsonlogic_tests_logic_218,
+    jsonlogic_tests_logic_219,
+    jsonlogic_tests_logic_220,
+    jsonlogic_tests_logic_221,
+    jsonlogic_tests_logic_222,
+    jsonlogic_tests_logic_223,
+    jsonlogic_tests_logic_224,
+    jsonlogic_tests_logic_225,
+    jsonlogic_tests_logic_226,
+    jsonlogic_tests_logic_227,
+    jsonlogic_tests_logic_228,
+    jsonlogic_tests_logic_229,
+    jsonlogic_tests_logic_230,
+    jsonlogic_tests_logic_231,
+    jsonlogic_tests_logic_232,
+    jsonlogic_tests_logic_233,
+    jsonlogic_tests_logic_234,
+    jsonlogic_tests_logic_235,
+    jsonlogic_tests_logic_236,
+    jsonlogic_tests_logic_237,
+    jsonlogic_tests_logic_238,
+    jsonlogic_tests_logic_239,
+    jsonlogic_tests_logic_240,
+    jsonlogic_tests_logic_241,
+    jsonlogic_tests_logic_242,
+    jsonlogic_tests_logic_243,
+    jsonlogic_tests_logic_244,
+    jsonlogic_tests_logic_245,
+    jsonlogic_tests_logic_246,
+    jsonlogic_tests_logic_247,
+    jsonlogic_tests_logic_248,
+    jsonlogic_tests_logic_249,
+    jsonlogic_tests_logic_250,
+    jsonlogic_tests_logic_251,
+    jsonlogic_tests_logic_252,
+    jsonlogic_tests_logic_253,
+    jsonlogic_tests_logic_254,
+    jsonlogic_tests_logic_255,
+    jsonlogic_tests_logic_256,
+    jsonlogic_tests_logic_257,
+    jsonlogic_tests_logic_258,
+    jsonlogic_tests_logic_259,
+    jsonlogic_tests_logic_260,
+    jsonlogic_tests_logic_261,
+    jsonlogic_tests_logic_262,
+    jsonlogic_tests_logic_263,
+    jsonlogic_tests_logic_264,
+    jsonlogic_tests_logic_265,
+    jsonlogic_tests_logic_266,
+    jsonlogic_tests_logic_267,
+    jsonlogic_tests_logic_268,
+    jsonlogic_tests_logic_269,
+    jsonlogic_tests_logic_270,
+    jsonlogic_tests_logic_271,
+    jsonlogic_tests_logic_272,
+    jsonlogic_tests_logic_273,
+    jsonlogic_tests_logic_274,
+    jsonlogic_tests_logic_275,
+    jsonlogic_tests_logic_276,
+    jsonlogic_tests_logic_277,
+    jsonlogic_tests_logic_278,
+    jsonlogic_tests_logic_279,
+    jsonlogic_tests_logic_280,
+    jsonlogic_tests_logic_281,
+    jsonlogic_tests_logic_282,
+    jsonlogic_tests_logic_283,
+    jsonlogic_tests_logic_284,
+    jsonlogic_tests_logic_285,
+    jsonlogic_tests_logic_286,
+    jsonlogic_tests_logic_287,
+    jsonlogic_tests_logic_288,
+    jsonlogic_tests_logic_289,
+    jsonlogic_tests_logic_290,
+    jsonlogic_tests_logic_291,
+    jsonlogic_tests_logic_292,
+    jsonlogic_tests_logic_293,
+    jsonlogic_tests_logic_294,
+    jsonlogic_tests_logic_295,
+    jsonlogic_tests_logic_296,
+    jsonlogic_tests_logic_297,
+    jsonlogic_tests_logic_298,
+    jsonlogic_tests_logic_299,
+    jsonlogic_tests_logic_300,
+    jsonlogic_tests_logic_301,
+    jsonlogic_tests_logic_302,
+    jsonlogic_tests_logic_303,
+    jsonlogic_tests_logic_304,
+    jsonlogic_tests_logic_305,
+    jsonlogic_tests_logic_306,
+    jsonlogic_tests_logic_307,
+    jsonlogic_tests_logic_308,
+    jsonlogic_tests_logic_309,
+    jsonlogic_tests_logic_310,
+    jsonlogic_tests_logic_311,
+    jsonlogic_tests_logic_312,
+    jsonlogic_tests_logic_313,
+    jsonlogic_tests_logic_314,
+};
+
+const size_t jsonlogic_tests_logic_count = 315;
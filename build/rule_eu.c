@@ -0,0 +1,1001 @@
+// generated by compile_logic from tests/rule.json, do not edit
+#include "jsonlogic_intern.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef JSONLOGIC_COMPILED_STRING
+    #define JSONLOGIC_COMPILED_STRING(NAME) (((JsonLogic_Handle)(uintptr_t)&(NAME)) | JsonLogic_Type_String)
+#endif
+
+static JsonLogic_Handle jsonlogic_compiled_some(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {
+        jsonlogic_decref(items);
+        return JsonLogic_False;
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    for (size_t index = 0; index < array->size; ++ index) {
+        JsonLogic_Handle condition = lambda(array->items[index]);
+        bool value = jsonlogic_to_bool(condition);
+        jsonlogic_decref(condition);
+        if (value) {
+            jsonlogic_decref(items);
+            return JsonLogic_True;
+        }
+    }
+    jsonlogic_decref(items);
+    return JsonLogic_False;
+}
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[6]; } rule_eu_str0 = {
+    1, UINT64_C(0xa38d5a4c8ec4d672), 6, {
+        0x0065, 0x0076, 0x0065, 0x006e, 0x0074, 0x0073,
+    }
+}; // "events"
+
+static JsonLogic_Handle rule_eu_lambda0(JsonLogic_Handle data);
+
+static JsonLogic_Handle jsonlogic_compiled_map(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items)) {
+        jsonlogic_decref(items);
+        return jsonlogic_empty_array();
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    JsonLogic_Array *mapped = jsonlogic_array_with_capacity(array->size);
+    if (mapped == NULL) {
+        jsonlogic_decref(items);
+        return JsonLogic_Error_OutOfMemory;
+    }
+    for (size_t index = 0; index < array->size; ++ index) {
+        mapped->items[index] = lambda(array->items[index]);
+    }
+    jsonlogic_decref(items);
+    return jsonlogic_array_into_handle(mapped);
+}
+
+static JsonLogic_Handle jsonlogic_compiled_filter(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {
+    if (JSONLOGIC_IS_ERROR(items)) {
+        return items;
+    }
+    if (!JSONLOGIC_IS_ARRAY(items) || lambda == NULL) {
+        jsonlogic_decref(items);
+        return jsonlogic_empty_array();
+    }
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    JsonLogic_Array *filtered = jsonlogic_array_with_capacity(array->size);
+    if (filtered == NULL) {
+        jsonlogic_decref(items);
+        return JsonLogic_Error_OutOfMemory;
+    }
+    size_t filtered_index = 0;
+    for (size_t index = 0; index < array->size; ++ index) {
+        JsonLogic_Handle item = array->items[index];
+        JsonLogic_Handle condition = lambda(item);
+        if (jsonlogic_to_bool(condition)) {
+            jsonlogic_incref(item);
+            filtered->items[filtered_index ++] = item;
+        }
+        jsonlogic_decref(condition);
+    }
+    jsonlogic_decref(items);
+    filtered = jsonlogic_array_truncate(filtered, filtered_index);
+    return jsonlogic_array_into_handle(filtered);
+}
+
+static JsonLogic_Handle rule_eu_lambda1(JsonLogic_Handle data);
+
+static JsonLogic_Handle rule_eu_lambda2(JsonLogic_Handle data);
+
+static JsonLogic_Handle rule_eu_lambda3(JsonLogic_Handle data);
+
+static JsonLogic_Handle rule_eu_lambda4(JsonLogic_Handle data);
+
+static JsonLogic_Handle rule_eu_lambda5(JsonLogic_Handle data);
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[4]; } rule_eu_str1 = {
+    1, UINT64_C(0xb542d3534870065d), 4, {
+        0x0074, 0x0079, 0x0070, 0x0065,
+    }
+}; // "type"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[9]; } rule_eu_str2 = {
+    1, UINT64_C(0x34cedabc0af7e3dc), 9, {
+        0x0043, 0x006f, 0x0076, 0x0069, 0x0064, 0x0054, 0x0065, 0x0073, 0x0074,
+    }
+}; // "CovidTest"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[8]; } rule_eu_str3 = {
+    1, UINT64_C(0x1025cc12715bdf13), 8, {
+        0x0074, 0x0065, 0x0073, 0x0074, 0x0054, 0x0079, 0x0070, 0x0065,
+    }
+}; // "testType"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[3]; } rule_eu_str4 = {
+    1, UINT64_C(0x66930f0269b17a5c), 3, {
+        0x0050, 0x0043, 0x0052,
+    }
+}; // "PCR"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[8]; } rule_eu_str5 = {
+    1, UINT64_C(0xf63bee9a2e20a3f), 8, {
+        0x0073, 0x0065, 0x006c, 0x0066, 0x0054, 0x0065, 0x0073, 0x0074,
+    }
+}; // "selfTest"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[8]; } rule_eu_str6 = {
+    1, UINT64_C(0xf2d91317d3ae378f), 8, {
+        0x0074, 0x0065, 0x0073, 0x0074, 0x0065, 0x0064, 0x0041, 0x0074,
+    }
+}; // "testedAt"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[7]; } rule_eu_str7 = {
+    1, UINT64_C(0x3825ad2f8486e7b3), 7, {
+        0x0041, 0x006e, 0x0074, 0x0069, 0x0047, 0x0065, 0x006e,
+    }
+}; // "AntiGen"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[11]; } rule_eu_str8 = {
+    1, UINT64_C(0x55571455cfc002d0), 11, {
+        0x0056, 0x0061, 0x0063, 0x0063, 0x0069, 0x006e, 0x0061, 0x0074, 0x0069, 0x006f, 0x006e,
+    }
+}; // "Vaccination"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[7]; } rule_eu_str9 = {
+    1, UINT64_C(0xb720d1d082310420), 7, {
+        0x0076, 0x0061, 0x0063, 0x0063, 0x0069, 0x006e, 0x0065,
+    }
+}; // "vaccine"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[12]; } rule_eu_str10 = {
+    1, UINT64_C(0x37df8dacf2c4cc17), 12, {
+        0x0045, 0x0055, 0x002f, 0x0031, 0x002f, 0x0032, 0x0030, 0x002f, 0x0031, 0x0035, 0x0032, 0x0038,
+    }
+}; // "EU/1/20/1528"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[12]; } rule_eu_str11 = {
+    1, UINT64_C(0xf67e939c452460d2), 12, {
+        0x0045, 0x0055, 0x002f, 0x0031, 0x002f, 0x0032, 0x0030, 0x002f, 0x0031, 0x0035, 0x0030, 0x0037,
+    }
+}; // "EU/1/20/1507"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[12]; } rule_eu_str12 = {
+    1, UINT64_C(0x3d75b26359d894ef), 12, {
+        0x0045, 0x0055, 0x002f, 0x0031, 0x002f, 0x0032, 0x0031, 0x002f, 0x0031, 0x0035, 0x0032, 0x0039,
+    }
+}; // "EU/1/21/1529"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[12]; } rule_eu_str13 = {
+    1, UINT64_C(0x6339c146a9e6d8f4), 12, {
+        0x0076, 0x0061, 0x0063, 0x0063, 0x0069, 0x006e, 0x0061, 0x0074, 0x0065, 0x0064, 0x0041, 0x0074,
+    }
+}; // "vaccinatedAt"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[10]; } rule_eu_str14 = {
+    1, UINT64_C(0xd8a106c7cb7d8c13), 10, {
+        0x0064, 0x006f, 0x0073, 0x0065, 0x004e, 0x0075, 0x006d, 0x0062, 0x0065, 0x0072,
+    }
+}; // "doseNumber"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[12]; } rule_eu_str15 = {
+    1, UINT64_C(0x37b35facf29f4302), 12, {
+        0x0045, 0x0055, 0x002f, 0x0031, 0x002f, 0x0032, 0x0030, 0x002f, 0x0031, 0x0035, 0x0032, 0x0035,
+    }
+}; // "EU/1/20/1525"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[8]; } rule_eu_str16 = {
+    1, UINT64_C(0xffdcf6e814224bb6), 8, {
+        0x0052, 0x0065, 0x0063, 0x006f, 0x0076, 0x0065, 0x0072, 0x0079,
+    }
+}; // "Recovery"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[10]; } rule_eu_str17 = {
+    1, UINT64_C(0x2d8bea8679164a2a), 10, {
+        0x0069, 0x006e, 0x0066, 0x0065, 0x0063, 0x0074, 0x0065, 0x0064, 0x0041, 0x0074,
+    }
+}; // "infectedAt"
+
+static struct { size_t refcount; uint64_t hash; size_t size; char16_t str[11]; } rule_eu_str18 = {
+    1, UINT64_C(0x1d93da5da48a5d3b), 11, {
+        0x0072, 0x0065, 0x0063, 0x006f, 0x0076, 0x0065, 0x0072, 0x0065, 0x0064, 0x0041, 0x0074,
+    }
+}; // "recoveredAt"
+
+JsonLogic_Handle rule_eu(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Handle items0;
+            {
+                JsonLogic_Handle args1[1];
+                args1[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str0));
+                items0 = jsonlogic_op_VAR(NULL, data, args1, 1);
+                jsonlogic_decref(args1[0]);
+            }
+            result = jsonlogic_compiled_some(items0, rule_eu_lambda0);
+        }
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle items2;
+            {
+                JsonLogic_Handle args3[2];
+                {
+                    JsonLogic_Handle items4;
+                    {
+                        JsonLogic_Handle items5;
+                        {
+                            JsonLogic_Handle args6[1];
+                            args6[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str0));
+                            items5 = jsonlogic_op_VAR(NULL, data, args6, 1);
+                            jsonlogic_decref(args6[0]);
+                        }
+                        items4 = jsonlogic_compiled_filter(items5, rule_eu_lambda1);
+                    }
+                    args3[0] = jsonlogic_compiled_map(items4, rule_eu_lambda2);
+                }
+                {
+                    JsonLogic_Handle items7;
+                    {
+                        JsonLogic_Handle items8;
+                        {
+                            JsonLogic_Handle args9[1];
+                            args9[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str0));
+                            items8 = jsonlogic_op_VAR(NULL, data, args9, 1);
+                            jsonlogic_decref(args9[0]);
+                        }
+                        items7 = jsonlogic_compiled_filter(items8, rule_eu_lambda3);
+                    }
+                    args3[1] = jsonlogic_compiled_map(items7, rule_eu_lambda4);
+                }
+                items2 = jsonlogic_extra_COMBINATIONS(NULL, data, args3, 2);
+                jsonlogic_decref(args3[0]);
+                jsonlogic_decref(args3[1]);
+            }
+            result = jsonlogic_compiled_some(items2, rule_eu_lambda5);
+        }
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle rule_eu_lambda0(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        do {
+            {
+                JsonLogic_Handle args10[2];
+                {
+                    JsonLogic_Handle args11[1];
+                    args11[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str1));
+                    args10[0] = jsonlogic_op_VAR(NULL, data, args11, 1);
+                    jsonlogic_decref(args11[0]);
+                }
+                args10[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str2));
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args10, 2);
+                jsonlogic_decref(args10[0]);
+                jsonlogic_decref(args10[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args12[2];
+                {
+                    JsonLogic_Handle args13[1];
+                    args13[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str3));
+                    args12[0] = jsonlogic_op_VAR(NULL, data, args13, 1);
+                    jsonlogic_decref(args13[0]);
+                }
+                args12[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str4));
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args12, 2);
+                jsonlogic_decref(args12[0]);
+                jsonlogic_decref(args12[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args14[2];
+                {
+                    JsonLogic_Handle args15[1];
+                    args15[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str5));
+                    args14[0] = jsonlogic_op_VAR(NULL, data, args15, 1);
+                    jsonlogic_decref(args15[0]);
+                }
+                args14[1] = JsonLogic_False;
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args14, 2);
+                jsonlogic_decref(args14[0]);
+                jsonlogic_decref(args14[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args16[3];
+                args16[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+                {
+                    JsonLogic_Handle args17[1];
+                    {
+                        JsonLogic_Handle args18[1];
+                        args18[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str6));
+                        args17[0] = jsonlogic_op_VAR(NULL, data, args18, 1);
+                        jsonlogic_decref(args18[0]);
+                    }
+                    args16[1] = jsonlogic_extra_TIME_SINCE(NULL, data, args17, 1);
+                    jsonlogic_decref(args17[0]);
+                }
+                {
+                    JsonLogic_Handle args19[1];
+                    args19[0] = (JsonLogic_Handle)UINT64_C(0x4052000000000000); // 72
+                    args16[2] = jsonlogic_extra_HOURS(NULL, data, args19, 1);
+                    jsonlogic_decref(args19[0]);
+                }
+                result = jsonlogic_op_LE(NULL, data, args16, 3);
+                jsonlogic_decref(args16[0]);
+                jsonlogic_decref(args16[1]);
+                jsonlogic_decref(args16[2]);
+            }
+        } while (0);
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        do {
+            {
+                JsonLogic_Handle args20[2];
+                {
+                    JsonLogic_Handle args21[1];
+                    args21[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str1));
+                    args20[0] = jsonlogic_op_VAR(NULL, data, args21, 1);
+                    jsonlogic_decref(args21[0]);
+                }
+                args20[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str2));
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args20, 2);
+                jsonlogic_decref(args20[0]);
+                jsonlogic_decref(args20[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args22[2];
+                {
+                    JsonLogic_Handle args23[1];
+                    args23[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str3));
+                    args22[0] = jsonlogic_op_VAR(NULL, data, args23, 1);
+                    jsonlogic_decref(args23[0]);
+                }
+                args22[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str7));
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args22, 2);
+                jsonlogic_decref(args22[0]);
+                jsonlogic_decref(args22[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args24[2];
+                {
+                    JsonLogic_Handle args25[1];
+                    args25[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str5));
+                    args24[0] = jsonlogic_op_VAR(NULL, data, args25, 1);
+                    jsonlogic_decref(args25[0]);
+                }
+                args24[1] = JsonLogic_False;
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args24, 2);
+                jsonlogic_decref(args24[0]);
+                jsonlogic_decref(args24[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args26[3];
+                args26[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+                {
+                    JsonLogic_Handle args27[1];
+                    {
+                        JsonLogic_Handle args28[1];
+                        args28[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str6));
+                        args27[0] = jsonlogic_op_VAR(NULL, data, args28, 1);
+                        jsonlogic_decref(args28[0]);
+                    }
+                    args26[1] = jsonlogic_extra_TIME_SINCE(NULL, data, args27, 1);
+                    jsonlogic_decref(args27[0]);
+                }
+                {
+                    JsonLogic_Handle args29[1];
+                    args29[0] = (JsonLogic_Handle)UINT64_C(0x4048000000000000); // 48
+                    args26[2] = jsonlogic_extra_HOURS(NULL, data, args29, 1);
+                    jsonlogic_decref(args29[0]);
+                }
+                result = jsonlogic_op_LE(NULL, data, args26, 3);
+                jsonlogic_decref(args26[0]);
+                jsonlogic_decref(args26[1]);
+                jsonlogic_decref(args26[2]);
+            }
+        } while (0);
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        do {
+            {
+                JsonLogic_Handle args30[2];
+                {
+                    JsonLogic_Handle args31[1];
+                    args31[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str1));
+                    args30[0] = jsonlogic_op_VAR(NULL, data, args31, 1);
+                    jsonlogic_decref(args31[0]);
+                }
+                args30[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str2));
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args30, 2);
+                jsonlogic_decref(args30[0]);
+                jsonlogic_decref(args30[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args32[2];
+                {
+                    JsonLogic_Handle args33[1];
+                    args33[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str5));
+                    args32[0] = jsonlogic_op_VAR(NULL, data, args33, 1);
+                    jsonlogic_decref(args33[0]);
+                }
+                args32[1] = JsonLogic_True;
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args32, 2);
+                jsonlogic_decref(args32[0]);
+                jsonlogic_decref(args32[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args34[3];
+                args34[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+                {
+                    JsonLogic_Handle args35[1];
+                    {
+                        JsonLogic_Handle args36[1];
+                        args36[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str6));
+                        args35[0] = jsonlogic_op_VAR(NULL, data, args36, 1);
+                        jsonlogic_decref(args36[0]);
+                    }
+                    args34[1] = jsonlogic_extra_TIME_SINCE(NULL, data, args35, 1);
+                    jsonlogic_decref(args35[0]);
+                }
+                {
+                    JsonLogic_Handle args37[1];
+                    args37[0] = (JsonLogic_Handle)UINT64_C(0x4038000000000000); // 24
+                    args34[2] = jsonlogic_extra_HOURS(NULL, data, args37, 1);
+                    jsonlogic_decref(args37[0]);
+                }
+                result = jsonlogic_op_LE(NULL, data, args34, 3);
+                jsonlogic_decref(args34[0]);
+                jsonlogic_decref(args34[1]);
+                jsonlogic_decref(args34[2]);
+            }
+        } while (0);
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        do {
+            {
+                JsonLogic_Handle args38[2];
+                {
+                    JsonLogic_Handle args39[1];
+                    args39[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str1));
+                    args38[0] = jsonlogic_op_VAR(NULL, data, args39, 1);
+                    jsonlogic_decref(args39[0]);
+                }
+                args38[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str8));
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args38, 2);
+                jsonlogic_decref(args38[0]);
+                jsonlogic_decref(args38[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args40[2];
+                {
+                    JsonLogic_Handle args41[1];
+                    args41[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str9));
+                    args40[0] = jsonlogic_op_VAR(NULL, data, args41, 1);
+                    jsonlogic_decref(args41[0]);
+                }
+                {
+                    JsonLogic_Array *array42 = jsonlogic_array_with_capacity(3);
+                    if (array42 == NULL) {
+                        args40[1] = JsonLogic_Error_OutOfMemory;
+                    } else {
+                        array42->items[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str10));
+                        array42->items[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str11));
+                        array42->items[2] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str12));
+                        args40[1] = jsonlogic_array_into_handle(array42);
+                    }
+                }
+                result = jsonlogic_op_IN(NULL, data, args40, 2);
+                jsonlogic_decref(args40[0]);
+                jsonlogic_decref(args40[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args43[3];
+                args43[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+                {
+                    JsonLogic_Handle args44[1];
+                    {
+                        JsonLogic_Handle args45[1];
+                        args45[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str13));
+                        args44[0] = jsonlogic_op_VAR(NULL, data, args45, 1);
+                        jsonlogic_decref(args45[0]);
+                    }
+                    args43[1] = jsonlogic_extra_TIME_SINCE(NULL, data, args44, 1);
+                    jsonlogic_decref(args44[0]);
+                }
+                {
+                    JsonLogic_Handle args46[1];
+                    args46[0] = (JsonLogic_Handle)UINT64_C(0x4070e00000000000); // 270
+                    args43[2] = jsonlogic_extra_DAYS(NULL, data, args46, 1);
+                    jsonlogic_decref(args46[0]);
+                }
+                result = jsonlogic_op_LE(NULL, data, args43, 3);
+                jsonlogic_decref(args43[0]);
+                jsonlogic_decref(args43[1]);
+                jsonlogic_decref(args43[2]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args47[2];
+                {
+                    JsonLogic_Handle args48[1];
+                    args48[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str14));
+                    args47[0] = jsonlogic_op_VAR(NULL, data, args48, 1);
+                    jsonlogic_decref(args48[0]);
+                }
+                args47[1] = (JsonLogic_Handle)UINT64_C(0x4000000000000000); // 2
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args47, 2);
+                jsonlogic_decref(args47[0]);
+                jsonlogic_decref(args47[1]);
+            }
+        } while (0);
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        do {
+            {
+                JsonLogic_Handle args49[2];
+                {
+                    JsonLogic_Handle args50[1];
+                    args50[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str1));
+                    args49[0] = jsonlogic_op_VAR(NULL, data, args50, 1);
+                    jsonlogic_decref(args50[0]);
+                }
+                args49[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str8));
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args49, 2);
+                jsonlogic_decref(args49[0]);
+                jsonlogic_decref(args49[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args51[2];
+                {
+                    JsonLogic_Handle args52[1];
+                    args52[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str9));
+                    args51[0] = jsonlogic_op_VAR(NULL, data, args52, 1);
+                    jsonlogic_decref(args52[0]);
+                }
+                {
+                    JsonLogic_Array *array53 = jsonlogic_array_with_capacity(1);
+                    if (array53 == NULL) {
+                        args51[1] = JsonLogic_Error_OutOfMemory;
+                    } else {
+                        array53->items[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str15));
+                        args51[1] = jsonlogic_array_into_handle(array53);
+                    }
+                }
+                result = jsonlogic_op_IN(NULL, data, args51, 2);
+                jsonlogic_decref(args51[0]);
+                jsonlogic_decref(args51[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args54[3];
+                {
+                    JsonLogic_Handle args55[1];
+                    args55[0] = (JsonLogic_Handle)UINT64_C(0x4035000000000000); // 21
+                    args54[0] = jsonlogic_extra_DAYS(NULL, data, args55, 1);
+                    jsonlogic_decref(args55[0]);
+                }
+                {
+                    JsonLogic_Handle args56[1];
+                    {
+                        JsonLogic_Handle args57[1];
+                        args57[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str13));
+                        args56[0] = jsonlogic_op_VAR(NULL, data, args57, 1);
+                        jsonlogic_decref(args57[0]);
+                    }
+                    args54[1] = jsonlogic_extra_TIME_SINCE(NULL, data, args56, 1);
+                    jsonlogic_decref(args56[0]);
+                }
+                {
+                    JsonLogic_Handle args58[1];
+                    args58[0] = (JsonLogic_Handle)UINT64_C(0x4070e00000000000); // 270
+                    args54[2] = jsonlogic_extra_DAYS(NULL, data, args58, 1);
+                    jsonlogic_decref(args58[0]);
+                }
+                result = jsonlogic_op_LE(NULL, data, args54, 3);
+                jsonlogic_decref(args54[0]);
+                jsonlogic_decref(args54[1]);
+                jsonlogic_decref(args54[2]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args59[2];
+                {
+                    JsonLogic_Handle args60[1];
+                    args60[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str14));
+                    args59[0] = jsonlogic_op_VAR(NULL, data, args60, 1);
+                    jsonlogic_decref(args60[0]);
+                }
+                args59[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args59, 2);
+                jsonlogic_decref(args59[0]);
+                jsonlogic_decref(args59[1]);
+            }
+        } while (0);
+        if (jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        do {
+            {
+                JsonLogic_Handle args61[2];
+                {
+                    JsonLogic_Handle args62[1];
+                    args62[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str1));
+                    args61[0] = jsonlogic_op_VAR(NULL, data, args62, 1);
+                    jsonlogic_decref(args62[0]);
+                }
+                args61[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str16));
+                result = jsonlogic_op_STRICT_EQ(NULL, data, args61, 2);
+                jsonlogic_decref(args61[0]);
+                jsonlogic_decref(args61[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args63[2];
+                {
+                    JsonLogic_Handle args64[1];
+                    {
+                        JsonLogic_Handle args65[1];
+                        args65[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str17));
+                        args64[0] = jsonlogic_op_VAR(NULL, data, args65, 1);
+                        jsonlogic_decref(args65[0]);
+                    }
+                    args63[0] = jsonlogic_extra_PARSE_TIME(NULL, data, args64, 1);
+                    jsonlogic_decref(args64[0]);
+                }
+                {
+                    JsonLogic_Handle args66[1];
+                    {
+                        JsonLogic_Handle args67[1];
+                        args67[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str18));
+                        args66[0] = jsonlogic_op_VAR(NULL, data, args67, 1);
+                        jsonlogic_decref(args67[0]);
+                    }
+                    args63[1] = jsonlogic_extra_PARSE_TIME(NULL, data, args66, 1);
+                    jsonlogic_decref(args66[0]);
+                }
+                result = jsonlogic_op_LT(NULL, data, args63, 2);
+                jsonlogic_decref(args63[0]);
+                jsonlogic_decref(args63[1]);
+            }
+            if (!jsonlogic_to_bool(result)) {
+                break;
+            }
+            jsonlogic_decref(result);
+            {
+                JsonLogic_Handle args68[3];
+                args68[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+                {
+                    JsonLogic_Handle args69[1];
+                    {
+                        JsonLogic_Handle args70[1];
+                        args70[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str18));
+                        args69[0] = jsonlogic_op_VAR(NULL, data, args70, 1);
+                        jsonlogic_decref(args70[0]);
+                    }
+                    args68[1] = jsonlogic_extra_TIME_SINCE(NULL, data, args69, 1);
+                    jsonlogic_decref(args69[0]);
+                }
+                {
+                    JsonLogic_Handle args71[1];
+                    args71[0] = (JsonLogic_Handle)UINT64_C(0x4066800000000000); // 180
+                    args68[2] = jsonlogic_extra_DAYS(NULL, data, args71, 1);
+                    jsonlogic_decref(args71[0]);
+                }
+                result = jsonlogic_op_LE(NULL, data, args68, 3);
+                jsonlogic_decref(args68[0]);
+                jsonlogic_decref(args68[1]);
+                jsonlogic_decref(args68[2]);
+            }
+        } while (0);
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle rule_eu_lambda1(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Handle args72[2];
+            {
+                JsonLogic_Handle args73[1];
+                args73[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str1));
+                args72[0] = jsonlogic_op_VAR(NULL, data, args73, 1);
+                jsonlogic_decref(args73[0]);
+            }
+            args72[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str8));
+            result = jsonlogic_op_STRICT_EQ(NULL, data, args72, 2);
+            jsonlogic_decref(args72[0]);
+            jsonlogic_decref(args72[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle args74[2];
+            {
+                JsonLogic_Handle args75[1];
+                args75[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str9));
+                args74[0] = jsonlogic_op_VAR(NULL, data, args75, 1);
+                jsonlogic_decref(args75[0]);
+            }
+            {
+                JsonLogic_Array *array76 = jsonlogic_array_with_capacity(4);
+                if (array76 == NULL) {
+                    args74[1] = JsonLogic_Error_OutOfMemory;
+                } else {
+                    array76->items[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str10));
+                    array76->items[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str11));
+                    array76->items[2] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str12));
+                    array76->items[3] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str15));
+                    args74[1] = jsonlogic_array_into_handle(array76);
+                }
+            }
+            result = jsonlogic_op_IN(NULL, data, args74, 2);
+            jsonlogic_decref(args74[0]);
+            jsonlogic_decref(args74[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle args77[3];
+            args77[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+            {
+                JsonLogic_Handle args78[1];
+                {
+                    JsonLogic_Handle args79[1];
+                    args79[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str13));
+                    args78[0] = jsonlogic_op_VAR(NULL, data, args79, 1);
+                    jsonlogic_decref(args79[0]);
+                }
+                args77[1] = jsonlogic_extra_TIME_SINCE(NULL, data, args78, 1);
+                jsonlogic_decref(args78[0]);
+            }
+            {
+                JsonLogic_Handle args80[1];
+                args80[0] = (JsonLogic_Handle)UINT64_C(0x4070e00000000000); // 270
+                args77[2] = jsonlogic_extra_DAYS(NULL, data, args80, 1);
+                jsonlogic_decref(args80[0]);
+            }
+            result = jsonlogic_op_LE(NULL, data, args77, 3);
+            jsonlogic_decref(args77[0]);
+            jsonlogic_decref(args77[1]);
+            jsonlogic_decref(args77[2]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle args81[2];
+            {
+                JsonLogic_Handle args82[1];
+                args82[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str14));
+                args81[0] = jsonlogic_op_VAR(NULL, data, args82, 1);
+                jsonlogic_decref(args82[0]);
+            }
+            args81[1] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+            result = jsonlogic_op_GE(NULL, data, args81, 2);
+            jsonlogic_decref(args81[0]);
+            jsonlogic_decref(args81[1]);
+        }
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle rule_eu_lambda2(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args83[1];
+        {
+            JsonLogic_Handle args84[1];
+            args84[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str13));
+            args83[0] = jsonlogic_op_VAR(NULL, data, args84, 1);
+            jsonlogic_decref(args84[0]);
+        }
+        result = jsonlogic_extra_PARSE_TIME(NULL, data, args83, 1);
+        jsonlogic_decref(args83[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle rule_eu_lambda3(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    do {
+        {
+            JsonLogic_Handle args85[2];
+            {
+                JsonLogic_Handle args86[1];
+                args86[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str1));
+                args85[0] = jsonlogic_op_VAR(NULL, data, args86, 1);
+                jsonlogic_decref(args86[0]);
+            }
+            args85[1] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str16));
+            result = jsonlogic_op_STRICT_EQ(NULL, data, args85, 2);
+            jsonlogic_decref(args85[0]);
+            jsonlogic_decref(args85[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle args87[2];
+            args87[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+            {
+                JsonLogic_Handle args88[1];
+                {
+                    JsonLogic_Handle args89[1];
+                    args89[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str18));
+                    args88[0] = jsonlogic_op_VAR(NULL, data, args89, 1);
+                    jsonlogic_decref(args89[0]);
+                }
+                args87[1] = jsonlogic_extra_TIME_SINCE(NULL, data, args88, 1);
+                jsonlogic_decref(args88[0]);
+            }
+            result = jsonlogic_op_LE(NULL, data, args87, 2);
+            jsonlogic_decref(args87[0]);
+            jsonlogic_decref(args87[1]);
+        }
+        if (!jsonlogic_to_bool(result)) {
+            break;
+        }
+        jsonlogic_decref(result);
+        {
+            JsonLogic_Handle args90[2];
+            {
+                JsonLogic_Handle args91[1];
+                {
+                    JsonLogic_Handle args92[1];
+                    args92[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str17));
+                    args91[0] = jsonlogic_op_VAR(NULL, data, args92, 1);
+                    jsonlogic_decref(args92[0]);
+                }
+                args90[0] = jsonlogic_extra_PARSE_TIME(NULL, data, args91, 1);
+                jsonlogic_decref(args91[0]);
+            }
+            {
+                JsonLogic_Handle args93[1];
+                {
+                    JsonLogic_Handle args94[1];
+                    args94[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str18));
+                    args93[0] = jsonlogic_op_VAR(NULL, data, args94, 1);
+                    jsonlogic_decref(args94[0]);
+                }
+                args90[1] = jsonlogic_extra_PARSE_TIME(NULL, data, args93, 1);
+                jsonlogic_decref(args93[0]);
+            }
+            result = jsonlogic_op_LT(NULL, data, args90, 2);
+            jsonlogic_decref(args90[0]);
+            jsonlogic_decref(args90[1]);
+        }
+    } while (0);
+    return result;
+}
+
+static JsonLogic_Handle rule_eu_lambda4(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args95[1];
+        {
+            JsonLogic_Handle args96[1];
+            args96[0] = jsonlogic_incref(JSONLOGIC_COMPILED_STRING(rule_eu_str17));
+            args95[0] = jsonlogic_op_VAR(NULL, data, args96, 1);
+            jsonlogic_decref(args96[0]);
+        }
+        result = jsonlogic_extra_PARSE_TIME(NULL, data, args95, 1);
+        jsonlogic_decref(args95[0]);
+    }
+    return result;
+}
+
+static JsonLogic_Handle rule_eu_lambda5(JsonLogic_Handle data) {
+    JsonLogic_Handle result;
+    {
+        JsonLogic_Handle args97[2];
+        {
+            JsonLogic_Handle args98[2];
+            {
+                JsonLogic_Handle args99[1];
+                args99[0] = (JsonLogic_Handle)UINT64_C(0x0000000000000000); // 0
+                args98[0] = jsonlogic_op_VAR(NULL, data, args99, 1);
+                jsonlogic_decref(args99[0]);
+            }
+            {
+                JsonLogic_Handle args100[1];
+                args100[0] = (JsonLogic_Handle)UINT64_C(0x3ff0000000000000); // 1
+                args98[1] = jsonlogic_op_VAR(NULL, data, args100, 1);
+                jsonlogic_decref(args100[0]);
+            }
+            args97[0] = jsonlogic_op_SUB(NULL, data, args98, 2);
+            jsonlogic_decref(args98[0]);
+            jsonlogic_decref(args98[1]);
+        }
+        {
+            JsonLogic_Handle args101[1];
+            args101[0] = (JsonLogic_Handle)UINT64_C(0x4035000000000000); // 21
+            args97[1] = jsonlogic_extra_DAYS(NULL, data, args101, 1);
+            jsonlogic_decref(args101[0]);
+        }
+        result = jsonlogic_op_GE(NULL, data, args97, 2);
+        jsonlogic_decref(args97[0]);
+        jsonlogic_decref(args97[1]);
+    }
+    return result;
+}
+
@@ -0,0 +1,14 @@
+// generated by compile_logic from tests/rule.json, do not edit
+#pragma once
+
+#include "jsonlogic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+JsonLogic_Handle rule_eu(JsonLogic_Handle data);
+
+#ifdef __cplusplus
+}
+#endif
@@ -15,7 +15,9 @@
 
 void usage(int argc, char *argv[]) {
     const char *progname = argc > 0 ? argv[0] : "benchmark";
-    fprintf(stderr, "usage: %s <repeat-count> <logic> <data>\n", progname);
+    fprintf(stderr,
+        "usage: %s <repeat-count> <logic> <data>\n"
+        "       %s --batch <record-count> <logic> <data>\n", progname, progname);
 }
 
 #ifdef JSONLOGIC_WINDOWS
@@ -31,6 +33,18 @@ void usage(int argc, char *argv[]) {
     #define JSONLOGIC_CLOCK struct timespec
 #endif
 
+#ifdef _MSC_VER
+    #define GET_CLOCK(CLOCK) CLOCK = GetTickCount64();
+    #define CLOCK_DELTA(C1, C2) (((C2) - (C1)) * 1000)
+#else
+    #define GET_CLOCK(CLOCK)                                   \
+        if (clock_gettime(CLOCK_MONOTONIC, &(CLOCK)) != 0) {   \
+            perror("*** error: getting monotonic time");       \
+            goto error;                                        \
+        }
+    #define CLOCK_DELTA(C1, C2) timedelta(&(C1), &(C2))
+#endif
+
 #ifndef _MSC_VER
 int64_t timedelta(const struct timespec *t1, const struct timespec *t2) {
     assert((uint64_t)t1->tv_sec <= INT64_MAX / 1000000);
@@ -100,6 +114,136 @@ void print_stats(int64_t *times, size_t count, const char *name) {
     );
 }
 
+bool parse_count(const char *str, size_t *countptr) {
+    char *endptr = NULL;
+    errno = 0;
+    const unsigned long long ull_count = strtoull(str, &endptr, 10);
+    if (!*str || *endptr || errno != 0 || (sizeof(unsigned long long) > sizeof(size_t) && ull_count > (unsigned long long)SIZE_MAX) || ull_count == 0) {
+        return false;
+    }
+    *countptr = (size_t) ull_count;
+    return true;
+}
+
+void print_rate(const char *name, size_t count, int64_t usec, size_t truthy) {
+    printf("%-12s %12.3f ms %14.0f records/s %10" PRIuPTR " truthy\n",
+        name,
+        (double)usec / 1000.0,
+        usec > 0 ? (double)count * 1000000.0 / (double)usec : 0.0,
+        truthy);
+}
+
+// Applies the logic to record-count copies of the data, once record by
+// record and once with each of the batch functions.
+int benchmark_batch(int argc, char *argv[]) {
+    int status = 0;
+    JsonLogic_Handle logic    = JsonLogic_Null;
+    JsonLogic_Handle *records = NULL;
+    JsonLogic_Handle *results = NULL;
+    uint8_t *bitmap = NULL;
+    size_t count  = 0;
+    size_t parsed = 0;
+
+    if (argc != 5) {
+        usage(argc, argv);
+        return 1;
+    }
+
+    const char *str_record_count = argv[2];
+    const char *str_logic        = argv[3];
+    const char *str_data         = argv[4];
+
+    if (!parse_count(str_record_count, &count)) {
+        fprintf(stderr, "*** error: parsing record-count '%s'\n", str_record_count);
+        usage(argc, argv);
+        return 1;
+    }
+
+    JsonLogic_LineInfo info = JSONLOGIC_LINEINFO_INIT;
+    logic = jsonlogic_parse(str_logic, &info);
+    JsonLogic_Error error = jsonlogic_get_error(logic);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        jsonlogic_print_parse_error(stderr, str_logic, error, info);
+        goto error;
+    }
+
+    records = calloc(count, sizeof(JsonLogic_Handle));
+    results = calloc(count, sizeof(JsonLogic_Handle));
+    bitmap  = calloc((count + 7) / 8, 1);
+    if (records == NULL || results == NULL || bitmap == NULL) {
+        perror("*** error: allocating memory");
+        goto error;
+    }
+
+    // every record is parsed on its own so they don't share memory
+    for (; parsed < count; ++ parsed) {
+        records[parsed] = jsonlogic_parse(str_data, &info);
+        error = jsonlogic_get_error(records[parsed]);
+        if (error != JSONLOGIC_ERROR_SUCCESS) {
+            jsonlogic_print_parse_error(stderr, str_data, error, info);
+            goto error;
+        }
+    }
+
+    JSONLOGIC_CLOCK start;
+    JSONLOGIC_CLOCK done;
+    size_t truthy = 0;
+
+    GET_CLOCK(start);
+    for (size_t index = 0; index < count; ++ index) {
+        JsonLogic_Handle result = jsonlogic_apply_custom(logic, records[index], &JsonLogic_Extras);
+        truthy += jsonlogic_to_bool(result);
+        jsonlogic_decref(result);
+    }
+    GET_CLOCK(done);
+    print_rate("apply", count, CLOCK_DELTA(start, done), truthy);
+
+    GET_CLOCK(start);
+    error = jsonlogic_apply_batch(logic, records, count, results, &JsonLogic_Extras);
+    truthy = 0;
+    for (size_t index = 0; index < count; ++ index) {
+        truthy += jsonlogic_to_bool(results[index]);
+        jsonlogic_decref(results[index]);
+    }
+    GET_CLOCK(done);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        fprintf(stderr, "*** error: applying batch: %s\n", jsonlogic_get_error_message(error));
+        goto error;
+    }
+    print_rate("batch", count, CLOCK_DELTA(start, done), truthy);
+
+    GET_CLOCK(start);
+    error = jsonlogic_apply_batch_bitmap(logic, records, count, bitmap, &JsonLogic_Extras);
+    truthy = 0;
+    for (size_t index = 0; index < count; ++ index) {
+        truthy += (bitmap[index / 8] >> (index % 8)) & 1;
+    }
+    GET_CLOCK(done);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        fprintf(stderr, "*** error: applying batch: %s\n", jsonlogic_get_error_message(error));
+        goto error;
+    }
+    print_rate("batch bitmap", count, CLOCK_DELTA(start, done), truthy);
+
+    goto cleanup;
+
+error:
+    status = 1;
+
+cleanup:
+    if (records != NULL) {
+        for (size_t index = 0; index < parsed; ++ index) {
+            jsonlogic_decref(records[index]);
+        }
+    }
+    free(records);
+    free(results);
+    free(bitmap);
+    jsonlogic_decref(logic);
+
+    return status;
+}
+
 int main(int argc, char *argv[]) {
     int status = 0;
     int64_t *parse_times = NULL;
@@ -112,6 +256,10 @@ int main(int argc, char *argv[]) {
     JsonLogic_Handle data   = JsonLogic_Null;
     JsonLogic_Handle result = JsonLogic_Null;
 
+    if (argc > 1 && strcmp(argv[1], "--batch") == 0) {
+        return benchmark_batch(argc, argv);
+    }
+
     if (argc != 4) {
         usage(argc, argv);
         goto error;
@@ -121,14 +269,12 @@ int main(int argc, char *argv[]) {
     const char *str_logic        = argv[2];
     const char *str_data         = argv[3];
 
-    char *endptr = NULL;
-    const unsigned long long ull_count = strtoull(str_repeat_count, &endptr, 10);
-    if (!*str_repeat_count || *endptr || (sizeof(unsigned long long) > sizeof(size_t) && ull_count > (unsigned long long)SIZE_MAX) || ull_count == 0) {
+    size_t count = 0;
+    if (!parse_count(str_repeat_count, &count)) {
         fprintf(stderr, "*** error: parsing repeat-count '%s': %s", str_repeat_count, strerror(errno));
         usage(argc, argv);
         return 1;
     }
-    const size_t count = (size_t) ull_count;
 
     parse_times = calloc(count, sizeof(int64_t));
     if (parse_times == NULL) {
@@ -205,18 +351,6 @@ int main(int argc, char *argv[]) {
         JSONLOGIC_CLOCK print_done;
         JSONLOGIC_CLOCK free_done;
 
-#ifdef _MSC_VER
-    #define GET_CLOCK(CLOCK) CLOCK = GetTickCount64();
-    #define CLOCK_DELTA(C1, C2) (((C2) - (C1)) * 1000)
-#else
-    #define GET_CLOCK(CLOCK)                                   \
-        if (clock_gettime(CLOCK_MONOTONIC, &(CLOCK)) != 0) {   \
-            perror("*** error: getting monotonic time");       \
-            goto error;                                        \
-        }
-    #define CLOCK_DELTA(C1, C2) timedelta(&(C1), &(C2))
-#endif
-
         GET_CLOCK(start);
 
         logic = jsonlogic_parse(str_logic, NULL);
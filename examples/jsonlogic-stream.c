@@ -0,0 +1,735 @@
+// for clock_gettime()
+#define _GNU_SOURCE 1
+
+#include "jsonlogic.h"
+#include "jsonlogic_extras.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <assert.h>
+
+// Applies one rule to every line of an NDJSON file. The main thread reads the
+// input in batches of whole lines, worker threads parse the lines and apply
+// the rule, and a writer thread writes the results of the batches in input
+// order. Only a bounded number of batches is in flight at any time, so the
+// reader waits for the writer when the workers or the output can't keep up.
+//
+// The rule is frozen and compiled once and then shared by all workers. All
+// other values stay on the thread that created them, so this doesn't need a
+// build with atomic reference counts.
+
+#if defined(JSONLOGIC_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN 1
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+// Bytes of input per batch. A line that is longer makes its batch bigger.
+#define BATCH_SIZE (256 * 1024)
+
+// Batches in flight per worker thread.
+#define BATCHES_PER_THREAD 4
+
+#if defined(JSONLOGIC_WINDOWS)
+    typedef HANDLE             Thread;
+    typedef CRITICAL_SECTION   Mutex;
+    typedef CONDITION_VARIABLE Cond;
+    typedef DWORD              ThreadResult;
+
+    #define THREAD_CALL WINAPI
+
+    #define THREAD_START(THREAD, FUNCT, ARG) ((*(THREAD) = CreateThread(NULL, 0, (FUNCT), (ARG), 0, NULL)) != NULL)
+    #define THREAD_JOIN(THREAD)              (WaitForSingleObject((THREAD), INFINITE), CloseHandle(THREAD))
+
+    #define MUTEX_INIT(MUTEX)    (InitializeCriticalSection(MUTEX), true)
+    #define MUTEX_DESTROY(MUTEX) DeleteCriticalSection(MUTEX)
+    #define MUTEX_LOCK(MUTEX)    EnterCriticalSection(MUTEX)
+    #define MUTEX_UNLOCK(MUTEX)  LeaveCriticalSection(MUTEX)
+
+    #define COND_INIT(COND)        (InitializeConditionVariable(COND), true)
+    #define COND_DESTROY(COND)     ((void)(COND))
+    #define COND_WAIT(COND, MUTEX) SleepConditionVariableCS((COND), (MUTEX), INFINITE)
+    #define COND_SIGNAL(COND)      WakeConditionVariable(COND)
+    #define COND_BROADCAST(COND)   WakeAllConditionVariable(COND)
+#else
+    typedef pthread_t       Thread;
+    typedef pthread_mutex_t Mutex;
+    typedef pthread_cond_t  Cond;
+    typedef void*           ThreadResult;
+
+    #define THREAD_CALL
+
+    #define THREAD_START(THREAD, FUNCT, ARG) (pthread_create((THREAD), NULL, (FUNCT), (ARG)) == 0)
+    #define THREAD_JOIN(THREAD)              pthread_join((THREAD), NULL)
+
+    #define MUTEX_INIT(MUTEX)    (pthread_mutex_init((MUTEX), NULL) == 0)
+    #define MUTEX_DESTROY(MUTEX) pthread_mutex_destroy(MUTEX)
+    #define MUTEX_LOCK(MUTEX)    pthread_mutex_lock(MUTEX)
+    #define MUTEX_UNLOCK(MUTEX)  pthread_mutex_unlock(MUTEX)
+
+    #define COND_INIT(COND)        (pthread_cond_init((COND), NULL) == 0)
+    #define COND_DESTROY(COND)     pthread_cond_destroy(COND)
+    #define COND_WAIT(COND, MUTEX) pthread_cond_wait((COND), (MUTEX))
+    #define COND_SIGNAL(COND)      pthread_cond_signal(COND)
+    #define COND_BROADCAST(COND)   pthread_cond_broadcast(COND)
+#endif
+
+#ifdef _MSC_VER
+    #define STREAM_CLOCK ULONGLONG
+    #define GET_CLOCK(CLOCK) CLOCK = GetTickCount64();
+    #define CLOCK_DELTA(C1, C2) ((int64_t)((C2) - (C1)) * 1000)
+#else
+    #define STREAM_CLOCK struct timespec
+    #define GET_CLOCK(CLOCK)                                   \
+        if (clock_gettime(CLOCK_MONOTONIC, &(CLOCK)) != 0) {   \
+            perror("*** error: getting monotonic time");       \
+            goto error;                                        \
+        }
+    #define CLOCK_DELTA(C1, C2) timedelta(&(C1), &(C2))
+
+int64_t timedelta(const struct timespec *t1, const struct timespec *t2) {
+    int64_t usec1 = (int64_t)t1->tv_sec * 1000000 + (int64_t)t1->tv_nsec / 1000;
+    int64_t usec2 = (int64_t)t2->tv_sec * 1000000 + (int64_t)t2->tv_nsec / 1000;
+    assert(usec2 >= usec1);
+
+    return usec2 - usec1;
+}
+#endif
+
+typedef struct Buffer {
+    char *data;
+    size_t size;
+    size_t capacity;
+} Buffer;
+
+#define BUFFER_INIT { .data = NULL, .size = 0, .capacity = 0 }
+
+typedef struct Batch {
+    size_t seq;
+    // line number of the first line of input
+    size_t lineno;
+    Buffer input;
+    // one line per record
+    Buffer output;
+    // error messages, written to stderr in input order as well
+    Buffer messages;
+    size_t records;
+    size_t errors;
+    bool done;
+} Batch;
+
+typedef struct Stream {
+    Mutex mutex;
+    // the reader waits for a free slot
+    Cond not_full;
+    // the workers wait for a batch
+    Cond not_empty;
+    // the writer waits for the next batch in order to be done
+    Cond ready;
+    const JsonLogic_Program *program;
+    FILE *output;
+    // slots[seq % slot_count] is the batch with sequence number seq
+    Batch **slots;
+    size_t slot_count;
+    // batches [write_seq, work_seq) are being processed or are done,
+    // batches [work_seq, read_seq) are waiting for a worker
+    size_t read_seq;
+    size_t work_seq;
+    size_t write_seq;
+    size_t records;
+    size_t errors;
+    bool eof;
+    bool failed;
+} Stream;
+
+typedef struct Reader {
+    FILE *file;
+    // start of a line that didn't fit into the last batch
+    Buffer rest;
+    size_t lineno;
+    bool eof;
+} Reader;
+
+void usage(int argc, char *argv[]) {
+    const char *progname = argc > 0 ? argv[0] : "jsonlogic-stream";
+    fprintf(stderr,
+        "usage: %s [options] <logic> [file]\n"
+        "\n"
+        "Applies logic to every line of NDJSON read from file or stdin and writes\n"
+        "one result per line to stdout. Empty lines are skipped. Records that can't\n"
+        "be parsed or evaluated produce null and an error message on stderr.\n"
+        "\n"
+        "OPTIONS:\n"
+        "    -j, --threads=COUNT  Number of worker threads. Default: number of CPUs.\n"
+        "    -x, --extras         Enable the extra operations.\n"
+        "    -q, --quiet          Don't print the records/s summary.\n"
+        "    -h, --help           Print this help message.\n",
+        progname);
+}
+
+bool parse_count(const char *str, size_t *countptr) {
+    char *endptr = NULL;
+    errno = 0;
+    const unsigned long long ull_count = strtoull(str, &endptr, 10);
+    if (!*str || *endptr || errno != 0 || (sizeof(unsigned long long) > sizeof(size_t) && ull_count > (unsigned long long)SIZE_MAX) || ull_count == 0) {
+        return false;
+    }
+    *countptr = (size_t) ull_count;
+    return true;
+}
+
+size_t cpu_count(void) {
+#if defined(JSONLOGIC_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+#endif
+}
+
+bool buffer_reserve(Buffer *buffer, size_t size) {
+    if (size > buffer->capacity - buffer->size) {
+        size_t capacity = buffer->capacity == 0 ? 256 : buffer->capacity;
+        while (size > capacity - buffer->size) {
+            if (capacity > SIZE_MAX / 2) {
+                return false;
+            }
+            capacity *= 2;
+        }
+        char *data = realloc(buffer->data, capacity);
+        if (data == NULL) {
+            return false;
+        }
+        buffer->data     = data;
+        buffer->capacity = capacity;
+    }
+    return true;
+}
+
+bool buffer_append(Buffer *buffer, const char *str, size_t size) {
+    if (!buffer_reserve(buffer, size)) {
+        return false;
+    }
+    memcpy(buffer->data + buffer->size, str, size);
+    buffer->size += size;
+    return true;
+}
+
+void batch_free(Batch *batch) {
+    if (batch != NULL) {
+        free(batch->input.data);
+        free(batch->output.data);
+        free(batch->messages.data);
+        free(batch);
+    }
+}
+
+// Reads the next batch of whole lines. Returns NULL at the end of the input
+// or on error, which is then reported on stderr and *errorptr is set.
+Batch *read_batch(Reader *reader, bool *errorptr) {
+    if (reader->eof && reader->rest.size == 0) {
+        return NULL;
+    }
+
+    Batch *batch = calloc(1, sizeof(Batch));
+    if (batch == NULL) {
+        perror("*** error: allocating batch");
+        *errorptr = true;
+        return NULL;
+    }
+
+    // the buffers are swapped, so the rest becomes the start of this batch
+    batch->input = reader->rest;
+    reader->rest = (Buffer)BUFFER_INIT;
+
+    size_t line_end = 0;
+    for (;;) {
+        if (!reader->eof && !buffer_reserve(&batch->input, BATCH_SIZE)) {
+            perror("*** error: allocating batch");
+            goto error;
+        }
+
+        while (!reader->eof && batch->input.size < batch->input.capacity) {
+            size_t count = fread(batch->input.data + batch->input.size, 1, batch->input.capacity - batch->input.size, reader->file);
+            batch->input.size += count;
+            if (count == 0) {
+                if (ferror(reader->file)) {
+                    perror("*** error: reading input");
+                    goto error;
+                }
+                reader->eof = true;
+            }
+        }
+
+        if (reader->eof) {
+            line_end = batch->input.size;
+            break;
+        }
+
+        line_end = batch->input.size;
+        while (line_end > 0 && batch->input.data[line_end - 1] != '\n') {
+            -- line_end;
+        }
+
+        if (line_end > 0) {
+            break;
+        }
+        // a single line is longer than the batch, read more of it
+    }
+
+    if (line_end < batch->input.size && !buffer_append(&reader->rest, batch->input.data + line_end, batch->input.size - line_end)) {
+        perror("*** error: allocating batch");
+        goto error;
+    }
+    batch->input.size = line_end;
+
+    if (batch->input.size == 0) {
+        batch_free(batch);
+        return NULL;
+    }
+
+    batch->lineno = reader->lineno;
+    const char *ptr = batch->input.data;
+    const char *end = ptr + batch->input.size;
+    while ((ptr = memchr(ptr, '\n', (size_t)(end - ptr))) != NULL) {
+        ++ reader->lineno;
+        ++ ptr;
+    }
+
+    return batch;
+
+error:
+    batch_free(batch);
+    *errorptr = true;
+    return NULL;
+}
+
+bool process_error(Batch *batch, size_t lineno, const char *message, JsonLogic_LineInfo info, bool parsing) {
+    char buf[256];
+    int count = parsing ?
+        snprintf(buf, sizeof(buf), "*** error: line %zu, column %zu: %s\n", lineno, info.column, message) :
+        snprintf(buf, sizeof(buf), "*** error: line %zu: %s\n", lineno, message);
+    if (count < 0) {
+        return false;
+    }
+    ++ batch->errors;
+    return
+        buffer_append(&batch->messages, buf, (size_t)count < sizeof(buf) ? (size_t)count : sizeof(buf) - 1) &&
+        buffer_append(&batch->output, "null\n", 5);
+}
+
+// Parses the lines of the batch and applies the program to each of them.
+// Only fails if out of memory.
+bool process_batch(const JsonLogic_Program *program, Batch *batch) {
+    const char *ptr = batch->input.data;
+    const char *end = ptr + batch->input.size;
+    size_t lineno = batch->lineno;
+
+    while (ptr < end) {
+        const char *newline = memchr(ptr, '\n', (size_t)(end - ptr));
+        const char *line_end = newline == NULL ? end : newline;
+        size_t size = (size_t)(line_end - ptr);
+        if (size > 0 && ptr[size - 1] == '\r') {
+            -- size;
+        }
+        ++ lineno;
+
+        if (size > 0) {
+            ++ batch->records;
+
+            JsonLogic_LineInfo info = JSONLOGIC_LINEINFO_INIT;
+            JsonLogic_Handle record = jsonlogic_parse_sized(ptr, size, &info);
+            JsonLogic_Error error = jsonlogic_get_error(record);
+            if (error == JSONLOGIC_ERROR_OUT_OF_MEMORY) {
+                return false;
+            } else if (error != JSONLOGIC_ERROR_SUCCESS) {
+                if (!process_error(batch, lineno, jsonlogic_get_error_message(error), info, true)) {
+                    return false;
+                }
+            } else {
+                JsonLogic_Handle result = jsonlogic_program_apply(program, record);
+                jsonlogic_decref(record);
+
+                error = jsonlogic_get_error(result);
+                if (error == JSONLOGIC_ERROR_OUT_OF_MEMORY) {
+                    return false;
+                } else if (error != JSONLOGIC_ERROR_SUCCESS) {
+                    if (!process_error(batch, lineno, jsonlogic_get_error_message(error), info, false)) {
+                        return false;
+                    }
+                } else {
+                    char *json = jsonlogic_stringify_utf8(result);
+                    jsonlogic_decref(result);
+                    if (json == NULL) {
+                        return false;
+                    }
+                    bool ok = buffer_append(&batch->output, json, strlen(json)) && buffer_append(&batch->output, "\n", 1);
+                    free(json);
+                    if (!ok) {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        ptr = line_end + 1;
+    }
+
+    // the input isn't needed anymore, free it before the batch waits for the writer
+    free(batch->input.data);
+    batch->input = (Buffer)BUFFER_INIT;
+
+    return true;
+}
+
+ThreadResult THREAD_CALL worker_main(void *arg) {
+    Stream *stream = arg;
+
+    MUTEX_LOCK(&stream->mutex);
+    for (;;) {
+        while (stream->work_seq == stream->read_seq && !stream->eof && !stream->failed) {
+            COND_WAIT(&stream->not_empty, &stream->mutex);
+        }
+
+        if (stream->work_seq == stream->read_seq || stream->failed) {
+            break;
+        }
+
+        Batch *batch = stream->slots[stream->work_seq % stream->slot_count];
+        ++ stream->work_seq;
+        MUTEX_UNLOCK(&stream->mutex);
+
+        bool ok = process_batch(stream->program, batch);
+
+        MUTEX_LOCK(&stream->mutex);
+        batch->done = true;
+        if (!ok) {
+            fprintf(stderr, "*** error: processing batch starting at line %zu: %s\n",
+                batch->lineno + 1, jsonlogic_get_error_message(JSONLOGIC_ERROR_OUT_OF_MEMORY));
+            stream->failed = true;
+            COND_BROADCAST(&stream->not_full);
+            COND_BROADCAST(&stream->not_empty);
+            COND_BROADCAST(&stream->ready);
+        } else if (batch->seq == stream->write_seq) {
+            COND_SIGNAL(&stream->ready);
+        }
+    }
+    MUTEX_UNLOCK(&stream->mutex);
+
+    return 0;
+}
+
+ThreadResult THREAD_CALL writer_main(void *arg) {
+    Stream *stream = arg;
+
+    MUTEX_LOCK(&stream->mutex);
+    for (;;) {
+        while (!stream->failed &&
+               !(stream->write_seq < stream->read_seq && stream->slots[stream->write_seq % stream->slot_count]->done) &&
+               !(stream->eof && stream->write_seq == stream->read_seq)) {
+            COND_WAIT(&stream->ready, &stream->mutex);
+        }
+
+        if (stream->failed || stream->write_seq == stream->read_seq) {
+            break;
+        }
+
+        Batch *batch = stream->slots[stream->write_seq % stream->slot_count];
+        MUTEX_UNLOCK(&stream->mutex);
+
+        if (batch->messages.size > 0) {
+            fwrite(batch->messages.data, 1, batch->messages.size, stderr);
+        }
+        bool ok = fwrite(batch->output.data, 1, batch->output.size, stream->output) == batch->output.size;
+        if (!ok) {
+            perror("*** error: writing output");
+        }
+
+        MUTEX_LOCK(&stream->mutex);
+        stream->records += batch->records;
+        stream->errors  += batch->errors;
+        stream->slots[stream->write_seq % stream->slot_count] = NULL;
+        ++ stream->write_seq;
+        batch_free(batch);
+        if (!ok) {
+            stream->failed = true;
+            COND_BROADCAST(&stream->not_empty);
+        }
+        COND_SIGNAL(&stream->not_full);
+    }
+    MUTEX_UNLOCK(&stream->mutex);
+
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    int status = 0;
+    size_t thread_count = 0;
+    bool extras = false;
+    bool quiet = false;
+    int argind = 1;
+
+    for (; argind < argc; ++ argind) {
+        const char *arg = argv[argind];
+        if (strcmp(arg, "-x") == 0 || strcmp(arg, "--extras") == 0) {
+            extras = true;
+        } else if (strcmp(arg, "-q") == 0 || strcmp(arg, "--quiet") == 0) {
+            quiet = true;
+        } else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            usage(argc, argv);
+            return 0;
+        } else if (strcmp(arg, "-j") == 0 || strcmp(arg, "--threads") == 0) {
+            if (argind + 1 >= argc) {
+                fprintf(stderr, "*** error: %s needs an argument\n", arg);
+                usage(argc, argv);
+                return 1;
+            }
+            const char *str_count = argv[++ argind];
+            if (!parse_count(str_count, &thread_count)) {
+                fprintf(stderr, "*** error: parsing thread count '%s'\n", str_count);
+                usage(argc, argv);
+                return 1;
+            }
+        } else if (strncmp(arg, "--threads=", 10) == 0 || (strncmp(arg, "-j", 2) == 0 && arg[2])) {
+            const char *str_count = arg[1] == 'j' ? arg + 2 : arg + 10;
+            if (!parse_count(str_count, &thread_count)) {
+                fprintf(stderr, "*** error: parsing thread count '%s'\n", str_count);
+                usage(argc, argv);
+                return 1;
+            }
+        } else if (strcmp(arg, "--") == 0) {
+            ++ argind;
+            break;
+        } else if (arg[0] == '-' && arg[1] != 0) {
+            fprintf(stderr, "*** error: illegal option: %s\n", arg);
+            usage(argc, argv);
+            return 1;
+        } else {
+            break;
+        }
+    }
+
+    if (argc - argind < 1 || argc - argind > 2) {
+        usage(argc, argv);
+        return 1;
+    }
+
+    if (thread_count == 0) {
+        thread_count = cpu_count();
+    }
+
+    const char *str_logic = argv[argind];
+    const char *filename  = argind + 1 < argc ? argv[argind + 1] : "-";
+
+    JsonLogic_Program *program = NULL;
+    Thread *workers = NULL;
+    Thread writer;
+    size_t started = 0;
+    bool writer_started = false;
+    bool sync_init = false;
+    Reader reader = {
+        .file   = NULL,
+        .rest   = BUFFER_INIT,
+        .lineno = 0,
+        .eof    = false,
+    };
+    Stream stream = {
+        .program    = NULL,
+        .output     = stdout,
+        .slots      = NULL,
+        .slot_count = thread_count * BATCHES_PER_THREAD,
+        .read_seq   = 0,
+        .work_seq   = 0,
+        .write_seq  = 0,
+        .records    = 0,
+        .errors     = 0,
+        .eof        = false,
+        .failed     = false,
+    };
+
+    JsonLogic_LineInfo info = JSONLOGIC_LINEINFO_INIT;
+    JsonLogic_Handle logic = jsonlogic_parse(str_logic, &info);
+    JsonLogic_Error error = jsonlogic_get_error(logic);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        jsonlogic_print_parse_error(stderr, str_logic, error, info);
+        return 1;
+    }
+
+    // frozen values can be shared between threads without atomic refcounts
+    jsonlogic_freeze(logic);
+
+    program = jsonlogic_compile(logic, extras ? &JsonLogic_Extras : &JsonLogic_Builtins);
+    if (program == NULL) {
+        fprintf(stderr, "*** error: compiling logic: %s\n", jsonlogic_get_error_message(JSONLOGIC_ERROR_OUT_OF_MEMORY));
+        goto error;
+    }
+    stream.program = program;
+
+    if (strcmp(filename, "-") == 0) {
+        reader.file = stdin;
+    } else {
+        reader.file = fopen(filename, "rb");
+        if (reader.file == NULL) {
+            fprintf(stderr, "*** error: opening %s: %s\n", filename, strerror(errno));
+            goto error;
+        }
+    }
+
+    stream.slots = calloc(stream.slot_count, sizeof(Batch*));
+    workers = calloc(thread_count, sizeof(Thread));
+    if (stream.slots == NULL || workers == NULL) {
+        perror("*** error: allocating memory");
+        goto error;
+    }
+
+    if (!MUTEX_INIT(&stream.mutex)) {
+        perror("*** error: initializing mutex");
+        goto error;
+    }
+
+    if (!COND_INIT(&stream.not_full) || !COND_INIT(&stream.not_empty) || !COND_INIT(&stream.ready)) {
+        // not bothering with cleaning up the conditions that might have been initialized
+        perror("*** error: initializing condition");
+        MUTEX_DESTROY(&stream.mutex);
+        goto error;
+    }
+    sync_init = true;
+
+    STREAM_CLOCK start;
+    STREAM_CLOCK done;
+
+    GET_CLOCK(start);
+
+    for (; started < thread_count; ++ started) {
+        if (!THREAD_START(&workers[started], worker_main, &stream)) {
+            perror("*** error: starting worker thread");
+            goto error;
+        }
+    }
+
+    if (!THREAD_START(&writer, writer_main, &stream)) {
+        perror("*** error: starting writer thread");
+        goto error;
+    }
+    writer_started = true;
+
+    for (;;) {
+        bool read_error = false;
+        Batch *batch = read_batch(&reader, &read_error);
+        if (batch == NULL) {
+            if (read_error) {
+                status = 1;
+            }
+            break;
+        }
+
+        MUTEX_LOCK(&stream.mutex);
+        while (stream.read_seq - stream.write_seq >= stream.slot_count && !stream.failed) {
+            COND_WAIT(&stream.not_full, &stream.mutex);
+        }
+
+        if (stream.failed) {
+            MUTEX_UNLOCK(&stream.mutex);
+            batch_free(batch);
+            break;
+        }
+
+        batch->seq = stream.read_seq;
+        stream.slots[stream.read_seq % stream.slot_count] = batch;
+        ++ stream.read_seq;
+        COND_SIGNAL(&stream.not_empty);
+        MUTEX_UNLOCK(&stream.mutex);
+    }
+
+    MUTEX_LOCK(&stream.mutex);
+    stream.eof = true;
+    COND_BROADCAST(&stream.not_empty);
+    COND_BROADCAST(&stream.ready);
+    MUTEX_UNLOCK(&stream.mutex);
+
+    for (; started > 0; -- started) {
+        THREAD_JOIN(workers[started - 1]);
+    }
+    THREAD_JOIN(writer);
+    writer_started = false;
+
+    if (fflush(stream.output) != 0) {
+        perror("*** error: writing output");
+        stream.failed = true;
+    }
+
+    GET_CLOCK(done);
+
+    if (stream.failed) {
+        goto error;
+    }
+
+    if (!quiet) {
+        int64_t usec = CLOCK_DELTA(start, done);
+        fprintf(stderr, "%zu records, %zu errors, %zu threads, %.3f s, %.0f records/s\n",
+            stream.records, stream.errors, thread_count,
+            (double)usec / 1000000.0,
+            usec > 0 ? (double)stream.records * 1000000.0 / (double)usec : 0.0);
+    }
+
+    if (stream.errors > 0) {
+        status = 1;
+    }
+
+    goto cleanup;
+
+error:
+    status = 1;
+
+    if (sync_init) {
+        MUTEX_LOCK(&stream.mutex);
+        stream.failed = true;
+        stream.eof = true;
+        COND_BROADCAST(&stream.not_full);
+        COND_BROADCAST(&stream.not_empty);
+        COND_BROADCAST(&stream.ready);
+        MUTEX_UNLOCK(&stream.mutex);
+    }
+
+    for (; started > 0; -- started) {
+        THREAD_JOIN(workers[started - 1]);
+    }
+
+    if (writer_started) {
+        THREAD_JOIN(writer);
+    }
+
+cleanup:
+    if (sync_init) {
+        COND_DESTROY(&stream.ready);
+        COND_DESTROY(&stream.not_empty);
+        COND_DESTROY(&stream.not_full);
+        MUTEX_DESTROY(&stream.mutex);
+    }
+
+    if (stream.slots != NULL) {
+        for (size_t seq = stream.write_seq; seq < stream.read_seq; ++ seq) {
+            batch_free(stream.slots[seq % stream.slot_count]);
+        }
+        free(stream.slots);
+    }
+
+    if (reader.file != NULL && reader.file != stdin) {
+        fclose(reader.file);
+    }
+    free(reader.rest.data);
+    free(workers);
+
+    jsonlogic_program_free(program);
+    jsonlogic_decref(jsonlogic_thaw(logic));
+
+    return status;
+}
@@ -1,37 +1,342 @@
 #include "jsonlogic_intern.h"
 
-JsonLogic_Handle jsonlogic_apply_custom(
-        JsonLogic_Handle logic,
-        JsonLogic_Handle input,
-        const JsonLogic_Operations *operations) {
-    JsonLogic_Handle result = JsonLogic_Null;
+#include <stdlib.h>
+#include <string.h>
 
-    if (JSONLOGIC_IS_ARRAY(logic)) {
-        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
-        JsonLogic_Array *new_array = jsonlogic_array_with_capacity(array->size);
-        if (new_array == NULL) {
+// Logic is evaluated without recursion in C. Every operation, array and
+// lambda application in progress is a frame on a frame stack and all
+// intermediate values live on one contiguous value stack. The arguments of an
+// operation are evaluated onto the value stack and passed to it as a slice
+// of that stack.
+
+#define JSONLOGIC_APPLY_STATIC_FRAMES 32
+#define JSONLOGIC_APPLY_STATIC_VALUES 64
+
+// Lambdas of reduce that only read the reduce context through var with a
+// constant key run with this as their data. These vars are resolved directly
+// from the reduce frame, so no context object is needed.
+#define JSONLOGIC_REDUCE_SCOPE JSONLOGIC_SLOT_UNSET
+
+// Upper limit of pending nodes when checking if a lambda only depends on its
+// item. More complex lambdas are neither fused nor evaluated in parallel.
+#define JSONLOGIC_PURE_LAMBDA_CHECK 64
+
+// Maximum number of filter and map operations that are fused into the lambda
+// operation that consumes their result. Deeper chains build arrays again.
+#define JSONLOGIC_APPLY_STAGES 4
+
+typedef enum JsonLogic_ApplyKind {
+    JsonLogic_Apply_Array = 0,
+    JsonLogic_Apply_Call,
+    JsonLogic_Apply_If,
+    JsonLogic_Apply_And,
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+    JsonLogic_Apply_Or,
+    JsonLogic_Apply_Filter,
+    JsonLogic_Apply_Map,
+    JsonLogic_Apply_All,
+    JsonLogic_Apply_Some,
+    JsonLogic_Apply_None,
+    // in with a filter or map pipeline as the second argument
+    JsonLogic_Apply_In,
+#endif
+    JsonLogic_Apply_Reduce,
+} JsonLogic_ApplyKind;
+
+typedef struct JsonLogic_ApplyFrame {
+    JsonLogic_ApplyKind kind;
+    // the value of a child that was entered is on top of the value stack
+    bool pending;
+    // the items of a lambda operation are evaluated
+    bool iterating;
+    const JsonLogic_Handle *values;
+    size_t value_count;
+    size_t index;
+    JsonLogic_Handle data;
+    // Array and Call: index of the first argument on the value stack
+    size_t base;
+    const JsonLogic_Operation *operation;
+    // lambda operations
+    JsonLogic_Handle lambda;
+    JsonLogic_Handle items;
+    JsonLogic_Array *result;
+    size_t result_size;
+    JsonLogic_Handle accumulator;
+    JsonLogic_Handle reduce_context;
+    size_t accumulator_index;
+    size_t current_index;
+    // reduce with JSONLOGIC_REDUCE_SCOPE instead of reduce_context
+    bool scoped;
+    size_t outer_scope;
+    // The element that is passed through the stages or JSONLOGIC_SLOT_UNSET.
+    // Elements are streamed from items through the lambdas of the fused
+    // filter and map operations (innermost first) to the lambda of the frame.
+    JsonLogic_Handle item;
+    size_t stage;
+    size_t stage_count;
+    // bit set: map, otherwise filter
+    unsigned int stage_maps;
+    // in: the needle was evaluated and the source of the items entered
+    bool sourced;
+    JsonLogic_Handle stages[JSONLOGIC_APPLY_STAGES];
+} JsonLogic_ApplyFrame;
+
+typedef struct JsonLogic_ApplyState {
+    const JsonLogic_Operations *operations;
+    size_t max_depth;
+    // JSONLOGIC_ERROR_SUCCESS or the error that aborts the evaluation
+    JsonLogic_Handle error;
+    // index of the reduce frame JSONLOGIC_REDUCE_SCOPE refers to
+    size_t scope;
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+    // evaluates large lambda operations in parallel if not NULL
+    JsonLogic_ThreadPool *pool;
+#endif
+    // remembers the results of pure, expensive operations if not NULL
+    JsonLogic_Memo *memo;
+    size_t frame_count;
+    size_t frame_capacity;
+    JsonLogic_ApplyFrame *frames;
+    size_t value_count;
+    size_t value_capacity;
+    JsonLogic_Handle *values;
+    JsonLogic_ApplyFrame *framebuf;
+    JsonLogic_Handle *valuebuf;
+} JsonLogic_ApplyState;
+
+static void jsonlogic_apply_push(JsonLogic_ApplyState *state, JsonLogic_Handle value) {
+    if (state->value_count == state->value_capacity) {
+        size_t new_capacity = state->value_capacity * 2;
+        JsonLogic_Handle *new_values;
+        if (state->values == state->valuebuf) {
+            new_values = malloc(sizeof(JsonLogic_Handle) * new_capacity);
+            if (new_values != NULL) {
+                memcpy(new_values, state->values, sizeof(JsonLogic_Handle) * state->value_count);
+            }
+        } else {
+            new_values = realloc(state->values, sizeof(JsonLogic_Handle) * new_capacity);
+        }
+        if (new_values == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            jsonlogic_decref(value);
+            state->error = JsonLogic_Error_OutOfMemory;
+            return;
+        }
+        state->values         = new_values;
+        state->value_capacity = new_capacity;
+    }
+    state->values[state->value_count ++] = value;
+}
+
+static inline JsonLogic_Handle jsonlogic_apply_pop(JsonLogic_ApplyState *state) {
+    assert(state->value_count > 0);
+    return state->values[-- state->value_count];
+}
+
+static JsonLogic_ApplyFrame *jsonlogic_apply_push_frame(JsonLogic_ApplyState *state, JsonLogic_ApplyKind kind, const JsonLogic_Handle *values, size_t value_count, JsonLogic_Handle data) {
+    if (state->frame_count >= state->max_depth) {
+        state->error = JsonLogic_Error_RecursionError;
+        return NULL;
+    }
+
+    if (state->frame_count == state->frame_capacity) {
+        size_t new_capacity = state->frame_capacity * 2;
+        JsonLogic_ApplyFrame *new_frames;
+        if (state->frames == state->framebuf) {
+            new_frames = malloc(sizeof(JsonLogic_ApplyFrame) * new_capacity);
+            if (new_frames != NULL) {
+                memcpy(new_frames, state->frames, sizeof(JsonLogic_ApplyFrame) * state->frame_count);
+            }
+        } else {
+            new_frames = realloc(state->frames, sizeof(JsonLogic_ApplyFrame) * new_capacity);
+        }
+        if (new_frames == NULL) {
             JSONLOGIC_ERROR_MEMORY();
-            return JsonLogic_Error_OutOfMemory;
+            state->error = JsonLogic_Error_OutOfMemory;
+            return NULL;
+        }
+        state->frames         = new_frames;
+        state->frame_capacity = new_capacity;
+    }
+
+    JsonLogic_ApplyFrame *frame = &state->frames[state->frame_count ++];
+    *frame = (JsonLogic_ApplyFrame){
+        .kind           = kind,
+        .pending        = false,
+        .iterating      = false,
+        .values         = values,
+        .value_count    = value_count,
+        .index          = 0,
+        .data           = data,
+        .base           = state->value_count,
+        .operation      = NULL,
+        .lambda         = JsonLogic_Null,
+        .items          = JsonLogic_Null,
+        .result         = NULL,
+        .result_size    = 0,
+        .accumulator    = JsonLogic_Null,
+        .reduce_context = JsonLogic_Null,
+        .scoped         = false,
+        .outer_scope    = SIZE_MAX,
+        .item           = JSONLOGIC_SLOT_UNSET,
+        .stage          = 0,
+        .stage_count    = 0,
+        .stage_maps     = 0,
+        .sourced        = false,
+    };
+
+    return frame;
+}
+
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+// Checks if lambda only consists of the special forms and deterministic
+// operations without side effects, so its value only depends on the item.
+// Such lambdas may be evaluated on other threads or interleaved with other
+// lambdas.
+static bool jsonlogic_apply_is_pure_lambda(const JsonLogic_ApplyState *state, JsonLogic_Handle lambda) {
+    JsonLogic_Handle pending[JSONLOGIC_PURE_LAMBDA_CHECK];
+    size_t pending_count = 0;
+
+    pending[pending_count ++] = lambda;
+
+    while (pending_count > 0) {
+        JsonLogic_Handle logic = pending[-- pending_count];
+        const JsonLogic_Handle *values;
+        size_t value_count;
+
+        if (JSONLOGIC_IS_ARRAY(logic)) {
+            const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+            values      = array->items;
+            value_count = array->size;
+        } else if (jsonlogic_is_literal(logic) || !JSONLOGIC_IS_OBJECT(logic)) {
+            continue;
+        } else {
+            const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+            const JsonLogic_Object_Entry *entry = NULL;
+            for (size_t index = object->first_index; index < object->size; ++ index) {
+                if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+                    entry = &object->entries[index];
+                    break;
+                }
+            }
+            assert(entry != NULL);
+
+            if (JSONLOGIC_IS_ARRAY(entry->value)) {
+                const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(entry->value);
+                value_count = array->size;
+                values      = array->items;
+            } else {
+                value_count = 1;
+                values      = &entry->value;
+            }
+
+            JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(entry->key);
+
+            if (!JSONLOGIC_IS_OP(opstr, IF) && !JSONLOGIC_IS_OP(opstr, ALT_IF) &&
+                !JSONLOGIC_IS_OP(opstr, AND) && !JSONLOGIC_IS_OP(opstr, OR) &&
+                !JSONLOGIC_IS_OP(opstr, FILTER) && !JSONLOGIC_IS_OP(opstr, MAP) && !JSONLOGIC_IS_OP(opstr, REDUCE) &&
+                !JSONLOGIC_IS_OP(opstr, ALL) && !JSONLOGIC_IS_OP(opstr, SOME) && !JSONLOGIC_IS_OP(opstr, NONE)) {
+                if (opstr->hash == JSONLOGIC_HASH_UNSET) {
+                    opstr->hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+                }
+
+                const JsonLogic_Operation *opptr = jsonlogic_operations_get_with_hash(
+                    state->operations, opstr->hash, opstr->str, opstr->size);
+
+                if (opptr != NULL && !jsonlogic_operation_has_flags(opptr,
+                        JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC)) {
+                    return false;
+                }
+            }
         }
-        for (size_t index = 0; index < array->size; ++ index) {
-            new_array->items[index] = jsonlogic_apply_custom(
-                array->items[index],
-                input,
-                operations);
+
+        if (value_count > JSONLOGIC_PURE_LAMBDA_CHECK - pending_count) {
+            return false;
         }
-        return jsonlogic_array_into_handle(new_array);
+
+        for (size_t index = 0; index < value_count; ++ index) {
+            pending[pending_count ++] = values[index];
+        }
+    }
+
+    return true;
+}
+
+// Gets the items and lambda of {"filter":[items, lambda]} or
+// {"map":[items, lambda]} if it can be fused into the operation that consumes
+// its result.
+static bool jsonlogic_apply_get_stage(const JsonLogic_ApplyState *state, JsonLogic_Handle logic, bool *mapptr, JsonLogic_Handle *itemsptr, JsonLogic_Handle *lambdaptr) {
+    if (!JSONLOGIC_IS_OBJECT(logic)) {
+        return false;
+    }
+
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+    if (object->used != 1) {
+        return false;
+    }
+
+    const JsonLogic_Object_Entry *entry = NULL;
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+            entry = &object->entries[index];
+            break;
+        }
+    }
+    assert(entry != NULL);
+
+    if (!JSONLOGIC_IS_STRING(entry->key) || !JSONLOGIC_IS_ARRAY(entry->value)) {
+        return false;
+    }
+
+    const JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(entry->key);
+    const JsonLogic_Array *args = JSONLOGIC_CAST_ARRAY(entry->value);
+
+    bool map;
+    if (JSONLOGIC_IS_OP(opstr, MAP)) {
+        map = true;
+    } else if (JSONLOGIC_IS_OP(opstr, FILTER)) {
+        map = false;
+    } else {
+        return false;
+    }
+
+    // filter without a truthy lambda and map without a lambda are left alone
+    if (args->size != 2 || (!map && !jsonlogic_to_bool(args->items[1]))) {
+        return false;
+    }
+
+    if (!jsonlogic_apply_is_pure_lambda(state, args->items[1])) {
+        return false;
+    }
+
+    *mapptr    = map;
+    *itemsptr  = args->items[0];
+    *lambdaptr = args->items[1];
+    return true;
+}
+#endif
+
+static void jsonlogic_apply_lazy(JsonLogic_ApplyState *state, const JsonLogic_Operation *opptr, const JsonLogic_Handle *values, size_t value_count, JsonLogic_Handle input);
+
+// Starts the evaluation of logic. It either pushes the value of logic onto
+// the value stack right away or a frame that eventually does.
+static void jsonlogic_apply_enter(JsonLogic_ApplyState *state, JsonLogic_Handle logic, JsonLogic_Handle input) {
+    if (JSONLOGIC_IS_ARRAY(logic)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+        jsonlogic_apply_push_frame(state, JsonLogic_Apply_Array, array->items, array->size, input);
+        return;
     }
 
     if (!JSONLOGIC_IS_OBJECT(logic)) {
-        jsonlogic_incref(logic);
-        return logic;
+        jsonlogic_apply_push(state, jsonlogic_incref(logic));
+        return;
     }
 
     const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
 
     if (object->used != 1) {
-        jsonlogic_incref(logic);
-        return logic;
+        jsonlogic_apply_push(state, jsonlogic_incref(logic));
+        return;
     }
 
     const JsonLogic_Object_Entry *entry = NULL;
@@ -43,468 +348,896 @@ JsonLogic_Handle jsonlogic_apply_custom(
     }
     assert(entry != NULL);
 
-    JsonLogic_Handle op    = entry->key;
-    JsonLogic_Handle oparg = entry->value;
+    JsonLogic_Handle op = entry->key;
 
     if (!JSONLOGIC_IS_STRING(op)) {
-        jsonlogic_incref(logic);
-        return logic;
+        jsonlogic_apply_push(state, jsonlogic_incref(logic));
+        return;
     }
 
     size_t value_count;
-    JsonLogic_Handle *values;
+    const JsonLogic_Handle *values;
 
-    if (JSONLOGIC_IS_ARRAY(oparg)) {
-        JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(oparg);
+    if (JSONLOGIC_IS_ARRAY(entry->value)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(entry->value);
         value_count = array->size;
         values      = array->items;
     } else {
         value_count = 1;
-        values      = &oparg;
+        values      = &entry->value;
     }
 
     JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(op);
+    JsonLogic_ApplyKind kind;
 
 #ifdef JSONLOGIC_COMPILE_CERTLOGIC
     if (JSONLOGIC_IS_OP(opstr, IF)) {
-        if (value_count == 0) {
-            return JsonLogic_Null;
-        }
-
-        JsonLogic_Handle value = jsonlogic_apply_custom(
-            values[0],
-            input,
-            operations);
-        bool condition = jsonlogic_to_bool(value);
-        jsonlogic_decref(value);
-        if (condition) {
-            if (value_count < 2) {
-                return JsonLogic_Null;
-            }
-
-            return jsonlogic_apply_custom(
-                values[1],
-                input,
-                operations);
-        } else {
-            if (value_count < 3) {
-                return JsonLogic_Null;
-            }
-
-            return jsonlogic_apply_custom(
-                values[2],
-                input,
-                operations);
-        }
 #else
     if (JSONLOGIC_IS_OP(opstr, IF) || JSONLOGIC_IS_OP(opstr, ALT_IF)) {
+#endif
         if (value_count == 0) {
-            return JsonLogic_Null;
-        }
-        size_t index = 0;
-        while (index < value_count - 1) {
-            JsonLogic_Handle value = jsonlogic_apply_custom(
-                values[index],
-                input,
-                operations);
-            bool condition = jsonlogic_to_bool(value);
-            jsonlogic_decref(value);
-            if (condition) {
-                return jsonlogic_apply_custom(
-                    values[index + 1],
-                    input,
-                    operations);
-            }
-            index += 2;
+            jsonlogic_apply_push(state, JsonLogic_Null);
+            return;
         }
-        if (index < value_count) {
-            return jsonlogic_apply_custom(
-                values[index],
-                input,
-                operations);
-        }
-        return JsonLogic_Null;
-#endif
+        kind = JsonLogic_Apply_If;
     } else if (JSONLOGIC_IS_OP(opstr, AND)) {
         if (value_count == 0) {
-            return JsonLogic_Null;
-        }
-        for (size_t index = 0; index < value_count - 1; ++ index) {
-            JsonLogic_Handle value = jsonlogic_apply_custom(
-                values[index],
-                input,
-                operations);
-            if (!jsonlogic_to_bool(value)) {
-                return value;
-            }
-            jsonlogic_decref(value);
+            jsonlogic_apply_push(state, JsonLogic_Null);
+            return;
         }
-        return jsonlogic_apply_custom(
-            values[value_count - 1],
-            input,
-            operations);
+        kind = JsonLogic_Apply_And;
 #ifndef JSONLOGIC_COMPILE_CERTLOGIC
     } else if (JSONLOGIC_IS_OP(opstr, OR)) {
         if (value_count == 0) {
-            return JsonLogic_Null;
+            jsonlogic_apply_push(state, JsonLogic_Null);
+            return;
         }
-        for (size_t index = 0; index < value_count - 1; ++ index) {
-            JsonLogic_Handle value = jsonlogic_apply_custom(
-                values[index],
-                input,
-                operations);
-            if (jsonlogic_to_bool(value)) {
-                return value;
-            }
-            jsonlogic_decref(value);
-        }
-        return jsonlogic_apply_custom(
-            values[value_count - 1],
-            input,
-            operations);
+        kind = JsonLogic_Apply_Or;
     } else if (JSONLOGIC_IS_OP(opstr, FILTER)) {
         if (value_count == 0) {
-            return jsonlogic_empty_array();
-        }
-        JsonLogic_Handle items = jsonlogic_apply_custom(
-            values[0],
-            input,
-            operations);
-        if (JSONLOGIC_IS_ERROR(items)) {
-            return items;
-        }
-        if (!JSONLOGIC_IS_ARRAY(items) || value_count < 2 || !jsonlogic_to_bool(values[1])) {
-            jsonlogic_decref(items);
-            return jsonlogic_empty_array();
-        }
-        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
-        JsonLogic_Array *filtered = jsonlogic_array_with_capacity(array->size);
-        if (filtered == NULL) {
-            jsonlogic_decref(items);
-            JSONLOGIC_ERROR_MEMORY();
-            return JsonLogic_Error_OutOfMemory;
+            jsonlogic_apply_push(state, jsonlogic_empty_array());
+            return;
         }
-
-        JsonLogic_Handle lambda = values[1];
-
-        size_t filtered_index = 0;
-        for (size_t index = 0; index < array->size; ++ index) {
-            JsonLogic_Handle item = array->items[index];
-            JsonLogic_Handle condition = jsonlogic_apply_custom(
-                lambda,
-                item,
-                operations);
-            if (jsonlogic_to_bool(condition)) {
-                jsonlogic_incref(item);
-                filtered->items[filtered_index ++] = item;
-            }
-            jsonlogic_decref(condition);
-        }
-
-        jsonlogic_decref(items);
-        filtered = jsonlogic_array_truncate(filtered, filtered_index);
-        return jsonlogic_array_into_handle(filtered);
+        kind = JsonLogic_Apply_Filter;
     } else if (JSONLOGIC_IS_OP(opstr, MAP)) {
         if (value_count == 0) {
-            return jsonlogic_empty_array();
-        }
-        JsonLogic_Handle items = jsonlogic_apply_custom(
-            values[0],
-            input,
-            operations);
-        if (JSONLOGIC_IS_ERROR(items)) {
-            return items;
-        }
-        if (!JSONLOGIC_IS_ARRAY(items)) {
-            jsonlogic_decref(items);
-            return jsonlogic_empty_array();
-        }
-        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
-        JsonLogic_Array *mapped = jsonlogic_array_with_capacity(array->size);
-        if (mapped == NULL) {
-            jsonlogic_decref(items);
-            JSONLOGIC_ERROR_MEMORY();
-            return JsonLogic_Error_OutOfMemory;
+            jsonlogic_apply_push(state, jsonlogic_empty_array());
+            return;
         }
-
-        JsonLogic_Handle lambda = value_count < 2 ? JsonLogic_Null : values[1];
-
-        for (size_t index = 0; index < array->size; ++ index) {
-            JsonLogic_Handle item = array->items[index];
-            JsonLogic_Handle value = jsonlogic_apply_custom(
-                lambda,
-                item,
-                operations);
-            mapped->items[index] = value;
+        kind = JsonLogic_Apply_Map;
+    } else if (JSONLOGIC_IS_OP(opstr, ALL)) {
+        // to be sane and logical it should return true on empty array,
+        // but JsonLogic is not logical here:
+        // https://github.com/jwadhams/json-logic-js/blob/c1dd82f5b15d8a553bb7a0cfa841ab8a11a9c227/logic.js#L318
+        if (value_count == 0) {
+            jsonlogic_apply_push(state, JsonLogic_False);
+            return;
         }
-
-        jsonlogic_decref(items);
-        return jsonlogic_array_into_handle(mapped);
+        kind = JsonLogic_Apply_All;
+    } else if (JSONLOGIC_IS_OP(opstr, SOME)) {
+        if (value_count == 0) {
+            jsonlogic_apply_push(state, JsonLogic_False);
+            return;
+        }
+        kind = JsonLogic_Apply_Some;
+    } else if (JSONLOGIC_IS_OP(opstr, NONE)) {
+        if (value_count == 0) {
+            jsonlogic_apply_push(state, JsonLogic_True);
+            return;
+        }
+        kind = JsonLogic_Apply_None;
 #endif
     } else if (JSONLOGIC_IS_OP(opstr, REDUCE)) {
         if (value_count == 0) {
-            return JsonLogic_Null;
-        }
-        JsonLogic_Handle lambda = JsonLogic_Null;
-        JsonLogic_Handle init   = JsonLogic_Null;
-        if (value_count > 1) {
-            lambda = values[1];
-            if (value_count > 2) {
-                init = values[2];
-            }
+            jsonlogic_apply_push(state, JsonLogic_Null);
+            return;
+        }
+        kind = JsonLogic_Apply_Reduce;
+    } else {
+        if (opstr->hash == JSONLOGIC_HASH_UNSET) {
+            opstr->hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
         }
 
-        JsonLogic_Handle items = jsonlogic_apply_custom(
-            values[0],
-            input,
-            operations);
-        if (JSONLOGIC_IS_ERROR(items)) {
-            return items;
+        const JsonLogic_Operation *opptr = jsonlogic_operations_get_with_hash(
+            state->operations, opstr->hash, opstr->str, opstr->size);
+
+        if (opptr == NULL) {
+            // JSONLOGIC_DEBUG_UTF16("%s", opstr->str, opstr->size, "illegal operation");
+            // jsonlogic_operations_debug(operations);
+            jsonlogic_apply_push(state, JsonLogic_Error_IllegalOperation);
+            return;
         }
 
-        if (!JSONLOGIC_IS_ARRAY(items)) {
-            jsonlogic_incref(init);
-            jsonlogic_decref(items);
-            return init;
+        if (opptr->lazy_funct != NULL) {
+            jsonlogic_apply_lazy(state, opptr, values, value_count, input);
+            return;
+        }
+
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+        // max and min aren't consumers: they convert an array operand to a
+        // number like any other operand instead of looking at its elements
+        bool map;
+        JsonLogic_Handle items;
+        JsonLogic_Handle lambda;
+        if (opptr->funct == jsonlogic_op_IN && value_count == 2 &&
+            jsonlogic_apply_get_stage(state, values[1], &map, &items, &lambda)) {
+            // the needle is searched for while the pipeline produces elements
+            jsonlogic_apply_push_frame(state, JsonLogic_Apply_In, values, value_count, input);
+            return;
         }
-        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
-        JsonLogic_Handle str_accumulator = jsonlogic_string_from_utf16_sized(JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);
-        JsonLogic_Handle str_current     = jsonlogic_string_from_utf16_sized(JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);
-#ifdef JSONLOGIC_COMPILE_CERTLOGIC
-        JsonLogic_Handle str_data        = jsonlogic_string_from_utf16_sized(JSONLOGIC_DATA, JSONLOGIC_DATA_SIZE);
-        JsonLogic_Handle reduce_context  = jsonlogic_object_build(
-            { .key = str_accumulator, .value = JsonLogic_Null },
-            { .key = str_current,     .value = JsonLogic_Null },
-            { .key = str_data,        .value = input          },
-        );
-#else
-        JsonLogic_Handle reduce_context  = jsonlogic_object_build(
-            { .key = str_accumulator, .value = JsonLogic_Null },
-            { .key = str_current,     .value = JsonLogic_Null },
-        );
-#endif
-        jsonlogic_decref(str_accumulator);
-        jsonlogic_decref(str_current);
-#ifdef JSONLOGIC_COMPILE_CERTLOGIC
-        jsonlogic_decref(str_data);
 #endif
-        if (JSONLOGIC_IS_ERROR(reduce_context)) {
-            jsonlogic_decref(items);
-            return reduce_context;
+
+        JsonLogic_ApplyFrame *frame = jsonlogic_apply_push_frame(state, JsonLogic_Apply_Call, values, value_count, input);
+        if (frame != NULL) {
+            frame->operation = opptr;
         }
-        JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(reduce_context);
-        JsonLogic_Handle accumulator = jsonlogic_incref(init);
+        return;
+    }
 
-        size_t accumulator_index = jsonlogic_object_get_index_utf16_with_hash(
-            reduce_context_object,
-            JSONLOGIC_ACCUMULATOR_HASH,
-            JSONLOGIC_ACCUMULATOR,
-            JSONLOGIC_ACCUMULATOR_SIZE);
-        assert(accumulator_index < reduce_context_object->size);
+    jsonlogic_apply_push_frame(state, kind, values, value_count, input);
+}
 
-        size_t current_index = jsonlogic_object_get_index_utf16_with_hash(
-            reduce_context_object,
-            JSONLOGIC_CURRENT_HASH,
-            JSONLOGIC_CURRENT,
-            JSONLOGIC_CURRENT_SIZE);
-        assert(current_index < reduce_context_object->size);
+// {"var":key} or {"var":[key, default]} with JSONLOGIC_REDUCE_SCOPE as data.
+static JsonLogic_Handle jsonlogic_apply_scope_var(const JsonLogic_ApplyState *state, JsonLogic_Handle args[], size_t argc) {
+    assert(state->scope < state->frame_count);
+    const JsonLogic_ApplyFrame *frame = &state->frames[state->scope];
+    JsonLogic_Handle default_value = argc > 1 ? args[1] : JsonLogic_Null;
 
-        for (size_t index = 0; index < array->size; ++ index) {
-            reduce_context_object->entries[accumulator_index].value = accumulator;
-            reduce_context_object->entries[current_index].value     = array->items[index];
+    // ensured by jsonlogic_reduce_is_scoped()
+    assert(argc > 0 && JSONLOGIC_IS_STRING(args[0]));
+    const JsonLogic_String *key = JSONLOGIC_CAST_STRING(args[0]);
 
-            JsonLogic_Handle new_accumulator = jsonlogic_apply_custom(
-                lambda,
-                reduce_context,
-                operations);
+    const char16_t *end = key->str + key->size;
+    const char16_t *next = jsonlogic_find_char(key->str, key->size, u'.');
+    if (next == NULL) {
+        next = end;
+    }
+    const size_t size = next - key->str;
 
-            jsonlogic_decref(accumulator);
-            accumulator = new_accumulator;
+    JsonLogic_Handle value;
+    if (jsonlogic_utf16_equals(key->str, size, JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE)) {
+        value = frame->accumulator;
+    } else if (jsonlogic_utf16_equals(key->str, size, JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE)) {
+        value = frame->item;
+#ifdef JSONLOGIC_COMPILE_CERTLOGIC
+    } else if (jsonlogic_utf16_equals(key->str, size, JSONLOGIC_DATA, JSONLOGIC_DATA_SIZE)) {
+        value = frame->data;
+#endif
+    } else {
+        return jsonlogic_incref(default_value);
+    }
 
-            reduce_context_object->entries[accumulator_index].value = JsonLogic_Null;
-            reduce_context_object->entries[current_index].value     = JsonLogic_Null;
-        }
+    if (next == end) {
+        return jsonlogic_incref(JSONLOGIC_IS_NULL(value) ? default_value : value);
+    }
 
-        jsonlogic_decref(reduce_context);
-        jsonlogic_decref(items);
+    return jsonlogic_get_path_utf16(value, next + 1, end - next - 1, default_value);
+}
 
-        return accumulator;
+// Releases what a lambda frame holds. The value stack isn't touched.
+static void jsonlogic_apply_release_frame(JsonLogic_ApplyFrame *frame) {
+    if (frame->reduce_context != JsonLogic_Null) {
+        JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(frame->reduce_context);
+        reduce_context_object->entries[frame->accumulator_index].value = JsonLogic_Null;
+        reduce_context_object->entries[frame->current_index].value     = JsonLogic_Null;
+        jsonlogic_decref(frame->reduce_context);
+        frame->reduce_context = JsonLogic_Null;
     }
+    if (frame->item != JSONLOGIC_SLOT_UNSET) {
+        jsonlogic_decref(frame->item);
+        frame->item = JSONLOGIC_SLOT_UNSET;
+    }
+    jsonlogic_decref(frame->accumulator);
+    jsonlogic_decref(frame->items);
+    if (frame->result != NULL) {
+        jsonlogic_decref(jsonlogic_array_into_handle(frame->result));
+    }
+    frame->accumulator = JsonLogic_Null;
+    frame->items       = JsonLogic_Null;
+    frame->result      = NULL;
+}
+
+// Pops the current frame and pushes its value.
+static void jsonlogic_apply_return(JsonLogic_ApplyState *state, JsonLogic_Handle value) {
+    -- state->frame_count;
+    jsonlogic_apply_push(state, value);
+}
+
+// Replaces the current frame by the evaluation of logic.
+static void jsonlogic_apply_tail(JsonLogic_ApplyState *state, JsonLogic_Handle logic) {
+    JsonLogic_Handle input = state->frames[state->frame_count - 1].data;
+    -- state->frame_count;
+    jsonlogic_apply_enter(state, logic, input);
+}
+
+// Starts the evaluation of the items of a lambda operation. Filter and map
+// operations with pure lambdas are fused into the frame, so only the items of
+// the innermost one are evaluated and no intermediate arrays are built.
+static void jsonlogic_apply_enter_source(JsonLogic_ApplyState *state, JsonLogic_ApplyFrame *frame, JsonLogic_Handle source) {
 #ifndef JSONLOGIC_COMPILE_CERTLOGIC
-    else if (JSONLOGIC_IS_OP(opstr, ALL)) {
-        // to be sane and logical it should return true on empty array,
-        // but JsonLogic is not logical here:
-        // https://github.com/jwadhams/json-logic-js/blob/c1dd82f5b15d8a553bb7a0cfa841ab8a11a9c227/logic.js#L318
-        if (value_count == 0) {
-            return JsonLogic_False;
-        }
+    bool map;
+    JsonLogic_Handle items;
+    JsonLogic_Handle lambda;
+    size_t stage_count = 0;
+    JsonLogic_Handle stages[JSONLOGIC_APPLY_STAGES];
+    unsigned int stage_maps = 0;
 
-        JsonLogic_Handle items = jsonlogic_apply_custom(
-            values[0],
-            input,
-            operations);
-        if (JSONLOGIC_IS_ERROR(items)) {
-            return items;
+    while (stage_count < JSONLOGIC_APPLY_STAGES && jsonlogic_apply_get_stage(state, source, &map, &items, &lambda)) {
+        stages[stage_count] = lambda;
+        if (map) {
+            stage_maps |= 1u << stage_count;
         }
+        ++ stage_count;
+        source = items;
+    }
 
-        if (!JSONLOGIC_IS_ARRAY(items) || value_count < 1) {
-            jsonlogic_decref(items);
-            return JsonLogic_False;
+    // innermost first
+    for (size_t index = 0; index < stage_count; ++ index) {
+        frame->stages[index] = stages[stage_count - index - 1];
+        if (stage_maps & (1u << (stage_count - index - 1))) {
+            frame->stage_maps |= 1u << index;
         }
+    }
+    frame->stage_count = stage_count;
+    frame->sourced     = true;
+#endif
+    frame->pending = true;
+    jsonlogic_apply_enter(state, source, frame->data);
+}
 
-        JsonLogic_Handle lambda = value_count > 1 ? values[1] : JsonLogic_Null;
+// Evaluates the first argument of a lambda operation and checks it. Returns
+// false if the frame is done.
+static bool jsonlogic_apply_start_lambda(JsonLogic_ApplyState *state, JsonLogic_ApplyFrame *frame) {
+    JsonLogic_Handle items = jsonlogic_apply_pop(state);
+    frame->pending = false;
 
-        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
-        if (array->size == 0) {
-            jsonlogic_decref(items);
-            return JsonLogic_False;
-        }
+    if (JSONLOGIC_IS_ERROR(items)) {
+        jsonlogic_apply_release_frame(frame);
+        jsonlogic_apply_return(state, items);
+        return false;
+    }
 
-        for (size_t index = 0; index < array->size; ++ index) {
-            JsonLogic_Handle item = array->items[index];
-            JsonLogic_Handle condition = jsonlogic_apply_custom(
-                lambda,
-                item,
-                operations);
-            if (!jsonlogic_to_bool(condition)) {
-                jsonlogic_decref(condition);
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+    if (frame->stage_count > 0 && !JSONLOGIC_IS_ARRAY(items)) {
+        // filter and map yield an empty array for anything else
+        jsonlogic_decref(items);
+        items = jsonlogic_empty_array();
+    }
+#endif
+
+    const size_t value_count = frame->value_count;
+    const JsonLogic_Handle *values = frame->values;
+
+    switch (frame->kind) {
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+        case JsonLogic_Apply_Filter:
+            if (!JSONLOGIC_IS_ARRAY(items) || value_count < 2 || !jsonlogic_to_bool(values[1])) {
                 jsonlogic_decref(items);
-                return JsonLogic_False;
+                jsonlogic_apply_return(state, jsonlogic_empty_array());
+                return false;
             }
-            jsonlogic_decref(condition);
-        }
+            frame->lambda = values[1];
+            break;
 
-        jsonlogic_decref(items);
-        return JsonLogic_True;
-    } else if (JSONLOGIC_IS_OP(opstr, SOME)) {
-        if (value_count == 0) {
-            return JsonLogic_False;
+        case JsonLogic_Apply_Map:
+            if (!JSONLOGIC_IS_ARRAY(items)) {
+                jsonlogic_decref(items);
+                jsonlogic_apply_return(state, jsonlogic_empty_array());
+                return false;
+            }
+            frame->lambda = value_count < 2 ? JsonLogic_Null : values[1];
+            break;
+
+        case JsonLogic_Apply_All:
+        case JsonLogic_Apply_Some:
+        case JsonLogic_Apply_None:
+            if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {
+                jsonlogic_decref(items);
+                jsonlogic_apply_return(state, frame->kind == JsonLogic_Apply_None ? JsonLogic_True : JsonLogic_False);
+                return false;
+            }
+            frame->lambda = value_count > 1 ? values[1] : JsonLogic_Null;
+            break;
+
+        case JsonLogic_Apply_In:
+            if (JSONLOGIC_CAST_ARRAY(items)->size == 0) {
+                jsonlogic_decref(items);
+                jsonlogic_apply_release_frame(frame);
+                jsonlogic_apply_return(state, JsonLogic_False);
+                return false;
+            }
+            break;
+#endif
+        case JsonLogic_Apply_Reduce:
+        {
+            JsonLogic_Handle init = value_count > 2 ? values[2] : JsonLogic_Null;
+            if (!JSONLOGIC_IS_ARRAY(items)) {
+                jsonlogic_decref(items);
+                jsonlogic_apply_return(state, jsonlogic_incref(init));
+                return false;
+            }
+            frame->lambda      = value_count > 1 ? values[1] : JsonLogic_Null;
+            frame->accumulator = jsonlogic_incref(init);
+
+#ifdef JSONLOGIC_COMPILE_CERTLOGIC
+            if (jsonlogic_reduce_is_scoped(frame->lambda, state->operations, true)) {
+#else
+            if (jsonlogic_reduce_is_scoped(frame->lambda, state->operations, false)) {
+#endif
+                frame->scoped = true;
+                break;
+            }
+
+            JsonLogic_Handle str_accumulator = jsonlogic_string_from_utf16_sized(JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);
+            JsonLogic_Handle str_current     = jsonlogic_string_from_utf16_sized(JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);
+#ifdef JSONLOGIC_COMPILE_CERTLOGIC
+            JsonLogic_Handle str_data        = jsonlogic_string_from_utf16_sized(JSONLOGIC_DATA, JSONLOGIC_DATA_SIZE);
+            JsonLogic_Handle reduce_context  = jsonlogic_object_build(
+                { .key = str_accumulator, .value = JsonLogic_Null },
+                { .key = str_current,     .value = JsonLogic_Null },
+                { .key = str_data,        .value = frame->data    },
+            );
+#else
+            JsonLogic_Handle reduce_context  = jsonlogic_object_build(
+                { .key = str_accumulator, .value = JsonLogic_Null },
+                { .key = str_current,     .value = JsonLogic_Null },
+            );
+#endif
+            jsonlogic_decref(str_accumulator);
+            jsonlogic_decref(str_current);
+#ifdef JSONLOGIC_COMPILE_CERTLOGIC
+            jsonlogic_decref(str_data);
+#endif
+            if (JSONLOGIC_IS_ERROR(reduce_context)) {
+                jsonlogic_decref(items);
+                jsonlogic_apply_release_frame(frame);
+                jsonlogic_apply_return(state, reduce_context);
+                return false;
+            }
+            JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(reduce_context);
+
+            frame->accumulator_index = jsonlogic_object_get_index_utf16_with_hash(
+                reduce_context_object,
+                JSONLOGIC_ACCUMULATOR_HASH,
+                JSONLOGIC_ACCUMULATOR,
+                JSONLOGIC_ACCUMULATOR_SIZE);
+            assert(frame->accumulator_index < reduce_context_object->size);
+
+            frame->current_index = jsonlogic_object_get_index_utf16_with_hash(
+                reduce_context_object,
+                JSONLOGIC_CURRENT_HASH,
+                JSONLOGIC_CURRENT,
+                JSONLOGIC_CURRENT_SIZE);
+            assert(frame->current_index < reduce_context_object->size);
+
+            frame->reduce_context = reduce_context;
+            break;
         }
+        default:
+            assert(false);
+            break;
+    }
 
-        JsonLogic_Handle items = jsonlogic_apply_custom(
-            values[0],
-            input,
-            operations);
-        if (JSONLOGIC_IS_ERROR(items)) {
-            return items;
+    frame->items = items;
+
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+    if (state->pool != NULL && frame->stage_count == 0 &&
+        frame->kind != JsonLogic_Apply_Reduce && frame->kind != JsonLogic_Apply_In &&
+        JSONLOGIC_CAST_ARRAY(items)->size >= jsonlogic_thread_pool_get_min_items(state->pool) &&
+        jsonlogic_is_frozen(items) && jsonlogic_is_frozen(frame->lambda) &&
+        jsonlogic_apply_is_pure_lambda(state, frame->lambda)) {
+        const JsonLogic_ParallelKind kind =
+            frame->kind == JsonLogic_Apply_Filter ? JsonLogic_Parallel_Filter :
+            frame->kind == JsonLogic_Apply_Map    ? JsonLogic_Parallel_Map :
+            frame->kind == JsonLogic_Apply_All    ? JsonLogic_Parallel_All :
+            frame->kind == JsonLogic_Apply_Some   ? JsonLogic_Parallel_Some :
+                                                    JsonLogic_Parallel_None;
+
+        // the lambda of the sequential evaluation would be one frame deeper
+        JsonLogic_Handle value = jsonlogic_thread_pool_apply(
+            state->pool, kind, frame->lambda, items, state->operations, state->max_depth - state->frame_count);
+
+        if (value != JSONLOGIC_SLOT_UNSET) {
+            jsonlogic_apply_release_frame(frame);
+            if (value == JsonLogic_Error_RecursionError) {
+                state->error = value;
+            } else {
+                jsonlogic_apply_return(state, value);
+            }
+            return false;
         }
+    }
 
-        if (!JSONLOGIC_IS_ARRAY(items) || value_count < 1) {
-            jsonlogic_decref(items);
-            return JsonLogic_False;
+    if (frame->kind == JsonLogic_Apply_Filter || frame->kind == JsonLogic_Apply_Map) {
+        frame->result = jsonlogic_array_with_capacity(JSONLOGIC_CAST_ARRAY(items)->size);
+        if (frame->result == NULL) {
+            jsonlogic_apply_release_frame(frame);
+            jsonlogic_apply_return(state, JsonLogic_Error_OutOfMemory);
+            return false;
         }
+    }
+#endif
 
-        JsonLogic_Handle lambda = value_count > 1 ? values[1] : JsonLogic_Null;
+    frame->iterating = true;
+    frame->index     = 0;
+    return true;
+}
 
-        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
-        if (array->size == 0) {
-            jsonlogic_decref(items);
-            return JsonLogic_False;
-        }
+// Takes the value of the lambda for the current item. Returns false if the
+// frame is done.
+static bool jsonlogic_apply_lambda_value(JsonLogic_ApplyState *state, JsonLogic_ApplyFrame *frame) {
+    JsonLogic_Handle value = jsonlogic_apply_pop(state);
+    frame->pending = false;
 
-        for (size_t index = 0; index < array->size; ++ index) {
-            JsonLogic_Handle item = array->items[index];
-            JsonLogic_Handle condition = jsonlogic_apply_custom(
-                lambda,
-                item,
-                operations);
-            if (jsonlogic_to_bool(condition)) {
-                jsonlogic_decref(condition);
-                jsonlogic_decref(items);
-                return JsonLogic_True;
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+    if (frame->stage < frame->stage_count) {
+        if (frame->stage_maps & (1u << frame->stage)) {
+            jsonlogic_decref(frame->item);
+            frame->item = value;
+        } else {
+            bool keep = jsonlogic_to_bool(value);
+            jsonlogic_decref(value);
+            if (!keep) {
+                jsonlogic_decref(frame->item);
+                frame->item = JSONLOGIC_SLOT_UNSET;
+                return true;
             }
-            jsonlogic_decref(condition);
         }
+        ++ frame->stage;
+        return true;
+    }
+#endif
 
-        jsonlogic_decref(items);
-        return JsonLogic_False;
-    } else if (JSONLOGIC_IS_OP(opstr, NONE)) {
-        if (value_count == 0) {
-            return JsonLogic_True;
-        }
+    JsonLogic_Handle item = frame->item;
+    frame->item = JSONLOGIC_SLOT_UNSET;
 
-        JsonLogic_Handle items = jsonlogic_apply_custom(
-            values[0],
-            input,
-            operations);
-        if (JSONLOGIC_IS_ERROR(items)) {
-            return items;
+    switch (frame->kind) {
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+        case JsonLogic_Apply_Filter:
+            if (jsonlogic_to_bool(value)) {
+                frame->result->items[frame->result_size ++] = item;
+            } else {
+                jsonlogic_decref(item);
+            }
+            jsonlogic_decref(value);
+            return true;
+
+        case JsonLogic_Apply_Map:
+            jsonlogic_decref(item);
+            frame->result->items[frame->result_size ++] = value;
+            return true;
+
+        case JsonLogic_Apply_All:
+        case JsonLogic_Apply_Some:
+        case JsonLogic_Apply_None:
+        {
+            bool condition = jsonlogic_to_bool(value);
+            jsonlogic_decref(item);
+            jsonlogic_decref(value);
+            ++ frame->result_size;
+            if (condition != (frame->kind == JsonLogic_Apply_All)) {
+                jsonlogic_apply_release_frame(frame);
+                jsonlogic_apply_return(state, frame->kind == JsonLogic_Apply_Some ? JsonLogic_True : JsonLogic_False);
+                return false;
+            }
+            return true;
         }
+#endif
+        case JsonLogic_Apply_Reduce:
+        {
+            if (frame->scoped) {
+                state->scope = frame->outer_scope;
+            } else {
+                JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(frame->reduce_context);
+                reduce_context_object->entries[frame->accumulator_index].value = JsonLogic_Null;
+                reduce_context_object->entries[frame->current_index].value     = JsonLogic_Null;
+            }
 
-        if (!JSONLOGIC_IS_ARRAY(items) || value_count < 1) {
-            jsonlogic_decref(items);
-            return JsonLogic_True;
+            jsonlogic_decref(item);
+            jsonlogic_decref(frame->accumulator);
+            frame->accumulator = value;
+            return true;
         }
+        default:
+            assert(false);
+            return true;
+    }
+}
+
+static void jsonlogic_apply_end_lambda(JsonLogic_ApplyState *state, JsonLogic_ApplyFrame *frame) {
+    JsonLogic_Handle value;
+
+    switch (frame->kind) {
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+        case JsonLogic_Apply_Filter:
+            value = jsonlogic_array_into_handle(jsonlogic_array_truncate(frame->result, frame->result_size));
+            frame->result = NULL;
+            break;
+
+        case JsonLogic_Apply_Map:
+            // fused filters may have dropped elements
+            value = jsonlogic_array_into_handle(jsonlogic_array_truncate(frame->result, frame->result_size));
+            frame->result = NULL;
+            break;
+
+        case JsonLogic_Apply_All:
+            // false for no items, even if fused filters dropped them all
+            value = frame->result_size > 0 ? JsonLogic_True : JsonLogic_False;
+            break;
+
+        case JsonLogic_Apply_Some:
+            value = JsonLogic_False;
+            break;
+
+        case JsonLogic_Apply_None:
+            value = JsonLogic_True;
+            break;
 
-        JsonLogic_Handle lambda = value_count > 1 ? values[1] : JsonLogic_Null;
+        case JsonLogic_Apply_In:
+            value = JsonLogic_False;
+            break;
+#endif
+        case JsonLogic_Apply_Reduce:
+            value = frame->accumulator;
+            frame->accumulator = JsonLogic_Null;
+            break;
+
+        default:
+            assert(false);
+            value = JsonLogic_Error_InternalError;
+            break;
+    }
 
-        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
-        if (array->size == 0) {
-            jsonlogic_decref(items);
-            return JsonLogic_True;
+    jsonlogic_apply_release_frame(frame);
+    jsonlogic_apply_return(state, value);
+}
+
+// Passes the next element to the next lambda of the frame.
+static void jsonlogic_apply_next(JsonLogic_ApplyState *state, JsonLogic_ApplyFrame *frame) {
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(frame->items);
+
+    for (;;) {
+        if (frame->item == JSONLOGIC_SLOT_UNSET) {
+            if (frame->index >= array->size) {
+                jsonlogic_apply_end_lambda(state, frame);
+                return;
+            }
+            frame->item  = jsonlogic_incref(array->items[frame->index ++]);
+            frame->stage = 0;
         }
 
-        for (size_t index = 0; index < array->size; ++ index) {
-            JsonLogic_Handle item = array->items[index];
-            JsonLogic_Handle condition = jsonlogic_apply_custom(
-                lambda,
-                item,
-                operations);
-            if (jsonlogic_to_bool(condition)) {
-                jsonlogic_decref(condition);
-                jsonlogic_decref(items);
-                return JsonLogic_False;
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+        if (frame->stage < frame->stage_count) {
+            frame->pending = true;
+            jsonlogic_apply_enter(state, frame->stages[frame->stage], frame->item);
+            return;
+        }
+
+        if (frame->kind == JsonLogic_Apply_In) {
+            bool found = JSONLOGIC_IS_TRUE(jsonlogic_strict_equal(frame->accumulator, frame->item));
+            jsonlogic_decref(frame->item);
+            frame->item = JSONLOGIC_SLOT_UNSET;
+            if (found) {
+                jsonlogic_apply_release_frame(frame);
+                jsonlogic_apply_return(state, JsonLogic_True);
+                return;
             }
-            jsonlogic_decref(condition);
+            continue;
         }
+#endif
 
-        jsonlogic_decref(items);
-        return JsonLogic_True;
+        frame->pending = true;
+        if (frame->scoped) {
+            frame->outer_scope = state->scope;
+            state->scope = state->frame_count - 1;
+            jsonlogic_apply_enter(state, frame->lambda, JSONLOGIC_REDUCE_SCOPE);
+        } else if (frame->kind == JsonLogic_Apply_Reduce) {
+            JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(frame->reduce_context);
+            reduce_context_object->entries[frame->accumulator_index].value = frame->accumulator;
+            reduce_context_object->entries[frame->current_index].value     = frame->item;
+            jsonlogic_apply_enter(state, frame->lambda, frame->reduce_context);
+        } else {
+            jsonlogic_apply_enter(state, frame->lambda, frame->item);
+        }
+        return;
     }
+}
+
+// Advances the frame on top of the frame stack by one step.
+static void jsonlogic_apply_step(JsonLogic_ApplyState *state) {
+    JsonLogic_ApplyFrame *frame = &state->frames[state->frame_count - 1];
+    const JsonLogic_Handle *values = frame->values;
+    const size_t value_count = frame->value_count;
+
+    switch (frame->kind) {
+        case JsonLogic_Apply_Array:
+        case JsonLogic_Apply_Call:
+            // the values of the arguments stay on the value stack
+            if (frame->index < value_count) {
+                jsonlogic_apply_enter(state, values[frame->index ++], frame->data);
+                return;
+            }
+
+            if (frame->kind == JsonLogic_Apply_Array) {
+                JsonLogic_Array *array = jsonlogic_array_with_capacity(value_count);
+                JsonLogic_Handle *args = state->values + frame->base;
+                if (array == NULL) {
+                    for (size_t index = 0; index < value_count; ++ index) {
+                        jsonlogic_decref(args[index]);
+                    }
+                } else {
+                    memcpy(array->items, args, sizeof(JsonLogic_Handle) * value_count);
+                }
+                state->value_count = frame->base;
+                jsonlogic_apply_return(state, jsonlogic_array_into_handle(array));
+            } else {
+                JsonLogic_Handle *args = state->values + frame->base;
+                const JsonLogic_Operation *opptr = frame->operation;
+                JsonLogic_Handle result;
+                if (frame->data == JSONLOGIC_REDUCE_SCOPE && opptr->funct == jsonlogic_op_VAR) {
+                    result = jsonlogic_apply_scope_var(state, args, value_count);
+                } else if (state->memo != NULL && jsonlogic_operation_has_flags(opptr, JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE)) {
+                    result = jsonlogic_memo_call(state->memo, opptr, frame->data, args, value_count);
+                } else {
+                    result = opptr->funct(opptr->context, frame->data, args, value_count);
+                }
+                for (size_t index = 0; index < value_count; ++ index) {
+                    jsonlogic_decref(args[index]);
+                }
+                state->value_count = frame->base;
+                jsonlogic_apply_return(state, result);
+            }
+            return;
+
+        case JsonLogic_Apply_If:
+            if (frame->pending) {
+                JsonLogic_Handle value = jsonlogic_apply_pop(state);
+                bool condition = jsonlogic_to_bool(value);
+                jsonlogic_decref(value);
+                frame->pending = false;
+#ifdef JSONLOGIC_COMPILE_CERTLOGIC
+                if (condition) {
+                    if (value_count < 2) {
+                        jsonlogic_apply_return(state, JsonLogic_Null);
+                    } else {
+                        jsonlogic_apply_tail(state, values[1]);
+                    }
+                } else {
+                    if (value_count < 3) {
+                        jsonlogic_apply_return(state, JsonLogic_Null);
+                    } else {
+                        jsonlogic_apply_tail(state, values[2]);
+                    }
+                }
+                return;
+#else
+                if (condition) {
+                    jsonlogic_apply_tail(state, values[frame->index + 1]);
+                    return;
+                }
+                frame->index += 2;
+#endif
+            }
+
+#ifdef JSONLOGIC_COMPILE_CERTLOGIC
+            frame->pending = true;
+            jsonlogic_apply_enter(state, values[0], frame->data);
+#else
+            if (frame->index < value_count - 1) {
+                frame->pending = true;
+                jsonlogic_apply_enter(state, values[frame->index], frame->data);
+            } else if (frame->index < value_count) {
+                jsonlogic_apply_tail(state, values[frame->index]);
+            } else {
+                jsonlogic_apply_return(state, JsonLogic_Null);
+            }
+#endif
+            return;
+
+        case JsonLogic_Apply_And:
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+        case JsonLogic_Apply_Or:
 #endif
+            if (frame->pending) {
+                JsonLogic_Handle value = state->values[state->value_count - 1];
+                if (jsonlogic_to_bool(value) != (frame->kind == JsonLogic_Apply_And)) {
+                    // the value stays as the value of the frame
+                    -- state->frame_count;
+                    return;
+                }
+                jsonlogic_decref(jsonlogic_apply_pop(state));
+                frame->pending = false;
+                ++ frame->index;
+            }
+
+            if (frame->index < value_count - 1) {
+                frame->pending = true;
+                jsonlogic_apply_enter(state, values[frame->index], frame->data);
+            } else {
+                jsonlogic_apply_tail(state, values[value_count - 1]);
+            }
+            return;
+
+        default:
+            if (!frame->iterating) {
+                if (!frame->pending) {
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+                    if (frame->kind == JsonLogic_Apply_In) {
+                        frame->pending = true;
+                        jsonlogic_apply_enter(state, values[0], frame->data);
+                        return;
+                    }
+#endif
+                    jsonlogic_apply_enter_source(state, frame, values[0]);
+                    return;
+                }
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+                if (frame->kind == JsonLogic_Apply_In && !frame->sourced) {
+                    JsonLogic_Handle needle = jsonlogic_apply_pop(state);
+                    if (JSONLOGIC_IS_ERROR(needle)) {
+                        jsonlogic_apply_return(state, needle);
+                        return;
+                    }
+                    frame->accumulator = needle;
+                    jsonlogic_apply_enter_source(state, frame, values[1]);
+                    return;
+                }
+#endif
+                if (!jsonlogic_apply_start_lambda(state, frame)) {
+                    return;
+                }
+            } else if (frame->pending && !jsonlogic_apply_lambda_value(state, frame)) {
+                return;
+            }
 
-    if (opstr->hash == JSONLOGIC_HASH_UNSET) {
-        opstr->hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+            jsonlogic_apply_next(state, frame);
+            return;
     }
+}
 
-    const JsonLogic_Operation *opptr = jsonlogic_operations_get_with_hash(
-        operations, opstr->hash, opstr->str, opstr->size);
+typedef struct JsonLogic_ApplyEvaluator {
+    JsonLogic_Evaluator evaluator;
+    JsonLogic_ApplyState *state;
+} JsonLogic_ApplyEvaluator;
 
-    if (opptr == NULL) {
-        // JSONLOGIC_DEBUG_UTF16("%s", opstr->str, opstr->size, "illegal operation");
-        // jsonlogic_operations_debug(operations);
-        return JsonLogic_Error_IllegalOperation;
+// Evaluates logic on top of the frames of the running evaluation, so the
+// nesting depth is limited by max_depth as a whole.
+static JsonLogic_Handle jsonlogic_apply_evaluate(JsonLogic_Evaluator *evaluator, JsonLogic_Handle logic, JsonLogic_Handle data) {
+    JsonLogic_ApplyState *state = ((JsonLogic_ApplyEvaluator*)evaluator)->state;
+    if (state->error != JsonLogic_Error_Success) {
+        return state->error;
     }
 
-    JsonLogic_Handle argbuf[JSONLOGIC_STATIC_ARGC];
-    JsonLogic_Handle *args;
+    const size_t frame_count = state->frame_count;
+    const size_t value_count = state->value_count;
 
-    if (value_count > JSONLOGIC_STATIC_ARGC) {
-        args = malloc(sizeof(JsonLogic_Handle) * value_count);
-        if (args == NULL) {
-            JSONLOGIC_ERROR_MEMORY();
-            return JsonLogic_Error_OutOfMemory;
+    jsonlogic_apply_enter(state, logic, data);
+
+    while (state->frame_count > frame_count && state->error == JsonLogic_Error_Success) {
+        jsonlogic_apply_step(state);
+    }
+
+    if (state->error != JsonLogic_Error_Success) {
+        while (state->frame_count > frame_count) {
+            jsonlogic_apply_release_frame(&state->frames[-- state->frame_count]);
         }
-    } else {
-        args = argbuf;
+        while (state->value_count > value_count) {
+            jsonlogic_decref(jsonlogic_apply_pop(state));
+        }
+        return state->error;
     }
 
-    for (size_t index = 0; index < value_count; ++ index) {
-        args[index] = jsonlogic_apply_custom(
-            values[index],
-            input,
-            operations);
+    assert(state->value_count == value_count + 1);
+    return jsonlogic_apply_pop(state);
+}
+
+// Calls an operation with the logic of its arguments. The frame only counts
+// towards max_depth, it is never stepped.
+static void jsonlogic_apply_lazy(JsonLogic_ApplyState *state, const JsonLogic_Operation *opptr, const JsonLogic_Handle *values, size_t value_count, JsonLogic_Handle input) {
+    JsonLogic_ApplyFrame *frame = jsonlogic_apply_push_frame(state, JsonLogic_Apply_Call, values, value_count, input);
+    if (frame == NULL) {
+        return;
     }
+    frame->operation = opptr;
 
-    result = opptr->funct(opptr->context, input, args, value_count);
+    JsonLogic_ApplyEvaluator evaluator = {
+        .evaluator = { .evaluate = jsonlogic_apply_evaluate },
+        .state     = state,
+    };
 
-    for (size_t index = 0; index < value_count; ++ index) {
-        jsonlogic_decref(args[index]);
+    JsonLogic_Handle result = opptr->lazy_funct(opptr->context, input, values, value_count, &evaluator.evaluator);
+    jsonlogic_apply_return(state, result);
+}
+
+static JsonLogic_Handle jsonlogic_apply_run(
+        JsonLogic_Handle logic,
+        JsonLogic_Handle input,
+        const JsonLogic_Operations *operations,
+        size_t max_depth,
+        JsonLogic_ThreadPool *pool,
+        JsonLogic_Memo *memo) {
+    JsonLogic_ApplyFrame framebuf[JSONLOGIC_APPLY_STATIC_FRAMES];
+    JsonLogic_Handle valuebuf[JSONLOGIC_APPLY_STATIC_VALUES];
+
+    JsonLogic_ApplyState state = {
+        .operations     = operations,
+        .max_depth      = max_depth,
+        .error          = JsonLogic_Error_Success,
+        .scope          = SIZE_MAX,
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+        .pool           = pool,
+#endif
+        .memo           = memo,
+        .frame_count    = 0,
+        .frame_capacity = JSONLOGIC_APPLY_STATIC_FRAMES,
+        .frames         = framebuf,
+        .value_count    = 0,
+        .value_capacity = JSONLOGIC_APPLY_STATIC_VALUES,
+        .values         = valuebuf,
+        .framebuf       = framebuf,
+        .valuebuf       = valuebuf,
+    };
+
+    jsonlogic_apply_enter(&state, logic, input);
+
+    while (state.frame_count > 0 && state.error == JsonLogic_Error_Success) {
+        jsonlogic_apply_step(&state);
+    }
+
+    JsonLogic_Handle result;
+    if (state.error != JsonLogic_Error_Success) {
+        while (state.frame_count > 0) {
+            jsonlogic_apply_release_frame(&state.frames[-- state.frame_count]);
+        }
+        while (state.value_count > 0) {
+            jsonlogic_decref(jsonlogic_apply_pop(&state));
+        }
+        result = state.error;
+    } else {
+        assert(state.value_count == 1);
+        result = state.values[0];
     }
 
-    if (value_count > JSONLOGIC_STATIC_ARGC) {
-        free(args);
+    if (state.frames != framebuf) {
+        free(state.frames);
+    }
+
+    if (state.values != valuebuf) {
+        free(state.values);
     }
 
     return result;
 }
+
+JsonLogic_Handle jsonlogic_apply_custom_max_depth(
+        JsonLogic_Handle logic,
+        JsonLogic_Handle input,
+        const JsonLogic_Operations *operations,
+        size_t max_depth) {
+    return jsonlogic_apply_run(logic, input, operations, max_depth, NULL, NULL);
+}
+
+#ifndef JSONLOGIC_COMPILE_CERTLOGIC
+JsonLogic_Handle jsonlogic_apply_custom_parallel(
+        JsonLogic_Handle logic,
+        JsonLogic_Handle input,
+        const JsonLogic_Operations *operations,
+        JsonLogic_ThreadPool *pool) {
+    return jsonlogic_apply_run(logic, input, operations, JSONLOGIC_MAX_DEPTH, pool, NULL);
+}
+#endif
+
+JsonLogic_Handle jsonlogic_apply_custom_memo(
+        JsonLogic_Handle logic,
+        JsonLogic_Handle input,
+        const JsonLogic_Operations *operations,
+        JsonLogic_Memo *memo) {
+    return jsonlogic_apply_run(logic, input, operations, JSONLOGIC_MAX_DEPTH, NULL, memo);
+}
+
+JsonLogic_Handle jsonlogic_apply_custom(
+        JsonLogic_Handle logic,
+        JsonLogic_Handle input,
+        const JsonLogic_Operations *operations) {
+    return jsonlogic_apply_custom_max_depth(logic, input, operations, JSONLOGIC_MAX_DEPTH);
+}
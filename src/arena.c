@@ -0,0 +1,398 @@
+#include "jsonlogic_intern.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Bump allocator for the temporary values of a single evaluation. Each
+// allocation is prefixed by its (aligned) size so that realloc() can copy it
+// and so that the most recent allocation can be grown or popped in place.
+// Freeing any other arena allocation is a no-op, all memory is released in
+// bulk when the evaluation is done.
+
+#define JSONLOGIC_ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+#define JSONLOGIC_ARENA_ALIGN  ((size_t)8)
+#define JSONLOGIC_ARENA_HEADER JSONLOGIC_ARENA_ALIGN
+#define JSONLOGIC_ARENA_NO_LAST SIZE_MAX
+
+typedef struct JsonLogic_ArenaBlock {
+    struct JsonLogic_ArenaBlock *next;
+    size_t size;
+    size_t used;
+    size_t last;
+    uint64_t data[1];
+} JsonLogic_ArenaBlock;
+
+struct JsonLogic_Arena {
+    JsonLogic_ArenaBlock *blocks;
+    JsonLogic_Arena *outer;
+    size_t block_size;
+    bool active;
+};
+
+static JSONLOGIC_THREAD_LOCAL JsonLogic_Arena *JsonLogic_CurrentArena = NULL;
+
+JsonLogic_Arena *jsonlogic_arena_new(size_t block_size) {
+    JsonLogic_Arena *arena = malloc(sizeof(JsonLogic_Arena));
+    if (arena == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    if (block_size == 0) {
+        block_size = JSONLOGIC_ARENA_DEFAULT_BLOCK_SIZE;
+    } else if (block_size > SIZE_MAX - JSONLOGIC_ARENA_ALIGN) {
+        block_size = SIZE_MAX & ~(JSONLOGIC_ARENA_ALIGN - 1);
+    } else {
+        block_size = (block_size + JSONLOGIC_ARENA_ALIGN - 1) & ~(JSONLOGIC_ARENA_ALIGN - 1);
+    }
+
+    arena->blocks     = NULL;
+    arena->outer      = NULL;
+    arena->block_size = block_size;
+    arena->active     = false;
+
+    return arena;
+}
+
+static void jsonlogic_arena_free_blocks(JsonLogic_Arena *arena) {
+    JsonLogic_ArenaBlock *block = arena->blocks;
+    while (block != NULL) {
+        JsonLogic_ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->blocks = NULL;
+}
+
+void jsonlogic_arena_free(JsonLogic_Arena *arena) {
+    if (arena != NULL) {
+        assert(!arena->active);
+        jsonlogic_arena_free_blocks(arena);
+        free(arena);
+    }
+}
+
+// Keeps a single block around. If the last evaluation needed more than one
+// block the blocks are replaced by one big enough for all of them, so the
+// next evaluation of similar input doesn't need to allocate at all.
+static void jsonlogic_arena_reset(JsonLogic_Arena *arena) {
+    JsonLogic_ArenaBlock *block = arena->blocks;
+    if (block == NULL) {
+        return;
+    }
+
+    if (block->next == NULL) {
+        block->used = 0;
+        block->last = JSONLOGIC_ARENA_NO_LAST;
+        return;
+    }
+
+    size_t total = 0;
+    for (; block != NULL; block = block->next) {
+        total += block->size;
+    }
+    jsonlogic_arena_free_blocks(arena);
+
+    if (total > arena->block_size) {
+        arena->block_size = total;
+    }
+}
+
+static JsonLogic_ArenaBlock *jsonlogic_arena_find_block(const JsonLogic_Arena *arena, const void *ptr) {
+    uintptr_t addr = (uintptr_t)ptr;
+    for (JsonLogic_ArenaBlock *block = arena->blocks; block != NULL; block = block->next) {
+        uintptr_t start = (uintptr_t)block->data;
+        if (addr >= start && addr < start + block->used) {
+            return block;
+        }
+    }
+    return NULL;
+}
+
+static void *jsonlogic_arena_alloc(JsonLogic_Arena *arena, size_t size) {
+    if (size > SIZE_MAX - JSONLOGIC_ARENA_HEADER - JSONLOGIC_ARENA_ALIGN) {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    size_t aligned = (size + JSONLOGIC_ARENA_ALIGN - 1) & ~(JSONLOGIC_ARENA_ALIGN - 1);
+    size_t needed  = JSONLOGIC_ARENA_HEADER + aligned;
+    JsonLogic_ArenaBlock *block = arena->blocks;
+
+    if (block == NULL || block->size - block->used < needed) {
+        size_t block_size = needed > arena->block_size ? needed : arena->block_size;
+        if (block_size > SIZE_MAX - sizeof(JsonLogic_ArenaBlock)) {
+            errno = ENOMEM;
+            return NULL;
+        }
+        block = malloc(sizeof(JsonLogic_ArenaBlock) - sizeof(uint64_t) + block_size);
+        if (block == NULL) {
+            return NULL;
+        }
+        block->next   = arena->blocks;
+        block->size   = block_size;
+        block->used   = 0;
+        block->last   = JSONLOGIC_ARENA_NO_LAST;
+        arena->blocks = block;
+    }
+
+    char *header = (char*)block->data + block->used;
+    *(size_t*)header = aligned;
+    block->last  = block->used;
+    block->used += needed;
+
+    return header + JSONLOGIC_ARENA_HEADER;
+}
+
+// Finds the arena an allocation belongs to. Arenas of enclosing evaluations
+// are searched too, their memory is released by the outer evaluation.
+static JsonLogic_Arena *jsonlogic_arena_find(const void *ptr, JsonLogic_ArenaBlock **blockptr) {
+    for (JsonLogic_Arena *arena = JsonLogic_CurrentArena; arena != NULL; arena = arena->outer) {
+        JsonLogic_ArenaBlock *block = jsonlogic_arena_find_block(arena, ptr);
+        if (block != NULL) {
+            *blockptr = block;
+            return arena;
+        }
+    }
+    return NULL;
+}
+
+void *jsonlogic_malloc(size_t size) {
+    JsonLogic_Arena *arena = JsonLogic_CurrentArena;
+    if (arena == NULL) {
+        return malloc(size);
+    }
+    return jsonlogic_arena_alloc(arena, size);
+}
+
+void *jsonlogic_realloc(void *ptr, size_t size) {
+    JsonLogic_Arena *current = JsonLogic_CurrentArena;
+    if (current == NULL) {
+        return realloc(ptr, size);
+    }
+
+    if (ptr == NULL) {
+        return jsonlogic_arena_alloc(current, size);
+    }
+
+    JsonLogic_ArenaBlock *block = NULL;
+    JsonLogic_Arena *arena = jsonlogic_arena_find(ptr, &block);
+    if (arena == NULL) {
+        // heap allocations stay on the heap
+        return realloc(ptr, size);
+    }
+
+    char *header = (char*)ptr - JSONLOGIC_ARENA_HEADER;
+    size_t old_size = *(size_t*)header;
+
+    if (size <= old_size) {
+        return ptr;
+    }
+
+    size_t offset = (size_t)(header - (char*)block->data);
+    if (arena == current && block == arena->blocks && offset == block->last &&
+            size <= block->size - offset - JSONLOGIC_ARENA_HEADER) {
+        size_t aligned = (size + JSONLOGIC_ARENA_ALIGN - 1) & ~(JSONLOGIC_ARENA_ALIGN - 1);
+        *(size_t*)header = aligned;
+        block->used = offset + JSONLOGIC_ARENA_HEADER + aligned;
+        return ptr;
+    }
+
+    void *new_ptr = jsonlogic_arena_alloc(current, size);
+    if (new_ptr != NULL) {
+        memcpy(new_ptr, ptr, old_size);
+    }
+    return new_ptr;
+}
+
+void jsonlogic_free(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+
+    if (JsonLogic_CurrentArena == NULL) {
+        free(ptr);
+        return;
+    }
+
+    JsonLogic_ArenaBlock *block = NULL;
+    JsonLogic_Arena *arena = jsonlogic_arena_find(ptr, &block);
+    if (arena == NULL) {
+        free(ptr);
+        return;
+    }
+
+    // pop the most recent allocation, e.g. the arguments of an operation
+    size_t offset = (size_t)((char*)ptr - JSONLOGIC_ARENA_HEADER - (char*)block->data);
+    if (arena == JsonLogic_CurrentArena && offset == block->last) {
+        block->used = offset;
+        block->last = JSONLOGIC_ARENA_NO_LAST;
+    }
+}
+
+size_t jsonlogic_arena_used(void) {
+    size_t used = 0;
+    const JsonLogic_Arena *arena = JsonLogic_CurrentArena;
+    if (arena != NULL) {
+        for (const JsonLogic_ArenaBlock *block = arena->blocks; block != NULL; block = block->next) {
+            used += block->used;
+        }
+    }
+    return used;
+}
+
+static bool jsonlogic_arena_contains(const JsonLogic_Arena *arena, JsonLogic_Handle handle) {
+    return jsonlogic_arena_find_block(arena, JSONLOGIC_CAST_STRING(handle)) != NULL;
+}
+
+// Copies everything of the value that lives in the arena into the enclosing
+// allocator (heap or the arena of an outer evaluation). Values that aren't in
+// the arena are shared.
+static JsonLogic_Handle jsonlogic_arena_copy_out(const JsonLogic_Arena *arena, JsonLogic_Handle handle) {
+    switch (handle & JsonLogic_TypeMask) {
+        case JsonLogic_Type_String:
+        {
+            if (!jsonlogic_arena_contains(arena, handle)) {
+                return jsonlogic_incref(handle);
+            }
+            const JsonLogic_String *string = JSONLOGIC_CAST_STRING(handle);
+            JsonLogic_String *new_string = JSONLOGIC_MALLOC_STRING(string->size);
+            if (new_string == NULL) {
+                JSONLOGIC_ERROR_MEMORY();
+                return JsonLogic_Error_OutOfMemory;
+            }
+            JSONLOGIC_SET_REFCOUNT(new_string->refcount, 1);
+            new_string->hash = string->hash;
+            new_string->size = string->size;
+            memcpy(new_string->str, string->str, string->size * sizeof(char16_t));
+            return jsonlogic_string_into_handle(new_string);
+        }
+        case JsonLogic_Type_Array:
+        {
+            if (!jsonlogic_arena_contains(arena, handle)) {
+                return jsonlogic_incref(handle);
+            }
+            const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(handle);
+            JsonLogic_Array *new_array = jsonlogic_array_with_capacity(array->size);
+            if (new_array == NULL) {
+                return JsonLogic_Error_OutOfMemory;
+            }
+            for (size_t index = 0; index < array->size; ++ index) {
+                JsonLogic_Handle item = jsonlogic_arena_copy_out(arena, array->items[index]);
+                if (item == JsonLogic_Error_OutOfMemory) {
+                    jsonlogic_array_free(new_array);
+                    return item;
+                }
+                new_array->items[index] = item;
+            }
+            return jsonlogic_array_into_handle(new_array);
+        }
+        case JsonLogic_Type_Object:
+        {
+            if (!jsonlogic_arena_contains(arena, handle)) {
+                return jsonlogic_incref(handle);
+            }
+            const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(handle);
+            JsonLogic_Object *new_object = JSONLOGIC_MALLOC_OBJECT(object->size);
+            if (new_object == NULL) {
+                JSONLOGIC_ERROR_MEMORY();
+                return JsonLogic_Error_OutOfMemory;
+            }
+            // keep the hash table layout, so no rehashing is needed
+            JSONLOGIC_SET_REFCOUNT(new_object->refcount, 1);
+            new_object->size        = object->size;
+            new_object->used        = object->used;
+            new_object->first_index = object->first_index;
+            for (size_t index = 0; index < object->size; ++ index) {
+                new_object->entries[index] = (JsonLogic_Object_Entry){
+                    .key   = JsonLogic_Null,
+                    .value = JsonLogic_Null,
+                };
+            }
+            for (size_t index = object->first_index; index < object->size; ++ index) {
+                const JsonLogic_Object_Entry *entry = &object->entries[index];
+                if (JSONLOGIC_IS_NULL(entry->key)) {
+                    continue;
+                }
+                JsonLogic_Handle key   = jsonlogic_arena_copy_out(arena, entry->key);
+                JsonLogic_Handle value = jsonlogic_arena_copy_out(arena, entry->value);
+                new_object->entries[index] = (JsonLogic_Object_Entry){
+                    .key   = key,
+                    .value = value,
+                };
+                if (key == JsonLogic_Error_OutOfMemory || value == JsonLogic_Error_OutOfMemory) {
+                    jsonlogic_object_free(new_object);
+                    return JsonLogic_Error_OutOfMemory;
+                }
+            }
+            return jsonlogic_object_into_handle(new_object);
+        }
+        default:
+            return handle;
+    }
+}
+
+static bool jsonlogic_arena_enter(JsonLogic_Arena *arena) {
+    if (arena == NULL || arena->active) {
+        return false;
+    }
+    arena->outer  = JsonLogic_CurrentArena;
+    arena->active = true;
+    JsonLogic_CurrentArena = arena;
+    return true;
+}
+
+static JsonLogic_Handle jsonlogic_arena_leave(JsonLogic_Arena *arena, JsonLogic_Handle result) {
+    assert(JsonLogic_CurrentArena == arena);
+
+    JsonLogic_CurrentArena = arena->outer;
+    JsonLogic_Handle copy = jsonlogic_arena_copy_out(arena, result);
+    JsonLogic_CurrentArena = arena;
+
+    // releases the references to values outside of the arena
+    jsonlogic_decref(result);
+
+    jsonlogic_arena_reset(arena);
+    JsonLogic_CurrentArena = arena->outer;
+    arena->outer  = NULL;
+    arena->active = false;
+
+    return copy;
+}
+
+JsonLogic_Handle jsonlogic_apply_custom_arena(
+        JsonLogic_Handle logic,
+        JsonLogic_Handle input,
+        const JsonLogic_Operations *operations,
+        JsonLogic_Arena *arena) {
+    if (!jsonlogic_arena_enter(arena)) {
+        return jsonlogic_apply_custom(logic, input, operations);
+    }
+    return jsonlogic_arena_leave(arena, jsonlogic_apply_custom(logic, input, operations));
+}
+
+JsonLogic_Handle jsonlogic_apply_arena(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_Arena *arena) {
+    return jsonlogic_apply_custom_arena(logic, input, &JsonLogic_Builtins, arena);
+}
+
+JsonLogic_Handle certlogic_apply_custom_arena(
+        JsonLogic_Handle logic,
+        JsonLogic_Handle input,
+        const JsonLogic_Operations *operations,
+        JsonLogic_Arena *arena) {
+    if (!jsonlogic_arena_enter(arena)) {
+        return certlogic_apply_custom(logic, input, operations);
+    }
+    return jsonlogic_arena_leave(arena, certlogic_apply_custom(logic, input, operations));
+}
+
+JsonLogic_Handle certlogic_apply_arena(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_Arena *arena) {
+    return certlogic_apply_custom_arena(logic, input, &CertLogic_Builtins, arena);
+}
+
+JsonLogic_Handle jsonlogic_program_apply_arena(const JsonLogic_Program *program, JsonLogic_Handle input, JsonLogic_Arena *arena) {
+    if (!jsonlogic_arena_enter(arena)) {
+        return jsonlogic_program_apply(program, input);
+    }
+    return jsonlogic_arena_leave(arena, jsonlogic_program_apply(program, input));
+}
@@ -7,17 +7,14 @@
 
 JsonLogic_Handle jsonlogic_array_into_handle(JsonLogic_Array *array);
 
-JsonLogic_Handle jsonlogic_empty_array(void) {
-    JsonLogic_Array *array = JSONLOGIC_MALLOC_EMPTY_ARRAY();
-    if (array == NULL) {
-        JSONLOGIC_ERROR_MEMORY();
-        return JsonLogic_Error_OutOfMemory;
-    }
-
-    array->refcount = 1;
-    array->size     = 0;
+static JsonLogic_Array JsonLogic_EmptyArray = {
+    .refcount = JSONLOGIC_REFCOUNT_IMMORTAL,
+    .size     = 0,
+    .items    = { JsonLogic_Type_Null },
+};
 
-    return jsonlogic_array_into_handle(array);
+JsonLogic_Handle jsonlogic_empty_array(void) {
+    return jsonlogic_array_into_handle(&JsonLogic_EmptyArray);
 }
 
 JsonLogic_Array *jsonlogic_array_with_capacity(size_t size) {
@@ -27,7 +24,7 @@ JsonLogic_Array *jsonlogic_array_with_capacity(size_t size) {
         return NULL;
     }
 
-    array->refcount = 1;
+    JSONLOGIC_SET_REFCOUNT(array->refcount, 1);
     array->size     = size;
 
     for (size_t index = 0; index < size; ++ index) {
@@ -44,7 +41,7 @@ JsonLogic_Handle jsonlogic_array_from_vararg(size_t count, ...) {
         return JsonLogic_Error_OutOfMemory;
     }
 
-    array->refcount = 1;
+    JSONLOGIC_SET_REFCOUNT(array->refcount, 1);
     array->size     = count;
 
     va_list ap;
@@ -56,7 +53,7 @@ JsonLogic_Handle jsonlogic_array_from_vararg(size_t count, ...) {
             for (size_t free_index = 0; free_index < index; ++ free_index) {
                 jsonlogic_decref(array->items[free_index]);
             }
-            free(array);
+            jsonlogic_free(array);
             return item;
         }
         array->items[index] = jsonlogic_incref(item);
@@ -74,7 +71,7 @@ JsonLogic_Handle jsonlogic_array_from(const JsonLogic_Handle items[], size_t siz
         return JsonLogic_Error_OutOfMemory;
     }
 
-    array->refcount = 1;
+    JSONLOGIC_SET_REFCOUNT(array->refcount, 1);
     array->size     = size;
 
     for (size_t index = 0; index < size; ++ index) {
@@ -83,7 +80,7 @@ JsonLogic_Handle jsonlogic_array_from(const JsonLogic_Handle items[], size_t siz
             for (size_t free_index = 0; free_index < index; ++ free_index) {
                 jsonlogic_decref(array->items[free_index]);
             }
-            free(array);
+            jsonlogic_free(array);
             return item;
         }
         array->items[index] = jsonlogic_incref(item);
@@ -107,7 +104,7 @@ void jsonlogic_array_free(JsonLogic_Array *array) {
         for (size_t index = 0; index < array->size; ++ index) {
             jsonlogic_decref(array->items[index]);
         }
-        free(array);
+        jsonlogic_free(array);
     }
 }
 
@@ -154,7 +151,7 @@ JsonLogic_Handle jsonlogic_includes(JsonLogic_Handle list, JsonLogic_Handle item
 }
 
 JsonLogic_Array *jsonlogic_array_truncate(JsonLogic_Array *array, size_t size) {
-    assert(array->refcount < 2);
+    assert(JSONLOGIC_GET_REFCOUNT(array->refcount) < 2);
 
     if (size < array->size) {
         for (size_t index = size; index < array->size; ++ index) {
@@ -188,7 +185,7 @@ JsonLogic_Error jsonlogic_arraybuf_append(JsonLogic_ArrayBuf *buf, JsonLogic_Han
             return JSONLOGIC_ERROR_OUT_OF_MEMORY;
         }
         if (buf->array == NULL) {
-            new_array->refcount = 1;
+            JSONLOGIC_SET_REFCOUNT(new_array->refcount, 1);
             new_array->size     = 0;
         }
         buf->array    = new_array;
@@ -202,13 +199,7 @@ JsonLogic_Error jsonlogic_arraybuf_append(JsonLogic_ArrayBuf *buf, JsonLogic_Han
 JsonLogic_Array *jsonlogic_arraybuf_take(JsonLogic_ArrayBuf *buf) {
     JsonLogic_Array *array = buf->array;
     if (array == NULL) {
-        array = JSONLOGIC_MALLOC_EMPTY_ARRAY();
-        if (array == NULL) {
-            JSONLOGIC_ERROR_MEMORY();
-        } else {
-            array->refcount = 1;
-            array->size     = 0;
-        }
+        array = &JsonLogic_EmptyArray;
     } else {
         // shrink to fit
         array = JSONLOGIC_REALLOC_ARRAY(array, array->size);
@@ -217,7 +208,7 @@ JsonLogic_Array *jsonlogic_arraybuf_take(JsonLogic_ArrayBuf *buf) {
             JSONLOGIC_ERROR_MEMORY();
             array = buf->array;
         }
-        assert(array->refcount == 1);
+        assert(JSONLOGIC_GET_REFCOUNT(array->refcount) == 1);
     }
     buf->capacity = 0;
     buf->array = NULL;
@@ -264,7 +255,7 @@ JsonLogic_Handle jsonlogic_to_array(JsonLogic_Handle handle) {
                     for (size_t free_index = 0; free_index < index; ++ index) {
                         jsonlogic_decref(array->items[free_index]);
                     }
-                    free(array);
+                    jsonlogic_free(array);
                     return item;
                 }
                 array->items[index] = item;
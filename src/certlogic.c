@@ -23,12 +23,16 @@ JsonLogic_Handle certlogic_op_TO_BOOL(void *context, JsonLogic_Handle data, Json
 #define JSONLOGIC_COMPILE_CERTLOGIC
 #define jsonlogic_apply        certlogic_apply
 #define jsonlogic_apply_custom certlogic_apply_custom
+#define jsonlogic_apply_custom_max_depth certlogic_apply_custom_max_depth
+#define jsonlogic_apply_custom_memo certlogic_apply_custom_memo
 #define jsonlogic_to_bool      certlogic_to_bool
 #define jsonlogic_to_boolean   certlogic_to_boolean
 #define jsonlogic_not          certlogic_not
 #include "apply.c"
 #undef jsonlogic_apply
 #undef jsonlogic_apply_custom
+#undef jsonlogic_apply_custom_max_depth
+#undef jsonlogic_apply_custom_memo
 #undef jsonlogic_to_bool
 #undef jsonlogic_to_boolean
 #undef jsonlogic_not
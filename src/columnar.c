@@ -0,0 +1,985 @@
+#include "jsonlogic_intern.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define JSONLOGIC_COLUMNAR_SSE2
+#endif
+
+// Rows are evaluated in blocks. The selection of a block is a bitmap of
+// JSONLOGIC_COLUMNAR_WORDS 64 bit words, bit N being row N of the block.
+#define JSONLOGIC_COLUMNAR_BLOCK 256
+#define JSONLOGIC_COLUMNAR_WORDS (JSONLOGIC_COLUMNAR_BLOCK / 64)
+
+typedef enum JsonLogic_ColNodeKind {
+    JsonLogic_ColNode_Const = 0,
+    JsonLogic_ColNode_Column,
+    JsonLogic_ColNode_Table,
+    JsonLogic_ColNode_Arith,
+    JsonLogic_ColNode_Compare,
+    JsonLogic_ColNode_And,
+    JsonLogic_ColNode_Or,
+    JsonLogic_ColNode_If,
+    JsonLogic_ColNode_Not,
+    JsonLogic_ColNode_ToBool,
+    JsonLogic_ColNode_Call,
+} JsonLogic_ColNodeKind;
+
+// Numeric nodes are evaluated into arrays of doubles, everything is evaluated
+// into selection bitmaps where only the truthiness matters. Only where values
+// are really needed (arguments of generic operations, results of and/or/if
+// used as values) rows are evaluated into handles one by one.
+typedef struct JsonLogic_ColNode {
+    JsonLogic_ColNodeKind kind;
+    bool numeric;
+    JsonLogic_Operation operation;
+    JsonLogic_Handle value;
+    const JsonLogic_Column *column;
+    // Column and Table: the value and truthiness of every dictionary code
+    // (or of false and true for boolean columns)
+    JsonLogic_Handle *table;
+    uint8_t *truth;
+    size_t table_size;
+    size_t argc;
+    struct JsonLogic_ColNode **args;
+} JsonLogic_ColNode;
+
+typedef struct JsonLogic_ColCompiler {
+    const JsonLogic_Operations *operations;
+    const JsonLogic_Column *columns;
+    const JsonLogic_Handle *names;
+    size_t column_count;
+    // SUCCESS if compiling failed because the logic isn't supported
+    JsonLogic_Error error;
+} JsonLogic_ColCompiler;
+
+static void jsonlogic_colnode_free(JsonLogic_ColNode *node) {
+    if (node == NULL) {
+        return;
+    }
+    jsonlogic_decref(node->value);
+    if (node->table != NULL) {
+        for (size_t index = 0; index < node->table_size; ++ index) {
+            jsonlogic_decref(node->table[index]);
+        }
+        free(node->table);
+    }
+    free(node->truth);
+    if (node->args != NULL) {
+        for (size_t index = 0; index < node->argc; ++ index) {
+            jsonlogic_colnode_free(node->args[index]);
+        }
+        free(node->args);
+    }
+    free(node);
+}
+
+static JsonLogic_ColNode *jsonlogic_colnode_new(JsonLogic_ColCompiler *compiler, JsonLogic_ColNodeKind kind) {
+    JsonLogic_ColNode *node = calloc(1, sizeof(JsonLogic_ColNode));
+    if (node == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        compiler->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        return NULL;
+    }
+    node->kind  = kind;
+    node->value = JsonLogic_Null;
+    return node;
+}
+
+static JsonLogic_ColNode *jsonlogic_colnode_const(JsonLogic_ColCompiler *compiler, JsonLogic_Handle value) {
+    JsonLogic_ColNode *node = jsonlogic_colnode_new(compiler, JsonLogic_ColNode_Const);
+    if (node != NULL) {
+        node->value   = jsonlogic_incref(value);
+        node->numeric = JSONLOGIC_IS_NUMBER(value);
+    }
+    return node;
+}
+
+static bool jsonlogic_colnode_alloc_table(JsonLogic_ColCompiler *compiler, JsonLogic_ColNode *node, size_t size) {
+    node->table = calloc(size > 0 ? size : 1, sizeof(JsonLogic_Handle));
+    node->truth = calloc(size > 0 ? size : 1, sizeof(uint8_t));
+    if (node->table == NULL || node->truth == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        compiler->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        return false;
+    }
+    for (size_t index = 0; index < size; ++ index) {
+        node->table[index] = JsonLogic_Null;
+    }
+    node->table_size = size;
+    return true;
+}
+
+static JsonLogic_ColNode *jsonlogic_colnode_column(JsonLogic_ColCompiler *compiler, const JsonLogic_Column *column) {
+    JsonLogic_ColNode *node = jsonlogic_colnode_new(compiler, JsonLogic_ColNode_Column);
+    if (node == NULL) {
+        return NULL;
+    }
+    node->column = column;
+
+    switch (column->type) {
+        case JsonLogic_Column_Number:
+            node->numeric = true;
+            break;
+
+        case JsonLogic_Column_Boolean:
+            if (!jsonlogic_colnode_alloc_table(compiler, node, 2)) {
+                jsonlogic_colnode_free(node);
+                return NULL;
+            }
+            node->table[0] = JsonLogic_False;
+            node->table[1] = JsonLogic_True;
+            node->truth[1] = 1;
+            break;
+
+        case JsonLogic_Column_Dictionary:
+            if (!jsonlogic_colnode_alloc_table(compiler, node, column->dictionary_size)) {
+                jsonlogic_colnode_free(node);
+                return NULL;
+            }
+            for (size_t index = 0; index < column->dictionary_size; ++ index) {
+                JsonLogic_Handle value = column->dictionary[index];
+                node->table[index] = jsonlogic_incref(value);
+                node->truth[index] = jsonlogic_to_bool(value);
+            }
+            break;
+
+        default:
+            assert(false);
+            jsonlogic_colnode_free(node);
+            return NULL;
+    }
+
+    return node;
+}
+
+static inline bool jsonlogic_colnode_is_categorical(const JsonLogic_ColNode *node) {
+    return node->table != NULL;
+}
+
+// Nodes that never evaluate to an error, so negating their selection bitmap
+// is the same as negating their values.
+static bool jsonlogic_colnode_is_boolean(const JsonLogic_ColNode *node) {
+    return
+        (node->numeric && node->kind != JsonLogic_ColNode_Const) ||
+        node->kind == JsonLogic_ColNode_Compare ||
+        node->kind == JsonLogic_ColNode_Not ||
+        node->kind == JsonLogic_ColNode_ToBool;
+}
+
+// Operations that are evaluated with the numeric kernels if all their
+// arguments are numeric.
+static bool jsonlogic_is_arith_operation(JsonLogic_Operation_Funct funct, size_t argc) {
+    return
+        ((funct == jsonlogic_op_ADD || funct == jsonlogic_op_MUL) && argc > 0) ||
+        (funct == jsonlogic_op_SUB && (argc == 1 || argc == 2)) ||
+        ((funct == jsonlogic_op_DIV || funct == jsonlogic_op_MOD) && argc == 2);
+}
+
+static bool jsonlogic_is_compare_operation(JsonLogic_Operation_Funct funct, size_t argc) {
+    return
+        ((funct == jsonlogic_op_LT || funct == jsonlogic_op_LE ||
+          funct == jsonlogic_op_GT || funct == jsonlogic_op_GE) && (argc == 2 || argc == 3)) ||
+        ((funct == jsonlogic_op_EQ || funct == jsonlogic_op_STRICT_EQ ||
+          funct == jsonlogic_op_NE || funct == jsonlogic_op_STRICT_NE) && argc == 2);
+}
+
+// A pure operation whose arguments are constant or depend on the same boolean
+// or dictionary column is evaluated once per dictionary entry.
+static JsonLogic_ColNode *jsonlogic_colnode_tabulate(JsonLogic_ColCompiler *compiler, JsonLogic_ColNode *node) {
+    const JsonLogic_Column *column = NULL;
+    const JsonLogic_ColNode *source = NULL;
+
+    for (size_t index = 0; index < node->argc; ++ index) {
+        const JsonLogic_ColNode *arg = node->args[index];
+        if (arg->kind == JsonLogic_ColNode_Const) {
+            continue;
+        }
+        if (!jsonlogic_colnode_is_categorical(arg) || (column != NULL && arg->column != column)) {
+            return node;
+        }
+        column = arg->column;
+        source = arg;
+    }
+
+    size_t size = source == NULL ? 1 : source->table_size;
+    JsonLogic_Handle argsbuf[8];
+    JsonLogic_Handle *args = argsbuf;
+    if (node->argc > 8) {
+        args = malloc(sizeof(JsonLogic_Handle) * node->argc);
+        if (args == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            compiler->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+            jsonlogic_colnode_free(node);
+            return NULL;
+        }
+    }
+
+    JsonLogic_ColNode *table = jsonlogic_colnode_new(compiler, JsonLogic_ColNode_Table);
+    if (table == NULL || !jsonlogic_colnode_alloc_table(compiler, table, size)) {
+        jsonlogic_colnode_free(table);
+        jsonlogic_colnode_free(node);
+        if (args != argsbuf) {
+            free(args);
+        }
+        return NULL;
+    }
+    table->column = column;
+
+    for (size_t code = 0; code < size; ++ code) {
+        for (size_t index = 0; index < node->argc; ++ index) {
+            const JsonLogic_ColNode *arg = node->args[index];
+            args[index] = arg->kind == JsonLogic_ColNode_Const ? arg->value : arg->table[code];
+        }
+        JsonLogic_Handle value = node->operation.funct(node->operation.context, JsonLogic_Null, args, node->argc);
+        table->table[code] = value;
+        table->truth[code] = jsonlogic_to_bool(value);
+    }
+
+    if (args != argsbuf) {
+        free(args);
+    }
+
+    jsonlogic_colnode_free(node);
+
+    if (source == NULL) {
+        // all arguments were constant
+        JsonLogic_ColNode *constant = jsonlogic_colnode_const(compiler, table->table[0]);
+        jsonlogic_colnode_free(table);
+        return constant;
+    }
+
+    return table;
+}
+
+static JsonLogic_ColNode *jsonlogic_colnode_compile(JsonLogic_ColCompiler *compiler, JsonLogic_Handle logic);
+
+static JsonLogic_ColNode *jsonlogic_colnode_compile_args(JsonLogic_ColCompiler *compiler, JsonLogic_ColNodeKind kind, const JsonLogic_Handle values[], size_t value_count) {
+    JsonLogic_ColNode *node = jsonlogic_colnode_new(compiler, kind);
+    if (node == NULL) {
+        return NULL;
+    }
+
+    node->args = calloc(value_count > 0 ? value_count : 1, sizeof(JsonLogic_ColNode*));
+    if (node->args == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        compiler->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        jsonlogic_colnode_free(node);
+        return NULL;
+    }
+
+    bool numeric = true;
+    for (; node->argc < value_count; ++ node->argc) {
+        JsonLogic_ColNode *arg = jsonlogic_colnode_compile(compiler, values[node->argc]);
+        if (arg == NULL) {
+            jsonlogic_colnode_free(node);
+            return NULL;
+        }
+        node->args[node->argc] = arg;
+        numeric = numeric && arg->numeric;
+    }
+
+    // reuse numeric for "all arguments are numeric" until the kind is final
+    node->numeric = numeric;
+
+    return node;
+}
+
+static const JsonLogic_Column *jsonlogic_colcompiler_find(const JsonLogic_ColCompiler *compiler, const JsonLogic_String *key) {
+    for (size_t index = 0; index < compiler->column_count; ++ index) {
+        const JsonLogic_String *name = JSONLOGIC_CAST_STRING(compiler->names[index]);
+        if (jsonlogic_utf16_equals(key->str, key->size, name->str, name->size)) {
+            return &compiler->columns[index];
+        }
+    }
+    return NULL;
+}
+
+static JsonLogic_ColNode *jsonlogic_colnode_compile_var(JsonLogic_ColCompiler *compiler, const JsonLogic_Handle values[], size_t value_count) {
+    // the default value is evaluated even if it isn't used
+    if (value_count == 0 || !JSONLOGIC_IS_STRING(values[0]) ||
+        (value_count > 1 && !jsonlogic_is_literal(values[1]))) {
+        return NULL;
+    }
+
+    const JsonLogic_String *key = JSONLOGIC_CAST_STRING(values[0]);
+    if (key->size == 0 || jsonlogic_find_char(key->str, key->size, u'.') != NULL) {
+        return NULL;
+    }
+
+    const JsonLogic_Column *column = jsonlogic_colcompiler_find(compiler, key);
+    if (column == NULL) {
+        // the row doesn't have this key
+        return jsonlogic_colnode_const(compiler, value_count > 1 ? values[1] : JsonLogic_Null);
+    }
+
+    if (value_count > 1 && column->type == JsonLogic_Column_Dictionary) {
+        // a dictionary might contain null, which would need the default value
+        for (size_t index = 0; index < column->dictionary_size; ++ index) {
+            if (JSONLOGIC_IS_NULL(column->dictionary[index])) {
+                return NULL;
+            }
+        }
+    }
+
+    return jsonlogic_colnode_column(compiler, column);
+}
+
+static JsonLogic_ColNode *jsonlogic_colnode_compile(JsonLogic_ColCompiler *compiler, JsonLogic_Handle logic) {
+    if (jsonlogic_is_literal(logic)) {
+        return jsonlogic_colnode_const(compiler, logic);
+    }
+
+    if (JSONLOGIC_IS_ARRAY(logic)) {
+        return NULL;
+    }
+
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+    const JsonLogic_Object_Entry *entry = NULL;
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+            entry = &object->entries[index];
+            break;
+        }
+    }
+    assert(entry != NULL);
+
+    JsonLogic_Handle oparg = entry->value;
+    JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(entry->key);
+
+    size_t value_count;
+    const JsonLogic_Handle *values;
+
+    if (JSONLOGIC_IS_ARRAY(oparg)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(oparg);
+        value_count = array->size;
+        values      = array->items;
+    } else {
+        value_count = 1;
+        values      = &oparg;
+    }
+
+    if (JSONLOGIC_IS_OP(opstr, IF) || JSONLOGIC_IS_OP(opstr, ALT_IF) ||
+        JSONLOGIC_IS_OP(opstr, AND) || JSONLOGIC_IS_OP(opstr, OR)) {
+        if (value_count == 0) {
+            return jsonlogic_colnode_const(compiler, JsonLogic_Null);
+        }
+        JsonLogic_ColNodeKind kind =
+            JSONLOGIC_IS_OP(opstr, AND) ? JsonLogic_ColNode_And :
+            JSONLOGIC_IS_OP(opstr, OR)  ? JsonLogic_ColNode_Or :
+                                          JsonLogic_ColNode_If;
+        JsonLogic_ColNode *node = jsonlogic_colnode_compile_args(compiler, kind, values, value_count);
+        if (node != NULL) {
+            node->numeric = false;
+        }
+        return node;
+    }
+
+    if (JSONLOGIC_IS_OP(opstr, FILTER) || JSONLOGIC_IS_OP(opstr, MAP) ||
+        JSONLOGIC_IS_OP(opstr, REDUCE) || JSONLOGIC_IS_OP(opstr, ALL) ||
+        JSONLOGIC_IS_OP(opstr, SOME)   || JSONLOGIC_IS_OP(opstr, NONE)) {
+        return NULL;
+    }
+
+    uint64_t hash = opstr->hash;
+    if (hash == JSONLOGIC_HASH_UNSET) {
+        hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+    }
+
+    const JsonLogic_Operation *opptr = jsonlogic_operations_get_with_hash(
+        compiler->operations, hash, opstr->str, opstr->size);
+
+    if (opptr == NULL) {
+        // Arguments of unknown operations are never evaluated.
+        return jsonlogic_colnode_const(compiler, JsonLogic_Error_IllegalOperation);
+    }
+
+    if (opptr->funct == jsonlogic_op_VAR) {
+        return jsonlogic_colnode_compile_var(compiler, values, value_count);
+    }
+
+    if (!jsonlogic_is_pure_operation(opptr)) {
+        return NULL;
+    }
+
+    JsonLogic_ColNode *node = jsonlogic_colnode_compile_args(compiler, JsonLogic_ColNode_Call, values, value_count);
+    if (node == NULL) {
+        return NULL;
+    }
+    node->operation = *opptr;
+
+    bool numeric = node->numeric;
+    node->numeric = false;
+
+    if (numeric && jsonlogic_is_arith_operation(opptr->funct, value_count)) {
+        node->kind    = JsonLogic_ColNode_Arith;
+        node->numeric = true;
+    } else if (numeric && jsonlogic_is_compare_operation(opptr->funct, value_count)) {
+        node->kind = JsonLogic_ColNode_Compare;
+    } else if ((opptr->funct == jsonlogic_op_NOT || opptr->funct == jsonlogic_op_TO_BOOL) && value_count > 0 &&
+               jsonlogic_colnode_is_boolean(node->args[0])) {
+        node->kind = opptr->funct == jsonlogic_op_NOT ? JsonLogic_ColNode_Not : JsonLogic_ColNode_ToBool;
+    } else {
+        return jsonlogic_colnode_tabulate(compiler, node);
+    }
+
+    return node;
+}
+
+// ---- kernels ----
+
+static inline void jsonlogic_mask_clear(uint64_t mask[]) {
+    memset(mask, 0, sizeof(uint64_t) * JSONLOGIC_COLUMNAR_WORDS);
+}
+
+static inline void jsonlogic_mask_fill(uint64_t mask[], size_t count) {
+    for (size_t word = 0; word < JSONLOGIC_COLUMNAR_WORDS; ++ word) {
+        size_t bits = count > word * 64 ? count - word * 64 : 0;
+        mask[word] = bits >= 64 ? UINT64_MAX : bits == 0 ? 0 : (UINT64_C(1) << bits) - 1;
+    }
+}
+
+static inline bool jsonlogic_mask_get(const uint64_t mask[], size_t index) {
+    return (mask[index / 64] >> (index % 64)) & 1;
+}
+
+static inline void jsonlogic_mask_set(uint64_t mask[], size_t index) {
+    mask[index / 64] |= UINT64_C(1) << (index % 64);
+}
+
+#if defined(JSONLOGIC_COLUMNAR_SSE2)
+    #define JSONLOGIC_DEF_ARITH_KERNEL(NAME, OP, SSE2_OP) \
+        static void NAME(double *out, const double *a, const double *b, size_t count) { \
+            size_t index = 0; \
+            for (; index + 2 <= count; index += 2) { \
+                _mm_storeu_pd(out + index, SSE2_OP(_mm_loadu_pd(a + index), _mm_loadu_pd(b + index))); \
+            } \
+            for (; index < count; ++ index) { \
+                out[index] = a[index] OP b[index]; \
+            } \
+        }
+
+    #define JSONLOGIC_DEF_COMPARE_KERNEL(NAME, OP, SSE2_OP) \
+        static void NAME(uint64_t mask[], const double *a, const double *b, size_t count) { \
+            jsonlogic_mask_clear(mask); \
+            size_t index = 0; \
+            for (; index + 2 <= count; index += 2) { \
+                uint64_t bits = (uint64_t)_mm_movemask_pd(SSE2_OP(_mm_loadu_pd(a + index), _mm_loadu_pd(b + index))); \
+                mask[index / 64] |= bits << (index % 64); \
+            } \
+            for (; index < count; ++ index) { \
+                if (a[index] OP b[index]) { \
+                    jsonlogic_mask_set(mask, index); \
+                } \
+            } \
+        }
+#else
+    #define JSONLOGIC_DEF_ARITH_KERNEL(NAME, OP, SSE2_OP) \
+        static void NAME(double *out, const double *a, const double *b, size_t count) { \
+            for (size_t index = 0; index < count; ++ index) { \
+                out[index] = a[index] OP b[index]; \
+            } \
+        }
+
+    #define JSONLOGIC_DEF_COMPARE_KERNEL(NAME, OP, SSE2_OP) \
+        static void NAME(uint64_t mask[], const double *a, const double *b, size_t count) { \
+            jsonlogic_mask_clear(mask); \
+            for (size_t index = 0; index < count; ++ index) { \
+                if (a[index] OP b[index]) { \
+                    jsonlogic_mask_set(mask, index); \
+                } \
+            } \
+        }
+#endif
+
+JSONLOGIC_DEF_ARITH_KERNEL(jsonlogic_kernel_add, +, _mm_add_pd)
+JSONLOGIC_DEF_ARITH_KERNEL(jsonlogic_kernel_sub, -, _mm_sub_pd)
+JSONLOGIC_DEF_ARITH_KERNEL(jsonlogic_kernel_mul, *, _mm_mul_pd)
+JSONLOGIC_DEF_ARITH_KERNEL(jsonlogic_kernel_div, /, _mm_div_pd)
+
+JSONLOGIC_DEF_COMPARE_KERNEL(jsonlogic_kernel_lt, <,  _mm_cmplt_pd)
+JSONLOGIC_DEF_COMPARE_KERNEL(jsonlogic_kernel_le, <=, _mm_cmple_pd)
+JSONLOGIC_DEF_COMPARE_KERNEL(jsonlogic_kernel_gt, >,  _mm_cmpgt_pd)
+JSONLOGIC_DEF_COMPARE_KERNEL(jsonlogic_kernel_ge, >=, _mm_cmpge_pd)
+JSONLOGIC_DEF_COMPARE_KERNEL(jsonlogic_kernel_eq, ==, _mm_cmpeq_pd)
+JSONLOGIC_DEF_COMPARE_KERNEL(jsonlogic_kernel_ne, !=, _mm_cmpneq_pd)
+
+// 0 and NaN are falsy
+static void jsonlogic_kernel_truthy(uint64_t mask[], const double *a, size_t count) {
+    jsonlogic_mask_clear(mask);
+    size_t index = 0;
+#if defined(JSONLOGIC_COLUMNAR_SSE2)
+    const __m128d zero = _mm_setzero_pd();
+    for (; index + 2 <= count; index += 2) {
+        __m128d value = _mm_loadu_pd(a + index);
+        uint64_t bits = (uint64_t)_mm_movemask_pd(_mm_or_pd(_mm_cmplt_pd(value, zero), _mm_cmpgt_pd(value, zero)));
+        mask[index / 64] |= bits << (index % 64);
+    }
+#endif
+    for (; index < count; ++ index) {
+        if (a[index] < 0.0 || a[index] > 0.0) {
+            jsonlogic_mask_set(mask, index);
+        }
+    }
+}
+
+static void jsonlogic_kernel_lookup(uint64_t mask[], const uint8_t *truth, const JsonLogic_Column *column, size_t start, size_t count) {
+    jsonlogic_mask_clear(mask);
+    if (column->type == JsonLogic_Column_Boolean) {
+        const bool *booleans = column->booleans + start;
+        for (size_t index = 0; index < count; ++ index) {
+            mask[index / 64] |= (uint64_t)truth[booleans[index]] << (index % 64);
+        }
+    } else {
+        const uint32_t *codes = column->codes + start;
+        for (size_t index = 0; index < count; ++ index) {
+            mask[index / 64] |= (uint64_t)truth[codes[index]] << (index % 64);
+        }
+    }
+}
+
+// ---- evaluation ----
+
+static const double *jsonlogic_colnode_numbers(const JsonLogic_ColNode *node, size_t start, size_t count, double *buf) {
+    assert(node->numeric);
+    switch (node->kind) {
+        case JsonLogic_ColNode_Const:
+        {
+            double value = JSONLOGIC_HNDL_TO_NUM(node->value);
+            for (size_t index = 0; index < count; ++ index) {
+                buf[index] = value;
+            }
+            return buf;
+        }
+        case JsonLogic_ColNode_Column:
+            return node->column->numbers + start;
+
+        case JsonLogic_ColNode_Arith:
+        {
+            double argbuf[JSONLOGIC_COLUMNAR_BLOCK];
+            JsonLogic_Operation_Funct funct = node->operation.funct;
+            const double *first = jsonlogic_colnode_numbers(node->args[0], start, count, buf);
+
+            if (funct == jsonlogic_op_ADD || funct == jsonlogic_op_MUL) {
+                // same order of operations as the operation itself, first
+                // may already be buf
+                if (funct == jsonlogic_op_ADD) {
+                    for (size_t index = 0; index < count; ++ index) {
+                        buf[index] = 0.0 + first[index];
+                    }
+                } else {
+                    for (size_t index = 0; index < count; ++ index) {
+                        buf[index] = 1.0 * first[index];
+                    }
+                }
+                for (size_t arg = 1; arg < node->argc; ++ arg) {
+                    const double *numbers = jsonlogic_colnode_numbers(node->args[arg], start, count, argbuf);
+                    (funct == jsonlogic_op_ADD ? jsonlogic_kernel_add : jsonlogic_kernel_mul)(buf, buf, numbers, count);
+                }
+                return buf;
+            }
+
+            if (node->argc == 1) {
+                // unary minus
+                for (size_t index = 0; index < count; ++ index) {
+                    buf[index] = -first[index];
+                }
+                return buf;
+            }
+
+            const double *second = jsonlogic_colnode_numbers(node->args[1], start, count, argbuf);
+            if (funct == jsonlogic_op_SUB) {
+                jsonlogic_kernel_sub(buf, first, second, count);
+            } else if (funct == jsonlogic_op_DIV) {
+                jsonlogic_kernel_div(buf, first, second, count);
+            } else {
+                for (size_t index = 0; index < count; ++ index) {
+                    buf[index] = fmod(first[index], second[index]);
+                }
+            }
+            return buf;
+        }
+        default:
+            assert(false);
+            return buf;
+    }
+}
+
+static void jsonlogic_colnode_compare(const JsonLogic_ColNode *node, const JsonLogic_ColNode *left, const JsonLogic_ColNode *right, size_t start, size_t count, uint64_t mask[]) {
+    double abuf[JSONLOGIC_COLUMNAR_BLOCK];
+    double bbuf[JSONLOGIC_COLUMNAR_BLOCK];
+    const double *a = jsonlogic_colnode_numbers(left,  start, count, abuf);
+    const double *b = jsonlogic_colnode_numbers(right, start, count, bbuf);
+    JsonLogic_Operation_Funct funct = node->operation.funct;
+
+    if      (funct == jsonlogic_op_LT) jsonlogic_kernel_lt(mask, a, b, count);
+    else if (funct == jsonlogic_op_LE) jsonlogic_kernel_le(mask, a, b, count);
+    else if (funct == jsonlogic_op_GT) jsonlogic_kernel_gt(mask, a, b, count);
+    else if (funct == jsonlogic_op_GE) jsonlogic_kernel_ge(mask, a, b, count);
+    else if (funct == jsonlogic_op_EQ || funct == jsonlogic_op_STRICT_EQ) jsonlogic_kernel_eq(mask, a, b, count);
+    else jsonlogic_kernel_ne(mask, a, b, count);
+}
+
+static JsonLogic_Error jsonlogic_colnode_values(const JsonLogic_ColNode *node, size_t start, size_t count, JsonLogic_Handle out[]);
+
+static JsonLogic_Error jsonlogic_colnode_mask(const JsonLogic_ColNode *node, size_t start, size_t count, uint64_t mask[]) {
+    if (node->numeric && node->kind != JsonLogic_ColNode_Const) {
+        double buf[JSONLOGIC_COLUMNAR_BLOCK];
+        jsonlogic_kernel_truthy(mask, jsonlogic_colnode_numbers(node, start, count, buf), count);
+        return JSONLOGIC_ERROR_SUCCESS;
+    }
+
+    switch (node->kind) {
+        case JsonLogic_ColNode_Const:
+            if (jsonlogic_to_bool(node->value)) {
+                jsonlogic_mask_fill(mask, count);
+            } else {
+                jsonlogic_mask_clear(mask);
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+
+        case JsonLogic_ColNode_Column:
+        case JsonLogic_ColNode_Table:
+            jsonlogic_kernel_lookup(mask, node->truth, node->column, start, count);
+            return JSONLOGIC_ERROR_SUCCESS;
+
+        case JsonLogic_ColNode_Compare:
+            jsonlogic_colnode_compare(node, node->args[0], node->args[1], start, count, mask);
+            if (node->argc == 3) {
+                uint64_t other[JSONLOGIC_COLUMNAR_WORDS];
+                jsonlogic_colnode_compare(node, node->args[1], node->args[2], start, count, other);
+                for (size_t word = 0; word < JSONLOGIC_COLUMNAR_WORDS; ++ word) {
+                    mask[word] &= other[word];
+                }
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+
+        case JsonLogic_ColNode_And:
+        case JsonLogic_ColNode_Or:
+        {
+            uint64_t other[JSONLOGIC_COLUMNAR_WORDS];
+            TRY(jsonlogic_colnode_mask(node->args[0], start, count, mask));
+            for (size_t arg = 1; arg < node->argc; ++ arg) {
+                TRY(jsonlogic_colnode_mask(node->args[arg], start, count, other));
+                for (size_t word = 0; word < JSONLOGIC_COLUMNAR_WORDS; ++ word) {
+                    mask[word] = node->kind == JsonLogic_ColNode_And ?
+                        mask[word] & other[word] :
+                        mask[word] | other[word];
+                }
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+        case JsonLogic_ColNode_If:
+        {
+            uint64_t remaining[JSONLOGIC_COLUMNAR_WORDS];
+            uint64_t condition[JSONLOGIC_COLUMNAR_WORDS];
+            uint64_t branch[JSONLOGIC_COLUMNAR_WORDS];
+            jsonlogic_mask_fill(remaining, count);
+            jsonlogic_mask_clear(mask);
+
+            size_t arg = 0;
+            for (; arg + 1 < node->argc; arg += 2) {
+                TRY(jsonlogic_colnode_mask(node->args[arg],     start, count, condition));
+                TRY(jsonlogic_colnode_mask(node->args[arg + 1], start, count, branch));
+                for (size_t word = 0; word < JSONLOGIC_COLUMNAR_WORDS; ++ word) {
+                    mask[word] |= remaining[word] & condition[word] & branch[word];
+                    remaining[word] &= ~condition[word];
+                }
+            }
+            if (arg < node->argc) {
+                TRY(jsonlogic_colnode_mask(node->args[arg], start, count, branch));
+                for (size_t word = 0; word < JSONLOGIC_COLUMNAR_WORDS; ++ word) {
+                    mask[word] |= remaining[word] & branch[word];
+                }
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+        case JsonLogic_ColNode_Not:
+        case JsonLogic_ColNode_ToBool:
+        {
+            TRY(jsonlogic_colnode_mask(node->args[0], start, count, mask));
+            if (node->kind == JsonLogic_ColNode_Not) {
+                uint64_t valid[JSONLOGIC_COLUMNAR_WORDS];
+                jsonlogic_mask_fill(valid, count);
+                for (size_t word = 0; word < JSONLOGIC_COLUMNAR_WORDS; ++ word) {
+                    mask[word] = ~mask[word] & valid[word];
+                }
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+        case JsonLogic_ColNode_Call:
+        {
+            JsonLogic_Handle values[JSONLOGIC_COLUMNAR_BLOCK];
+            TRY(jsonlogic_colnode_values(node, start, count, values));
+            jsonlogic_mask_clear(mask);
+            for (size_t index = 0; index < count; ++ index) {
+                if (jsonlogic_to_bool(values[index])) {
+                    jsonlogic_mask_set(mask, index);
+                }
+                jsonlogic_decref(values[index]);
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+        default:
+            assert(false);
+            return JSONLOGIC_ERROR_INTERNAL_ERROR;
+    }
+}
+
+static JsonLogic_Error jsonlogic_colnode_values(const JsonLogic_ColNode *node, size_t start, size_t count, JsonLogic_Handle out[]) {
+    switch (node->kind) {
+        case JsonLogic_ColNode_Const:
+            for (size_t index = 0; index < count; ++ index) {
+                out[index] = jsonlogic_incref(node->value);
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+
+        case JsonLogic_ColNode_Column:
+        case JsonLogic_ColNode_Table:
+            if (node->numeric) {
+                const double *numbers = node->column->numbers + start;
+                for (size_t index = 0; index < count; ++ index) {
+                    out[index] = jsonlogic_number_from(numbers[index]);
+                }
+            } else if (node->column->type == JsonLogic_Column_Boolean) {
+                const bool *booleans = node->column->booleans + start;
+                for (size_t index = 0; index < count; ++ index) {
+                    out[index] = jsonlogic_incref(node->table[booleans[index]]);
+                }
+            } else {
+                const uint32_t *codes = node->column->codes + start;
+                for (size_t index = 0; index < count; ++ index) {
+                    out[index] = jsonlogic_incref(node->table[codes[index]]);
+                }
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+
+        case JsonLogic_ColNode_Arith:
+        {
+            double buf[JSONLOGIC_COLUMNAR_BLOCK];
+            const double *numbers = jsonlogic_colnode_numbers(node, start, count, buf);
+            for (size_t index = 0; index < count; ++ index) {
+                out[index] = jsonlogic_number_from(numbers[index]);
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+        case JsonLogic_ColNode_Compare:
+        case JsonLogic_ColNode_Not:
+        case JsonLogic_ColNode_ToBool:
+        {
+            uint64_t mask[JSONLOGIC_COLUMNAR_WORDS];
+            TRY(jsonlogic_colnode_mask(node, start, count, mask));
+            for (size_t index = 0; index < count; ++ index) {
+                out[index] = jsonlogic_mask_get(mask, index) ? JsonLogic_True : JsonLogic_False;
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+        case JsonLogic_ColNode_And:
+        case JsonLogic_ColNode_Or:
+        case JsonLogic_ColNode_If:
+        case JsonLogic_ColNode_Call:
+        {
+            // all arguments are pure, so evaluating the ones that aren't
+            // needed for a row doesn't change anything
+            const size_t argc = node->argc;
+            if (argc > SIZE_MAX / JSONLOGIC_COLUMNAR_BLOCK / sizeof(JsonLogic_Handle)) {
+                JSONLOGIC_ERROR_MEMORY();
+                return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+            }
+            JsonLogic_Handle *values = malloc(sizeof(JsonLogic_Handle) * JSONLOGIC_COLUMNAR_BLOCK * (argc + 1));
+            if (values == NULL) {
+                JSONLOGIC_ERROR_MEMORY();
+                return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+            }
+            JsonLogic_Handle *args = values + JSONLOGIC_COLUMNAR_BLOCK * argc;
+
+            for (size_t arg = 0; arg < argc; ++ arg) {
+                JsonLogic_Error error = jsonlogic_colnode_values(node->args[arg], start, count, values + JSONLOGIC_COLUMNAR_BLOCK * arg);
+                if (error != JSONLOGIC_ERROR_SUCCESS) {
+                    for (size_t prev = 0; prev < arg; ++ prev) {
+                        for (size_t index = 0; index < count; ++ index) {
+                            jsonlogic_decref(values[JSONLOGIC_COLUMNAR_BLOCK * prev + index]);
+                        }
+                    }
+                    free(values);
+                    return error;
+                }
+            }
+
+            for (size_t index = 0; index < count; ++ index) {
+                for (size_t arg = 0; arg < argc; ++ arg) {
+                    args[arg] = values[JSONLOGIC_COLUMNAR_BLOCK * arg + index];
+                }
+
+                JsonLogic_Handle result;
+                switch (node->kind) {
+                    case JsonLogic_ColNode_And:
+                    case JsonLogic_ColNode_Or:
+                    {
+                        size_t arg = 0;
+                        bool want = node->kind == JsonLogic_ColNode_Or;
+                        while (arg < argc - 1 && jsonlogic_to_bool(args[arg]) != want) {
+                            ++ arg;
+                        }
+                        result = jsonlogic_incref(args[arg]);
+                        break;
+                    }
+                    case JsonLogic_ColNode_If:
+                    {
+                        size_t arg = 0;
+                        while (arg < argc - 1 && !jsonlogic_to_bool(args[arg])) {
+                            arg += 2;
+                        }
+                        result = arg < argc - 1 ? jsonlogic_incref(args[arg + 1]) :
+                                 arg < argc     ? jsonlogic_incref(args[arg]) :
+                                                  JsonLogic_Null;
+                        break;
+                    }
+                    default:
+                        result = node->operation.funct(node->operation.context, JsonLogic_Null, args, argc);
+                        break;
+                }
+
+                for (size_t arg = 0; arg < argc; ++ arg) {
+                    jsonlogic_decref(args[arg]);
+                }
+                out[index] = result;
+            }
+
+            free(values);
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+        default:
+            assert(false);
+            return JSONLOGIC_ERROR_INTERNAL_ERROR;
+    }
+}
+
+static inline void jsonlogic_bitmap_store(uint8_t bitmap[], size_t start, size_t count, const uint64_t mask[]) {
+    // start is always a multiple of the block size
+    uint8_t *bytes = bitmap + start / 8;
+    for (size_t index = 0; index < (count + 7) / 8; ++ index) {
+        bytes[index] = (uint8_t)(mask[index / 8] >> ((index % 8) * 8));
+    }
+}
+
+// Logic that isn't supported by the columnar evaluator is applied to one
+// object per row.
+static JsonLogic_Error jsonlogic_apply_columnar_rows(JsonLogic_Handle logic, const JsonLogic_Column columns[], const JsonLogic_Handle names[], size_t column_count, size_t row_count, uint8_t bitmap[], const JsonLogic_Operations *operations) {
+    JsonLogic_Error error = JSONLOGIC_ERROR_SUCCESS;
+    JsonLogic_Handle rows[JSONLOGIC_COLUMNAR_BLOCK];
+    uint8_t row_bits[JSONLOGIC_COLUMNAR_BLOCK / 8];
+    JsonLogic_Object_Entry *entries = malloc(sizeof(JsonLogic_Object_Entry) * (column_count > 0 ? column_count : 1));
+    JsonLogic_Program *program = jsonlogic_compile(logic, operations);
+
+    if (entries == NULL || program == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+
+    for (size_t start = 0; start < row_count; start += JSONLOGIC_COLUMNAR_BLOCK) {
+        size_t count = row_count - start < JSONLOGIC_COLUMNAR_BLOCK ? row_count - start : JSONLOGIC_COLUMNAR_BLOCK;
+
+        for (size_t index = 0; index < count; ++ index) {
+            size_t row = start + index;
+            for (size_t column_index = 0; column_index < column_count; ++ column_index) {
+                const JsonLogic_Column *column = &columns[column_index];
+                JsonLogic_Handle value;
+                switch (column->type) {
+                    case JsonLogic_Column_Number:
+                        value = jsonlogic_number_from(column->numbers[row]);
+                        break;
+
+                    case JsonLogic_Column_Boolean:
+                        value = column->booleans[row] ? JsonLogic_True : JsonLogic_False;
+                        break;
+
+                    default:
+                        value = column->dictionary[column->codes[row]];
+                        break;
+                }
+                entries[column_index] = (JsonLogic_Object_Entry){ .key = names[column_index], .value = value };
+            }
+            rows[index] = jsonlogic_object_from(entries, column_count);
+        }
+
+        error = jsonlogic_program_apply_batch_bitmap(program, rows, count, row_bits);
+        for (size_t index = 0; index < count; ++ index) {
+            jsonlogic_decref(rows[index]);
+        }
+        if (error != JSONLOGIC_ERROR_SUCCESS) {
+            goto cleanup;
+        }
+        memcpy(bitmap + start / 8, row_bits, (count + 7) / 8);
+    }
+
+cleanup:
+    jsonlogic_program_free(program);
+    free(entries);
+
+    return error;
+}
+
+JsonLogic_Error jsonlogic_apply_columnar(JsonLogic_Handle logic, const JsonLogic_Column columns[], size_t column_count, size_t row_count, uint8_t bitmap[], const JsonLogic_Operations *operations) {
+    JsonLogic_Error error = JSONLOGIC_ERROR_SUCCESS;
+    JsonLogic_ColNode *root = NULL;
+    JsonLogic_Handle *names = calloc(column_count > 0 ? column_count : 1, sizeof(JsonLogic_Handle));
+
+    memset(bitmap, 0, (row_count + 7) / 8);
+
+    if (names == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (size_t index = 0; index < column_count; ++ index) {
+        names[index] = jsonlogic_string_from_utf16(columns[index].name);
+        if (JSONLOGIC_IS_ERROR(names[index])) {
+            error = jsonlogic_get_error(names[index]);
+            goto cleanup;
+        }
+    }
+
+    JsonLogic_ColCompiler compiler = {
+        .operations   = operations,
+        .columns      = columns,
+        .names        = names,
+        .column_count = column_count,
+        .error        = JSONLOGIC_ERROR_SUCCESS,
+    };
+
+    root = jsonlogic_colnode_compile(&compiler, logic);
+    if (root == NULL) {
+        error = compiler.error;
+        if (error == JSONLOGIC_ERROR_SUCCESS) {
+            error = jsonlogic_apply_columnar_rows(logic, columns, names, column_count, row_count, bitmap, operations);
+        }
+        goto cleanup;
+    }
+
+    for (size_t start = 0; start < row_count; start += JSONLOGIC_COLUMNAR_BLOCK) {
+        size_t count = row_count - start < JSONLOGIC_COLUMNAR_BLOCK ? row_count - start : JSONLOGIC_COLUMNAR_BLOCK;
+        uint64_t mask[JSONLOGIC_COLUMNAR_WORDS];
+
+        error = jsonlogic_colnode_mask(root, start, count, mask);
+        if (error != JSONLOGIC_ERROR_SUCCESS) {
+            goto cleanup;
+        }
+
+        jsonlogic_bitmap_store(bitmap, start, count, mask);
+    }
+
+cleanup:
+    jsonlogic_colnode_free(root);
+    for (size_t index = 0; index < column_count; ++ index) {
+        jsonlogic_decref(names[index]);
+    }
+    free(names);
+
+    return error;
+}
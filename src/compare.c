@@ -474,3 +474,96 @@ JsonLogic_Handle jsonlogic_ge(JsonLogic_Handle a, JsonLogic_Handle b) {
 
     return jsonlogic_equal(a, b);
 }
+
+// Structural hash of values, e.g. logic. Numbers are hashed (and compared) by their bits,
+// so that 0 and -0 aren't the same subtree.
+uint64_t jsonlogic_logic_hash(JsonLogic_Handle logic) {
+    if (JSONLOGIC_IS_NUMBER(logic)) {
+        return logic * UINT64_C(0x9e3779b97f4a7c15);
+    }
+
+    switch (logic & JsonLogic_TypeMask) {
+        case JsonLogic_Type_String:
+        {
+            JsonLogic_String *string = JSONLOGIC_CAST_STRING(logic);
+            if (string->hash == JSONLOGIC_HASH_UNSET) {
+                return jsonlogic_hash_fnv1a_utf16(string->str, string->size);
+            }
+            return string->hash;
+        }
+        case JsonLogic_Type_Array:
+        {
+            const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+            uint64_t hash = JsonLogic_Type_Array ^ array->size;
+            for (size_t index = 0; index < array->size; ++ index) {
+                hash = (hash ^ jsonlogic_logic_hash(array->items[index])) * UINT64_C(0x100000001b3);
+            }
+            return hash;
+        }
+        case JsonLogic_Type_Object:
+        {
+            // independent of the order of the entries
+            const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+            uint64_t hash = JsonLogic_Type_Object ^ object->used;
+            for (size_t index = object->first_index; index < object->size; ++ index) {
+                const JsonLogic_Object_Entry *entry = &object->entries[index];
+                if (!JSONLOGIC_IS_NULL(entry->key)) {
+                    hash += jsonlogic_logic_hash(entry->key) * 31 ^ jsonlogic_logic_hash(entry->value);
+                }
+            }
+            return hash;
+        }
+        default:
+            return logic;
+    }
+}
+
+bool jsonlogic_logic_equals(JsonLogic_Handle a, JsonLogic_Handle b) {
+    if (a == b) {
+        return true;
+    }
+
+    if (JSONLOGIC_IS_NUMBER(a) || (a & JsonLogic_TypeMask) != (b & JsonLogic_TypeMask)) {
+        return false;
+    }
+
+    switch (a & JsonLogic_TypeMask) {
+        case JsonLogic_Type_String:
+            return jsonlogic_string_equals(JSONLOGIC_CAST_STRING(a), JSONLOGIC_CAST_STRING(b));
+
+        case JsonLogic_Type_Array:
+        {
+            const JsonLogic_Array *aarray = JSONLOGIC_CAST_ARRAY(a);
+            const JsonLogic_Array *barray = JSONLOGIC_CAST_ARRAY(b);
+            if (aarray->size != barray->size) {
+                return false;
+            }
+            for (size_t index = 0; index < aarray->size; ++ index) {
+                if (!jsonlogic_logic_equals(aarray->items[index], barray->items[index])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case JsonLogic_Type_Object:
+        {
+            const JsonLogic_Object *aobject = JSONLOGIC_CAST_OBJECT(a);
+            const JsonLogic_Object *bobject = JSONLOGIC_CAST_OBJECT(b);
+            if (aobject->used != bobject->used) {
+                return false;
+            }
+            for (size_t index = aobject->first_index; index < aobject->size; ++ index) {
+                const JsonLogic_Object_Entry *entry = &aobject->entries[index];
+                if (!JSONLOGIC_IS_NULL(entry->key)) {
+                    size_t bindex = jsonlogic_object_get_index(bobject, entry->key);
+                    if (bindex >= bobject->size || !jsonlogic_logic_equals(entry->value, bobject->entries[bindex].value)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,1335 @@
+#include "jsonlogic_intern.h"
+#include "jsonlogic_extras.h"
+#include "operation_names.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <uchar.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <inttypes.h>
+
+// Translates a JsonLogic rule into a C function that calls the operation
+// functions directly, so the rule is not interpreted at runtime anymore.
+//
+// Strings used by the rule are emitted as static, immortal objects with the same
+// layout as JsonLogic_String, so the generated function can be called from any
+// number of threads. The generated code uses internal APIs and thus needs to be
+// linked against the static library.
+
+#define HELPER_FILTER (1 << 0)
+#define HELPER_MAP    (1 << 1)
+#define HELPER_REDUCE (1 << 2)
+#define HELPER_ALL    (1 << 3)
+#define HELPER_SOME   (1 << 4)
+#define HELPER_NONE   (1 << 5)
+#define HELPER_REDUCE_SCOPE (1 << 6)
+#define HELPER_SCOPE_VAR    (1 << 7)
+
+#define TARGET_SIZE 64
+
+// Lambdas of reduce that pass jsonlogic_reduce_is_scoped() get the
+// accumulator and the current item as arguments instead of a context object.
+typedef struct Lambda {
+    JsonLogic_Handle logic;
+    bool scoped;
+} Lambda;
+
+typedef struct Generator {
+    const char *name;
+    const Op *ops;
+    const JsonLogic_Operations *operations;
+    bool certlogic;
+    const char *to_bool;
+
+    FILE *decls;
+    FILE *code;
+
+    JsonLogic_Handle *strings;
+    size_t string_count;
+    size_t string_capacity;
+
+    Lambda *lambdas;
+    size_t lambda_count;
+    size_t lambda_capacity;
+    // generating a scoped lambda
+    bool scope;
+
+    size_t var_count;
+    unsigned int helpers;
+    size_t illegal_count;
+} Generator;
+
+static const char *HELPER_FILTER_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_filter(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {\n"
+    "    if (JSONLOGIC_IS_ERROR(items)) {\n"
+    "        return items;\n"
+    "    }\n"
+    "    if (!JSONLOGIC_IS_ARRAY(items) || lambda == NULL) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return jsonlogic_empty_array();\n"
+    "    }\n"
+    "    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);\n"
+    "    JsonLogic_Array *filtered = jsonlogic_array_with_capacity(array->size);\n"
+    "    if (filtered == NULL) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return JsonLogic_Error_OutOfMemory;\n"
+    "    }\n"
+    "    size_t filtered_index = 0;\n"
+    "    for (size_t index = 0; index < array->size; ++ index) {\n"
+    "        JsonLogic_Handle item = array->items[index];\n"
+    "        JsonLogic_Handle condition = lambda(item);\n"
+    "        if (jsonlogic_to_bool(condition)) {\n"
+    "            jsonlogic_incref(item);\n"
+    "            filtered->items[filtered_index ++] = item;\n"
+    "        }\n"
+    "        jsonlogic_decref(condition);\n"
+    "    }\n"
+    "    jsonlogic_decref(items);\n"
+    "    filtered = jsonlogic_array_truncate(filtered, filtered_index);\n"
+    "    return jsonlogic_array_into_handle(filtered);\n"
+    "}\n\n";
+
+static const char *HELPER_MAP_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_map(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {\n"
+    "    if (JSONLOGIC_IS_ERROR(items)) {\n"
+    "        return items;\n"
+    "    }\n"
+    "    if (!JSONLOGIC_IS_ARRAY(items)) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return jsonlogic_empty_array();\n"
+    "    }\n"
+    "    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);\n"
+    "    JsonLogic_Array *mapped = jsonlogic_array_with_capacity(array->size);\n"
+    "    if (mapped == NULL) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return JsonLogic_Error_OutOfMemory;\n"
+    "    }\n"
+    "    for (size_t index = 0; index < array->size; ++ index) {\n"
+    "        mapped->items[index] = lambda(array->items[index]);\n"
+    "    }\n"
+    "    jsonlogic_decref(items);\n"
+    "    return jsonlogic_array_into_handle(mapped);\n"
+    "}\n\n";
+
+static const char *HELPER_REDUCE_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_reduce(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data), JsonLogic_Handle init) {\n"
+    "    if (JSONLOGIC_IS_ERROR(items)) {\n"
+    "        jsonlogic_decref(init);\n"
+    "        return items;\n"
+    "    }\n"
+    "    if (!JSONLOGIC_IS_ARRAY(items)) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return init;\n"
+    "    }\n"
+    "    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);\n"
+    "    JsonLogic_Handle str_accumulator = jsonlogic_string_from_utf16_sized(JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);\n"
+    "    JsonLogic_Handle str_current     = jsonlogic_string_from_utf16_sized(JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);\n"
+    "    JsonLogic_Handle reduce_context  = jsonlogic_object_build(\n"
+    "        { .key = str_accumulator, .value = JsonLogic_Null },\n"
+    "        { .key = str_current,     .value = JsonLogic_Null },\n"
+    "    );\n"
+    "    jsonlogic_decref(str_accumulator);\n"
+    "    jsonlogic_decref(str_current);\n"
+    "    if (JSONLOGIC_IS_ERROR(reduce_context)) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        jsonlogic_decref(init);\n"
+    "        return reduce_context;\n"
+    "    }\n"
+    "    JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(reduce_context);\n"
+    "    size_t accumulator_index = jsonlogic_object_get_index_utf16_with_hash(\n"
+    "        reduce_context_object, JSONLOGIC_ACCUMULATOR_HASH, JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);\n"
+    "    size_t current_index = jsonlogic_object_get_index_utf16_with_hash(\n"
+    "        reduce_context_object, JSONLOGIC_CURRENT_HASH, JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);\n"
+    "    JsonLogic_Handle accumulator = init;\n"
+    "    for (size_t index = 0; index < array->size; ++ index) {\n"
+    "        reduce_context_object->entries[accumulator_index].value = accumulator;\n"
+    "        reduce_context_object->entries[current_index].value     = array->items[index];\n"
+    "        JsonLogic_Handle new_accumulator = lambda(reduce_context);\n"
+    "        jsonlogic_decref(accumulator);\n"
+    "        accumulator = new_accumulator;\n"
+    "        reduce_context_object->entries[accumulator_index].value = JsonLogic_Null;\n"
+    "        reduce_context_object->entries[current_index].value     = JsonLogic_Null;\n"
+    "    }\n"
+    "    jsonlogic_decref(reduce_context);\n"
+    "    jsonlogic_decref(items);\n"
+    "    return accumulator;\n"
+    "}\n\n";
+
+// CertLogic passes the outer data to the reduce lambda as context.data
+static const char *HELPER_CERTLOGIC_REDUCE_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_reduce(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data), JsonLogic_Handle init, JsonLogic_Handle data) {\n"
+    "    if (JSONLOGIC_IS_ERROR(items)) {\n"
+    "        jsonlogic_decref(init);\n"
+    "        return items;\n"
+    "    }\n"
+    "    if (!JSONLOGIC_IS_ARRAY(items)) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return init;\n"
+    "    }\n"
+    "    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);\n"
+    "    JsonLogic_Handle str_accumulator = jsonlogic_string_from_utf16_sized(JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);\n"
+    "    JsonLogic_Handle str_current     = jsonlogic_string_from_utf16_sized(JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);\n"
+    "    JsonLogic_Handle str_data        = jsonlogic_string_from_utf16_sized(JSONLOGIC_DATA, JSONLOGIC_DATA_SIZE);\n"
+    "    JsonLogic_Handle reduce_context  = jsonlogic_object_build(\n"
+    "        { .key = str_accumulator, .value = JsonLogic_Null },\n"
+    "        { .key = str_current,     .value = JsonLogic_Null },\n"
+    "        { .key = str_data,        .value = data           },\n"
+    "    );\n"
+    "    jsonlogic_decref(str_accumulator);\n"
+    "    jsonlogic_decref(str_current);\n"
+    "    jsonlogic_decref(str_data);\n"
+    "    if (JSONLOGIC_IS_ERROR(reduce_context)) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        jsonlogic_decref(init);\n"
+    "        return reduce_context;\n"
+    "    }\n"
+    "    JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(reduce_context);\n"
+    "    size_t accumulator_index = jsonlogic_object_get_index_utf16_with_hash(\n"
+    "        reduce_context_object, JSONLOGIC_ACCUMULATOR_HASH, JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);\n"
+    "    size_t current_index = jsonlogic_object_get_index_utf16_with_hash(\n"
+    "        reduce_context_object, JSONLOGIC_CURRENT_HASH, JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);\n"
+    "    JsonLogic_Handle accumulator = init;\n"
+    "    for (size_t index = 0; index < array->size; ++ index) {\n"
+    "        reduce_context_object->entries[accumulator_index].value = accumulator;\n"
+    "        reduce_context_object->entries[current_index].value     = array->items[index];\n"
+    "        JsonLogic_Handle new_accumulator = lambda(reduce_context);\n"
+    "        jsonlogic_decref(accumulator);\n"
+    "        accumulator = new_accumulator;\n"
+    "        reduce_context_object->entries[accumulator_index].value = JsonLogic_Null;\n"
+    "        reduce_context_object->entries[current_index].value     = JsonLogic_Null;\n"
+    "    }\n"
+    "    jsonlogic_decref(reduce_context);\n"
+    "    jsonlogic_decref(items);\n"
+    "    return accumulator;\n"
+    "}\n\n";
+
+static const char *HELPER_REDUCE_SCOPE_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_reduce_scope(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data), JsonLogic_Handle init, JsonLogic_Handle data) {\n"
+    "    if (JSONLOGIC_IS_ERROR(items)) {\n"
+    "        jsonlogic_decref(init);\n"
+    "        return items;\n"
+    "    }\n"
+    "    if (!JSONLOGIC_IS_ARRAY(items)) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return init;\n"
+    "    }\n"
+    "    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);\n"
+    "    JsonLogic_Handle accumulator = init;\n"
+    "    for (size_t index = 0; index < array->size; ++ index) {\n"
+    "        JsonLogic_Handle new_accumulator = lambda(accumulator, array->items[index], data);\n"
+    "        jsonlogic_decref(accumulator);\n"
+    "        accumulator = new_accumulator;\n"
+    "    }\n"
+    "    jsonlogic_decref(items);\n"
+    "    return accumulator;\n"
+    "}\n\n";
+
+// var in a scoped lambda, value is the accumulator, the current item or
+// (CertLogic) the data named by the first segment of the key
+static const char *HELPER_SCOPE_VAR_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_scope_var(JsonLogic_Handle value, const char16_t *path, size_t size, JsonLogic_Handle default_value) {\n"
+    "    if (JSONLOGIC_IS_NULL(value)) {\n"
+    "        return jsonlogic_incref(default_value);\n"
+    "    }\n"
+    "    return jsonlogic_get_path_utf16(value, path, size, default_value);\n"
+    "}\n\n";
+
+// all() returns false for an empty array, see apply.c
+static const char *HELPER_ALL_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_all(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {\n"
+    "    if (JSONLOGIC_IS_ERROR(items)) {\n"
+    "        return items;\n"
+    "    }\n"
+    "    if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return JsonLogic_False;\n"
+    "    }\n"
+    "    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);\n"
+    "    for (size_t index = 0; index < array->size; ++ index) {\n"
+    "        JsonLogic_Handle condition = lambda(array->items[index]);\n"
+    "        bool value = jsonlogic_to_bool(condition);\n"
+    "        jsonlogic_decref(condition);\n"
+    "        if (!value) {\n"
+    "            jsonlogic_decref(items);\n"
+    "            return JsonLogic_False;\n"
+    "        }\n"
+    "    }\n"
+    "    jsonlogic_decref(items);\n"
+    "    return JsonLogic_True;\n"
+    "}\n\n";
+
+static const char *HELPER_SOME_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_some(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {\n"
+    "    if (JSONLOGIC_IS_ERROR(items)) {\n"
+    "        return items;\n"
+    "    }\n"
+    "    if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return JsonLogic_False;\n"
+    "    }\n"
+    "    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);\n"
+    "    for (size_t index = 0; index < array->size; ++ index) {\n"
+    "        JsonLogic_Handle condition = lambda(array->items[index]);\n"
+    "        bool value = jsonlogic_to_bool(condition);\n"
+    "        jsonlogic_decref(condition);\n"
+    "        if (value) {\n"
+    "            jsonlogic_decref(items);\n"
+    "            return JsonLogic_True;\n"
+    "        }\n"
+    "    }\n"
+    "    jsonlogic_decref(items);\n"
+    "    return JsonLogic_False;\n"
+    "}\n\n";
+
+static const char *HELPER_NONE_CODE =
+    "static JsonLogic_Handle jsonlogic_compiled_none(JsonLogic_Handle items, JsonLogic_Handle (*lambda)(JsonLogic_Handle data)) {\n"
+    "    if (JSONLOGIC_IS_ERROR(items)) {\n"
+    "        return items;\n"
+    "    }\n"
+    "    if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {\n"
+    "        jsonlogic_decref(items);\n"
+    "        return JsonLogic_True;\n"
+    "    }\n"
+    "    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);\n"
+    "    for (size_t index = 0; index < array->size; ++ index) {\n"
+    "        JsonLogic_Handle condition = lambda(array->items[index]);\n"
+    "        bool value = jsonlogic_to_bool(condition);\n"
+    "        jsonlogic_decref(condition);\n"
+    "        if (value) {\n"
+    "            jsonlogic_decref(items);\n"
+    "            return JsonLogic_False;\n"
+    "        }\n"
+    "    }\n"
+    "    jsonlogic_decref(items);\n"
+    "    return JsonLogic_True;\n"
+    "}\n\n";
+
+static void emit(FILE *fp, unsigned int indent, const char *fmt, ...) {
+    for (unsigned int index = 0; index < indent; ++ index) {
+        fputs("    ", fp);
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(fp, fmt, ap);
+    va_end(ap);
+}
+
+static const char *find_ident(const Op *ops, const JsonLogic_String *name) {
+    for (const Op *ptr = ops; ptr->name; ++ ptr) {
+        if (jsonlogic_utf16_equals(ptr->name, jsonlogic_utf16_len(ptr->name), name->str, name->size)) {
+            return ptr->ident;
+        }
+    }
+    return NULL;
+}
+
+static bool string_id(Generator *gen, JsonLogic_Handle string, size_t *idptr) {
+    const JsonLogic_String *str = JSONLOGIC_CAST_STRING(string);
+    for (size_t index = 0; index < gen->string_count; ++ index) {
+        if (jsonlogic_string_equals(JSONLOGIC_CAST_STRING(gen->strings[index]), str)) {
+            *idptr = index;
+            return true;
+        }
+    }
+
+    if (gen->string_count == gen->string_capacity) {
+        size_t new_capacity = gen->string_capacity == 0 ? 64 : gen->string_capacity * 2;
+        JsonLogic_Handle *new_strings = realloc(gen->strings, sizeof(JsonLogic_Handle) * new_capacity);
+        if (new_strings == NULL) {
+            perror("allocating strings");
+            return false;
+        }
+        gen->strings = new_strings;
+        gen->string_capacity = new_capacity;
+    }
+
+    size_t id = gen->string_count ++;
+    gen->strings[id] = jsonlogic_incref(string);
+
+    uint64_t hash = jsonlogic_hash_fnv1a_utf16(str->str, str->size);
+    fprintf(gen->decls,
+        "static struct { JsonLogic_RefCount refcount; uint64_t hash; size_t size; char16_t str[%" PRIuPTR "]; } %s_str%" PRIuPTR " = {\n"
+        "    JSONLOGIC_REFCOUNT_IMMORTAL, UINT64_C(0x%" PRIx64 "), %" PRIuPTR ", {",
+        str->size == 0 ? (size_t)1 : str->size, gen->name, id, hash, str->size);
+
+    if (str->size == 0) {
+        fputs(" 0", gen->decls);
+    }
+
+    for (size_t index = 0; index < str->size; ++ index) {
+        if (index % 12 == 0) {
+            fputs("\n       ", gen->decls);
+        }
+        fprintf(gen->decls, " 0x%04x,", (unsigned int)str->str[index]);
+    }
+
+    fputs("\n    }\n}; // \"", gen->decls);
+    for (size_t index = 0; index < str->size; ++ index) {
+        char16_t ch = str->str[index];
+        fputc(ch >= 0x20 && ch < 0x7f && ch != '\\' ? (int)ch : '?', gen->decls);
+    }
+    fputs("\"\n\n", gen->decls);
+
+    *idptr = id;
+    return true;
+}
+
+static bool lambda_id(Generator *gen, JsonLogic_Handle logic, bool scoped, size_t *idptr) {
+    if (gen->lambda_count == gen->lambda_capacity) {
+        size_t new_capacity = gen->lambda_capacity == 0 ? 16 : gen->lambda_capacity * 2;
+        Lambda *new_lambdas = realloc(gen->lambdas, sizeof(Lambda) * new_capacity);
+        if (new_lambdas == NULL) {
+            perror("allocating lambdas");
+            return false;
+        }
+        gen->lambdas = new_lambdas;
+        gen->lambda_capacity = new_capacity;
+    }
+
+    size_t id = gen->lambda_count ++;
+    gen->lambdas[id] = (Lambda){
+        .logic  = jsonlogic_incref(logic),
+        .scoped = scoped,
+    };
+
+    fprintf(gen->decls, "static JsonLogic_Handle %s_lambda%" PRIuPTR "(%sJsonLogic_Handle data);\n\n",
+        gen->name, id, scoped ? "JsonLogic_Handle accumulator, JsonLogic_Handle current, " : "");
+
+    *idptr = id;
+    return true;
+}
+
+static void use_helper(Generator *gen, unsigned int helper) {
+    if (gen->helpers & helper) {
+        return;
+    }
+    gen->helpers |= helper;
+
+    switch (helper) {
+        case HELPER_FILTER: fputs(HELPER_FILTER_CODE, gen->decls); break;
+        case HELPER_MAP:    fputs(HELPER_MAP_CODE,    gen->decls); break;
+        case HELPER_REDUCE:
+            fputs(gen->certlogic ? HELPER_CERTLOGIC_REDUCE_CODE : HELPER_REDUCE_CODE, gen->decls);
+            break;
+        case HELPER_ALL:    fputs(HELPER_ALL_CODE,    gen->decls); break;
+        case HELPER_SOME:   fputs(HELPER_SOME_CODE,   gen->decls); break;
+        case HELPER_NONE:   fputs(HELPER_NONE_CODE,   gen->decls); break;
+        case HELPER_REDUCE_SCOPE: fputs(HELPER_REDUCE_SCOPE_CODE, gen->decls); break;
+        case HELPER_SCOPE_VAR:    fputs(HELPER_SCOPE_VAR_CODE,    gen->decls); break;
+        default:
+            assert(false);
+    }
+}
+
+// Emit code that assigns the value itself (not evaluated as logic) to target.
+static bool generate_value(Generator *gen, JsonLogic_Handle value, const char *target, unsigned int indent) {
+    FILE *fp = gen->code;
+
+    if (JSONLOGIC_IS_NUMBER(value)) {
+        emit(fp, indent, "%s = (JsonLogic_Handle)UINT64_C(0x%016" PRIx64 "); // %.17g\n",
+            target, value, JSONLOGIC_HNDL_TO_NUM(value));
+    } else if (JSONLOGIC_IS_NULL(value)) {
+        emit(fp, indent, "%s = JsonLogic_Null;\n", target);
+    } else if (JSONLOGIC_IS_TRUE(value)) {
+        emit(fp, indent, "%s = JsonLogic_True;\n", target);
+    } else if (JSONLOGIC_IS_FALSE(value)) {
+        emit(fp, indent, "%s = JsonLogic_False;\n", target);
+    } else if (JSONLOGIC_IS_STRING(value)) {
+        size_t id = 0;
+        if (!string_id(gen, value, &id)) {
+            return false;
+        }
+        // immortal, no need to incref
+        emit(fp, indent, "%s = JSONLOGIC_COMPILED_STRING(%s_str%" PRIuPTR ");\n",
+            target, gen->name, id);
+    } else if (JSONLOGIC_IS_ARRAY(value)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(value);
+        if (array->size == 0) {
+            emit(fp, indent, "%s = jsonlogic_empty_array();\n", target);
+            return true;
+        }
+        size_t var = gen->var_count ++;
+        emit(fp, indent, "{\n");
+        emit(fp, indent + 1, "JsonLogic_Array *array%" PRIuPTR " = jsonlogic_array_with_capacity(%" PRIuPTR ");\n", var, array->size);
+        emit(fp, indent + 1, "if (array%" PRIuPTR " == NULL) {\n", var);
+        emit(fp, indent + 2, "%s = JsonLogic_Error_OutOfMemory;\n", target);
+        emit(fp, indent + 1, "} else {\n");
+        for (size_t index = 0; index < array->size; ++ index) {
+            char item_target[TARGET_SIZE];
+            snprintf(item_target, sizeof(item_target), "array%" PRIuPTR "->items[%" PRIuPTR "]", var, index);
+            if (!generate_value(gen, array->items[index], item_target, indent + 2)) {
+                return false;
+            }
+        }
+        emit(fp, indent + 2, "%s = jsonlogic_array_into_handle(array%" PRIuPTR ");\n", target, var);
+        emit(fp, indent + 1, "}\n");
+        emit(fp, indent, "}\n");
+    } else if (JSONLOGIC_IS_OBJECT(value)) {
+        const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(value);
+        if (object->used == 0) {
+            emit(fp, indent, "%s = jsonlogic_empty_object();\n", target);
+            return true;
+        }
+        size_t var = gen->var_count ++;
+        size_t entry_index = 0;
+        emit(fp, indent, "{\n");
+        emit(fp, indent + 1, "JsonLogic_Object_Entry entries%" PRIuPTR "[%" PRIuPTR "];\n", var, object->used);
+        for (size_t index = object->first_index; index < object->size; ++ index) {
+            const JsonLogic_Object_Entry *entry = &object->entries[index];
+            if (JSONLOGIC_IS_NULL(entry->key)) {
+                continue;
+            }
+            char entry_target[TARGET_SIZE];
+            snprintf(entry_target, sizeof(entry_target), "entries%" PRIuPTR "[%" PRIuPTR "].key", var, entry_index);
+            if (!generate_value(gen, entry->key, entry_target, indent + 1)) {
+                return false;
+            }
+            snprintf(entry_target, sizeof(entry_target), "entries%" PRIuPTR "[%" PRIuPTR "].value", var, entry_index);
+            if (!generate_value(gen, entry->value, entry_target, indent + 1)) {
+                return false;
+            }
+            ++ entry_index;
+        }
+        assert(entry_index == object->used);
+        emit(fp, indent + 1, "%s = jsonlogic_object_from_and_decref(entries%" PRIuPTR ", %" PRIuPTR ");\n",
+            target, var, object->used);
+        emit(fp, indent, "}\n");
+    } else {
+        fprintf(stderr, "*** error: cannot compile value of type %s\n",
+            jsonlogic_get_type_name(jsonlogic_get_type(value)));
+        return false;
+    }
+
+    return true;
+}
+
+static bool generate_logic(Generator *gen, JsonLogic_Handle logic, const char *target, unsigned int indent);
+
+// Generates items (evaluated) and hands them to a loop helper, e.g.:
+// target = jsonlogic_compiled_map(items, lambda);
+static bool generate_loop(Generator *gen, const char *helper, JsonLogic_Handle items, JsonLogic_Handle lambda, bool has_lambda, const char *target, unsigned int indent) {
+    FILE *fp = gen->code;
+    size_t var = gen->var_count ++;
+    char items_target[TARGET_SIZE];
+    snprintf(items_target, sizeof(items_target), "items%" PRIuPTR, var);
+
+    emit(fp, indent, "{\n");
+    emit(fp, indent + 1, "JsonLogic_Handle %s;\n", items_target);
+    if (!generate_logic(gen, items, items_target, indent + 1)) {
+        return false;
+    }
+
+    if (has_lambda) {
+        size_t id = 0;
+        if (!lambda_id(gen, lambda, false, &id)) {
+            return false;
+        }
+        emit(fp, indent + 1, "%s = jsonlogic_compiled_%s(%s, %s_lambda%" PRIuPTR ");\n",
+            target, helper, items_target, gen->name, id);
+    } else {
+        emit(fp, indent + 1, "%s = jsonlogic_compiled_%s(%s, NULL);\n", target, helper, items_target);
+    }
+    emit(fp, indent, "}\n");
+
+    return true;
+}
+
+// var in a scoped lambda, see jsonlogic_path_get_scoped(). The first segment
+// of the key selects the argument of the lambda, the rest is looked up in it.
+static bool generate_scope_var(Generator *gen, const JsonLogic_Handle values[], size_t value_count, const char *target, unsigned int indent) {
+    FILE *fp = gen->code;
+    // ensured by jsonlogic_reduce_is_scoped()
+    assert(value_count > 0 && JSONLOGIC_IS_STRING(values[0]));
+    const JsonLogic_String *key = JSONLOGIC_CAST_STRING(values[0]);
+    const char16_t *dot = jsonlogic_find_char(key->str, key->size, u'.');
+    size_t first_size = dot == NULL ? key->size : (size_t)(dot - key->str);
+
+    const char *value;
+    if (jsonlogic_utf16_equals(key->str, first_size, JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE)) {
+        value = "accumulator";
+    } else if (jsonlogic_utf16_equals(key->str, first_size, JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE)) {
+        value = "current";
+    } else if (gen->certlogic && jsonlogic_utf16_equals(key->str, first_size, JSONLOGIC_DATA, JSONLOGIC_DATA_SIZE)) {
+        value = "data";
+    } else {
+        value = "JsonLogic_Null";
+    }
+
+    use_helper(gen, HELPER_SCOPE_VAR);
+
+    char path[TARGET_SIZE];
+    size_t path_size = dot == NULL ? 0 : key->size - first_size - 1;
+    if (path_size == 0) {
+        snprintf(path, sizeof(path), "NULL, 0");
+    } else {
+        JsonLogic_Handle rest = jsonlogic_string_from_utf16_sized(dot + 1, path_size);
+        if (JSONLOGIC_IS_ERROR(rest)) {
+            perror("allocating var path");
+            return false;
+        }
+        size_t id = 0;
+        bool ok = string_id(gen, rest, &id);
+        jsonlogic_decref(rest);
+        if (!ok) {
+            return false;
+        }
+        snprintf(path, sizeof(path), "%s_str%" PRIuPTR ".str, %" PRIuPTR, gen->name, id, path_size);
+    }
+
+    if (value_count == 1) {
+        emit(fp, indent, "%s = jsonlogic_compiled_scope_var(%s, %s, JsonLogic_Null);\n", target, value, path);
+        return true;
+    }
+
+    // only the default value is evaluated
+    size_t var = gen->var_count ++;
+    emit(fp, indent, "{\n");
+    emit(fp, indent + 1, "JsonLogic_Handle args%" PRIuPTR "[%" PRIuPTR "];\n", var, value_count - 1);
+    for (size_t index = 1; index < value_count; ++ index) {
+        char arg_target[TARGET_SIZE];
+        snprintf(arg_target, sizeof(arg_target), "args%" PRIuPTR "[%" PRIuPTR "]", var, index - 1);
+        if (!generate_logic(gen, values[index], arg_target, indent + 1)) {
+            return false;
+        }
+    }
+    emit(fp, indent + 1, "%s = jsonlogic_compiled_scope_var(%s, %s, args%" PRIuPTR "[0]);\n", target, value, path, var);
+    for (size_t index = 1; index < value_count; ++ index) {
+        emit(fp, indent + 1, "jsonlogic_decref(args%" PRIuPTR "[%" PRIuPTR "]);\n", var, index - 1);
+    }
+    emit(fp, indent, "}\n");
+
+    return true;
+}
+
+static bool generate_logic(Generator *gen, JsonLogic_Handle logic, const char *target, unsigned int indent) {
+    FILE *fp = gen->code;
+
+    if (JSONLOGIC_IS_ARRAY(logic)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+        size_t var = gen->var_count ++;
+        emit(fp, indent, "{\n");
+        emit(fp, indent + 1, "JsonLogic_Array *array%" PRIuPTR " = jsonlogic_array_with_capacity(%" PRIuPTR ");\n", var, array->size);
+        emit(fp, indent + 1, "if (array%" PRIuPTR " == NULL) {\n", var);
+        emit(fp, indent + 2, "%s = JsonLogic_Error_OutOfMemory;\n", target);
+        emit(fp, indent + 1, "} else {\n");
+        for (size_t index = 0; index < array->size; ++ index) {
+            char item_target[TARGET_SIZE];
+            snprintf(item_target, sizeof(item_target), "array%" PRIuPTR "->items[%" PRIuPTR "]", var, index);
+            if (!generate_logic(gen, array->items[index], item_target, indent + 2)) {
+                return false;
+            }
+        }
+        emit(fp, indent + 2, "%s = jsonlogic_array_into_handle(array%" PRIuPTR ");\n", target, var);
+        emit(fp, indent + 1, "}\n");
+        emit(fp, indent, "}\n");
+        return true;
+    }
+
+    if (!JSONLOGIC_IS_OBJECT(logic)) {
+        return generate_value(gen, logic, target, indent);
+    }
+
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+
+    if (object->used != 1) {
+        return generate_value(gen, logic, target, indent);
+    }
+
+    const JsonLogic_Object_Entry *entry = NULL;
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+            entry = &object->entries[index];
+            break;
+        }
+    }
+    assert(entry != NULL);
+
+    JsonLogic_Handle op    = entry->key;
+    JsonLogic_Handle oparg = entry->value;
+
+    if (!JSONLOGIC_IS_STRING(op)) {
+        return generate_value(gen, logic, target, indent);
+    }
+
+    size_t value_count;
+    const JsonLogic_Handle *values;
+
+    if (JSONLOGIC_IS_ARRAY(oparg)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(oparg);
+        value_count = array->size;
+        values      = array->items;
+    } else {
+        value_count = 1;
+        values      = &oparg;
+    }
+
+    const JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(op);
+    const char *to_bool = gen->to_bool;
+
+    if (gen->certlogic && JSONLOGIC_IS_OP(opstr, IF)) {
+        if (value_count == 0) {
+            emit(fp, indent, "%s = JsonLogic_Null;\n", target);
+            return true;
+        }
+        size_t var = gen->var_count ++;
+        char cond_target[TARGET_SIZE];
+        snprintf(cond_target, sizeof(cond_target), "value%" PRIuPTR, var);
+
+        emit(fp, indent, "{\n");
+        emit(fp, indent + 1, "JsonLogic_Handle %s;\n", cond_target);
+        if (!generate_logic(gen, values[0], cond_target, indent + 1)) {
+            return false;
+        }
+        emit(fp, indent + 1, "bool condition%" PRIuPTR " = %s(%s);\n", var, to_bool, cond_target);
+        emit(fp, indent + 1, "jsonlogic_decref(%s);\n", cond_target);
+        emit(fp, indent + 1, "if (condition%" PRIuPTR ") {\n", var);
+        if (value_count < 2) {
+            emit(fp, indent + 2, "%s = JsonLogic_Null;\n", target);
+        } else if (!generate_logic(gen, values[1], target, indent + 2)) {
+            return false;
+        }
+        emit(fp, indent + 1, "} else {\n");
+        if (value_count < 3) {
+            emit(fp, indent + 2, "%s = JsonLogic_Null;\n", target);
+        } else if (!generate_logic(gen, values[2], target, indent + 2)) {
+            return false;
+        }
+        emit(fp, indent + 1, "}\n");
+        emit(fp, indent, "}\n");
+    } else if (!gen->certlogic && (JSONLOGIC_IS_OP(opstr, IF) || JSONLOGIC_IS_OP(opstr, ALT_IF))) {
+        if (value_count == 0) {
+            emit(fp, indent, "%s = JsonLogic_Null;\n", target);
+            return true;
+        }
+        size_t var = gen->var_count ++;
+        char cond_target[TARGET_SIZE];
+        snprintf(cond_target, sizeof(cond_target), "value%" PRIuPTR, var);
+
+        emit(fp, indent, "do {\n");
+        if (value_count > 1) {
+            emit(fp, indent + 1, "JsonLogic_Handle %s;\n", cond_target);
+            emit(fp, indent + 1, "bool condition%" PRIuPTR ";\n", var);
+        }
+        size_t index = 0;
+        while (index < value_count - 1) {
+            if (!generate_logic(gen, values[index], cond_target, indent + 1)) {
+                return false;
+            }
+            emit(fp, indent + 1, "condition%" PRIuPTR " = %s(%s);\n", var, to_bool, cond_target);
+            emit(fp, indent + 1, "jsonlogic_decref(%s);\n", cond_target);
+            emit(fp, indent + 1, "if (condition%" PRIuPTR ") {\n", var);
+            if (!generate_logic(gen, values[index + 1], target, indent + 2)) {
+                return false;
+            }
+            emit(fp, indent + 2, "break;\n");
+            emit(fp, indent + 1, "}\n");
+            index += 2;
+        }
+        if (index < value_count) {
+            if (!generate_logic(gen, values[index], target, indent + 1)) {
+                return false;
+            }
+        } else {
+            emit(fp, indent + 1, "%s = JsonLogic_Null;\n", target);
+        }
+        emit(fp, indent, "} while (0);\n");
+    } else if (JSONLOGIC_IS_OP(opstr, AND) || (!gen->certlogic && JSONLOGIC_IS_OP(opstr, OR))) {
+        if (value_count == 0) {
+            emit(fp, indent, "%s = JsonLogic_Null;\n", target);
+            return true;
+        }
+        const char *negate = JSONLOGIC_IS_OP(opstr, AND) ? "!" : "";
+        emit(fp, indent, "do {\n");
+        for (size_t index = 0; index < value_count - 1; ++ index) {
+            if (!generate_logic(gen, values[index], target, indent + 1)) {
+                return false;
+            }
+            emit(fp, indent + 1, "if (%s%s(%s)) {\n", negate, to_bool, target);
+            emit(fp, indent + 2, "break;\n");
+            emit(fp, indent + 1, "}\n");
+            emit(fp, indent + 1, "jsonlogic_decref(%s);\n", target);
+        }
+        if (!generate_logic(gen, values[value_count - 1], target, indent + 1)) {
+            return false;
+        }
+        emit(fp, indent, "} while (0);\n");
+    } else if (!gen->certlogic && JSONLOGIC_IS_OP(opstr, FILTER)) {
+        if (value_count == 0) {
+            emit(fp, indent, "%s = jsonlogic_empty_array();\n", target);
+            return true;
+        }
+        use_helper(gen, HELPER_FILTER);
+        // like the interpreter this checks the truthiness of the lambda logic itself
+        bool has_lambda = value_count > 1 && jsonlogic_to_bool(values[1]);
+        return generate_loop(gen, "filter", values[0], has_lambda ? values[1] : JsonLogic_Null, has_lambda, target, indent);
+    } else if (!gen->certlogic && JSONLOGIC_IS_OP(opstr, MAP)) {
+        if (value_count == 0) {
+            emit(fp, indent, "%s = jsonlogic_empty_array();\n", target);
+            return true;
+        }
+        use_helper(gen, HELPER_MAP);
+        return generate_loop(gen, "map", values[0], value_count > 1 ? values[1] : JsonLogic_Null, true, target, indent);
+    } else if (!gen->certlogic && (JSONLOGIC_IS_OP(opstr, ALL) || JSONLOGIC_IS_OP(opstr, SOME) || JSONLOGIC_IS_OP(opstr, NONE))) {
+        bool is_none = JSONLOGIC_IS_OP(opstr, NONE);
+        if (value_count == 0) {
+            emit(fp, indent, "%s = %s;\n", target, is_none ? "JsonLogic_True" : "JsonLogic_False");
+            return true;
+        }
+        const char *helper;
+        if (JSONLOGIC_IS_OP(opstr, ALL)) {
+            use_helper(gen, HELPER_ALL);
+            helper = "all";
+        } else if (is_none) {
+            use_helper(gen, HELPER_NONE);
+            helper = "none";
+        } else {
+            use_helper(gen, HELPER_SOME);
+            helper = "some";
+        }
+        return generate_loop(gen, helper, values[0], value_count > 1 ? values[1] : JsonLogic_Null, true, target, indent);
+    } else if (JSONLOGIC_IS_OP(opstr, REDUCE)) {
+        if (value_count == 0) {
+            emit(fp, indent, "%s = JsonLogic_Null;\n", target);
+            return true;
+        }
+        JsonLogic_Handle lambda = value_count > 1 ? values[1] : JsonLogic_Null;
+        bool scoped = jsonlogic_reduce_is_scoped(lambda, gen->operations, gen->certlogic);
+        use_helper(gen, scoped ? HELPER_REDUCE_SCOPE : HELPER_REDUCE);
+
+        size_t var = gen->var_count ++;
+        char items_target[TARGET_SIZE];
+        char init_target[TARGET_SIZE];
+        snprintf(items_target, sizeof(items_target), "items%" PRIuPTR, var);
+        snprintf(init_target,  sizeof(init_target),  "init%"  PRIuPTR, var);
+
+        emit(fp, indent, "{\n");
+        emit(fp, indent + 1, "JsonLogic_Handle %s;\n", items_target);
+        emit(fp, indent + 1, "JsonLogic_Handle %s;\n", init_target);
+        if (!generate_logic(gen, values[0], items_target, indent + 1)) {
+            return false;
+        }
+        // init is used as is, just like in the interpreter
+        if (!generate_value(gen, value_count > 2 ? values[2] : JsonLogic_Null, init_target, indent + 1)) {
+            return false;
+        }
+        size_t id = 0;
+        if (!lambda_id(gen, lambda, scoped, &id)) {
+            return false;
+        }
+        emit(fp, indent + 1, "%s = jsonlogic_compiled_reduce%s(%s, %s_lambda%" PRIuPTR ", %s%s);\n",
+            target, scoped ? "_scope" : "", items_target, gen->name, id, init_target,
+            scoped || gen->certlogic ? ", data" : "");
+        emit(fp, indent, "}\n");
+    } else {
+        const char *ident = find_ident(gen->ops, opstr);
+        if (ident == NULL) {
+            char *name = jsonlogic_utf16_to_utf8(opstr->str, opstr->size);
+            fprintf(stderr, "*** warning: illegal operation: %s\n", name == NULL ? "?" : name);
+            free(name);
+            ++ gen->illegal_count;
+            // arguments of unknown operations are not evaluated
+            emit(fp, indent, "%s = JsonLogic_Error_IllegalOperation;\n", target);
+            return true;
+        }
+
+        if (gen->scope) {
+            const JsonLogic_Operation *opptr = jsonlogic_operations_get_sized(gen->operations, opstr->str, opstr->size);
+            if (opptr != NULL && opptr->funct == jsonlogic_op_VAR) {
+                return generate_scope_var(gen, values, value_count, target, indent);
+            }
+        }
+
+        if (value_count == 0) {
+            emit(fp, indent, "%s = %s(NULL, data, NULL, 0);\n", target, ident);
+            return true;
+        }
+
+        size_t var = gen->var_count ++;
+        emit(fp, indent, "{\n");
+        emit(fp, indent + 1, "JsonLogic_Handle args%" PRIuPTR "[%" PRIuPTR "];\n", var, value_count);
+        for (size_t index = 0; index < value_count; ++ index) {
+            char arg_target[TARGET_SIZE];
+            snprintf(arg_target, sizeof(arg_target), "args%" PRIuPTR "[%" PRIuPTR "]", var, index);
+            if (!generate_logic(gen, values[index], arg_target, indent + 1)) {
+                return false;
+            }
+        }
+        emit(fp, indent + 1, "%s = %s(NULL, data, args%" PRIuPTR ", %" PRIuPTR ");\n", target, ident, var, value_count);
+        for (size_t index = 0; index < value_count; ++ index) {
+            emit(fp, indent + 1, "jsonlogic_decref(args%" PRIuPTR "[%" PRIuPTR "]);\n", var, index);
+        }
+        emit(fp, indent, "}\n");
+    }
+
+    return true;
+}
+
+static bool generate_function(Generator *gen, const char *qualifier, const char *funcname, JsonLogic_Handle logic, bool scoped) {
+    FILE *fp = gen->code;
+    fprintf(fp, "%sJsonLogic_Handle %s(%sJsonLogic_Handle data) {\n", qualifier, funcname,
+        scoped ? "JsonLogic_Handle accumulator, JsonLogic_Handle current, " : "");
+    emit(fp, 1, "JsonLogic_Handle result;\n");
+    gen->scope = scoped;
+    bool ok = generate_logic(gen, logic, "result", 1);
+    gen->scope = false;
+    if (!ok) {
+        return false;
+    }
+    emit(fp, 1, "return result;\n");
+    fprintf(fp, "}\n\n");
+    return true;
+}
+
+// Lambdas may define further lambdas, so this loops until there are no more.
+static bool generate_lambdas(Generator *gen, size_t start) {
+    for (size_t id = start; id < gen->lambda_count; ++ id) {
+        char funcname[TARGET_SIZE + 64];
+        snprintf(funcname, sizeof(funcname), "%s_lambda%" PRIuPTR, gen->name, id);
+        if (!generate_function(gen, "static ", funcname, gen->lambdas[id].logic, gen->lambdas[id].scoped)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool copy_file(FILE *dest, FILE *src) {
+    char buf[BUFSIZ];
+    rewind(src);
+    for (;;) {
+        size_t count = fread(buf, 1, sizeof(buf), src);
+        if (count == 0) {
+            break;
+        }
+        if (fwrite(buf, 1, count, dest) != count) {
+            return false;
+        }
+    }
+    return !ferror(src);
+}
+
+static JsonLogic_Handle parse_file(const char *filename) {
+    FILE *fp = fopen(filename, "rb");
+    if (fp == NULL) {
+        perror(filename);
+        return JsonLogic_Error_IOError;
+    }
+
+    JsonLogic_Utf8Buf buf = JSONLOGIC_UTF8BUF_INIT;
+    char chunk[BUFSIZ];
+    for (;;) {
+        size_t count = fread(chunk, 1, sizeof(chunk), fp);
+        if (count == 0) {
+            break;
+        }
+        if (jsonlogic_utf8buf_ensure(&buf, count) != JSONLOGIC_ERROR_SUCCESS) {
+            fclose(fp);
+            jsonlogic_utf8buf_free(&buf);
+            perror(filename);
+            return JsonLogic_Error_OutOfMemory;
+        }
+        memcpy(buf.string + buf.used, chunk, count);
+        buf.used += count;
+    }
+
+    if (ferror(fp)) {
+        fclose(fp);
+        jsonlogic_utf8buf_free(&buf);
+        perror(filename);
+        return JsonLogic_Error_IOError;
+    }
+
+    fclose(fp);
+
+    const char *data = buf.string == NULL ? "" : buf.string;
+    JsonLogic_LineInfo info = JSONLOGIC_LINEINFO_INIT;
+    JsonLogic_Handle handle = jsonlogic_parse_sized(data, buf.used, &info);
+
+    JsonLogic_Error error = jsonlogic_get_error(handle);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        jsonlogic_print_parse_error_sized(stderr, data, buf.used, error, info);
+    }
+    jsonlogic_utf8buf_free(&buf);
+
+    return handle;
+}
+
+static bool is_ident(const char *name) {
+    if (*name == 0 || (*name >= '0' && *name <= '9')) {
+        return false;
+    }
+    for (const char *ptr = name; *ptr; ++ ptr) {
+        char ch = *ptr;
+        if (!((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void usage(const char *progname) {
+    printf(
+        "usage: %s [OPTIONS] <logic.json>\n"
+        "       %s [OPTIONS] --tests <tests.json>...\n"
+        "\n"
+        "Translates a JsonLogic rule into a C function:\n"
+        "\n"
+        "    JsonLogic_Handle NAME(JsonLogic_Handle data);\n"
+        "\n"
+        "The generated code uses internal APIs of the library and needs to be linked\n"
+        "against the static library. Operations that are not known at compile time\n"
+        "evaluate to an illegal operation error.\n"
+        "\n"
+        "OPTIONS:\n"
+        "    -h, --help          Print this help message.\n"
+        "    -o, --output=FILE   Write C source to FILE instead of stdout.\n"
+        "    -H, --header=FILE   Also write a header declaring the function to FILE.\n"
+        "    -n, --name=NAME     Name of the generated function. (default: rule)\n"
+        "    -e, --extras        Allow the operations of jsonlogic_extras.h.\n"
+        "    -c, --certlogic     Compile CertLogic instead of JsonLogic.\n"
+        "    -t, --tests         Inputs are lists of [logic, data, expected] tests like\n"
+        "                        tests/tests.json. Generates an array of functions\n"
+        "                        NAME[] (the tests of all inputs in order) and its\n"
+        "                        length NAME_count instead.\n",
+        progname, progname);
+}
+
+// Accepts "-o VALUE", "--output VALUE" and "--output=VALUE".
+static const char *get_option_value(int argc, char *argv[], int *indexptr, const char *short_opt, const char *long_opt) {
+    const char *arg = argv[*indexptr];
+    size_t long_size = strlen(long_opt);
+
+    if (strncmp(arg, long_opt, long_size) == 0 && arg[long_size] == '=') {
+        return arg + long_size + 1;
+    }
+
+    if (strcmp(arg, short_opt) == 0 || strcmp(arg, long_opt) == 0) {
+        if (*indexptr + 1 >= argc) {
+            fprintf(stderr, "*** error: option %s needs an argument\n", arg);
+            return NULL;
+        }
+        ++ *indexptr;
+        return argv[*indexptr];
+    }
+
+    return NULL;
+}
+
+static void print_inputs(FILE *fp, const char *inputs[], size_t input_count) {
+    for (size_t index = 0; index < input_count; ++ index) {
+        fprintf(fp, index == 0 ? "%s" : ", %s", inputs[index]);
+    }
+}
+
+static bool is_option(const char *arg, const char *short_opt, const char *long_opt) {
+    size_t long_size = strlen(long_opt);
+    return strcmp(arg, short_opt) == 0 || strcmp(arg, long_opt) == 0 ||
+        (strncmp(arg, long_opt, long_size) == 0 && arg[long_size] == '=');
+}
+
+int main(int argc, char *argv[]) {
+    const char *progname = argc > 0 ? argv[0] : "compile_logic";
+    const char *output = NULL;
+    const char *header = NULL;
+    const char *name   = "rule";
+    const char **inputs = NULL;
+    size_t input_count  = 0;
+    bool extras    = false;
+    bool certlogic = false;
+    bool tests     = false;
+    int status = 0;
+
+    Generator gen = {
+        .name            = NULL,
+        .ops             = NULL,
+        .operations      = &JsonLogic_Builtins,
+        .certlogic       = false,
+        .to_bool         = "jsonlogic_to_bool",
+        .decls           = NULL,
+        .code            = NULL,
+        .strings         = NULL,
+        .string_count    = 0,
+        .string_capacity = 0,
+        .lambdas         = NULL,
+        .lambda_count    = 0,
+        .lambda_capacity = 0,
+        .scope           = false,
+        .var_count       = 0,
+        .helpers         = 0,
+        .illegal_count   = 0,
+    };
+    JsonLogic_Handle logic = JsonLogic_Null;
+    FILE *fp = NULL;
+    char *funcname = NULL;
+    Op *ops = NULL;
+
+    inputs = malloc(sizeof(const char*) * (argc > 0 ? argc : 1));
+    if (inputs == NULL) {
+        perror("allocating inputs");
+        goto error;
+    }
+
+    for (int index = 1; index < argc; ++ index) {
+        const char *arg = argv[index];
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            usage(progname);
+            goto cleanup;
+        } else if (is_option(arg, "-o", "--output")) {
+            if ((output = get_option_value(argc, argv, &index, "-o", "--output")) == NULL) {
+                goto error;
+            }
+        } else if (is_option(arg, "-H", "--header")) {
+            if ((header = get_option_value(argc, argv, &index, "-H", "--header")) == NULL) {
+                goto error;
+            }
+        } else if (is_option(arg, "-n", "--name")) {
+            if ((name = get_option_value(argc, argv, &index, "-n", "--name")) == NULL) {
+                goto error;
+            }
+        } else if (strcmp(arg, "-e") == 0 || strcmp(arg, "--extras") == 0) {
+            extras = true;
+        } else if (strcmp(arg, "-c") == 0 || strcmp(arg, "--certlogic") == 0) {
+            certlogic = true;
+        } else if (strcmp(arg, "-t") == 0 || strcmp(arg, "--tests") == 0) {
+            tests = true;
+        } else if (arg[0] == '-' && arg[1] != 0) {
+            fprintf(stderr, "*** error: illegal option: %s\n", arg);
+            goto error;
+        } else {
+            inputs[input_count ++] = arg;
+        }
+    }
+
+    if (input_count == 0) {
+        usage(progname);
+        goto error;
+    }
+
+    if (input_count > 1 && !tests) {
+        fprintf(stderr, "*** error: illegal number of arguments\n");
+        goto error;
+    }
+
+    if (!is_ident(name)) {
+        fprintf(stderr, "*** error: not a valid C identifier: %s\n", name);
+        goto error;
+    }
+
+    gen.name      = name;
+    gen.certlogic = certlogic;
+    if (certlogic) {
+        gen.ops        = extras ? certlogic_extra_names : certlogic_names;
+        gen.operations = extras ? &CertLogic_Extras : &CertLogic_Builtins;
+        gen.to_bool    = "certlogic_to_bool";
+    } else if (!extras) {
+        gen.ops        = bultin_names;
+    } else {
+        gen.operations = &JsonLogic_Extras;
+        // JsonLogic_Extras are the builtins plus the extras
+        size_t builtin_count = 0;
+        size_t extra_count   = 0;
+        while (bultin_names[builtin_count].name) ++ builtin_count;
+        while (extra_names[extra_count].name) ++ extra_count;
+        ops = malloc(sizeof(Op) * (builtin_count + extra_count + 1));
+        if (ops == NULL) {
+            perror("allocating operations");
+            goto error;
+        }
+        memcpy(ops, extra_names, sizeof(Op) * extra_count);
+        memcpy(ops + extra_count, bultin_names, sizeof(Op) * (builtin_count + 1));
+        gen.ops = ops;
+    }
+
+    gen.decls = tmpfile();
+    if (gen.decls == NULL) {
+        perror("creating temporary file");
+        goto error;
+    }
+
+    gen.code = tmpfile();
+    if (gen.code == NULL) {
+        perror("creating temporary file");
+        goto error;
+    }
+
+    size_t funcname_size = strlen(name) + 32;
+    funcname = malloc(funcname_size);
+    if (funcname == NULL) {
+        perror("allocating function name");
+        goto error;
+    }
+
+    size_t test_count = 0;
+    if (tests) {
+        for (size_t input_index = 0; input_index < input_count; ++ input_index) {
+            const char *input = inputs[input_index];
+            logic = parse_file(input);
+            if (jsonlogic_is_error(logic)) {
+                goto error;
+            }
+
+            JsonLogic_Iterator iter = jsonlogic_iter(logic);
+            for (;;) {
+                JsonLogic_Handle test = jsonlogic_iter_next(&iter);
+                JsonLogic_Error error = jsonlogic_get_error(test);
+                if (error == JSONLOGIC_ERROR_STOP_ITERATION) {
+                    break;
+                } else if (error != JSONLOGIC_ERROR_SUCCESS) {
+                    fprintf(stderr, "*** error: %s: %s\n", input, jsonlogic_get_error_message(error));
+                    jsonlogic_iter_free(&iter);
+                    goto error;
+                }
+
+                // strings are comments
+                if (!jsonlogic_is_string(test)) {
+                    JsonLogic_Handle test_logic = jsonlogic_get_index(test, 0);
+                    size_t lambda_start = gen.lambda_count;
+                    snprintf(funcname, funcname_size, "%s_%" PRIuPTR, name, test_count);
+                    bool ok = generate_function(&gen, "static ", funcname, test_logic, false) &&
+                              generate_lambdas(&gen, lambda_start);
+                    jsonlogic_decref(test_logic);
+                    if (!ok) {
+                        jsonlogic_decref(test);
+                        jsonlogic_iter_free(&iter);
+                        goto error;
+                    }
+                    ++ test_count;
+                }
+                jsonlogic_decref(test);
+            }
+            jsonlogic_iter_free(&iter);
+            jsonlogic_decref(logic);
+            logic = JsonLogic_Null;
+        }
+
+        fprintf(gen.code, "JsonLogic_Handle (*const %s[])(JsonLogic_Handle data) = {\n", name);
+        for (size_t index = 0; index < test_count; ++ index) {
+            emit(gen.code, 1, "%s_%" PRIuPTR ",\n", name, index);
+        }
+        fprintf(gen.code, "};\n\n");
+        fprintf(gen.code, "const size_t %s_count = %" PRIuPTR ";\n", name, test_count);
+    } else {
+        logic = parse_file(inputs[0]);
+        if (jsonlogic_is_error(logic)) {
+            goto error;
+        }
+
+        if (!generate_function(&gen, "", name, logic, false) || !generate_lambdas(&gen, 0)) {
+            goto error;
+        }
+    }
+
+    if (output != NULL) {
+        fp = fopen(output, "wb");
+        if (fp == NULL) {
+            perror(output);
+            goto error;
+        }
+    } else {
+        fp = stdout;
+    }
+
+    fputs("// generated by compile_logic from ", fp);
+    print_inputs(fp, inputs, input_count);
+    fputs(", do not edit\n", fp);
+    fprintf(fp, "#include \"jsonlogic_intern.h\"\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#include <stdint.h>\n");
+    fprintf(fp, "#include <stdbool.h>\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#ifndef JSONLOGIC_COMPILED_STRING\n");
+    fprintf(fp, "    #define JSONLOGIC_COMPILED_STRING(NAME) (((JsonLogic_Handle)(uintptr_t)&(NAME)) | JsonLogic_Type_String)\n");
+    fprintf(fp, "#endif\n");
+    fprintf(fp, "\n");
+
+    if (!copy_file(fp, gen.decls) || !copy_file(fp, gen.code)) {
+        perror(output == NULL ? "<stdout>" : output);
+        goto error;
+    }
+
+    if (fp != stdout) {
+        if (fclose(fp) != 0) {
+            fp = NULL;
+            perror(output);
+            goto error;
+        }
+        fp = NULL;
+        printf("written: %s\n", output);
+    }
+
+    if (header != NULL) {
+        fp = fopen(header, "wb");
+        if (fp == NULL) {
+            perror(header);
+            goto error;
+        }
+
+        fputs("// generated by compile_logic from ", fp);
+    print_inputs(fp, inputs, input_count);
+    fputs(", do not edit\n", fp);
+        fprintf(fp, "#pragma once\n");
+        fprintf(fp, "\n");
+        fprintf(fp, "#include \"jsonlogic.h\"\n");
+        fprintf(fp, "\n");
+        fprintf(fp, "#ifdef __cplusplus\n");
+        fprintf(fp, "extern \"C\" {\n");
+        fprintf(fp, "#endif\n");
+        fprintf(fp, "\n");
+        if (tests) {
+            fprintf(fp, "extern JsonLogic_Handle (*const %s[])(JsonLogic_Handle data);\n", name);
+            fprintf(fp, "extern const size_t %s_count;\n", name);
+        } else {
+            fprintf(fp, "JsonLogic_Handle %s(JsonLogic_Handle data);\n", name);
+        }
+        fprintf(fp, "\n");
+        fprintf(fp, "#ifdef __cplusplus\n");
+        fprintf(fp, "}\n");
+        fprintf(fp, "#endif\n");
+
+        if (fclose(fp) != 0) {
+            fp = NULL;
+            perror(header);
+            goto error;
+        }
+        fp = NULL;
+        printf("written: %s\n", header);
+    }
+
+    if (gen.illegal_count > 0) {
+        fprintf(stderr, "*** warning: %" PRIuPTR " illegal operation(s) in ", gen.illegal_count);
+        print_inputs(stderr, inputs, input_count);
+        fputc('\n', stderr);
+    }
+
+    goto cleanup;
+
+error:
+    status = 1;
+
+cleanup:
+    if (fp != NULL && fp != stdout) {
+        fclose(fp);
+    }
+    if (gen.decls != NULL) {
+        fclose(gen.decls);
+    }
+    if (gen.code != NULL) {
+        fclose(gen.code);
+    }
+    for (size_t index = 0; index < gen.string_count; ++ index) {
+        jsonlogic_decref(gen.strings[index]);
+    }
+    for (size_t index = 0; index < gen.lambda_count; ++ index) {
+        jsonlogic_decref(gen.lambdas[index].logic);
+    }
+    free(gen.strings);
+    free(gen.lambdas);
+    free(funcname);
+    free(ops);
+    free(inputs);
+    jsonlogic_decref(logic);
+
+    return status;
+}
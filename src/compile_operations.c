@@ -1,4 +1,5 @@
 #include "jsonlogic_intern.h"
+#include "operation_names.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -8,124 +9,6 @@
 #include <assert.h>
 #include <inttypes.h>
 
-typedef struct Op {
-    const char16_t *name;
-    const char *ident;
-} Op;
-
-const Op bultin_names[] = {
-    { u"!",            "jsonlogic_op_NOT"          },
-    { u"!!",           "jsonlogic_op_TO_BOOL"      },
-    { u"!=",           "jsonlogic_op_NE"           },
-    { u"!==",          "jsonlogic_op_STRICT_NE"    },
-    { u"%",            "jsonlogic_op_MOD"          },
-    { u"*",            "jsonlogic_op_MUL"          },
-    { u"+",            "jsonlogic_op_ADD"          },
-    { u"-",            "jsonlogic_op_SUB"          },
-    { u"/",            "jsonlogic_op_DIV"          },
-    { u"<",            "jsonlogic_op_LT"           },
-    { u"<=",           "jsonlogic_op_LE"           },
-    { u"==",           "jsonlogic_op_EQ"           },
-    { u"===",          "jsonlogic_op_STRICT_EQ"    },
-    { u">",            "jsonlogic_op_GT"           },
-    { u">=",           "jsonlogic_op_GE"           },
-    { u"cat",          "jsonlogic_op_CAT"          },
-    { u"in",           "jsonlogic_op_IN"           },
-    { u"log",          "jsonlogic_op_LOG"          },
-    { u"max",          "jsonlogic_op_MAX"          },
-    { u"merge",        "jsonlogic_op_MERGE"        },
-    { u"min",          "jsonlogic_op_MIN"          },
-    { u"missing",      "jsonlogic_op_MISSING"      },
-    { u"missing_some", "jsonlogic_op_MISSING_SOME" },
-    { u"substr",       "jsonlogic_op_SUBSTR"       },
-    { u"var",          "jsonlogic_op_VAR"          },
-    { NULL,            NULL                        },
-};
-
-const Op extra_names[] = {
-    { u"add-years",       "jsonlogic_extra_ADD_YEARS"         },
-    { u"after",           "jsonlogic_extra_AFTER"             },
-    { u"before",          "jsonlogic_extra_BEFORE"            },
-    { u"combinations",    "jsonlogic_extra_COMBINATIONS"      },
-    { u"days",            "jsonlogic_extra_DAYS"              },
-    { u"extractFromUVCI", "jsonlogic_extra_EXTRACT_FROM_UVCI" },
-    { u"format-time",     "jsonlogic_extra_FORMAT_TIME"       },
-    { u"hours",           "jsonlogic_extra_HOURS"             },
-    { u"not-after",       "jsonlogic_extra_NOT_AFTER"         },
-    { u"not-before",      "jsonlogic_extra_NOT_BEFORE"        },
-    { u"now",             "jsonlogic_extra_NOW"               },
-    { u"timestamp",       "jsonlogic_extra_PARSE_TIME"        },
-    { u"plusTime",        "jsonlogic_extra_PLUS_TIME"         },
-    { u"time-since",      "jsonlogic_extra_TIME_SINCE"        },
-    { u"to-array",        "jsonlogic_extra_TO_ARRAY"          },
-    { u"zip",             "jsonlogic_extra_ZIP"               },
-    { NULL,               NULL                                },
-};
-
-const Op certlogic_names[] = {
-    { u"!",               "certlogic_op_NOT"                  },
-    { u"+",               "jsonlogic_op_ADD"                  },
-    { u"<",               "jsonlogic_op_LT"                   },
-    { u">",               "jsonlogic_op_GT"                   },
-    { u"<=",              "jsonlogic_op_LE"                   },
-    { u">=",              "jsonlogic_op_GE"                   },
-    { u"===",             "jsonlogic_op_STRICT_EQ"            },
-    { u"var",             "jsonlogic_op_VAR"                  },
-    { u"in",              "jsonlogic_op_IN"                   },
-    { u"after",           "jsonlogic_extra_AFTER"             },
-    { u"before",          "jsonlogic_extra_BEFORE"            },
-    { u"extractFromUVCI", "jsonlogic_extra_EXTRACT_FROM_UVCI" },
-    { u"not-after",       "jsonlogic_extra_NOT_AFTER"         },
-    { u"not-before",      "jsonlogic_extra_NOT_BEFORE"        },
-    { u"plusTime",        "jsonlogic_extra_PLUS_TIME"         },
-    { NULL,               NULL                                },
-};
-
-const Op certlogic_extra_names[] = {
-    { u"!",               "certlogic_op_NOT"                  },
-    { u"!!",              "certlogic_op_TO_BOOL"              },
-    { u"!=",              "jsonlogic_op_NE"                   },
-    { u"!==",             "jsonlogic_op_STRICT_NE"            },
-    { u"%",               "jsonlogic_op_MOD"                  },
-    { u"*",               "jsonlogic_op_MUL"                  },
-    { u"+",               "jsonlogic_op_ADD"                  },
-    { u"-",               "jsonlogic_op_SUB"                  },
-    { u"/",               "jsonlogic_op_DIV"                  },
-    { u"<",               "jsonlogic_op_LT"                   },
-    { u"<=",              "jsonlogic_op_LE"                   },
-    { u"==",              "jsonlogic_op_EQ"                   },
-    { u"===",             "jsonlogic_op_STRICT_EQ"            },
-    { u">",               "jsonlogic_op_GT"                   },
-    { u">=",              "jsonlogic_op_GE"                   },
-    { u"cat",             "jsonlogic_op_CAT"                  },
-    { u"in",              "jsonlogic_op_IN"                   },
-    { u"log",             "jsonlogic_op_LOG"                  },
-    { u"max",             "jsonlogic_op_MAX"                  },
-    { u"merge",           "jsonlogic_op_MERGE"                },
-    { u"min",             "jsonlogic_op_MIN"                  },
-    { u"missing",         "jsonlogic_op_MISSING"              },
-    { u"missing_some",    "jsonlogic_op_MISSING_SOME"         },
-    { u"substr",          "jsonlogic_op_SUBSTR"               },
-    { u"var",             "jsonlogic_op_VAR"                  },
-    { u"add-years",       "jsonlogic_extra_ADD_YEARS"         },
-    { u"after",           "jsonlogic_extra_AFTER"             },
-    { u"before",          "jsonlogic_extra_BEFORE"            },
-    { u"combinations",    "jsonlogic_extra_COMBINATIONS"      },
-    { u"days",            "jsonlogic_extra_DAYS"              },
-    { u"extractFromUVCI", "jsonlogic_extra_EXTRACT_FROM_UVCI" },
-    { u"format-time",     "jsonlogic_extra_FORMAT_TIME"       },
-    { u"hours",           "jsonlogic_extra_HOURS"             },
-    { u"not-after",       "jsonlogic_extra_NOT_AFTER"         },
-    { u"not-before",      "jsonlogic_extra_NOT_BEFORE"        },
-    { u"now",             "jsonlogic_extra_NOW"               },
-    { u"timestamp",       "jsonlogic_extra_PARSE_TIME"        },
-    { u"plusTime",        "jsonlogic_extra_PLUS_TIME"         },
-    { u"time-since",      "jsonlogic_extra_TIME_SINCE"        },
-    { u"to-array",        "jsonlogic_extra_TO_ARRAY"          },
-    { u"zip",             "jsonlogic_extra_ZIP"               },
-    { NULL,               NULL                                },
-};
-
 typedef struct Entry {
     uint64_t hash;
     const char16_t *key;
@@ -308,6 +191,15 @@ void print_ascii_utf16(FILE *fp, const char16_t *str) {
     }
 }
 
+const char *operation_flags_of(const char *ident) {
+    for (const OpFlags *ptr = operation_flags; ptr->ident; ++ ptr) {
+        if (strcmp(ptr->ident, ident) == 0) {
+            return ptr->flags;
+        }
+    }
+    return "0";
+}
+
 void generate_source(FILE *fp, const char *symname, const char *header, const Table *tbl) {
     fprintf(fp, "#include \"jsonlogic_intern.h\"\n");
     if (header != NULL) {
@@ -325,10 +217,10 @@ void generate_source(FILE *fp, const char *symname, const char *header, const Ta
             fprintf(fp, "        { .hash = 0x%" PRIx64 ", .key = u\"", entry->hash);
             print_ascii_utf16(fp, entry->key);
             fprintf(fp,
-                "\", .key_size = %" PRIuPTR ", .operation = { .context = NULL, .funct = %s } },\n",
-                utf16_len(entry->key), entry->ident);
+                "\", .key_size = %" PRIuPTR ", .operation = { .context = NULL, .funct = %s, .lazy_funct = NULL, .flags = %s } },\n",
+                utf16_len(entry->key), entry->ident, operation_flags_of(entry->ident));
         } else {
-            fprintf(fp, "        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL } },\n");
+            fprintf(fp, "        { .hash = 0x0, .key = NULL, .key_size = 0, .operation = { .context = NULL, .funct = NULL, .lazy_funct = NULL, .flags = 0 } },\n");
         }
     }
 
@@ -0,0 +1,616 @@
+#include "jsonlogic_intern.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+// Boolean rules made of and, or and ! over comparisons of var paths with
+// constants are compiled into one reduced ordered binary decision diagram.
+// Every distinct comparison (atom) is a variable of the diagram, ordered by
+// its first occurrence. Nodes are shared between all rules of the diagram,
+// so every atom is evaluated at most once per input.
+//
+// The interpreter evaluates to an error if a compared value is an error, even
+// when the diagram doesn't need that comparison. Therefore every rule also
+// records the paths it reads and isn't decided by the diagram if any of them
+// is an error.
+
+#define JSONLOGIC_DIAGRAM_FALSE 0
+#define JSONLOGIC_DIAGRAM_TRUE  1
+
+// Diagrams grow exponentially for some rules. Rules that would make the
+// diagram bigger than this are evaluated by the VM instead.
+#define JSONLOGIC_DIAGRAM_MAX_NODES (1 << 16)
+
+// direct mapped and lossy
+#define JSONLOGIC_DIAGRAM_CACHE_SIZE 4096
+
+typedef struct JsonLogic_DiagramPath {
+    JsonLogic_Handle key;
+    JsonLogic_Path *path;
+} JsonLogic_DiagramPath;
+
+typedef struct JsonLogic_DiagramAtom {
+    JsonLogic_Operation operation;
+    size_t path;
+    JsonLogic_Handle constant;
+    bool var_first;
+} JsonLogic_DiagramAtom;
+
+typedef struct JsonLogic_DiagramNode {
+    uint32_t atom;
+    uint32_t low;
+    uint32_t high;
+} JsonLogic_DiagramNode;
+
+typedef struct JsonLogic_DiagramCacheEntry {
+    uint32_t f;
+    uint32_t g;
+    uint32_t h;
+    uint32_t result;
+} JsonLogic_DiagramCacheEntry;
+
+struct JsonLogic_Diagram {
+    size_t path_count;
+    size_t path_capacity;
+    JsonLogic_DiagramPath *paths;
+    size_t atom_count;
+    size_t atom_capacity;
+    JsonLogic_DiagramAtom *atoms;
+    size_t node_count;
+    size_t node_capacity;
+    JsonLogic_DiagramNode *nodes;
+    // index of every node + 1, 0 for free buckets
+    size_t unique_capacity;
+    uint32_t *unique;
+    JsonLogic_DiagramCacheEntry *cache;
+    // per rule the root node or SIZE_MAX if the rule isn't in the diagram
+    size_t rule_count;
+    size_t *roots;
+    // the paths of rule R are rule_paths[path_offsets[R]..path_offsets[R + 1]]
+    size_t *path_offsets;
+    size_t rule_path_count;
+    size_t rule_path_capacity;
+    size_t *rule_paths;
+};
+
+typedef struct JsonLogic_DiagramBuilder {
+    JsonLogic_Diagram *diagram;
+    const JsonLogic_Operations *operations;
+    bool certlogic;
+    // SUCCESS if the rule isn't supported or the diagram got too big
+    JsonLogic_Error error;
+} JsonLogic_DiagramBuilder;
+
+#define JSONLOGIC_DIAGRAM_FAIL UINT32_MAX
+
+static inline uint64_t jsonlogic_diagram_hash(uint32_t a, uint32_t b, uint32_t c) {
+    uint64_t hash = a;
+    hash = hash * UINT64_C(0x100000001b3) ^ b;
+    hash = hash * UINT64_C(0x100000001b3) ^ c;
+    return hash * UINT64_C(0x9e3779b97f4a7c15);
+}
+
+static inline uint32_t jsonlogic_diagram_level(const JsonLogic_Diagram *diagram, uint32_t node) {
+    return node <= JSONLOGIC_DIAGRAM_TRUE ? UINT32_MAX : diagram->nodes[node].atom;
+}
+
+static bool jsonlogic_diagram_grow_unique(JsonLogic_DiagramBuilder *builder) {
+    JsonLogic_Diagram *diagram = builder->diagram;
+    size_t new_capacity = diagram->unique_capacity == 0 ? 256 : diagram->unique_capacity * 2;
+    uint32_t *new_unique = calloc(new_capacity, sizeof(uint32_t));
+    if (new_unique == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        builder->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        return false;
+    }
+
+    for (size_t node = JSONLOGIC_DIAGRAM_TRUE + 1; node < diagram->node_count; ++ node) {
+        const JsonLogic_DiagramNode *entry = &diagram->nodes[node];
+        size_t index = jsonlogic_diagram_hash(entry->atom, entry->low, entry->high) & (new_capacity - 1);
+        while (new_unique[index] != 0) {
+            index = (index + 1) & (new_capacity - 1);
+        }
+        new_unique[index] = (uint32_t)node + 1;
+    }
+
+    free(diagram->unique);
+    diagram->unique          = new_unique;
+    diagram->unique_capacity = new_capacity;
+
+    return true;
+}
+
+// Returns the one node for (atom, low, high).
+static uint32_t jsonlogic_diagram_make(JsonLogic_DiagramBuilder *builder, uint32_t atom, uint32_t low, uint32_t high) {
+    if (low == high) {
+        return low;
+    }
+
+    JsonLogic_Diagram *diagram = builder->diagram;
+    if ((diagram->node_count + 1) * 2 > diagram->unique_capacity && !jsonlogic_diagram_grow_unique(builder)) {
+        return JSONLOGIC_DIAGRAM_FAIL;
+    }
+
+    const size_t mask = diagram->unique_capacity - 1;
+    size_t index = jsonlogic_diagram_hash(atom, low, high) & mask;
+    for (; diagram->unique[index] != 0; index = (index + 1) & mask) {
+        uint32_t node = diagram->unique[index] - 1;
+        const JsonLogic_DiagramNode *entry = &diagram->nodes[node];
+        if (entry->atom == atom && entry->low == low && entry->high == high) {
+            return node;
+        }
+    }
+
+    if (diagram->node_count >= JSONLOGIC_DIAGRAM_MAX_NODES) {
+        return JSONLOGIC_DIAGRAM_FAIL;
+    }
+
+    if (diagram->node_count == diagram->node_capacity) {
+        size_t new_capacity = diagram->node_capacity * 2;
+        JsonLogic_DiagramNode *new_nodes = realloc(diagram->nodes, new_capacity * sizeof(JsonLogic_DiagramNode));
+        if (new_nodes == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            builder->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+            return JSONLOGIC_DIAGRAM_FAIL;
+        }
+        diagram->nodes         = new_nodes;
+        diagram->node_capacity = new_capacity;
+    }
+
+    uint32_t node = (uint32_t)diagram->node_count ++;
+    diagram->nodes[node] = (JsonLogic_DiagramNode){ .atom = atom, .low = low, .high = high };
+    diagram->unique[index] = node + 1;
+
+    return node;
+}
+
+static inline uint32_t jsonlogic_diagram_cofactor(const JsonLogic_Diagram *diagram, uint32_t node, uint32_t atom, bool value) {
+    if (jsonlogic_diagram_level(diagram, node) != atom) {
+        return node;
+    }
+    return value ? diagram->nodes[node].high : diagram->nodes[node].low;
+}
+
+// if f then g else h
+static uint32_t jsonlogic_diagram_ite(JsonLogic_DiagramBuilder *builder, uint32_t f, uint32_t g, uint32_t h) {
+    if (f == JSONLOGIC_DIAGRAM_TRUE)  return g;
+    if (f == JSONLOGIC_DIAGRAM_FALSE) return h;
+    if (g == h) return g;
+    if (g == JSONLOGIC_DIAGRAM_TRUE && h == JSONLOGIC_DIAGRAM_FALSE) return f;
+
+    JsonLogic_Diagram *diagram = builder->diagram;
+    JsonLogic_DiagramCacheEntry *cached = &diagram->cache[jsonlogic_diagram_hash(f, g, h) % JSONLOGIC_DIAGRAM_CACHE_SIZE];
+    if (cached->f == f && cached->g == g && cached->h == h) {
+        return cached->result;
+    }
+
+    uint32_t atom = jsonlogic_diagram_level(diagram, f);
+    uint32_t glevel = jsonlogic_diagram_level(diagram, g);
+    uint32_t hlevel = jsonlogic_diagram_level(diagram, h);
+    if (glevel < atom) atom = glevel;
+    if (hlevel < atom) atom = hlevel;
+
+    uint32_t high = jsonlogic_diagram_ite(builder,
+        jsonlogic_diagram_cofactor(diagram, f, atom, true),
+        jsonlogic_diagram_cofactor(diagram, g, atom, true),
+        jsonlogic_diagram_cofactor(diagram, h, atom, true));
+    if (high == JSONLOGIC_DIAGRAM_FAIL) {
+        return JSONLOGIC_DIAGRAM_FAIL;
+    }
+
+    uint32_t low = jsonlogic_diagram_ite(builder,
+        jsonlogic_diagram_cofactor(diagram, f, atom, false),
+        jsonlogic_diagram_cofactor(diagram, g, atom, false),
+        jsonlogic_diagram_cofactor(diagram, h, atom, false));
+    if (low == JSONLOGIC_DIAGRAM_FAIL) {
+        return JSONLOGIC_DIAGRAM_FAIL;
+    }
+
+    uint32_t result = jsonlogic_diagram_make(builder, atom, low, high);
+    if (result != JSONLOGIC_DIAGRAM_FAIL) {
+        *cached = (JsonLogic_DiagramCacheEntry){ .f = f, .g = g, .h = h, .result = result };
+    }
+
+    return result;
+}
+
+static const JsonLogic_Operation *jsonlogic_diagram_resolve(const JsonLogic_DiagramBuilder *builder, const JsonLogic_String *opstr) {
+    uint64_t hash = opstr->hash;
+    if (hash == JSONLOGIC_HASH_UNSET) {
+        hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+    }
+    return jsonlogic_operations_get_with_hash(builder->operations, hash, opstr->str, opstr->size);
+}
+
+static const JsonLogic_String *jsonlogic_diagram_operation(JsonLogic_Handle logic, const JsonLogic_Handle **valuesptr, size_t *countptr) {
+    if (jsonlogic_is_literal(logic) || !JSONLOGIC_IS_OBJECT(logic)) {
+        return NULL;
+    }
+
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        const JsonLogic_Object_Entry *entry = &object->entries[index];
+        if (!JSONLOGIC_IS_NULL(entry->key)) {
+            if (JSONLOGIC_IS_ARRAY(entry->value)) {
+                const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(entry->value);
+                *countptr  = array->size;
+                *valuesptr = array->items;
+            } else {
+                *countptr  = 1;
+                *valuesptr = &entry->value;
+            }
+            return JSONLOGIC_CAST_STRING(entry->key);
+        }
+    }
+
+    assert(false);
+    return NULL;
+}
+
+// Comparisons that always evaluate to a boolean or an error.
+static bool jsonlogic_is_atom_operation(JsonLogic_Operation_Funct funct) {
+    return
+        funct == jsonlogic_op_LT ||
+        funct == jsonlogic_op_LE ||
+        funct == jsonlogic_op_GT ||
+        funct == jsonlogic_op_GE ||
+        funct == jsonlogic_op_EQ ||
+        funct == jsonlogic_op_NE ||
+        funct == jsonlogic_op_STRICT_EQ ||
+        funct == jsonlogic_op_STRICT_NE ||
+        funct == jsonlogic_op_IN;
+}
+
+// {"var":KEY} or {"var":[KEY]} without a default value
+static bool jsonlogic_diagram_is_var(const JsonLogic_DiagramBuilder *builder, JsonLogic_Handle logic, JsonLogic_Handle *keyptr) {
+    const JsonLogic_Handle *values;
+    size_t value_count;
+    const JsonLogic_String *opstr = jsonlogic_diagram_operation(logic, &values, &value_count);
+    if (opstr == NULL || value_count != 1 || !(JSONLOGIC_IS_STRING(values[0]) || JSONLOGIC_IS_NUMBER(values[0]))) {
+        return false;
+    }
+
+    const JsonLogic_Operation *opptr = jsonlogic_diagram_resolve(builder, opstr);
+    if (opptr == NULL || opptr->funct != jsonlogic_op_VAR) {
+        return false;
+    }
+
+    *keyptr = values[0];
+    return true;
+}
+
+static bool jsonlogic_diagram_add_rule_path(JsonLogic_DiagramBuilder *builder, size_t rule, size_t path) {
+    JsonLogic_Diagram *diagram = builder->diagram;
+
+    for (size_t index = diagram->path_offsets[rule]; index < diagram->rule_path_count; ++ index) {
+        if (diagram->rule_paths[index] == path) {
+            return true;
+        }
+    }
+
+    if (diagram->rule_path_count == diagram->rule_path_capacity) {
+        size_t new_capacity = diagram->rule_path_capacity == 0 ? 16 : diagram->rule_path_capacity * 2;
+        size_t *new_rule_paths = realloc(diagram->rule_paths, new_capacity * sizeof(size_t));
+        if (new_rule_paths == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            builder->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+            return false;
+        }
+        diagram->rule_paths         = new_rule_paths;
+        diagram->rule_path_capacity = new_capacity;
+    }
+
+    diagram->rule_paths[diagram->rule_path_count ++] = path;
+    return true;
+}
+
+static size_t jsonlogic_diagram_path(JsonLogic_DiagramBuilder *builder, JsonLogic_Handle key) {
+    JsonLogic_Diagram *diagram = builder->diagram;
+
+    for (size_t index = 0; index < diagram->path_count; ++ index) {
+        if (jsonlogic_deep_strict_equal(diagram->paths[index].key, key)) {
+            return index;
+        }
+    }
+
+    if (diagram->path_count == diagram->path_capacity) {
+        size_t new_capacity = diagram->path_capacity == 0 ? 16 : diagram->path_capacity * 2;
+        JsonLogic_DiagramPath *new_paths = realloc(diagram->paths, new_capacity * sizeof(JsonLogic_DiagramPath));
+        if (new_paths == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            builder->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+            return SIZE_MAX;
+        }
+        diagram->paths         = new_paths;
+        diagram->path_capacity = new_capacity;
+    }
+
+    JsonLogic_Path *path = jsonlogic_path_compile(key);
+    if (path == NULL) {
+        builder->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        return SIZE_MAX;
+    }
+
+    diagram->paths[diagram->path_count] = (JsonLogic_DiagramPath){
+        .key  = jsonlogic_incref(key),
+        .path = path,
+    };
+
+    return diagram->path_count ++;
+}
+
+static uint32_t jsonlogic_diagram_atom(JsonLogic_DiagramBuilder *builder, size_t rule, const JsonLogic_Operation *opptr, JsonLogic_Handle key, JsonLogic_Handle constant, bool var_first) {
+    JsonLogic_Diagram *diagram = builder->diagram;
+
+    size_t path = jsonlogic_diagram_path(builder, key);
+    if (path == SIZE_MAX || !jsonlogic_diagram_add_rule_path(builder, rule, path)) {
+        return JSONLOGIC_DIAGRAM_FAIL;
+    }
+
+    size_t index = 0;
+    for (; index < diagram->atom_count; ++ index) {
+        const JsonLogic_DiagramAtom *atom = &diagram->atoms[index];
+        if (atom->operation.funct == opptr->funct && atom->operation.context == opptr->context &&
+            atom->path == path && atom->var_first == var_first &&
+            jsonlogic_deep_strict_equal(atom->constant, constant)) {
+            break;
+        }
+    }
+
+    if (index == diagram->atom_count) {
+        if (diagram->atom_count >= JSONLOGIC_DIAGRAM_MAX_NODES) {
+            return JSONLOGIC_DIAGRAM_FAIL;
+        }
+
+        if (diagram->atom_count == diagram->atom_capacity) {
+            size_t new_capacity = diagram->atom_capacity == 0 ? 16 : diagram->atom_capacity * 2;
+            JsonLogic_DiagramAtom *new_atoms = realloc(diagram->atoms, new_capacity * sizeof(JsonLogic_DiagramAtom));
+            if (new_atoms == NULL) {
+                JSONLOGIC_ERROR_MEMORY();
+                builder->error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+                return JSONLOGIC_DIAGRAM_FAIL;
+            }
+            diagram->atoms         = new_atoms;
+            diagram->atom_capacity = new_capacity;
+        }
+
+        diagram->atoms[index] = (JsonLogic_DiagramAtom){
+            .operation = *opptr,
+            .path      = path,
+            .constant  = jsonlogic_incref(constant),
+            .var_first = var_first,
+        };
+        ++ diagram->atom_count;
+    }
+
+    return jsonlogic_diagram_make(builder, (uint32_t)index, JSONLOGIC_DIAGRAM_FALSE, JSONLOGIC_DIAGRAM_TRUE);
+}
+
+static uint32_t jsonlogic_diagram_build(JsonLogic_DiagramBuilder *builder, size_t rule, JsonLogic_Handle logic) {
+    const JsonLogic_Handle *values;
+    size_t value_count;
+    const JsonLogic_String *opstr = jsonlogic_diagram_operation(logic, &values, &value_count);
+
+    if (opstr == NULL) {
+        return JSONLOGIC_DIAGRAM_FAIL;
+    }
+
+    // The same special forms as in apply.c. Without arguments they are null,
+    // not a boolean.
+    bool is_and = JSONLOGIC_IS_OP(opstr, AND);
+    if (is_and || (!builder->certlogic && JSONLOGIC_IS_OP(opstr, OR))) {
+        if (value_count == 0) {
+            return JSONLOGIC_DIAGRAM_FAIL;
+        }
+        uint32_t result = jsonlogic_diagram_build(builder, rule, values[0]);
+        for (size_t index = 1; index < value_count && result != JSONLOGIC_DIAGRAM_FAIL; ++ index) {
+            uint32_t arg = jsonlogic_diagram_build(builder, rule, values[index]);
+            if (arg == JSONLOGIC_DIAGRAM_FAIL) {
+                return JSONLOGIC_DIAGRAM_FAIL;
+            }
+            result = is_and ?
+                jsonlogic_diagram_ite(builder, result, arg, JSONLOGIC_DIAGRAM_FALSE) :
+                jsonlogic_diagram_ite(builder, result, JSONLOGIC_DIAGRAM_TRUE, arg);
+        }
+        return result;
+    }
+
+    if (JSONLOGIC_IS_OP(opstr, IF) || JSONLOGIC_IS_OP(opstr, OR) || JSONLOGIC_IS_OP(opstr, REDUCE) ||
+        JSONLOGIC_IS_OP(opstr, ALT_IF) || JSONLOGIC_IS_OP(opstr, FILTER) || JSONLOGIC_IS_OP(opstr, MAP) ||
+        JSONLOGIC_IS_OP(opstr, ALL) || JSONLOGIC_IS_OP(opstr, SOME) || JSONLOGIC_IS_OP(opstr, NONE)) {
+        return JSONLOGIC_DIAGRAM_FAIL;
+    }
+
+    const JsonLogic_Operation *opptr = jsonlogic_diagram_resolve(builder, opstr);
+    if (opptr == NULL) {
+        return JSONLOGIC_DIAGRAM_FAIL;
+    }
+
+    if (opptr->funct == jsonlogic_op_NOT || opptr->funct == certlogic_op_NOT) {
+        // more arguments would still be evaluated
+        if (value_count != 1) {
+            return JSONLOGIC_DIAGRAM_FAIL;
+        }
+        uint32_t arg = jsonlogic_diagram_build(builder, rule, values[0]);
+        if (arg == JSONLOGIC_DIAGRAM_FAIL) {
+            return JSONLOGIC_DIAGRAM_FAIL;
+        }
+        return jsonlogic_diagram_ite(builder, arg, JSONLOGIC_DIAGRAM_FALSE, JSONLOGIC_DIAGRAM_TRUE);
+    }
+
+    if (jsonlogic_is_atom_operation(opptr->funct) && value_count == 2) {
+        JsonLogic_Handle key;
+        if (jsonlogic_diagram_is_var(builder, values[0], &key) && jsonlogic_is_literal(values[1])) {
+            return jsonlogic_diagram_atom(builder, rule, opptr, key, values[1], true);
+        }
+        if (jsonlogic_diagram_is_var(builder, values[1], &key) && jsonlogic_is_literal(values[0])) {
+            return jsonlogic_diagram_atom(builder, rule, opptr, key, values[0], false);
+        }
+    }
+
+    return JSONLOGIC_DIAGRAM_FAIL;
+}
+
+JsonLogic_Diagram *jsonlogic_diagram_compile(const JsonLogic_Handle rules[], size_t rule_count, const JsonLogic_Operations *operations, bool certlogic) {
+    JsonLogic_Diagram *diagram = calloc(1, sizeof(JsonLogic_Diagram));
+    if (diagram == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    diagram->rule_count    = rule_count;
+    diagram->roots         = malloc(sizeof(size_t) * (rule_count > 0 ? rule_count : 1));
+    diagram->path_offsets  = malloc(sizeof(size_t) * (rule_count + 1));
+    diagram->node_capacity = 64;
+    diagram->nodes         = malloc(sizeof(JsonLogic_DiagramNode) * diagram->node_capacity);
+    // no valid entry has f == 0
+    diagram->cache         = calloc(JSONLOGIC_DIAGRAM_CACHE_SIZE, sizeof(JsonLogic_DiagramCacheEntry));
+    if (diagram->roots == NULL || diagram->path_offsets == NULL || diagram->nodes == NULL || diagram->cache == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        jsonlogic_diagram_free(diagram);
+        return NULL;
+    }
+
+    // the terminals
+    diagram->nodes[JSONLOGIC_DIAGRAM_FALSE] = (JsonLogic_DiagramNode){ .atom = UINT32_MAX, .low = 0, .high = 0 };
+    diagram->nodes[JSONLOGIC_DIAGRAM_TRUE]  = (JsonLogic_DiagramNode){ .atom = UINT32_MAX, .low = 1, .high = 1 };
+    diagram->node_count = 2;
+
+    JsonLogic_DiagramBuilder builder = {
+        .diagram    = diagram,
+        .operations = operations,
+        .certlogic  = certlogic,
+        .error      = JSONLOGIC_ERROR_SUCCESS,
+    };
+
+    for (size_t rule = 0; rule < rule_count; ++ rule) {
+        diagram->path_offsets[rule] = diagram->rule_path_count;
+        uint32_t root = jsonlogic_diagram_build(&builder, rule, rules[rule]);
+        if (builder.error != JSONLOGIC_ERROR_SUCCESS) {
+            jsonlogic_diagram_free(diagram);
+            return NULL;
+        }
+        if (root == JSONLOGIC_DIAGRAM_FAIL) {
+            // atoms that were already added stay, they just aren't used by this rule
+            diagram->rule_path_count = diagram->path_offsets[rule];
+            diagram->roots[rule] = SIZE_MAX;
+        } else {
+            diagram->roots[rule] = root;
+        }
+    }
+    diagram->path_offsets[rule_count] = diagram->rule_path_count;
+
+    // only needed while building
+    free(diagram->cache);
+    free(diagram->unique);
+    diagram->cache           = NULL;
+    diagram->unique          = NULL;
+    diagram->unique_capacity = 0;
+
+    return diagram;
+}
+
+void jsonlogic_diagram_free(JsonLogic_Diagram *diagram) {
+    if (diagram != NULL) {
+        for (size_t index = 0; index < diagram->path_count; ++ index) {
+            jsonlogic_path_free(diagram->paths[index].path);
+            jsonlogic_decref(diagram->paths[index].key);
+        }
+        for (size_t index = 0; index < diagram->atom_count; ++ index) {
+            jsonlogic_decref(diagram->atoms[index].constant);
+        }
+        free(diagram->paths);
+        free(diagram->atoms);
+        free(diagram->nodes);
+        free(diagram->unique);
+        free(diagram->cache);
+        free(diagram->roots);
+        free(diagram->path_offsets);
+        free(diagram->rule_paths);
+        free(diagram);
+    }
+}
+
+size_t jsonlogic_diagram_get_atom_count(const JsonLogic_Diagram *diagram) {
+    return diagram->atom_count;
+}
+
+size_t jsonlogic_diagram_get_path_count(const JsonLogic_Diagram *diagram) {
+    return diagram->path_count;
+}
+
+bool jsonlogic_diagram_has_rule(const JsonLogic_Diagram *diagram, size_t rule) {
+    return diagram->roots[rule] != SIZE_MAX;
+}
+
+void jsonlogic_diagram_reset(const JsonLogic_Diagram *diagram, uint8_t atoms[], JsonLogic_Handle values[]) {
+    memset(atoms, JSONLOGIC_ATOM_UNKNOWN, diagram->atom_count);
+    for (size_t index = 0; index < diagram->path_count; ++ index) {
+        values[index] = JSONLOGIC_SLOT_UNSET;
+    }
+}
+
+void jsonlogic_diagram_release(const JsonLogic_Diagram *diagram, JsonLogic_Handle values[]) {
+    for (size_t index = 0; index < diagram->path_count; ++ index) {
+        if (values[index] != JSONLOGIC_SLOT_UNSET) {
+            jsonlogic_decref(values[index]);
+        }
+    }
+}
+
+static inline JsonLogic_Handle jsonlogic_diagram_value(const JsonLogic_Diagram *diagram, size_t path, JsonLogic_Handle input, JsonLogic_Handle values[]) {
+    JsonLogic_Handle value = values[path];
+    if (value == JSONLOGIC_SLOT_UNSET) {
+        value = values[path] = jsonlogic_path_get(diagram->paths[path].path, input, JsonLogic_Null);
+    }
+    return value;
+}
+
+static uint8_t jsonlogic_diagram_eval_atom(const JsonLogic_Diagram *diagram, const JsonLogic_DiagramAtom *atom, JsonLogic_Handle input, JsonLogic_Handle values[]) {
+    JsonLogic_Handle args[2];
+    if (atom->var_first) {
+        args[0] = jsonlogic_diagram_value(diagram, atom->path, input, values);
+        args[1] = atom->constant;
+    } else {
+        args[0] = atom->constant;
+        args[1] = jsonlogic_diagram_value(diagram, atom->path, input, values);
+    }
+
+    JsonLogic_Handle result = atom->operation.funct(atom->operation.context, input, args, 2);
+
+    if (result == JsonLogic_True) {
+        return JSONLOGIC_ATOM_TRUE;
+    }
+    if (result == JsonLogic_False) {
+        return JSONLOGIC_ATOM_FALSE;
+    }
+    jsonlogic_decref(result);
+    return JSONLOGIC_ATOM_OTHER;
+}
+
+JsonLogic_Handle jsonlogic_diagram_apply(const JsonLogic_Diagram *diagram, size_t rule, JsonLogic_Handle input, uint8_t atoms[], JsonLogic_Handle values[]) {
+    size_t node = diagram->roots[rule];
+    assert(node != SIZE_MAX);
+
+    for (size_t index = diagram->path_offsets[rule]; index < diagram->path_offsets[rule + 1]; ++ index) {
+        if (JSONLOGIC_IS_ERROR(jsonlogic_diagram_value(diagram, diagram->rule_paths[index], input, values))) {
+            return JSONLOGIC_SLOT_UNSET;
+        }
+    }
+
+    while (node > JSONLOGIC_DIAGRAM_TRUE) {
+        const JsonLogic_DiagramNode *entry = &diagram->nodes[node];
+        uint8_t value = atoms[entry->atom];
+        if (value == JSONLOGIC_ATOM_UNKNOWN) {
+            value = atoms[entry->atom] = jsonlogic_diagram_eval_atom(diagram, &diagram->atoms[entry->atom], input, values);
+        }
+        if (value == JSONLOGIC_ATOM_OTHER) {
+            // the rule has to be evaluated the normal way
+            return JSONLOGIC_SLOT_UNSET;
+        }
+        node = value == JSONLOGIC_ATOM_TRUE ? entry->high : entry->low;
+    }
+
+    return node == JSONLOGIC_DIAGRAM_TRUE ? JsonLogic_True : JsonLogic_False;
+}
@@ -13,6 +13,7 @@ const JsonLogic_Handle JsonLogic_Error_StopIteration    = JSONLOGIC_ERROR_STOP_I
 const JsonLogic_Handle JsonLogic_Error_IOError          = JSONLOGIC_ERROR_IO_ERROR         ;
 const JsonLogic_Handle JsonLogic_Error_SyntaxError      = JSONLOGIC_ERROR_SYNTAX_ERROR     ;
 const JsonLogic_Handle JsonLogic_Error_UnicodeError     = JSONLOGIC_ERROR_UNICODE_ERROR    ;
+const JsonLogic_Handle JsonLogic_Error_RecursionError   = JSONLOGIC_ERROR_RECURSION_ERROR  ;
 
 JsonLogic_Error jsonlogic_get_error(JsonLogic_Handle handle) {
     if (JSONLOGIC_IS_ERROR(handle)) {
@@ -50,6 +51,9 @@ const char *jsonlogic_get_error_message(JsonLogic_Error error) {
         case JSONLOGIC_ERROR_UNICODE_ERROR:
             return "Unicode Error";
 
+        case JSONLOGIC_ERROR_RECURSION_ERROR:
+            return "Maximum Recursion Depth Exceeded";
+
         default:
             JSONLOGIC_DEBUG("illegal error code: 0x%" PRIx64, error);
             return "(Illegal Error Code)";
@@ -67,6 +71,7 @@ JsonLogic_Handle jsonlogic_error_from(JsonLogic_Error error) {
         case JSONLOGIC_ERROR_IO_ERROR:
         case JSONLOGIC_ERROR_SYNTAX_ERROR:
         case JSONLOGIC_ERROR_UNICODE_ERROR:
+        case JSONLOGIC_ERROR_RECURSION_ERROR:
             return error;
 
         default:
@@ -418,6 +418,135 @@ static const int JsonLogic_HexMap[256] = {
     ['F'] = 15 | 0xF00,
 };
 
+// ---- structural scanning ----
+//
+// The state machines look at one byte at a time. Runs of whitespace between
+// tokens and runs of plain ASCII in strings (no quote, backslash, control
+// character or multibyte sequence) don't change their state, so these are
+// classified 64 bytes at a time with SSE2 or AVX2 and skipped in one go. Bit N
+// of a mask stands for byte N of the block. Without SIMD support the runs are
+// scanned byte by byte.
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define JSONLOGIC_SCAN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define JSONLOGIC_SCAN_SSE2
+#endif
+
+#define JSONLOGIC_SCAN_BLOCK_SIZE 64
+
+#define JSONLOGIC_IS_JSON_SPACE(C) ((C) == ' ' || (C) == '\n' || (C) == '\r' || (C) == '\t')
+
+#if defined(JSONLOGIC_SCAN_AVX2) || defined(JSONLOGIC_SCAN_SSE2)
+#define JSONLOGIC_SCAN_SIMD
+
+#if defined(JSONLOGIC_SCAN_AVX2)
+    typedef __m256i JsonLogic_ScanVec;
+    #define JSONLOGIC_SCAN_VEC_SIZE 32
+    #define jsonlogic_scan_load(PTR)  _mm256_loadu_si256((const __m256i*)(PTR))
+    #define jsonlogic_scan_splat(CH)  _mm256_set1_epi8((char)(CH))
+    #define jsonlogic_scan_eq(A, B)   _mm256_cmpeq_epi8((A), (B))
+    #define jsonlogic_scan_gt(A, B)   _mm256_cmpgt_epi8((A), (B))
+    #define jsonlogic_scan_or(A, B)   _mm256_or_si256((A), (B))
+    #define jsonlogic_scan_mask(VEC)  ((uint64_t)(uint32_t)_mm256_movemask_epi8(VEC))
+#else
+    typedef __m128i JsonLogic_ScanVec;
+    #define JSONLOGIC_SCAN_VEC_SIZE 16
+    #define jsonlogic_scan_load(PTR)  _mm_loadu_si128((const __m128i*)(PTR))
+    #define jsonlogic_scan_splat(CH)  _mm_set1_epi8((char)(CH))
+    #define jsonlogic_scan_eq(A, B)   _mm_cmpeq_epi8((A), (B))
+    #define jsonlogic_scan_gt(A, B)   _mm_cmpgt_epi8((A), (B))
+    #define jsonlogic_scan_or(A, B)   _mm_or_si128((A), (B))
+    #define jsonlogic_scan_mask(VEC)  ((uint64_t)(uint32_t)_mm_movemask_epi8(VEC))
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+static inline unsigned int jsonlogic_ctz64(uint64_t mask) {
+    assert(mask != 0);
+#if defined(_MSC_VER)
+    unsigned long index;
+    if ((uint32_t)mask != 0) {
+        _BitScanForward(&index, (unsigned long)(uint32_t)mask);
+        return (unsigned int)index;
+    }
+    _BitScanForward(&index, (unsigned long)(mask >> 32));
+    return (unsigned int)index + 32;
+#else
+    return (unsigned int)__builtin_ctzll(mask);
+#endif
+}
+
+static inline uint64_t jsonlogic_scan_whitespace(const char *block) {
+    uint64_t mask = 0;
+    for (unsigned int offset = 0; offset < JSONLOGIC_SCAN_BLOCK_SIZE; offset += JSONLOGIC_SCAN_VEC_SIZE) {
+        JsonLogic_ScanVec chunk = jsonlogic_scan_load(block + offset);
+        JsonLogic_ScanVec match = jsonlogic_scan_or(
+            jsonlogic_scan_or(jsonlogic_scan_eq(chunk, jsonlogic_scan_splat(' ')),  jsonlogic_scan_eq(chunk, jsonlogic_scan_splat('\n'))),
+            jsonlogic_scan_or(jsonlogic_scan_eq(chunk, jsonlogic_scan_splat('\r')), jsonlogic_scan_eq(chunk, jsonlogic_scan_splat('\t'))));
+        mask |= jsonlogic_scan_mask(match) << offset;
+    }
+    return mask;
+}
+
+// Quotes, backslashes and bytes that are less than 0x20 when taken as signed,
+// which are the control characters and all bytes of multibyte sequences.
+static inline uint64_t jsonlogic_scan_string_special(const char *block) {
+    uint64_t mask = 0;
+    for (unsigned int offset = 0; offset < JSONLOGIC_SCAN_BLOCK_SIZE; offset += JSONLOGIC_SCAN_VEC_SIZE) {
+        JsonLogic_ScanVec chunk = jsonlogic_scan_load(block + offset);
+        JsonLogic_ScanVec match = jsonlogic_scan_or(
+            jsonlogic_scan_or(jsonlogic_scan_eq(chunk, jsonlogic_scan_splat('"')), jsonlogic_scan_eq(chunk, jsonlogic_scan_splat('\\'))),
+            jsonlogic_scan_gt(jsonlogic_scan_splat(' '), chunk));
+        mask |= jsonlogic_scan_mask(match) << offset;
+    }
+    return mask;
+}
+#endif
+
+// Index of the first byte at or after index that isn't whitespace.
+static size_t jsonlogic_skip_whitespace(const char *str, size_t size, size_t index) {
+#ifdef JSONLOGIC_SCAN_SIMD
+    while (size - index >= JSONLOGIC_SCAN_BLOCK_SIZE) {
+        uint64_t mask = ~jsonlogic_scan_whitespace(str + index);
+        if (mask != 0) {
+            return index + jsonlogic_ctz64(mask);
+        }
+        index += JSONLOGIC_SCAN_BLOCK_SIZE;
+    }
+#endif
+    while (index < size && JSONLOGIC_IS_JSON_SPACE(str[index])) {
+        ++ index;
+    }
+    return index;
+}
+
+// Index of the first byte at or after index that ends a run of plain ASCII in
+// a string.
+static size_t jsonlogic_scan_string_run(const char *str, size_t size, size_t index) {
+#ifdef JSONLOGIC_SCAN_SIMD
+    while (size - index >= JSONLOGIC_SCAN_BLOCK_SIZE) {
+        uint64_t mask = jsonlogic_scan_string_special(str + index);
+        if (mask != 0) {
+            return index + jsonlogic_ctz64(mask);
+        }
+        index += JSONLOGIC_SCAN_BLOCK_SIZE;
+    }
+#endif
+    while (index < size) {
+        unsigned char ch = (unsigned char)str[index];
+        if (ch == '"' || ch == '\\' || ch < 0x20 || ch >= 0x80) {
+            break;
+        }
+        ++ index;
+    }
+    return index;
+}
+
 #define JSONLOGIC_PARSE_STRING(STR, SIZE, INDEX, ERROR, CODE) \
     for (;;) { \
         if ((INDEX) >= (SIZE)) { \
@@ -537,23 +666,98 @@ static const int JsonLogic_HexMap[256] = {
         } \
     }
 
+// The var paths of a projection as a tree. A value is kept if a path ends at
+// it or on the way to it, everything else is only validated.
+typedef struct JsonLogic_ProjectionNode {
+    // path segment that leads here, compared with object keys
+    JsonLogic_Handle key;
+    // the segment as an array index, SIZE_MAX if it isn't one
+    size_t index;
+    // a path ends here, so all of the value is kept
+    bool keep;
+    // array items from this index on aren't needed, SIZE_MAX if the length is
+    size_t index_end;
+    struct JsonLogic_ProjectionNode *children;
+    struct JsonLogic_ProjectionNode *next;
+} JsonLogic_ProjectionNode;
+
+struct JsonLogic_Projection {
+    JsonLogic_ProjectionNode root;
+};
+
+// The entries of a tape are 64 bit words, the kind of a value is in the top
+// byte of its first word:
+//
+//   null, true, false  kind
+//   number             kind | start, end
+//   string             kind | start, end, UTF-16 size (start and end without the quotes)
+//   array, object      kind | index of the entry after it, number of items
+//
+// The items of an array follow it, the keys and values of an object alternate.
+typedef enum JsonLogic_TapeKind {
+    JsonLogic_TapeKind_Null = 1,
+    JsonLogic_TapeKind_True,
+    JsonLogic_TapeKind_False,
+    JsonLogic_TapeKind_Number,
+    JsonLogic_TapeKind_String,
+    JsonLogic_TapeKind_Array,
+    JsonLogic_TapeKind_Object,
+} JsonLogic_TapeKind;
+
+#define JSONLOGIC_TAPE_KIND_SHIFT 56
+#define JSONLOGIC_TAPE_PAYLOAD_MASK ((UINT64_C(1) << JSONLOGIC_TAPE_KIND_SHIFT) - 1)
+#define JSONLOGIC_TAPE_KIND(ENTRY) ((JsonLogic_TapeKind)((ENTRY) >> JSONLOGIC_TAPE_KIND_SHIFT))
+#define JSONLOGIC_TAPE_PAYLOAD(ENTRY) ((size_t)((ENTRY) & JSONLOGIC_TAPE_PAYLOAD_MASK))
+#define JSONLOGIC_TAPE_ENTRY(KIND, PAYLOAD) (((uint64_t)(KIND) << JSONLOGIC_TAPE_KIND_SHIFT) | (uint64_t)(PAYLOAD))
+
+struct JsonLogic_Tape {
+    // copy of the document, the tape refers to it by offsets
+    char *str;
+    size_t size;
+    size_t str_capacity;
+    uint64_t *entries;
+    size_t used;
+    size_t capacity;
+    // the error of the last parse, or JSONLOGIC_ERROR_SUCCESS
+    JsonLogic_Error error;
+};
+
 typedef enum JsonLogic_ParseType {
     JsonLogic_ParseType_Value,
     JsonLogic_ParseType_Array,
     JsonLogic_ParseType_Object,
+    // arrays and objects that aren't projected, nothing of them is kept
+    JsonLogic_ParseType_SkipArray,
+    JsonLogic_ParseType_SkipObject,
 } JsonLogic_ParseType;
 
 typedef struct JsonLogic_ParseItem_Object {
     JsonLogic_Handle key;
     JsonLogic_ObjBuf buf;
+    // projection of the value of key
+    const JsonLogic_ProjectionNode *child;
+    // key isn't projected, so its value is skipped
+    bool skip;
 } JsonLogic_ParseItem_Object;
 
+typedef struct JsonLogic_ParseItem_Skip {
+    // the key of a skipped object was read, the value comes next
+    bool value;
+    // number of items read so far
+    size_t count;
+    // entry of the array or object on the tape
+    size_t tape_index;
+} JsonLogic_ParseItem_Skip;
+
 typedef struct JsonLogic_ParseItem {
     JsonLogic_ParseType type;
+    // projection of the array or object, NULL if all of it is kept
+    const JsonLogic_ProjectionNode *node;
     union {
         JsonLogic_Handle value;
         JsonLogic_ArrayBuf arraybuf;
         JsonLogic_ParseItem_Object object;
+        JsonLogic_ParseItem_Skip skip;
     } data;
 } JsonLogic_ParseItem;
 
@@ -561,10 +765,14 @@ typedef struct JsonLogic_ParseStack {
     size_t capacity;
     size_t used;
     JsonLogic_ParseItem *items;
+    // projection of the document, NULL if all of it is kept
+    const JsonLogic_ProjectionNode *root;
+    // if set nothing is kept, all values are recorded on the tape instead
+    JsonLogic_Tape *tape;
 } JsonLogic_ParseStack;
 
 #define JSONLOGIC_PARSESTACK_CHUNK_SIZE 64
-#define JSONLOGIC_PARSESTACK_INIT (JsonLogic_ParseStack){ .capacity = 0, .used = 0, .items = NULL }
+#define JSONLOGIC_PARSESTACK_INIT (JsonLogic_ParseStack){ .capacity = 0, .used = 0, .items = NULL, .root = NULL, .tape = NULL }
 
 static JsonLogic_ParseItem *jsonlogic_parsestack_push(JsonLogic_ParseStack *stack, JsonLogic_ParseType type) {
     if (stack->used == stack->capacity) {
@@ -589,6 +797,7 @@ static JsonLogic_ParseItem *jsonlogic_parsestack_push(JsonLogic_ParseStack *stac
     }
     JsonLogic_ParseItem *item = &stack->items[stack->used ++];
     item->type = type;
+    item->node = NULL;
     switch (type) {
         case JsonLogic_ParseType_Value:
             item->data.value = JsonLogic_Null;
@@ -599,8 +808,17 @@ static JsonLogic_ParseItem *jsonlogic_parsestack_push(JsonLogic_ParseStack *stac
             break;
 
         case JsonLogic_ParseType_Object:
-            item->data.object.key = JsonLogic_Null;
-            item->data.object.buf = JSONLOGIC_OBJBUF_INIT;
+            item->data.object.key   = JsonLogic_Null;
+            item->data.object.buf   = JSONLOGIC_OBJBUF_INIT;
+            item->data.object.child = NULL;
+            item->data.object.skip  = false;
+            break;
+
+        case JsonLogic_ParseType_SkipArray:
+        case JsonLogic_ParseType_SkipObject:
+            item->data.skip.value      = false;
+            item->data.skip.count      = 0;
+            item->data.skip.tape_index = 0;
             break;
 
         default:
@@ -619,27 +837,353 @@ static inline JsonLogic_Error jsonlogic_parsestack_push_value(JsonLogic_ParseSta
     return JSONLOGIC_ERROR_SUCCESS;
 }
 
-static inline JsonLogic_Error jsonlogic_parsestack_push_array(JsonLogic_ParseStack *stack) {
+static inline JsonLogic_Error jsonlogic_parsestack_push_array(JsonLogic_ParseStack *stack, const JsonLogic_ProjectionNode *node) {
     JsonLogic_ParseItem *item = jsonlogic_parsestack_push(stack, JsonLogic_ParseType_Array);
     if (item == NULL) {
         return JSONLOGIC_ERROR_OUT_OF_MEMORY;
     }
+    item->node = node;
     return JSONLOGIC_ERROR_SUCCESS;
 }
 
-static inline JsonLogic_Error jsonlogic_parsestack_push_object(JsonLogic_ParseStack *stack) {
+static inline JsonLogic_Error jsonlogic_parsestack_push_object(JsonLogic_ParseStack *stack, const JsonLogic_ProjectionNode *node) {
     JsonLogic_ParseItem *item = jsonlogic_parsestack_push(stack, JsonLogic_ParseType_Object);
     if (item == NULL) {
         return JSONLOGIC_ERROR_OUT_OF_MEMORY;
     }
+    item->node = node;
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+// Space for count more entries at the end of the tape, NULL if out of memory.
+static inline uint64_t *jsonlogic_tape_extend(JsonLogic_Tape *tape, size_t count) {
+    if (tape->capacity - tape->used < count) {
+        size_t new_capacity = tape->capacity < 256 ? 256 : tape->capacity;
+        while (new_capacity - tape->used < count) {
+            if (new_capacity > SIZE_MAX / 2 / sizeof(uint64_t)) {
+                JSONLOGIC_ERROR_MEMORY();
+                errno = ENOMEM;
+                return NULL;
+            }
+            new_capacity *= 2;
+        }
+        uint64_t *new_entries = realloc(tape->entries, sizeof(uint64_t) * new_capacity);
+        if (new_entries == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            return NULL;
+        }
+        tape->entries  = new_entries;
+        tape->capacity = new_capacity;
+    }
+    uint64_t *entries = tape->entries + tape->used;
+    tape->used += count;
+    return entries;
+}
+
+static inline JsonLogic_Error jsonlogic_parsestack_push_skip(JsonLogic_ParseStack *stack, JsonLogic_ParseType type) {
+    JsonLogic_ParseItem *item = jsonlogic_parsestack_push(stack, type);
+    if (item == NULL) {
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+    if (stack->tape != NULL) {
+        // the end and the count are filled in by jsonlogic_parsestack_pop_skip()
+        uint64_t *entries = jsonlogic_tape_extend(stack->tape, 2);
+        if (entries == NULL) {
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        item->data.skip.tape_index = stack->tape->used - 2;
+        entries[0] = JSONLOGIC_TAPE_ENTRY(type == JsonLogic_ParseType_SkipArray ? JsonLogic_TapeKind_Array : JsonLogic_TapeKind_Object, 0);
+        entries[1] = 0;
+    }
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static inline void jsonlogic_parsestack_pop_skip(JsonLogic_ParseStack *stack) {
+    const JsonLogic_ParseItem *item = &stack->items[-- stack->used];
+    if (stack->tape != NULL) {
+        uint64_t *entries = stack->tape->entries + item->data.skip.tape_index;
+        entries[0] |= stack->tape->used;
+        entries[1]  = item->data.skip.count;
+    }
+}
+
+static const JsonLogic_ProjectionNode *jsonlogic_projection_find_index(const JsonLogic_ProjectionNode *node, size_t index) {
+    for (const JsonLogic_ProjectionNode *child = node->children; child != NULL; child = child->next) {
+        if (child->index == index) {
+            return child;
+        }
+    }
+    return NULL;
+}
+
+// Whether the value that starts next is kept. *nodeptr is set to its
+// projection, NULL if all of it is kept. The keys of projected objects are
+// matched by jsonlogic_parsestack_keeps_key().
+static bool jsonlogic_parsestack_keeps(const JsonLogic_ParseStack *stack, const JsonLogic_ProjectionNode **nodeptr) {
+    const JsonLogic_ProjectionNode *node = NULL;
+
+    if (stack->used == 0) {
+        node = stack->root;
+    } else {
+        const JsonLogic_ParseItem *item = &stack->items[stack->used - 1];
+        switch (item->type) {
+            case JsonLogic_ParseType_Array:
+                if (item->node != NULL) {
+                    const JsonLogic_Array *array = item->data.arraybuf.array;
+                    node = jsonlogic_projection_find_index(item->node, array == NULL ? 0 : array->size);
+                    if (node == NULL) {
+                        return false;
+                    }
+                }
+                break;
+
+            case JsonLogic_ParseType_Object:
+                if (item->data.object.skip) {
+                    return false;
+                }
+                if (!JSONLOGIC_IS_NULL(item->data.object.key)) {
+                    node = item->data.object.child;
+                }
+                break;
+
+            case JsonLogic_ParseType_SkipArray:
+            case JsonLogic_ParseType_SkipObject:
+                return false;
+
+            default:
+                break;
+        }
+    }
+
+    if (nodeptr != NULL) {
+        *nodeptr = node != NULL && node->keep ? NULL : node;
+    }
+    return true;
+}
+
+// Moves on after a value (or key) that isn't kept. Arrays get null in its
+// place while the index of a kept item or the length might follow.
+static JsonLogic_Error jsonlogic_parsestack_skip(JsonLogic_ParseStack *stack, JsonLogic_RootParser *stateptr) {
+    if (stack->used == 0) {
+        // only happens for the root of a tape
+        *stateptr = JsonLogic_ParserState_End;
+        return JSONLOGIC_ERROR_SUCCESS;
+    }
+
+    JsonLogic_ParseItem *item = &stack->items[stack->used - 1];
+    switch (item->type) {
+        case JsonLogic_ParseType_Array:
+        {
+            *stateptr = JsonLogic_ParserState_ArrayValueOrEnd;
+            const JsonLogic_Array *array = item->data.arraybuf.array;
+            if ((array == NULL ? 0 : array->size) < item->node->index_end) {
+                return jsonlogic_arraybuf_append(&item->data.arraybuf, JsonLogic_Null);
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+        case JsonLogic_ParseType_Object:
+            *stateptr = item->data.object.skip ? JsonLogic_ParserState_ObjectNext : JsonLogic_ParserState_ObjectAfterKey;
+            item->data.object.skip = !item->data.object.skip;
+            return JSONLOGIC_ERROR_SUCCESS;
+
+        case JsonLogic_ParseType_SkipArray:
+            *stateptr = JsonLogic_ParserState_ArrayValueOrEnd;
+            ++ item->data.skip.count;
+            return JSONLOGIC_ERROR_SUCCESS;
+
+        case JsonLogic_ParseType_SkipObject:
+            if (item->data.skip.value) {
+                *stateptr = JsonLogic_ParserState_ObjectNext;
+                ++ item->data.skip.count;
+            } else {
+                *stateptr = JsonLogic_ParserState_ObjectAfterKey;
+            }
+            item->data.skip.value = !item->data.skip.value;
+            return JSONLOGIC_ERROR_SUCCESS;
+
+        default:
+            return JSONLOGIC_ERROR_INTERNAL_ERROR;
+    }
+}
+
+// Whether the JSON string str[start_index, end_index) (without the quotes)
+// decodes to key. It was validated before, utf16_size is its decoded size
+// and run_end the end of its plain ASCII prefix.
+static bool jsonlogic_json_string_equals(const char *str, size_t start_index, size_t run_end, size_t end_index, size_t utf16_size, const char16_t *key, size_t key_size) {
+    if (key_size != utf16_size) {
+        return false;
+    }
+
+    size_t utf16_index = 0;
+    for (size_t index = start_index; index < run_end; ++ index) {
+        if (key[utf16_index ++] != (unsigned char)str[index]) {
+            return false;
+        }
+    }
+
+    if (run_end == end_index) {
+        return true;
+    }
+
+    JsonLogic_Error error = JSONLOGIC_ERROR_SUCCESS;
+    bool equals = true;
+    size_t index = run_end;
+    // decodes like the parser, up to and including the closing quote
+    JSONLOGIC_PARSE_STRING(str, end_index + 1, index, error, {
+        if (codepoint < 0x10000) {
+            if (key[utf16_index ++] != (char16_t) codepoint) {
+                equals = false;
+                break;
+            }
+        } else if (key[utf16_index ++] != (char16_t) (0xD800 | (codepoint >> 10)) ||
+                   key[utf16_index ++] != (char16_t) (0xDC00 | (codepoint & 0x3FF))) {
+            equals = false;
+            break;
+        }
+    });
+
+    return equals && error == JSONLOGIC_ERROR_SUCCESS;
+}
+
+// Decodes the validated JSON string str[start_index, end_index) like
+// jsonlogic_json_string_equals() into a string handle.
+static JsonLogic_Handle jsonlogic_json_string_decode(const char *str, size_t start_index, size_t run_end, size_t end_index, size_t utf16_size) {
+    if (utf16_size == 0) {
+        return jsonlogic_empty_string();
+    }
+
+    JsonLogic_String *string = JSONLOGIC_MALLOC_STRING(utf16_size);
+    if (string == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return JsonLogic_Error_OutOfMemory;
+    }
+    JSONLOGIC_SET_REFCOUNT(string->refcount, 1);
+    string->hash     = JSONLOGIC_HASH_UNSET;
+    string->size     = utf16_size;
+
+    size_t utf16_index = run_end - start_index;
+    for (size_t run_index = 0; run_index < utf16_index; ++ run_index) {
+        string->str[run_index] = (unsigned char)str[start_index + run_index];
+    }
+
+    if (run_end < end_index) {
+        JsonLogic_Error error = JSONLOGIC_ERROR_SUCCESS;
+        size_t index = run_end;
+        JSONLOGIC_PARSE_STRING(str, end_index + 1, index, error, {
+            if (codepoint < 0x10000) {
+                string->str[utf16_index ++] = (char16_t) codepoint;
+            } else {
+                string->str[utf16_index ++] = (char16_t) (0xD800 | (codepoint >> 10));
+                string->str[utf16_index ++] = (char16_t) (0xDC00 | (codepoint & 0x3FF));
+            }
+        });
+        assert(index == end_index + 1);
+        assert(error == JSONLOGIC_ERROR_SUCCESS);
+        (void)error;
+    }
+
+    assert(utf16_index == utf16_size);
+
+    return jsonlogic_string_into_handle(string);
+}
+
+// Converts the validated JSON number str[start_index, end_index).
+static JsonLogic_Error jsonlogic_json_number_decode(const char *str, size_t start_index, size_t end_index, double *numberptr) {
+    jsonlogic_init_c_locale();
+
+    char *endptr = NULL;
+    char buf[128];
+    size_t num_size = end_index - start_index;
+    size_t clib_index = start_index;
+    if (num_size + 1 > sizeof(buf)) {
+        char *heap_buf = malloc(num_size + 1);
+        if (heap_buf == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        memcpy(heap_buf, str + start_index, num_size);
+        heap_buf[num_size] = 0;
+        *numberptr = JSONLOGIC_STRTOD_L(heap_buf, &endptr, JsonLogic_C_Locale);
+        clib_index += endptr - heap_buf;
+        free(heap_buf);
+    } else {
+        memcpy(buf, str + start_index, num_size);
+        buf[num_size] = 0;
+        *numberptr = JSONLOGIC_STRTOD_L(buf, &endptr, JsonLogic_C_Locale);
+        clib_index += endptr - buf;
+    }
+    if (clib_index != end_index) {
+        JSONLOGIC_DEBUG(
+            "Clib disagrees about where number \"%s\" ends. Clib index: %" PRIuPTR ", JsonLogic index: %" PRIuPTR,
+            buf, clib_index, end_index);
+        return JSONLOGIC_ERROR_INTERNAL_ERROR;
+    }
     return JSONLOGIC_ERROR_SUCCESS;
 }
 
+static JsonLogic_Error jsonlogic_parsestack_tape_string(JsonLogic_ParseStack *stack, size_t start_index, size_t end_index, size_t utf16_size, JsonLogic_RootParser *stateptr) {
+    uint64_t *entries = jsonlogic_tape_extend(stack->tape, 3);
+    if (entries == NULL) {
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+    entries[0] = JSONLOGIC_TAPE_ENTRY(JsonLogic_TapeKind_String, start_index);
+    entries[1] = end_index;
+    entries[2] = utf16_size;
+    return jsonlogic_parsestack_skip(stack, stateptr);
+}
+
+static JsonLogic_Error jsonlogic_parsestack_tape_number(JsonLogic_ParseStack *stack, size_t start_index, size_t end_index, JsonLogic_RootParser *stateptr) {
+    uint64_t *entries = jsonlogic_tape_extend(stack->tape, 2);
+    if (entries == NULL) {
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+    entries[0] = JSONLOGIC_TAPE_ENTRY(JsonLogic_TapeKind_Number, start_index);
+    entries[1] = end_index;
+    return jsonlogic_parsestack_skip(stack, stateptr);
+}
+
+// Like jsonlogic_parsestack_keeps() for a string that was just read. Keys of
+// projected objects are matched against the projection without decoding them.
+static bool jsonlogic_parsestack_keeps_string(JsonLogic_ParseStack *stack, const char *str, size_t start_index, size_t run_end, size_t end_index, size_t utf16_size) {
+    if (stack->used > 0) {
+        JsonLogic_ParseItem *item = &stack->items[stack->used - 1];
+        if (item->type == JsonLogic_ParseType_Object && item->node != NULL &&
+            JSONLOGIC_IS_NULL(item->data.object.key) && !item->data.object.skip) {
+            for (const JsonLogic_ProjectionNode *child = item->node->children; child != NULL; child = child->next) {
+                const JsonLogic_String *key = JSONLOGIC_CAST_STRING(child->key);
+                if (jsonlogic_json_string_equals(str, start_index, run_end, end_index, utf16_size, key->str, key->size)) {
+                    item->data.object.child = child;
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    return jsonlogic_parsestack_keeps(stack, NULL);
+}
+
 static inline JsonLogic_Error jsonlogic_parsestack_handle_value(JsonLogic_ParseStack *stack, JsonLogic_Handle value, JsonLogic_RootParser *stateptr) {
     if (stateptr == NULL) {
         return JSONLOGIC_ERROR_ILLEGAL_ARGUMENT;
     }
 
+    if (stack->tape != NULL) {
+        // only null, true and false get here, the rest is recorded by its state
+        uint64_t *entries = jsonlogic_tape_extend(stack->tape, 1);
+        if (entries == NULL) {
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        entries[0] = JSONLOGIC_TAPE_ENTRY(
+            JSONLOGIC_IS_NULL(value) ? JsonLogic_TapeKind_Null :
+            JSONLOGIC_IS_TRUE(value) ? JsonLogic_TapeKind_True : JsonLogic_TapeKind_False, 0);
+        return jsonlogic_parsestack_skip(stack, stateptr);
+    }
+
+    if (stack->root != NULL && !jsonlogic_parsestack_keeps(stack, NULL)) {
+        return jsonlogic_parsestack_skip(stack, stateptr);
+    }
+
     if (stack->used == 0) {
         *stateptr = JsonLogic_ParserState_End;
         return jsonlogic_parsestack_push_value(stack, value);
@@ -701,6 +1245,10 @@ static JsonLogic_Handle jsonlogic_parsestack_pop(JsonLogic_ParseStack *stack) {
             }
             return jsonlogic_object_into_handle(jsonlogic_objbuf_take(&item->data.object.buf));
 
+        case JsonLogic_ParseType_SkipArray:
+        case JsonLogic_ParseType_SkipObject:
+            return JsonLogic_Error_SyntaxError;
+
         default:
             assert(false);
             return JsonLogic_Error_InternalError;
@@ -724,6 +1272,10 @@ static void jsonlogic_parsestack_free(JsonLogic_ParseStack *stack) {
                 jsonlogic_decref(item->data.object.key);
                 break;
 
+            case JsonLogic_ParseType_SkipArray:
+            case JsonLogic_ParseType_SkipObject:
+                break;
+
             default:
                 assert(false);
         }
@@ -762,6 +1314,13 @@ static void jsonlogic_parsestack_free(JsonLogic_ParseStack *stack) {
         case JsonLogic_ParserState_Max: goto ParserState_Max; \
     }
 
+// Every state that the whitespace passes through keeps it, so whole runs of
+// whitespace are skipped at once.
+#define SKIP_WHITESPACE \
+    if (index < size && JSONLOGIC_IS_JSON_SPACE(str[index])) { \
+        index = jsonlogic_skip_whitespace(str, size, index + 1); \
+    }
+
 // but this slows it down again?? (471 ms to 480 ms)
 #if defined(__GNUC__)
     #pragma GCC diagnostic ignored "-Wunused-label"
@@ -786,22 +1345,74 @@ static void jsonlogic_parsestack_free(JsonLogic_ParseStack *stack) {
         case JsonLogic_NumberParser_Max: goto NumberParser_Max; \
     }
 
-JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_LineInfo *infoptr) {
-    JsonLogic_ParseStack stack = JSONLOGIC_PARSESTACK_INIT;
-    JsonLogic_RootParser state = JsonLogic_ParserState_Start;
+// Number of bytes JSONLOGIC_PARSE_STRING takes for the escape or UTF-8
+// sequence that starts with byte. A quote among them doesn't end the string.
+static inline size_t jsonlogic_string_sequence_size(unsigned char byte) {
+    if (byte == '\\') {
+        return 2;
+    } else if (byte < 0xBF) {
+        return 1;
+    } else if (byte < 0xE0) {
+        return 2;
+    } else if (byte < 0xF0) {
+        return 3;
+    } else if (byte < 0xF8) {
+        return 4;
+    } else {
+        return 1;
+    }
+}
+
+// Index of the quote that ends a string which continues at index or size if
+// it doesn't end before size.
+static size_t jsonlogic_find_string_end(const char *str, size_t size, size_t index) {
+    while (index < size) {
+        index = jsonlogic_scan_string_run(str, size, index);
+        if (index >= size || str[index] == '"') {
+            return index;
+        }
+        index += jsonlogic_string_sequence_size((unsigned char)str[index]);
+    }
+    return size;
+}
+
+#define JSONLOGIC_IS_TOKEN_STATE(STATE) \
+    ((STATE) >= JsonLogic_ParserState_String && (STATE) <= JsonLogic_ParserState_False)
+
+// Runs the state machine from *indexptr to size. Unless final, a string,
+// number or literal that might continue after size isn't parsed. Then *indexptr
+// is left at its start and *stateptr at the state of that token, so that the
+// token can be resumed from a buffer that starts with it. The index of an
+// error is passed back in *indexptr, too.
+static JsonLogic_Error jsonlogic_parse_chunk(JsonLogic_ParseStack *stackptr, JsonLogic_RootParser *stateptr, const char *str, size_t size, size_t *indexptr, bool final) {
+    JsonLogic_ParseStack stack = *stackptr;
+    JsonLogic_RootParser state = *stateptr;
     JsonLogic_Error error = JSONLOGIC_ERROR_SUCCESS;
 
-    size_t index = 0;
+    size_t index = *indexptr;
+    if (index < size) {
+        switch (state) {
+            case JsonLogic_ParserState_String: goto ParserState_String;
+            case JsonLogic_ParserState_Number: goto ParserState_Number;
+            case JsonLogic_ParserState_Null:   goto ParserState_Null;
+            case JsonLogic_ParserState_True:   goto ParserState_True;
+            case JsonLogic_ParserState_False:  goto ParserState_False;
+            default: break;
+        }
+    }
+
     while (index < size) {
         state = JsonLogic_Parser_Root[state][(unsigned char)str[index]];
         switch (state) {
             case JsonLogic_ParserState_Start: ParserState_Start:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_End: ParserState_End:
                 index ++;
+                SKIP_WHITESPACE;
                 if (index == size) {
                     goto loop_end;
                 }
@@ -810,47 +1421,58 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
 
             case JsonLogic_ParserState_String: ParserState_String:
             {
+                if (!final && jsonlogic_find_string_end(str, size, index + 1) >= size) {
+                    goto loop_end;
+                }
                 size_t start_index = ++ index;
-                size_t utf16_size = 0;
-                JSONLOGIC_PARSE_STRING(str, size, index, error, {
-                    if (codepoint < 0x10000) {
-                        utf16_size += 1;
-                    } else {
-                        utf16_size += 2;
-                    }
-                });
+                // plain ASCII is copied as is, only the rest is decoded
+                size_t run_end = jsonlogic_scan_string_run(str, size, index);
+                size_t utf16_size = run_end - start_index;
+                index = run_end;
+                if (index < size && str[index] == '"') {
+                    ++ index;
+                } else {
+                    JSONLOGIC_PARSE_STRING(str, size, index, error, {
+                        if (codepoint < 0x10000) {
+                            utf16_size += 1;
+                        } else {
+                            utf16_size += 2;
+                        }
+                    });
+                }
 
                 if (error != JSONLOGIC_ERROR_SUCCESS) {
                     state = JsonLogic_ParserState_Error;
                     goto loop_end;
                 }
 
-                JsonLogic_String *string = JSONLOGIC_MALLOC_STRING(utf16_size);
-                if (string == NULL) {
-                    JSONLOGIC_ERROR_MEMORY();
-                    state = JsonLogic_ParserState_Error;
-                    error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
-                    goto loop_end;
+                if (stack.tape != NULL) {
+                    error = jsonlogic_parsestack_tape_string(&stack, start_index, index - 1, utf16_size, &state);
+                    if (error != JSONLOGIC_ERROR_SUCCESS) {
+                        state = JsonLogic_ParserState_Error;
+                        goto loop_end;
+                    }
+                    DISPATCH;
+                    break;
                 }
-                string->refcount = 1;
-                string->hash     = JSONLOGIC_HASH_UNSET;
-                string->size     = utf16_size;
-
-                index = start_index;
-                size_t utf16_index = 0;
-                JSONLOGIC_PARSE_STRING(str, size, index, error, {
-                    if (codepoint < 0x10000) {
-                        string->str[utf16_index ++] = (char16_t) codepoint;
-                    } else {
-                        string->str[utf16_index ++] = (char16_t) (0xD800 | (codepoint >> 10));
-                        string->str[utf16_index ++] = (char16_t) (0xDC00 | (codepoint & 0x3FF));
+
+                if (stack.root != NULL && !jsonlogic_parsestack_keeps_string(&stack, str, start_index, run_end, index - 1, utf16_size)) {
+                    error = jsonlogic_parsestack_skip(&stack, &state);
+                    if (error != JSONLOGIC_ERROR_SUCCESS) {
+                        state = JsonLogic_ParserState_Error;
+                        goto loop_end;
                     }
-                });
+                    DISPATCH;
+                    break;
+                }
 
-                assert(utf16_index == utf16_size);
-                assert(error == JSONLOGIC_ERROR_SUCCESS);
+                JsonLogic_Handle handle = jsonlogic_json_string_decode(str, start_index, run_end, index - 1, utf16_size);
+                if (JSONLOGIC_IS_ERROR(handle)) {
+                    state = JsonLogic_ParserState_Error;
+                    error = handle;
+                    goto loop_end;
+                }
 
-                JsonLogic_Handle handle = jsonlogic_string_into_handle(string);
                 error = jsonlogic_parsestack_handle_value(&stack, handle, &state);
                 jsonlogic_decref(handle);
                 if (error != JSONLOGIC_ERROR_SUCCESS) {
@@ -923,6 +1545,11 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
                 }
             num_loop_end:
 
+                if (!final && index >= size) {
+                    index = start_index;
+                    goto loop_end;
+                }
+
                 num_state = JsonLogic_Parser_Number[num_state][JSONLOGIC_PARSE_EOF];
 
                 if (num_state != JsonLogic_NumberParser_End) {
@@ -930,40 +1557,31 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
                     error = JSONLOGIC_ERROR_SYNTAX_ERROR;
                     goto loop_end;
                 }
-                if (JsonLogic_C_Locale == NULL) {
-                    JsonLogic_C_Locale = JSONLOGIC_CREATE_C_LOCALE();
+
+                if (stack.tape != NULL) {
+                    error = jsonlogic_parsestack_tape_number(&stack, start_index, index, &state);
+                    if (error != JSONLOGIC_ERROR_SUCCESS) {
+                        state = JsonLogic_ParserState_Error;
+                        goto loop_end;
+                    }
+                    DISPATCH;
+                    break;
                 }
 
-                char *endptr = NULL;
-                char buf[128];
-                size_t num_size = index - start_index;
-                size_t clib_index = start_index;
-                double number;
-                if (num_size + 1 > sizeof(buf)) {
-                    char *heap_buf = malloc(num_size + 1);
-                    if (heap_buf == NULL) {
-                        JSONLOGIC_ERROR_MEMORY();
+                if (stack.root != NULL && !jsonlogic_parsestack_keeps(&stack, NULL)) {
+                    error = jsonlogic_parsestack_skip(&stack, &state);
+                    if (error != JSONLOGIC_ERROR_SUCCESS) {
                         state = JsonLogic_ParserState_Error;
-                        error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
                         goto loop_end;
                     }
-                    memcpy(heap_buf, str + start_index, num_size);
-                    heap_buf[num_size] = 0;
-                    number = JSONLOGIC_STRTOD_L(heap_buf, &endptr, JsonLogic_C_Locale);
-                    clib_index += endptr - heap_buf;
-                    free(heap_buf);
-                } else {
-                    memcpy(buf, str + start_index, num_size);
-                    buf[num_size] = 0;
-                    number = JSONLOGIC_STRTOD_L(buf, &endptr, JsonLogic_C_Locale);
-                    clib_index += endptr - buf;
+                    DISPATCH;
+                    break;
                 }
-                if (clib_index != index) {
-                    JSONLOGIC_DEBUG(
-                        "Clib disagrees about where number \"%s\" ends. Clib index: %" PRIuPTR ", JsonLogic index: %" PRIuPTR,
-                        buf, clib_index, index);
+
+                double number;
+                error = jsonlogic_json_number_decode(str, start_index, index, &number);
+                if (error != JSONLOGIC_ERROR_SUCCESS) {
                     state = JsonLogic_ParserState_Error;
-                    error = JSONLOGIC_ERROR_INTERNAL_ERROR;
                     goto loop_end;
                 }
                 error = jsonlogic_parsestack_handle_value(&stack, jsonlogic_number_from(number), &state);
@@ -976,6 +1594,9 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
             }
             case JsonLogic_ParserState_Null: ParserState_Null:
                 if (size < index + 4) {
+                    if (!final) {
+                        goto loop_end;
+                    }
                     error = JSONLOGIC_ERROR_SYNTAX_ERROR;
                     state = JsonLogic_ParserState_Error;
                     goto loop_end;
@@ -996,6 +1617,9 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
 
             case JsonLogic_ParserState_True: ParserState_True:
                 if (size < index + 4) {
+                    if (!final) {
+                        goto loop_end;
+                    }
                     error = JSONLOGIC_ERROR_SYNTAX_ERROR;
                     state = JsonLogic_ParserState_Error;
                     goto loop_end;
@@ -1016,6 +1640,9 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
 
             case JsonLogic_ParserState_False: ParserState_False:
                 if (size < index + 5) {
+                    if (!final) {
+                        goto loop_end;
+                    }
                     error = JSONLOGIC_ERROR_SYNTAX_ERROR;
                     state = JsonLogic_ParserState_Error;
                     goto loop_end;
@@ -1035,7 +1662,13 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
                 break;
 
             case JsonLogic_ParserState_ArrayStart: ParserState_ArrayStart:
-                error = jsonlogic_parsestack_push_array(&stack);
+            {
+                const JsonLogic_ProjectionNode *node = NULL;
+                if (stack.tape == NULL && (stack.root == NULL || jsonlogic_parsestack_keeps(&stack, &node))) {
+                    error = jsonlogic_parsestack_push_array(&stack, node);
+                } else {
+                    error = jsonlogic_parsestack_push_skip(&stack, JsonLogic_ParseType_SkipArray);
+                }
                 if (error != JSONLOGIC_ERROR_SUCCESS) {
                     state = JsonLogic_ParserState_Error;
                     goto loop_end;
@@ -1043,25 +1676,41 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
                 index ++;
                 DISPATCH;
                 break;
+            }
 
             // redundancy for better branch prediction:
             case JsonLogic_ParserState_ArrayAfterStart: ParserState_ArrayAfterStart:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_ArrayValueOrEnd: ParserState_ArrayValueOrEnd:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_ArrayValue: ParserState_ArrayValue:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_ArrayEnd: ParserState_ArrayEnd:
             {
+                if (stack.used > 0 && stack.items[stack.used - 1].type == JsonLogic_ParseType_SkipArray) {
+                    jsonlogic_parsestack_pop_skip(&stack);
+                    error = jsonlogic_parsestack_skip(&stack, &state);
+                    if (error != JSONLOGIC_ERROR_SUCCESS) {
+                        state = JsonLogic_ParserState_Error;
+                        goto loop_end;
+                    }
+                    index ++;
+                    DISPATCH;
+                    break;
+                }
+
                 JsonLogic_Handle handle = jsonlogic_parsestack_pop(&stack);
                 if (!JSONLOGIC_IS_ARRAY(handle)) {
                     jsonlogic_decref(handle);
@@ -1080,7 +1729,13 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
                 break;
             }
             case JsonLogic_ParserState_ObjectStart: ParserState_ObjectStart:
-                error = jsonlogic_parsestack_push_object(&stack);
+            {
+                const JsonLogic_ProjectionNode *node = NULL;
+                if (stack.tape == NULL && (stack.root == NULL || jsonlogic_parsestack_keeps(&stack, &node))) {
+                    error = jsonlogic_parsestack_push_object(&stack, node);
+                } else {
+                    error = jsonlogic_parsestack_push_skip(&stack, JsonLogic_ParseType_SkipObject);
+                }
                 if (error != JSONLOGIC_ERROR_SUCCESS) {
                     state = JsonLogic_ParserState_Error;
                     goto loop_end;
@@ -1088,35 +1743,53 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
                 index ++;
                 DISPATCH;
                 break;
+            }
 
             // redundancy for better branch prediction:
             case JsonLogic_ParserState_ObjectAfterStart: ParserState_ObjectAfterStart:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_ObjectKey: ParserState_ObjectKey:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_ObjectAfterKey: ParserState_ObjectAfterKey:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_ObjectValue: ParserState_ObjectValue:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_ObjectNext: ParserState_ObjectNext:
                 index ++;
+                SKIP_WHITESPACE;
                 DISPATCH;
                 break;
 
             case JsonLogic_ParserState_ObjectEnd: ParserState_ObjectEnd:
             {
+                if (stack.used > 0 && stack.items[stack.used - 1].type == JsonLogic_ParseType_SkipObject) {
+                    jsonlogic_parsestack_pop_skip(&stack);
+                    error = jsonlogic_parsestack_skip(&stack, &state);
+                    if (error != JSONLOGIC_ERROR_SUCCESS) {
+                        state = JsonLogic_ParserState_Error;
+                        goto loop_end;
+                    }
+                    index ++;
+                    DISPATCH;
+                    break;
+                }
+
                 JsonLogic_Handle handle = jsonlogic_parsestack_pop(&stack);
                 if (!JSONLOGIC_IS_OBJECT(handle)) {
                     jsonlogic_decref(handle);
@@ -1149,11 +1822,26 @@ JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_L
     }
 loop_end:
 
-    if (error != JSONLOGIC_ERROR_SUCCESS) {
-        JsonLogic_LineInfo info = jsonlogic_get_lineinfo(str, size, index);
-        if (infoptr != NULL) {
-            *infoptr = info;
-        }
+    *stackptr = stack;
+    *stateptr = state;
+    *indexptr = index;
+
+    return error;
+}
+
+static JsonLogic_Handle jsonlogic_parse_root(const char *str, size_t size, const JsonLogic_ProjectionNode *root, JsonLogic_LineInfo *infoptr) {
+    JsonLogic_ParseStack stack = JSONLOGIC_PARSESTACK_INIT;
+    JsonLogic_RootParser state = JsonLogic_ParserState_Start;
+    stack.root = root;
+    size_t index = 0;
+
+    JsonLogic_Error error = jsonlogic_parse_chunk(&stack, &state, str, size, &index, true);
+
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        JsonLogic_LineInfo info = jsonlogic_get_lineinfo(str, size, index);
+        if (infoptr != NULL) {
+            *infoptr = info;
+        }
         jsonlogic_parsestack_free(&stack);
         return error;
     }
@@ -1176,6 +1864,758 @@ loop_end:
     return value;
 }
 
+JsonLogic_Handle jsonlogic_parse_sized(const char *str, size_t size, JsonLogic_LineInfo *infoptr) {
+    return jsonlogic_parse_root(str, size, NULL, infoptr);
+}
+
+// ---- projection ----
+
+static void jsonlogic_projection_free_children(JsonLogic_ProjectionNode *node) {
+    JsonLogic_ProjectionNode *child = node->children;
+    while (child != NULL) {
+        JsonLogic_ProjectionNode *next = child->next;
+        jsonlogic_projection_free_children(child);
+        jsonlogic_decref(child->key);
+        free(child);
+        child = next;
+    }
+    node->children = NULL;
+}
+
+void jsonlogic_projection_free(JsonLogic_Projection *projection) {
+    if (projection != NULL) {
+        jsonlogic_projection_free_children(&projection->root);
+        free(projection);
+    }
+}
+
+static JsonLogic_ProjectionNode *jsonlogic_projection_add(JsonLogic_ProjectionNode *node, const char16_t *key, size_t size, size_t index) {
+    for (JsonLogic_ProjectionNode *child = node->children; child != NULL; child = child->next) {
+        const JsonLogic_String *string = JSONLOGIC_CAST_STRING(child->key);
+        if (jsonlogic_utf16_equals(string->str, string->size, key, size)) {
+            return child;
+        }
+    }
+
+    JsonLogic_ProjectionNode *child = malloc(sizeof(JsonLogic_ProjectionNode));
+    if (child == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    child->key = jsonlogic_string_from_utf16_sized(key, size);
+    if (JSONLOGIC_IS_ERROR(child->key)) {
+        free(child);
+        return NULL;
+    }
+    child->index     = index;
+    child->keep      = false;
+    child->index_end = 0;
+    child->children  = NULL;
+    child->next      = node->children;
+    node->children   = child;
+
+    // var reads the length of arrays, other keys that aren't indices are null
+    if (index != SIZE_MAX) {
+        if (node->index_end != SIZE_MAX && index >= node->index_end) {
+            node->index_end = index + 1;
+        }
+    } else if (jsonlogic_utf16_equals(key, size, JSONLOGIC_LENGTH, JSONLOGIC_LENGTH_SIZE)) {
+        node->index_end = SIZE_MAX;
+    }
+
+    return child;
+}
+
+JsonLogic_Projection *jsonlogic_projection_new(const JsonLogic_Handle paths[], size_t count) {
+    JsonLogic_Projection *projection = malloc(sizeof(JsonLogic_Projection));
+    if (projection == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    projection->root = (JsonLogic_ProjectionNode){
+        .key       = JsonLogic_Null,
+        .index     = SIZE_MAX,
+        .keep      = false,
+        .index_end = 0,
+        .children  = NULL,
+        .next      = NULL,
+    };
+
+    for (size_t path_index = 0; path_index < count; ++ path_index) {
+        // split just like the paths of var
+        JsonLogic_Path *path = jsonlogic_path_compile(paths[path_index]);
+        if (path == NULL) {
+            jsonlogic_projection_free(projection);
+            return NULL;
+        }
+
+        JsonLogic_ProjectionNode *node = &projection->root;
+        switch (path->kind) {
+            case JsonLogic_PathKind_Data:
+                break;
+
+            case JsonLogic_PathKind_Index:
+            {
+                // objects are indexed by the number as a string
+                JsonLogic_Handle key = jsonlogic_to_string(path->key);
+                if (JSONLOGIC_IS_ERROR(key)) {
+                    node = NULL;
+                    break;
+                }
+                const JsonLogic_String *string = JSONLOGIC_CAST_STRING(key);
+                node = jsonlogic_projection_add(node, string->str, string->size, path->index);
+                jsonlogic_decref(key);
+                break;
+            }
+            case JsonLogic_PathKind_Segments:
+                for (size_t index = 0; index < path->count && node != NULL; ++ index) {
+                    const JsonLogic_PathSegment *segment = &path->segments[index];
+                    node = jsonlogic_projection_add(node, segment->key, segment->size, segment->index);
+                }
+                break;
+
+            default:
+                assert(false);
+                node = NULL;
+                break;
+        }
+
+        jsonlogic_path_free(path);
+
+        if (node == NULL) {
+            jsonlogic_projection_free(projection);
+            return NULL;
+        }
+        node->keep = true;
+    }
+
+    return projection;
+}
+
+JsonLogic_Handle jsonlogic_parse_projected(const char *str, size_t size, const JsonLogic_Projection *projection, JsonLogic_LineInfo *infoptr) {
+    return jsonlogic_parse_root(str, size, &projection->root, infoptr);
+}
+
+// ---- tape ----
+
+JsonLogic_Tape *jsonlogic_tape_new(void) {
+    JsonLogic_Tape *tape = malloc(sizeof(JsonLogic_Tape));
+    if (tape == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    *tape = (JsonLogic_Tape){
+        .str          = NULL,
+        .size         = 0,
+        .str_capacity = 0,
+        .entries      = NULL,
+        .used         = 0,
+        .capacity     = 0,
+        // there is no document yet
+        .error        = JSONLOGIC_ERROR_ILLEGAL_ARGUMENT,
+    };
+
+    return tape;
+}
+
+void jsonlogic_tape_free(JsonLogic_Tape *tape) {
+    if (tape != NULL) {
+        free(tape->str);
+        free(tape->entries);
+        free(tape);
+    }
+}
+
+JsonLogic_Error jsonlogic_tape_parse(JsonLogic_Tape *tape, const char *str, size_t size, JsonLogic_LineInfo *infoptr) {
+    tape->used  = 0;
+    tape->size  = 0;
+    tape->error = JSONLOGIC_ERROR_ILLEGAL_ARGUMENT;
+
+    if (size > JSONLOGIC_TAPE_PAYLOAD_MASK) {
+        JSONLOGIC_ERROR_MEMORY();
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    if (size > tape->str_capacity) {
+        char *new_str = realloc(tape->str, size);
+        if (new_str == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        tape->str          = new_str;
+        tape->str_capacity = size;
+    }
+    if (size > 0) {
+        memcpy(tape->str, str, size);
+    }
+    tape->size = size;
+
+    JsonLogic_ParseStack stack = JSONLOGIC_PARSESTACK_INIT;
+    JsonLogic_RootParser state = JsonLogic_ParserState_Start;
+    stack.tape = tape;
+    size_t index = 0;
+
+    JsonLogic_Error error = jsonlogic_parse_chunk(&stack, &state, tape->str, size, &index, true);
+
+    if (error == JSONLOGIC_ERROR_SUCCESS && JsonLogic_Parser_Root[state][JSONLOGIC_PARSE_EOF] != JsonLogic_ParserState_End) {
+        error = JSONLOGIC_ERROR_SYNTAX_ERROR;
+    }
+
+    jsonlogic_parsestack_free(&stack);
+
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        if (infoptr != NULL) {
+            *infoptr = jsonlogic_get_lineinfo(tape->str, size, index);
+        }
+        tape->used = 0;
+        return error;
+    }
+
+    tape->error = JSONLOGIC_ERROR_SUCCESS;
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+// Index of the entry after the value at index.
+static inline size_t jsonlogic_tape_next(const JsonLogic_Tape *tape, size_t index) {
+    uint64_t entry = tape->entries[index];
+    switch (JSONLOGIC_TAPE_KIND(entry)) {
+        case JsonLogic_TapeKind_Number:
+            return index + 2;
+
+        case JsonLogic_TapeKind_String:
+            return index + 3;
+
+        case JsonLogic_TapeKind_Array:
+        case JsonLogic_TapeKind_Object:
+            return JSONLOGIC_TAPE_PAYLOAD(entry);
+
+        default:
+            return index + 1;
+    }
+}
+
+static inline bool jsonlogic_tape_key_equals(const JsonLogic_Tape *tape, size_t index, const char16_t *key, size_t size) {
+    const uint64_t *entries = tape->entries + index;
+    size_t start_index = JSONLOGIC_TAPE_PAYLOAD(entries[0]);
+    size_t end_index   = entries[1];
+    size_t utf16_size  = entries[2];
+    if (utf16_size != size) {
+        return false;
+    }
+    size_t run_end = jsonlogic_scan_string_run(tape->str, end_index, start_index);
+    return jsonlogic_json_string_equals(tape->str, start_index, run_end, end_index, utf16_size, key, size);
+}
+
+static JsonLogic_Handle jsonlogic_tape_string(const JsonLogic_Tape *tape, size_t index) {
+    const uint64_t *entries = tape->entries + index;
+    size_t start_index = JSONLOGIC_TAPE_PAYLOAD(entries[0]);
+    size_t end_index   = entries[1];
+    size_t run_end = jsonlogic_scan_string_run(tape->str, end_index, start_index);
+    return jsonlogic_json_string_decode(tape->str, start_index, run_end, end_index, entries[2]);
+}
+
+// Index of the value of key in the object at index, SIZE_MAX if there is
+// none. Like in parsed objects the last of duplicate keys wins.
+static size_t jsonlogic_tape_find_key(const JsonLogic_Tape *tape, size_t index, const char16_t *key, size_t size) {
+    size_t count = tape->entries[index + 1];
+    size_t entry_index = index + 2;
+    size_t found = SIZE_MAX;
+    for (size_t item_index = 0; item_index < count; ++ item_index) {
+        size_t value_index = entry_index + 3;
+        if (jsonlogic_tape_key_equals(tape, entry_index, key, size)) {
+            found = value_index;
+        }
+        entry_index = jsonlogic_tape_next(tape, value_index);
+    }
+    return found;
+}
+
+// Index of the item at item_index in the array at index, SIZE_MAX if there
+// is none.
+static size_t jsonlogic_tape_find_item(const JsonLogic_Tape *tape, size_t index, size_t item_index) {
+    if (item_index >= tape->entries[index + 1]) {
+        return SIZE_MAX;
+    }
+    index += 2;
+    for (; item_index > 0; -- item_index) {
+        index = jsonlogic_tape_next(tape, index);
+    }
+    return index;
+}
+
+// Materializes the value at index, node is its projection or NULL if all of
+// it is kept.
+static JsonLogic_Handle jsonlogic_tape_value(const JsonLogic_Tape *tape, size_t index, const JsonLogic_ProjectionNode *node) {
+    const uint64_t *entries = tape->entries + index;
+    switch (JSONLOGIC_TAPE_KIND(entries[0])) {
+        case JsonLogic_TapeKind_Null:
+            return JsonLogic_Null;
+
+        case JsonLogic_TapeKind_True:
+            return JsonLogic_True;
+
+        case JsonLogic_TapeKind_False:
+            return JsonLogic_False;
+
+        case JsonLogic_TapeKind_Number:
+        {
+            double number;
+            JsonLogic_Error error = jsonlogic_json_number_decode(tape->str, JSONLOGIC_TAPE_PAYLOAD(entries[0]), entries[1], &number);
+            if (error != JSONLOGIC_ERROR_SUCCESS) {
+                return error;
+            }
+            return jsonlogic_number_from(number);
+        }
+        case JsonLogic_TapeKind_String:
+            return jsonlogic_tape_string(tape, index);
+
+        case JsonLogic_TapeKind_Array:
+        {
+            size_t size = entries[1];
+            if (node != NULL && node->index_end < size) {
+                size = node->index_end;
+            }
+            if (size == 0) {
+                return jsonlogic_empty_array();
+            }
+            JsonLogic_Array *array = jsonlogic_array_with_capacity(size);
+            if (array == NULL) {
+                return JsonLogic_Error_OutOfMemory;
+            }
+            size_t item_index = index + 2;
+            for (size_t array_index = 0; array_index < size; ++ array_index) {
+                const JsonLogic_ProjectionNode *child = NULL;
+                // items that aren't projected stay null
+                if (node == NULL || (child = jsonlogic_projection_find_index(node, array_index)) != NULL) {
+                    JsonLogic_Handle item = jsonlogic_tape_value(tape, item_index, child != NULL && child->keep ? NULL : child);
+                    if (JSONLOGIC_IS_ERROR(item)) {
+                        jsonlogic_decref(jsonlogic_array_into_handle(array));
+                        return item;
+                    }
+                    array->items[array_index] = item;
+                }
+                item_index = jsonlogic_tape_next(tape, item_index);
+            }
+            return jsonlogic_array_into_handle(array);
+        }
+        case JsonLogic_TapeKind_Object:
+        {
+            JsonLogic_ObjBuf buf = JSONLOGIC_OBJBUF_INIT;
+            size_t count = entries[1];
+            size_t entry_index = index + 2;
+            for (size_t item_index = 0; item_index < count; ++ item_index) {
+                size_t value_index = entry_index + 3;
+                const JsonLogic_ProjectionNode *child = NULL;
+                if (node != NULL) {
+                    for (child = node->children; child != NULL; child = child->next) {
+                        const JsonLogic_String *key = JSONLOGIC_CAST_STRING(child->key);
+                        if (jsonlogic_tape_key_equals(tape, entry_index, key->str, key->size)) {
+                            break;
+                        }
+                    }
+                    if (child == NULL) {
+                        entry_index = jsonlogic_tape_next(tape, value_index);
+                        continue;
+                    }
+                }
+
+                JsonLogic_Handle key = jsonlogic_tape_string(tape, entry_index);
+                if (JSONLOGIC_IS_ERROR(key)) {
+                    jsonlogic_objbuf_free(&buf);
+                    return key;
+                }
+                JsonLogic_Handle value = jsonlogic_tape_value(tape, value_index, child != NULL && child->keep ? NULL : child);
+                if (JSONLOGIC_IS_ERROR(value)) {
+                    jsonlogic_decref(key);
+                    jsonlogic_objbuf_free(&buf);
+                    return value;
+                }
+                JsonLogic_Error error = jsonlogic_objbuf_set(&buf, key, value);
+                jsonlogic_decref(key);
+                jsonlogic_decref(value);
+                if (error != JSONLOGIC_ERROR_SUCCESS) {
+                    jsonlogic_objbuf_free(&buf);
+                    return error;
+                }
+                entry_index = jsonlogic_tape_next(tape, value_index);
+            }
+            return jsonlogic_object_into_handle(jsonlogic_objbuf_take(&buf));
+        }
+        default:
+            assert(false);
+            return JsonLogic_Error_InternalError;
+    }
+}
+
+JsonLogic_Handle jsonlogic_tape_materialize(const JsonLogic_Tape *tape, const JsonLogic_Projection *projection) {
+    if (tape->error != JSONLOGIC_ERROR_SUCCESS) {
+        return tape->error;
+    }
+
+    return jsonlogic_tape_value(tape, 0, projection == NULL || projection->root.keep ? NULL : &projection->root);
+}
+
+JsonLogic_Handle jsonlogic_tape_get(const JsonLogic_Tape *tape, JsonLogic_Handle key) {
+    if (tape->error != JSONLOGIC_ERROR_SUCCESS) {
+        return tape->error;
+    }
+
+    // split just like the paths of var
+    JsonLogic_Path *path = jsonlogic_path_compile(key);
+    if (path == NULL) {
+        return JsonLogic_Error_OutOfMemory;
+    }
+
+    JsonLogic_Handle value = JsonLogic_Null;
+    size_t index = 0;
+    switch (path->kind) {
+        case JsonLogic_PathKind_Data:
+            value = jsonlogic_tape_value(tape, index, NULL);
+            break;
+
+        case JsonLogic_PathKind_Index:
+            switch (JSONLOGIC_TAPE_KIND(tape->entries[index])) {
+                case JsonLogic_TapeKind_Array:
+                    index = jsonlogic_tape_find_item(tape, index, path->index);
+                    if (index != SIZE_MAX) {
+                        value = jsonlogic_tape_value(tape, index, NULL);
+                    }
+                    break;
+
+                case JsonLogic_TapeKind_Object:
+                {
+                    // objects are indexed by the number as a string
+                    JsonLogic_Handle strkey = jsonlogic_to_string(path->key);
+                    if (JSONLOGIC_IS_ERROR(strkey)) {
+                        value = strkey;
+                        break;
+                    }
+                    const JsonLogic_String *string = JSONLOGIC_CAST_STRING(strkey);
+                    index = jsonlogic_tape_find_key(tape, index, string->str, string->size);
+                    jsonlogic_decref(strkey);
+                    if (index != SIZE_MAX) {
+                        value = jsonlogic_tape_value(tape, index, NULL);
+                    }
+                    break;
+                }
+                default:
+                {
+                    JsonLogic_Handle data = jsonlogic_tape_value(tape, index, NULL);
+                    value = JSONLOGIC_IS_ERROR(data) ? data : jsonlogic_get_index(data, path->index);
+                    jsonlogic_decref(data);
+                    break;
+                }
+            }
+            break;
+
+        case JsonLogic_PathKind_Segments:
+        {
+            // walk the tape as far as it goes, then read the rest from the
+            // materialized value like var does
+            size_t segment_index = 0;
+            for (; segment_index < path->count && index != SIZE_MAX; ++ segment_index) {
+                const JsonLogic_PathSegment *segment = &path->segments[segment_index];
+                uint64_t entry = tape->entries[index];
+                if (JSONLOGIC_TAPE_KIND(entry) == JsonLogic_TapeKind_Object) {
+                    index = jsonlogic_tape_find_key(tape, index, segment->key, segment->size);
+                } else if (JSONLOGIC_TAPE_KIND(entry) == JsonLogic_TapeKind_Array) {
+                    if (segment->index != SIZE_MAX) {
+                        index = jsonlogic_tape_find_item(tape, index, segment->index);
+                    } else {
+                        if (jsonlogic_utf16_equals(segment->key, segment->size, JSONLOGIC_LENGTH, JSONLOGIC_LENGTH_SIZE)) {
+                            value = jsonlogic_number_from((double) tape->entries[index + 1]);
+                            ++ segment_index;
+                        }
+                        index = SIZE_MAX;
+                        break;
+                    }
+                } else {
+                    break;
+                }
+            }
+
+            if (index != SIZE_MAX) {
+                value = jsonlogic_tape_value(tape, index, NULL);
+            }
+
+            for (; segment_index < path->count && !JSONLOGIC_IS_NULL(value) && !JSONLOGIC_IS_ERROR(value); ++ segment_index) {
+                const JsonLogic_PathSegment *segment = &path->segments[segment_index];
+                JsonLogic_Handle next_value = jsonlogic_get_utf16_sized(value, segment->key, segment->size);
+                jsonlogic_decref(value);
+                value = next_value;
+            }
+            break;
+        }
+        default:
+            assert(false);
+            value = JsonLogic_Error_InternalError;
+            break;
+    }
+
+    jsonlogic_path_free(path);
+
+    return value;
+}
+
+// ---- push parser ----
+
+struct JsonLogic_Parser {
+    JsonLogic_ParseStack stack;
+    JsonLogic_RootParser state;
+    JsonLogic_Error error;
+    JsonLogic_LineInfo info;
+    // the start of a token that continues in the next chunk
+    char *pending;
+    size_t pending_size;
+    size_t pending_capacity;
+    // bytes at the start of the next chunk that belong to an escape or UTF-8
+    // sequence at the end of the pending string
+    size_t pending_skip;
+    // position of the next byte that is fed
+    size_t offset;
+    size_t lineno;
+    size_t linestart;
+};
+
+static void jsonlogic_parser_reset(JsonLogic_Parser *parser) {
+    jsonlogic_parsestack_free(&parser->stack);
+    parser->state          = JsonLogic_ParserState_Start;
+    parser->error          = JSONLOGIC_ERROR_SUCCESS;
+    parser->info           = JSONLOGIC_LINEINFO_INIT;
+    parser->pending_size   = 0;
+    parser->pending_skip   = 0;
+    parser->offset         = 0;
+    parser->lineno         = 1;
+    parser->linestart      = 0;
+}
+
+JsonLogic_Parser *jsonlogic_parser_new(void) {
+    JsonLogic_Parser *parser = malloc(sizeof(JsonLogic_Parser));
+    if (parser == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    parser->stack            = JSONLOGIC_PARSESTACK_INIT;
+    parser->pending          = NULL;
+    parser->pending_capacity = 0;
+    jsonlogic_parser_reset(parser);
+
+    return parser;
+}
+
+void jsonlogic_parser_free(JsonLogic_Parser *parser) {
+    if (parser == NULL) {
+        return;
+    }
+
+    jsonlogic_parsestack_free(&parser->stack);
+    free(parser->pending);
+    free(parser);
+}
+
+// Moves the position past size bytes of str for the line info of errors.
+static void jsonlogic_parser_advance(JsonLogic_Parser *parser, const char *str, size_t size) {
+    if (size == 0) {
+        return;
+    }
+
+    const char *end = str + size;
+    const char *ptr = str;
+    while ((ptr = memchr(ptr, '\n', (size_t)(end - ptr))) != NULL) {
+        ++ ptr;
+        ++ parser->lineno;
+        parser->linestart = parser->offset + (size_t)(ptr - str);
+        if (ptr == end) {
+            break;
+        }
+    }
+    parser->offset += size;
+}
+
+// Fails at index of str, which continues at the current position.
+static JsonLogic_Error jsonlogic_parser_fail(JsonLogic_Parser *parser, JsonLogic_Error error, const char *str, size_t index) {
+    jsonlogic_parser_advance(parser, str, index);
+    parser->info = (JsonLogic_LineInfo){
+        .index  = parser->offset,
+        .lineno = parser->lineno,
+        .column = 1 + parser->offset - parser->linestart,
+    };
+    parser->error = error;
+    jsonlogic_parsestack_free(&parser->stack);
+    return error;
+}
+
+static JsonLogic_Error jsonlogic_parser_append(JsonLogic_Parser *parser, const char *str, size_t size) {
+    if (size > parser->pending_capacity - parser->pending_size) {
+        size_t new_capacity = parser->pending_capacity == 0 ? 64 : parser->pending_capacity;
+        while (new_capacity - parser->pending_size < size) {
+            if (new_capacity > SIZE_MAX / 2) {
+                JSONLOGIC_ERROR_MEMORY();
+                return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+            }
+            new_capacity *= 2;
+        }
+        char *new_pending = realloc(parser->pending, new_capacity);
+        if (new_pending == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        parser->pending          = new_pending;
+        parser->pending_capacity = new_capacity;
+    }
+    memcpy(parser->pending + parser->pending_size, str, size);
+    parser->pending_size += size;
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+// Number of bytes of str that complete the pending token or SIZE_MAX if the
+// token continues after str. A number includes the byte after it, so that the
+// state machine sees that it ends.
+static size_t jsonlogic_parser_token_end(JsonLogic_Parser *parser, const char *str, size_t size, size_t index) {
+    switch (parser->state) {
+        case JsonLogic_ParserState_String:
+            if (parser->pending_skip > 0) {
+                if (size - index < parser->pending_skip) {
+                    parser->pending_skip -= size - index;
+                    return SIZE_MAX;
+                }
+                index += parser->pending_skip;
+                parser->pending_skip = 0;
+            }
+            for (;;) {
+                index = jsonlogic_scan_string_run(str, size, index);
+                if (index >= size) {
+                    return SIZE_MAX;
+                }
+                if (str[index] == '"') {
+                    return index + 1;
+                }
+                size_t sequence_size = jsonlogic_string_sequence_size((unsigned char)str[index]);
+                if (size - index < sequence_size) {
+                    parser->pending_skip = sequence_size - (size - index);
+                    return SIZE_MAX;
+                }
+                index += sequence_size;
+            }
+
+        case JsonLogic_ParserState_Number:
+            for (; index < size; ++ index) {
+                char ch = str[index];
+                if (!((ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == '.' || ch == 'e' || ch == 'E')) {
+                    return index + 1;
+                }
+            }
+            return SIZE_MAX;
+
+        default:
+        {
+            size_t token_size = parser->state == JsonLogic_ParserState_False ? 5 : 4;
+            size_t missing = token_size - parser->pending_size;
+            return size - index >= missing ? index + missing : SIZE_MAX;
+        }
+    }
+}
+
+JsonLogic_Error jsonlogic_parser_feed(JsonLogic_Parser *parser, const char *chunk, size_t size) {
+    if (parser->error != JSONLOGIC_ERROR_SUCCESS) {
+        return parser->error;
+    }
+
+    JsonLogic_Error error;
+    size_t start_index = 0;
+    if (parser->pending_size > 0) {
+        size_t end_index = jsonlogic_parser_token_end(parser, chunk, size, 0);
+        if (end_index == SIZE_MAX) {
+            error = jsonlogic_parser_append(parser, chunk, size);
+            if (error != JSONLOGIC_ERROR_SUCCESS) {
+                return jsonlogic_parser_fail(parser, error, parser->pending, 0);
+            }
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+
+        error = jsonlogic_parser_append(parser, chunk, end_index);
+        if (error != JSONLOGIC_ERROR_SUCCESS) {
+            return jsonlogic_parser_fail(parser, error, parser->pending, 0);
+        }
+
+        size_t index = 0;
+        error = jsonlogic_parse_chunk(&parser->stack, &parser->state, parser->pending, parser->pending_size, &index, false);
+        if (error != JSONLOGIC_ERROR_SUCCESS) {
+            return jsonlogic_parser_fail(parser, error, parser->pending, index);
+        }
+
+        if (index != parser->pending_size) {
+            // only a number includes a byte after it, which can't start a token
+            assert(false);
+            return jsonlogic_parser_fail(parser, JSONLOGIC_ERROR_INTERNAL_ERROR, parser->pending, index);
+        }
+
+        jsonlogic_parser_advance(parser, parser->pending, parser->pending_size);
+        parser->pending_size = 0;
+        start_index = end_index;
+    }
+
+    size_t index = start_index;
+    error = jsonlogic_parse_chunk(&parser->stack, &parser->state, chunk, size, &index, false);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        return jsonlogic_parser_fail(parser, error, chunk + start_index, index - start_index);
+    }
+
+    jsonlogic_parser_advance(parser, chunk + start_index, index - start_index);
+
+    if (index < size) {
+        assert(JSONLOGIC_IS_TOKEN_STATE(parser->state));
+        error = jsonlogic_parser_append(parser, chunk + index, size - index);
+        if (error != JSONLOGIC_ERROR_SUCCESS) {
+            return jsonlogic_parser_fail(parser, error, parser->pending, 0);
+        }
+        if (parser->state == JsonLogic_ParserState_String) {
+            // sets pending_skip
+            size_t end_index = jsonlogic_parser_token_end(parser, parser->pending, parser->pending_size, 1);
+            assert(end_index == SIZE_MAX);
+            (void)end_index;
+        }
+    }
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+JsonLogic_Handle jsonlogic_parser_finish(JsonLogic_Parser *parser, JsonLogic_LineInfo *infoptr) {
+    if (parser->error == JSONLOGIC_ERROR_SUCCESS && parser->pending_size > 0) {
+        size_t index = 0;
+        JsonLogic_Error error = jsonlogic_parse_chunk(&parser->stack, &parser->state, parser->pending, parser->pending_size, &index, true);
+        if (error != JSONLOGIC_ERROR_SUCCESS) {
+            jsonlogic_parser_fail(parser, error, parser->pending, index);
+        } else {
+            jsonlogic_parser_advance(parser, parser->pending, parser->pending_size);
+            parser->pending_size = 0;
+        }
+    }
+
+    if (parser->error == JSONLOGIC_ERROR_SUCCESS &&
+        JsonLogic_Parser_Root[parser->state][JSONLOGIC_PARSE_EOF] != JsonLogic_ParserState_End) {
+        jsonlogic_parser_fail(parser, JSONLOGIC_ERROR_SYNTAX_ERROR, parser->pending, 0);
+    }
+
+    JsonLogic_Handle value;
+    if (parser->error != JSONLOGIC_ERROR_SUCCESS) {
+        if (infoptr != NULL) {
+            *infoptr = parser->info;
+        }
+        value = parser->error;
+    } else {
+        value = jsonlogic_parsestack_pop(&parser->stack);
+    }
+
+    jsonlogic_parser_reset(parser);
+
+    return value;
+}
+
 static const unsigned char JsonLogic_ToHexMap[16] = {
     '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
     'a', 'b', 'c', 'd', 'e', 'f',
@@ -1239,9 +2679,7 @@ char *jsonlogic_stringify_utf8(JsonLogic_Handle value) {
 static inline JsonLogic_Error jsonlogic_print_double(FILE *file, double value) {
 #if defined(JSONLOGIC_WINDOWS) && 0
     // XXX: Disabled because this crashes (at least under WINE)!?
-    if (JsonLogic_C_Locale == NULL) {
-        JsonLogic_C_Locale = JSONLOGIC_CREATE_C_LOCALE();
-    }
+    jsonlogic_init_c_locale();
     int count = _fprintf_l(file, "%.*g", JsonLogic_C_Locale, DBL_DIG, value);
 #else
     int count = fprintf(file, "%.*g", DBL_DIG, value);
@@ -89,22 +89,59 @@ bool jsonlogic_is_false(JsonLogic_Handle handle) {
     return handle == JSONLOGIC_FALSE;
 }
 
+// With JSONLOGIC_ATOMIC_REFCOUNT values may be released on another thread than
+// the one that created them. Increments don't need to be ordered, decrements
+// release the writes of this thread and acquire the writes of all other
+// threads for the one that drops the last reference and frees the value.
+static inline void jsonlogic_refcount_increment(JsonLogic_RefCount *refcount) {
+#if defined(JSONLOGIC_ATOMIC_REFCOUNT)
+    size_t old_refcount = atomic_fetch_add_explicit(refcount, 1, memory_order_relaxed);
+    assert(old_refcount < JSONLOGIC_REFCOUNT_FREEZE_ROOT - 1);
+    (void)old_refcount;
+#else
+    assert(*refcount < JSONLOGIC_REFCOUNT_FREEZE_ROOT - 1);
+    ++ *refcount;
+#endif
+}
+
+// Returns true if this was the last reference.
+static inline bool jsonlogic_refcount_decrement(JsonLogic_RefCount *refcount) {
+#if defined(JSONLOGIC_ATOMIC_REFCOUNT)
+    size_t old_refcount = atomic_fetch_sub_explicit(refcount, 1, memory_order_acq_rel);
+    assert(old_refcount > 0);
+    return old_refcount == 1;
+#else
+    assert(*refcount > 0);
+    return -- *refcount == 0;
+#endif
+}
+
 JsonLogic_Handle jsonlogic_incref(JsonLogic_Handle handle) {
     switch (handle & JsonLogic_TypeMask) {
         case JsonLogic_Type_String:
-            assert(JSONLOGIC_CAST_STRING(handle)->refcount < SIZE_MAX);
-            JSONLOGIC_CAST_STRING(handle)->refcount ++;
+        {
+            JsonLogic_String *string = JSONLOGIC_CAST_STRING(handle);
+            if (!JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(string->refcount))) {
+                jsonlogic_refcount_increment(&string->refcount);
+            }
             break;
-
+        }
         case JsonLogic_Type_Array:
-            assert(JSONLOGIC_CAST_ARRAY(handle)->refcount < SIZE_MAX);
-            JSONLOGIC_CAST_ARRAY(handle)->refcount ++;
+        {
+            JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(handle);
+            if (!JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(array->refcount))) {
+                jsonlogic_refcount_increment(&array->refcount);
+            }
             break;
-
+        }
         case JsonLogic_Type_Object:
-            assert(JSONLOGIC_CAST_OBJECT(handle)->refcount < SIZE_MAX);
-            JSONLOGIC_CAST_OBJECT(handle)->refcount ++;
+        {
+            JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(handle);
+            if (!JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(object->refcount))) {
+                jsonlogic_refcount_increment(&object->refcount);
+            }
             break;
+        }
     }
     return handle;
 }
@@ -114,9 +151,10 @@ JsonLogic_Handle jsonlogic_decref(JsonLogic_Handle handle) {
         case JsonLogic_Type_String:
         {
             JsonLogic_String *string = JSONLOGIC_CAST_STRING(handle);
-            assert(string->refcount > 0);
-            string->refcount --;
-            if (string->refcount == 0) {
+            if (JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(string->refcount))) {
+                break;
+            }
+            if (jsonlogic_refcount_decrement(&string->refcount)) {
                 jsonlogic_string_free(string);
                 return JsonLogic_Null;
             }
@@ -125,9 +163,10 @@ JsonLogic_Handle jsonlogic_decref(JsonLogic_Handle handle) {
         case JsonLogic_Type_Array:
         {
             JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(handle);
-            assert(array->refcount > 0);
-            array->refcount --;
-            if (array->refcount == 0) {
+            if (JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(array->refcount))) {
+                break;
+            }
+            if (jsonlogic_refcount_decrement(&array->refcount)) {
                 jsonlogic_array_free(array);
                 return JsonLogic_Null;
             }
@@ -136,9 +175,10 @@ JsonLogic_Handle jsonlogic_decref(JsonLogic_Handle handle) {
         case JsonLogic_Type_Object:
         {
             JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(handle);
-            assert(object->refcount > 0);
-            object->refcount --;
-            if (object->refcount == 0) {
+            if (JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(object->refcount))) {
+                break;
+            }
+            if (jsonlogic_refcount_decrement(&object->refcount)) {
                 jsonlogic_object_free(object);
                 return JsonLogic_Null;
             }
@@ -149,6 +189,10 @@ JsonLogic_Handle jsonlogic_decref(JsonLogic_Handle handle) {
 }
 
 JsonLogic_Handle jsonlogic_dissolve(JsonLogic_Handle handle) {
+    if (jsonlogic_is_frozen(handle)) {
+        return handle;
+    }
+
     switch (handle & JsonLogic_TypeMask) {
         case JsonLogic_Type_Array:
         {
@@ -183,17 +227,170 @@ JsonLogic_Handle jsonlogic_dissolve(JsonLogic_Handle handle) {
 size_t jsonlogic_get_refcount(JsonLogic_Handle handle) {
     switch (handle & JsonLogic_TypeMask) {
         case JsonLogic_Type_String:
-            return JSONLOGIC_CAST_STRING(handle)->refcount;
+            return JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_STRING(handle)->refcount) & ~JSONLOGIC_REFCOUNT_FLAGS;
 
         case JsonLogic_Type_Array:
-            return JSONLOGIC_CAST_ARRAY(handle)->refcount;
+            return JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_ARRAY(handle)->refcount) & ~JSONLOGIC_REFCOUNT_FLAGS;
 
         case JsonLogic_Type_Object:
-            return JSONLOGIC_CAST_OBJECT(handle)->refcount;
+            return JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_OBJECT(handle)->refcount) & ~JSONLOGIC_REFCOUNT_FLAGS;
     }
     return 1;
 }
 
+// Returns false for values that are already frozen (or immortal), which also
+// stops recursion for ref-loops. Only the root of a freeze is marked as such.
+static bool jsonlogic_freeze_refcount(JsonLogic_RefCount *refcount, bool immortal, bool root) {
+    size_t value = JSONLOGIC_GET_REFCOUNT(*refcount);
+    if (immortal) {
+        if (JSONLOGIC_IS_IMMORTAL_REFCOUNT(value)) {
+            return false;
+        }
+        JSONLOGIC_SET_REFCOUNT(*refcount, JSONLOGIC_REFCOUNT_IMMORTAL);
+        return true;
+    }
+
+    if (JSONLOGIC_IS_FROZEN_REFCOUNT(value)) {
+        return false;
+    }
+    JSONLOGIC_SET_REFCOUNT(*refcount, value | JSONLOGIC_REFCOUNT_FROZEN | (root ? JSONLOGIC_REFCOUNT_FREEZE_ROOT : 0));
+    return true;
+}
+
+static void jsonlogic_freeze_intern(JsonLogic_Handle handle, bool immortal, bool root) {
+    switch (handle & JsonLogic_TypeMask) {
+        case JsonLogic_Type_String:
+        {
+            JsonLogic_String *string = JSONLOGIC_CAST_STRING(handle);
+            if (jsonlogic_freeze_refcount(&string->refcount, immortal, root)) {
+                if (string->hash == JSONLOGIC_HASH_UNSET) {
+                    string->hash = jsonlogic_hash_fnv1a_utf16(string->str, string->size);
+                }
+            }
+            break;
+        }
+        case JsonLogic_Type_Array:
+        {
+            JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(handle);
+            if (jsonlogic_freeze_refcount(&array->refcount, immortal, root)) {
+                for (size_t index = 0; index < array->size; ++ index) {
+                    jsonlogic_freeze_intern(array->items[index], immortal, false);
+                }
+            }
+            break;
+        }
+        case JsonLogic_Type_Object:
+        {
+            JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(handle);
+            if (jsonlogic_freeze_refcount(&object->refcount, immortal, root)) {
+                for (size_t index = object->first_index; index < object->size; ++ index) {
+                    JsonLogic_Object_Entry *entry = &object->entries[index];
+                    jsonlogic_freeze_intern(entry->key,   immortal, false);
+                    jsonlogic_freeze_intern(entry->value, immortal, false);
+                }
+            }
+            break;
+        }
+    }
+}
+
+JsonLogic_Handle jsonlogic_freeze(JsonLogic_Handle handle) {
+    // The C locale is otherwise created lazily on first use by any thread.
+    jsonlogic_init_c_locale();
+    jsonlogic_freeze_intern(handle, false, true);
+    return handle;
+}
+
+JsonLogic_Handle jsonlogic_make_immortal(JsonLogic_Handle handle) {
+    jsonlogic_init_c_locale();
+    jsonlogic_freeze_intern(handle, true, true);
+    return handle;
+}
+
+// Clears the frozen bits of a value frozen by the same jsonlogic_freeze() as
+// the value that is thawed. Returns false for values that stay frozen: ones
+// that aren't frozen (anymore), immortal ones and the roots of other freezes.
+static bool jsonlogic_thaw_refcount(JsonLogic_RefCount *refcount, bool root) {
+    size_t value = JSONLOGIC_GET_REFCOUNT(*refcount);
+    if (!JSONLOGIC_IS_FROZEN_REFCOUNT(value) || JSONLOGIC_IS_IMMORTAL_REFCOUNT(value) ||
+        (!root && JSONLOGIC_IS_FREEZE_ROOT_REFCOUNT(value))) {
+        return false;
+    }
+    JSONLOGIC_SET_REFCOUNT(*refcount, value & ~JSONLOGIC_REFCOUNT_FLAGS);
+    return true;
+}
+
+static void jsonlogic_thaw_intern(JsonLogic_Handle handle, bool root) {
+    switch (handle & JsonLogic_TypeMask) {
+        case JsonLogic_Type_String:
+            jsonlogic_thaw_refcount(&JSONLOGIC_CAST_STRING(handle)->refcount, root);
+            break;
+
+        case JsonLogic_Type_Array:
+        {
+            JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(handle);
+            if (jsonlogic_thaw_refcount(&array->refcount, root)) {
+                for (size_t index = 0; index < array->size; ++ index) {
+                    jsonlogic_thaw_intern(array->items[index], false);
+                }
+            }
+            break;
+        }
+        case JsonLogic_Type_Object:
+        {
+            JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(handle);
+            if (jsonlogic_thaw_refcount(&object->refcount, root)) {
+                for (size_t index = object->first_index; index < object->size; ++ index) {
+                    JsonLogic_Object_Entry *entry = &object->entries[index];
+                    jsonlogic_thaw_intern(entry->key,   false);
+                    jsonlogic_thaw_intern(entry->value, false);
+                }
+            }
+            break;
+        }
+    }
+}
+
+JsonLogic_Handle jsonlogic_thaw(JsonLogic_Handle handle) {
+    jsonlogic_thaw_intern(handle, true);
+    return handle;
+}
+
+// Values that aren't reference counted are immutable anyway.
+bool jsonlogic_is_frozen(JsonLogic_Handle handle) {
+    switch (handle & JsonLogic_TypeMask) {
+        case JsonLogic_Type_String:
+            return JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_STRING(handle)->refcount));
+
+        case JsonLogic_Type_Array:
+            return JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_ARRAY(handle)->refcount));
+
+        case JsonLogic_Type_Object:
+            return JSONLOGIC_IS_FROZEN_REFCOUNT(JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_OBJECT(handle)->refcount));
+    }
+    return true;
+}
+
+bool jsonlogic_is_immortal(JsonLogic_Handle handle) {
+    switch (handle & JsonLogic_TypeMask) {
+        case JsonLogic_Type_String:
+            return JSONLOGIC_IS_IMMORTAL_REFCOUNT(JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_STRING(handle)->refcount));
+
+        case JsonLogic_Type_Array:
+            return JSONLOGIC_IS_IMMORTAL_REFCOUNT(JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_ARRAY(handle)->refcount));
+
+        case JsonLogic_Type_Object:
+            return JSONLOGIC_IS_IMMORTAL_REFCOUNT(JSONLOGIC_GET_REFCOUNT(JSONLOGIC_CAST_OBJECT(handle)->refcount));
+    }
+    return true;
+}
+
+void jsonlogic_init_c_locale(void) {
+    if (JsonLogic_C_Locale == NULL) {
+        JsonLogic_C_Locale = JSONLOGIC_CREATE_C_LOCALE();
+    }
+}
+
 JSONLOGIC_DEF_UTF16(JSONLOGIC_ALT_IF, u"?:")
 JSONLOGIC_DEF_UTF16(JSONLOGIC_ALL,    u"all")
 JSONLOGIC_DEF_UTF16(JSONLOGIC_AND,    u"and")
@@ -581,17 +778,21 @@ JsonLogic_Handle jsonlogic_op_VAR(void *context, JsonLogic_Handle data, JsonLogi
     JsonLogic_Handle default_value = argc > 1 ? args[1] : JsonLogic_Null;
 
     const JsonLogic_String *strkey = JSONLOGIC_CAST_STRING(key);
+    JsonLogic_Handle value = jsonlogic_get_path_utf16(data, strkey->str, strkey->size, default_value);
+    jsonlogic_decref(key);
+
+    return value;
+}
 
-    if (strkey->size == 0) {
-        jsonlogic_decref(key);
+JsonLogic_Handle jsonlogic_get_path_utf16(JsonLogic_Handle data, const char16_t *str, size_t size, JsonLogic_Handle default_value) {
+    if (size == 0) {
         return jsonlogic_incref(data);
     }
 
-    const char16_t *pos = strkey->str;
-    const char16_t *next = jsonlogic_find_char(pos, strkey->size, u'.');
+    const char16_t *pos = str;
+    const char16_t *next = jsonlogic_find_char(pos, size, u'.');
     if (next == NULL) {
-        JsonLogic_Handle value = jsonlogic_get_utf16_sized(data, strkey->str, strkey->size);
-        jsonlogic_decref(key);
+        JsonLogic_Handle value = jsonlogic_get_utf16_sized(data, str, size);
         if (JSONLOGIC_IS_NULL(value)) {
             jsonlogic_incref(default_value);
             return default_value;
@@ -599,21 +800,19 @@ JsonLogic_Handle jsonlogic_op_VAR(void *context, JsonLogic_Handle data, JsonLogi
         return value;
     }
 
-    const char16_t *end = strkey->str + strkey->size;
+    const char16_t *end = str + size;
     jsonlogic_incref(data);
     for (;;) {
-        size_t size = next - pos;
-        JsonLogic_Handle next_data = jsonlogic_get_utf16_sized(data, pos, size);
+        size_t segment_size = next - pos;
+        JsonLogic_Handle next_data = jsonlogic_get_utf16_sized(data, pos, segment_size);
         jsonlogic_decref(data);
         if (JSONLOGIC_IS_NULL(next_data)) {
             jsonlogic_incref(default_value);
-            jsonlogic_decref(key);
             return default_value;
         }
 
         pos = next + 1;
         if (pos >= end) {
-            jsonlogic_decref(key);
             return next_data;
         }
         next = jsonlogic_find_char(pos, end - pos, u'.');
@@ -42,6 +42,7 @@ typedef uint64_t JsonLogic_Type;
 #define JSONLOGIC_ERROR_IO_ERROR           (JsonLogic_Type_Error | 6)
 #define JSONLOGIC_ERROR_SYNTAX_ERROR       (JsonLogic_Type_Error | 7)
 #define JSONLOGIC_ERROR_UNICODE_ERROR      (JsonLogic_Type_Error | 8)
+#define JSONLOGIC_ERROR_RECURSION_ERROR    (JsonLogic_Type_Error | 9)
 
 #if defined(_WIN32) || defined(_WIN64)
     #define JSONLOGIC_WINDOWS
@@ -12,42 +12,64 @@
 #include <errno.h>
 #include <locale.h>
 
+#if defined(JSONLOGIC_ATOMIC_REFCOUNT)
+    #include <stdatomic.h>
+
+    typedef atomic_size_t JsonLogic_RefCount;
+
+    // Setting the refcount is only done on values that aren't shared yet.
+    #define JSONLOGIC_SET_REFCOUNT(REFCOUNT, VALUE) atomic_store_explicit(&(REFCOUNT), (VALUE), memory_order_relaxed)
+    #define JSONLOGIC_GET_REFCOUNT(REFCOUNT) atomic_load_explicit(&(REFCOUNT), memory_order_relaxed)
+#else
+    typedef size_t JsonLogic_RefCount;
+
+    #define JSONLOGIC_SET_REFCOUNT(REFCOUNT, VALUE) ((REFCOUNT) = (VALUE))
+    #define JSONLOGIC_GET_REFCOUNT(REFCOUNT) (REFCOUNT)
+#endif
+
 #define JsonLogic_PtrMask  (~(uint64_t)0xffff000000000000)
 #define JsonLogic_TypeMask  ((uint64_t)0xffff000000000000)
 #define JsonLogic_MaxNumber ((uint64_t)0xfff8000000000000)
 
+#if defined(_MSC_VER)
+    #define JSONLOGIC_THREAD_LOCAL __declspec(thread)
+#else
+    #define JSONLOGIC_THREAD_LOCAL _Thread_local
+#endif
+
+// Allocation of values and other temporaries of an evaluation. These use the
+// arena of the current thread if there is one (see jsonlogic_apply_arena()),
+// otherwise the heap.
+JSONLOGIC_PRIVATE void *jsonlogic_malloc(size_t size);
+JSONLOGIC_PRIVATE void *jsonlogic_realloc(void *ptr, size_t size);
+JSONLOGIC_PRIVATE void  jsonlogic_free(void *ptr);
+
+// Bytes in use in the arena of the current thread, 0 if there is none.
+JSONLOGIC_PRIVATE size_t jsonlogic_arena_used(void);
+
 #define JSONLOGIC_MALLOC(HEAD_SIZE, ITEM_SIZE, ITEM_COUNT) \
     ((ITEM_COUNT) >= (SIZE_MAX - (HEAD_SIZE)) / (ITEM_SIZE) ? (errno = ENOMEM, NULL) : \
-    malloc((HEAD_SIZE) + (ITEM_SIZE) * (ITEM_COUNT)))
+    jsonlogic_malloc((HEAD_SIZE) + (ITEM_SIZE) * (ITEM_COUNT)))
 
 #define JSONLOGIC_REALLOC(PTR, HEAD_SIZE, ITEM_SIZE, ITEM_COUNT) \
     ((ITEM_COUNT) >= (SIZE_MAX - (HEAD_SIZE)) / (ITEM_SIZE) ? (errno = ENOMEM, NULL) : \
-    realloc((PTR), (HEAD_SIZE) + (ITEM_SIZE) * (ITEM_COUNT)))
+    jsonlogic_realloc((PTR), (HEAD_SIZE) + (ITEM_SIZE) * (ITEM_COUNT)))
 
 #define JSONLOGIC_MALLOC_OBJECT(ITEM_COUNT) \
     (JsonLogic_Object*)JSONLOGIC_MALLOC(sizeof(JsonLogic_Object) - sizeof(JsonLogic_Object_Entry), sizeof(JsonLogic_Object_Entry), (ITEM_COUNT))
 
-#define JSONLOGIC_MALLOC_EMPTY_OBJECT() \
-    (JsonLogic_Object*)malloc(sizeof(JsonLogic_Object) - sizeof(JsonLogic_Object_Entry))
-
 #define JSONLOGIC_MALLOC_ARRAY(ITEM_COUNT) \
     (JsonLogic_Array*)JSONLOGIC_MALLOC(sizeof(JsonLogic_Array) - sizeof(JsonLogic_Handle), sizeof(JsonLogic_Handle), (ITEM_COUNT))
 
 #define JSONLOGIC_REALLOC_ARRAY(ARRAY, ITEM_COUNT) \
     (JsonLogic_Array*)JSONLOGIC_REALLOC((ARRAY), sizeof(JsonLogic_Array) - sizeof(JsonLogic_Handle), sizeof(JsonLogic_Handle), (ITEM_COUNT))
 
-#define JSONLOGIC_MALLOC_EMPTY_ARRAY() \
-    (JsonLogic_Array*)malloc(sizeof(JsonLogic_Array) - sizeof(JsonLogic_Handle))
-
 #define JSONLOGIC_MALLOC_STRING(SIZE) \
     (JsonLogic_String*)JSONLOGIC_MALLOC(sizeof(JsonLogic_String) - sizeof(char16_t), sizeof(char16_t), (SIZE))
 
 #define JSONLOGIC_REALLOC_STRING(STRING, SIZE) \
     (JsonLogic_String*)JSONLOGIC_REALLOC((STRING), sizeof(JsonLogic_String) - sizeof(char16_t), sizeof(char16_t), (SIZE))
 
-#define JSONLOGIC_MALLOC_EMPTY_STRING() \
-    (JsonLogic_String*)malloc(sizeof(JsonLogic_String) - sizeof(char16_t))
-
 #if defined(NDEBUG)
     #define JSONLOGIC_DEBUG(...)
     #define JSONLOGIC_ERROR(...)
@@ -165,33 +187,54 @@ JSONLOGIC_DECL_UTF16(JSONLOGIC_SOME)
 JSONLOGIC_DECL_UTF16(JSONLOGIC_ACCUMULATOR)
 JSONLOGIC_DECL_UTF16(JSONLOGIC_CURRENT)
 JSONLOGIC_DECL_UTF16(JSONLOGIC_DATA)
+JSONLOGIC_DECL_UTF16(JSONLOGIC_LENGTH)
 
 #define JSONLOGIC_ACCUMULATOR_HASH 0xd70624b7f0caa74d
 #define JSONLOGIC_CURRENT_HASH     0x1e84ef3a9c8034b4
 #define JSONLOGIC_DATA_HASH        0xf8c35b7f283d7585
 
-#define JSONLOGIC_STATIC_ARGC 8
+// Default nesting limit of jsonlogic_apply_custom().
+#ifndef JSONLOGIC_MAX_DEPTH
+    #define JSONLOGIC_MAX_DEPTH 4096
+#endif
 
 #define JSONLOGIC_IS_OP(OPSRT, OP) \
     jsonlogic_utf16_equals((OPSRT)->str, (OPSRT)->size, (JSONLOGIC_##OP), (JSONLOGIC_##OP##_SIZE))
 
 #define JSONLOGIC_HASH_UNSET ((uint64_t)0)
 
+// Highest bit of the refcount. Frozen values are never written to, so
+// jsonlogic_incref() and jsonlogic_decref() don't touch their refcount.
+#define JSONLOGIC_REFCOUNT_FROZEN (~(SIZE_MAX >> 1))
+#define JSONLOGIC_IS_FROZEN_REFCOUNT(REFCOUNT) (((REFCOUNT) & JSONLOGIC_REFCOUNT_FROZEN) != 0)
+
+// Second highest bit, set on the value jsonlogic_freeze() was called on. Such
+// values may be shared by other frozen values, so jsonlogic_thaw() of a value
+// that contains them leaves them frozen.
+#define JSONLOGIC_REFCOUNT_FREEZE_ROOT (JSONLOGIC_REFCOUNT_FROZEN >> 1)
+#define JSONLOGIC_IS_FREEZE_ROOT_REFCOUNT(REFCOUNT) (((REFCOUNT) & JSONLOGIC_REFCOUNT_FREEZE_ROOT) != 0)
+#define JSONLOGIC_REFCOUNT_FLAGS (JSONLOGIC_REFCOUNT_FROZEN | JSONLOGIC_REFCOUNT_FREEZE_ROOT)
+
+// Immortal values are frozen for good. jsonlogic_thaw() leaves them alone and
+// they are never freed, e.g. the empty string/array/object singletons.
+#define JSONLOGIC_REFCOUNT_IMMORTAL SIZE_MAX
+#define JSONLOGIC_IS_IMMORTAL_REFCOUNT(REFCOUNT) ((REFCOUNT) == JSONLOGIC_REFCOUNT_IMMORTAL)
+
 typedef struct JsonLogic_String {
-    size_t refcount;
+    JsonLogic_RefCount refcount;
     uint64_t hash;
     size_t size;
     char16_t str[1];
 } JsonLogic_String;
 
 typedef struct JsonLogic_Array {
-    size_t refcount;
+    JsonLogic_RefCount refcount;
     size_t size;
     JsonLogic_Handle items[1];
 } JsonLogic_Array;
 
 typedef struct JsonLogic_Object {
-    size_t refcount;
+    JsonLogic_RefCount refcount;
     size_t size;
     size_t used;
     size_t first_index;
@@ -218,6 +261,7 @@ extern "C" {
     #define JSONLOGIC_CREATE_C_LOCALE() newlocale(LC_ALL_MASK, "C", NULL)
 #endif
 JSONLOGIC_PRIVATE extern JSONLOGIC_LOCALE_T JsonLogic_C_Locale;
+JSONLOGIC_PRIVATE void jsonlogic_init_c_locale(void);
 
 JSONLOGIC_PRIVATE JsonLogic_Array *jsonlogic_array_with_capacity(size_t size);
 
@@ -233,7 +277,7 @@ JSONLOGIC_PRIVATE inline JsonLogic_Handle jsonlogic_string_into_handle(JsonLogic
     if (string == NULL) {
         return JsonLogic_Error_OutOfMemory;
     }
-    assert(string->refcount == 1);
+    assert(JSONLOGIC_GET_REFCOUNT(string->refcount) == 1 || JSONLOGIC_IS_IMMORTAL_REFCOUNT(JSONLOGIC_GET_REFCOUNT(string->refcount)));
     return ((uint64_t)(uintptr_t)string) | JsonLogic_Type_String;
 }
 
@@ -241,7 +285,7 @@ JSONLOGIC_PRIVATE inline JsonLogic_Handle jsonlogic_array_into_handle(JsonLogic_
     if (array == NULL) {
         return JsonLogic_Error_OutOfMemory;
     }
-    assert(array->refcount == 1);
+    assert(JSONLOGIC_GET_REFCOUNT(array->refcount) == 1 || JSONLOGIC_IS_IMMORTAL_REFCOUNT(JSONLOGIC_GET_REFCOUNT(array->refcount)));
     return ((uint64_t)(uintptr_t)array) | JsonLogic_Type_Array;
 }
 
@@ -249,7 +293,7 @@ JSONLOGIC_PRIVATE inline JsonLogic_Handle jsonlogic_object_into_handle(JsonLogic
     if (object == NULL) {
         return JsonLogic_Error_OutOfMemory;
     }
-    assert(object->refcount == 1);
+    assert(JSONLOGIC_GET_REFCOUNT(object->refcount) == 1 || JSONLOGIC_IS_IMMORTAL_REFCOUNT(JSONLOGIC_GET_REFCOUNT(object->refcount)));
     return ((uint64_t)(uintptr_t)object) | JsonLogic_Type_Object;
 }
 
@@ -335,14 +379,26 @@ JSONLOGIC_PRIVATE void jsonlogic_objbuf_free(JsonLogic_ObjBuf *buf);
 
 JSONLOGIC_PRIVATE const char16_t *jsonlogic_find_char(const char16_t *str, size_t size, char16_t ch);
 
+// The value of the dotted path str in data like {"var":str}, but without
+// allocating a key string. Returns a new reference.
+JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_get_path_utf16(JsonLogic_Handle data, const char16_t *str, size_t size, JsonLogic_Handle default_value);
+
+// Passed to lazy operations. The interpreter and the program VM each embed it
+// as the first member of their own evaluator.
+struct JsonLogic_Evaluator {
+    JsonLogic_Handle (*evaluate)(JsonLogic_Evaluator *evaluator, JsonLogic_Handle logic, JsonLogic_Handle data);
+};
+
 JSONLOGIC_PRIVATE const JsonLogic_Operation *jsonlogic_operations_get_with_hash(const JsonLogic_Operations *operations, uint64_t hash, const char16_t *key, size_t key_size);
-JSONLOGIC_PRIVATE JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operations, uint64_t hash, const char16_t *key, size_t key_size, void *context, JsonLogic_Operation_Funct funct);
+JSONLOGIC_PRIVATE JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operations, uint64_t hash, const char16_t *key, size_t key_size, JsonLogic_Operation operation);
 #ifndef NDEBUG
 JSONLOGIC_PRIVATE void jsonlogic_operations_debug(const JsonLogic_Operations *operations);
 #endif
 
 JSONLOGIC_PRIVATE uint64_t jsonlogic_hash_fnv1a(const uint8_t *data, size_t size);
 JSONLOGIC_PRIVATE uint64_t jsonlogic_hash_fnv1a_utf16(const char16_t *str, size_t size);
+JSONLOGIC_PRIVATE uint64_t jsonlogic_logic_hash(JsonLogic_Handle logic);
+JSONLOGIC_PRIVATE bool jsonlogic_logic_equals(JsonLogic_Handle a, JsonLogic_Handle b);
 
 JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_op_NOT         (void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc);
 JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_op_TO_BOOL     (void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc);
@@ -390,6 +446,177 @@ JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_extra_ZIP              (void *conte
 JSONLOGIC_PRIVATE JsonLogic_Handle certlogic_op_NOT    (void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc);
 JSONLOGIC_PRIVATE JsonLogic_Handle certlogic_op_TO_BOOL(void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc);
 
+typedef enum JsonLogic_PathKind {
+    JsonLogic_PathKind_Data = 0,
+    JsonLogic_PathKind_Index,
+    JsonLogic_PathKind_Segments,
+} JsonLogic_PathKind;
+
+typedef struct JsonLogic_PathSegment {
+    const char16_t *key;
+    size_t size;
+    uint64_t hash;
+    size_t index; // SIZE_MAX if the segment isn't an array index
+} JsonLogic_PathSegment;
+
+// A pre-split var path. The segment keys point into str.
+typedef struct JsonLogic_Path {
+    JsonLogic_PathKind kind;
+    JsonLogic_Handle key;
+    JsonLogic_Handle str;
+    size_t index;
+    size_t count;
+    JsonLogic_PathSegment segments[1];
+} JsonLogic_Path;
+
+typedef struct JsonLogic_Paths {
+    size_t size;
+    JsonLogic_Path *items[1];
+} JsonLogic_Paths;
+
+JSONLOGIC_PRIVATE JsonLogic_Path *jsonlogic_path_compile(JsonLogic_Handle key);
+JSONLOGIC_PRIVATE void jsonlogic_path_free(JsonLogic_Path *path);
+JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_path_get(const JsonLogic_Path *path, JsonLogic_Handle data, JsonLogic_Handle default_value);
+JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_path_get_scoped(const JsonLogic_Path *path, JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data, JsonLogic_Handle default_value);
+
+JSONLOGIC_PRIVATE JsonLogic_Paths *jsonlogic_paths_compile(const JsonLogic_Handle keys[], size_t count);
+JSONLOGIC_PRIVATE void jsonlogic_paths_free(JsonLogic_Paths *paths);
+JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_paths_missing(const JsonLogic_Paths *paths, JsonLogic_Handle data);
+
+typedef enum JsonLogic_OpCode {
+    JsonLogic_OpCode_Push = 0,
+    JsonLogic_OpCode_Call,
+    JsonLogic_OpCode_Array,
+    JsonLogic_OpCode_Jump,
+    JsonLogic_OpCode_JumpIfFalse,
+    JsonLogic_OpCode_AndJump,
+    JsonLogic_OpCode_OrJump,
+    JsonLogic_OpCode_Filter,
+    JsonLogic_OpCode_Map,
+    JsonLogic_OpCode_Reduce,
+    JsonLogic_OpCode_ReduceScope,
+    JsonLogic_OpCode_All,
+    JsonLogic_OpCode_Some,
+    JsonLogic_OpCode_None,
+    JsonLogic_OpCode_Var,
+    JsonLogic_OpCode_ScopeVar,
+    JsonLogic_OpCode_Missing,
+    JsonLogic_OpCode_MissingSome,
+    JsonLogic_OpCode_Load,
+    JsonLogic_OpCode_Store,
+    JsonLogic_OpCode_Lazy,
+    JsonLogic_OpCode_Return,
+} JsonLogic_OpCode;
+
+// A call of a lazy operation. The arguments are compiled in-line after the
+// instruction, each one ending with a return. Any other logic the operation
+// evaluates is interpreted with the copy of the operations table.
+typedef struct JsonLogic_LazyCall {
+    JsonLogic_Operation operation;
+    JsonLogic_Operations operations;
+    size_t argc;
+    // the logic of the arguments
+    JsonLogic_Handle *args;
+    // start of the code of each argument
+    size_t *entries;
+    // the instruction after the code of the arguments
+    size_t next;
+} JsonLogic_LazyCall;
+
+typedef struct JsonLogic_Instr {
+    JsonLogic_OpCode opcode;
+    size_t argc;
+    union {
+        JsonLogic_Handle value;
+        size_t target;
+        JsonLogic_Operation operation;
+        JsonLogic_Path *path;
+        JsonLogic_Paths *paths;
+        JsonLogic_LazyCall *lazy;
+    };
+} JsonLogic_Instr;
+
+struct JsonLogic_Program {
+    bool (*to_bool)(JsonLogic_Handle handle);
+    size_t stack_size;
+    size_t size;
+    JsonLogic_Instr *code;
+};
+
+#define JSONLOGIC_PROGRAM_STATIC_STACK 64
+
+// Slots that weren't evaluated yet hold a NaN that isn't a valid handle.
+#define JSONLOGIC_SLOT_UNSET JsonLogic_MaxNumber
+
+// Decision diagram of boolean rules, see decision.c.
+typedef struct JsonLogic_Diagram JsonLogic_Diagram;
+
+// Per input state of the comparisons of a decision diagram.
+#define JSONLOGIC_ATOM_UNKNOWN 0
+#define JSONLOGIC_ATOM_FALSE   1
+#define JSONLOGIC_ATOM_TRUE    2
+#define JSONLOGIC_ATOM_OTHER   3
+
+JSONLOGIC_PRIVATE JsonLogic_Diagram *jsonlogic_diagram_compile(const JsonLogic_Handle rules[], size_t rule_count, const JsonLogic_Operations *operations, bool certlogic);
+JSONLOGIC_PRIVATE void jsonlogic_diagram_free(JsonLogic_Diagram *diagram);
+JSONLOGIC_PRIVATE size_t jsonlogic_diagram_get_atom_count(const JsonLogic_Diagram *diagram);
+JSONLOGIC_PRIVATE size_t jsonlogic_diagram_get_path_count(const JsonLogic_Diagram *diagram);
+JSONLOGIC_PRIVATE bool jsonlogic_diagram_has_rule(const JsonLogic_Diagram *diagram, size_t rule);
+
+// atoms has one entry per atom and values one per path. Both are
+// initialized by jsonlogic_diagram_reset() and values has to be released
+// by jsonlogic_diagram_release() once the input is done.
+JSONLOGIC_PRIVATE void jsonlogic_diagram_reset(const JsonLogic_Diagram *diagram, uint8_t atoms[], JsonLogic_Handle values[]);
+JSONLOGIC_PRIVATE void jsonlogic_diagram_release(const JsonLogic_Diagram *diagram, JsonLogic_Handle values[]);
+
+// Returns true or false or JSONLOGIC_SLOT_UNSET if the rule has to be
+// evaluated by other means for this input.
+JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_diagram_apply(const JsonLogic_Diagram *diagram, size_t rule, JsonLogic_Handle input, uint8_t atoms[], JsonLogic_Handle values[]);
+
+// Default of the min_items argument of jsonlogic_thread_pool_new().
+#ifndef JSONLOGIC_PARALLEL_MIN_ITEMS
+    #define JSONLOGIC_PARALLEL_MIN_ITEMS 1024
+#endif
+
+typedef enum JsonLogic_ParallelKind {
+    JsonLogic_Parallel_Filter = 0,
+    JsonLogic_Parallel_Map,
+    JsonLogic_Parallel_All,
+    JsonLogic_Parallel_Some,
+    JsonLogic_Parallel_None,
+} JsonLogic_ParallelKind;
+
+// Applies lambda to all items on the threads of the pool, see parallel.c.
+// Lambda and items have to be frozen. Returns the value of the operation or
+// JSONLOGIC_SLOT_UNSET if it has to be evaluated on the calling thread.
+JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_thread_pool_apply(
+    JsonLogic_ThreadPool *pool,
+    JsonLogic_ParallelKind kind,
+    JsonLogic_Handle lambda,
+    JsonLogic_Handle items,
+    const JsonLogic_Operations *operations,
+    size_t max_depth
+);
+
+// Calls operation or returns the result of an earlier call with equal
+// arguments, see memo.c.
+JSONLOGIC_PRIVATE JsonLogic_Handle jsonlogic_memo_call(JsonLogic_Memo *memo, const JsonLogic_Operation *operation, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc);
+
+// Logic that evaluates to itself.
+JSONLOGIC_PRIVATE bool jsonlogic_is_literal(JsonLogic_Handle logic);
+
+// Checks if the lambda of reduce needs no context object, see program.c.
+JSONLOGIC_PRIVATE bool jsonlogic_reduce_is_scoped(JsonLogic_Handle lambda, const JsonLogic_Operations *operations, bool certlogic);
+
+// Checks if operation has all of the JSONLOGIC_OPERATION_* flags. Lazy
+// operations have none, since what they evaluate isn't known.
+static inline bool jsonlogic_operation_has_flags(const JsonLogic_Operation *operation, unsigned int flags) {
+    return operation->lazy_funct == NULL && (operation->flags & flags) == flags;
+}
+
+#define jsonlogic_is_pure_operation(operation) \
+    jsonlogic_operation_has_flags((operation), JSONLOGIC_OPERATION_PURE)
+
 #define TRY(EXPR) { \
         const JsonLogic_Error json_logic_error__ = (EXPR); \
         if (json_logic_error__ != JSONLOGIC_ERROR_SUCCESS) { \
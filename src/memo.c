@@ -0,0 +1,311 @@
+#include "jsonlogic_intern.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Results of operations that are pure and expensive, keyed by the operation
+// and the structural hash of the values of its arguments, so equal arguments
+// hit the memo no matter which logic or input they come from. The entries are
+// chained in a hash table and linked in the order of their last use, the least
+// recently used entries are evicted first once the size limit is reached.
+
+#define JSONLOGIC_MEMO_DEFAULT_MAX_SIZE (1024 * 1024)
+#define JSONLOGIC_MEMO_MIN_CAPACITY 64
+
+typedef struct JsonLogic_MemoEntry {
+    struct JsonLogic_MemoEntry *chain;
+    struct JsonLogic_MemoEntry *newer;
+    struct JsonLogic_MemoEntry *older;
+    uint64_t hash;
+    JsonLogic_Operation_Funct funct;
+    void *context;
+    JsonLogic_Handle result;
+    size_t size;
+    size_t argc;
+    JsonLogic_Handle args[1];
+} JsonLogic_MemoEntry;
+
+struct JsonLogic_Memo {
+    JsonLogic_MemoEntry **buckets;
+    size_t capacity;
+    size_t count;
+    JsonLogic_MemoEntry *newest;
+    JsonLogic_MemoEntry *oldest;
+    size_t size;
+    size_t max_size;
+    size_t hits;
+    size_t misses;
+};
+
+JsonLogic_Memo *jsonlogic_memo_new(size_t max_size) {
+    JsonLogic_Memo *memo = malloc(sizeof(JsonLogic_Memo));
+    if (memo == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    memo->buckets  = NULL;
+    memo->capacity = 0;
+    memo->count    = 0;
+    memo->newest   = NULL;
+    memo->oldest   = NULL;
+    memo->size     = 0;
+    memo->max_size = max_size == 0 ? JSONLOGIC_MEMO_DEFAULT_MAX_SIZE : max_size;
+    memo->hits     = 0;
+    memo->misses   = 0;
+
+    return memo;
+}
+
+static void jsonlogic_memo_entry_free(JsonLogic_MemoEntry *entry) {
+    for (size_t index = 0; index < entry->argc; ++ index) {
+        jsonlogic_decref(entry->args[index]);
+    }
+    jsonlogic_decref(entry->result);
+    free(entry);
+}
+
+void jsonlogic_memo_clear(JsonLogic_Memo *memo) {
+    if (memo == NULL) {
+        return;
+    }
+
+    JsonLogic_MemoEntry *entry = memo->newest;
+    while (entry != NULL) {
+        JsonLogic_MemoEntry *older = entry->older;
+        jsonlogic_memo_entry_free(entry);
+        entry = older;
+    }
+
+    if (memo->capacity > 0) {
+        memset(memo->buckets, 0, sizeof(JsonLogic_MemoEntry*) * memo->capacity);
+    }
+    memo->count  = 0;
+    memo->newest = NULL;
+    memo->oldest = NULL;
+    memo->size   = 0;
+}
+
+void jsonlogic_memo_free(JsonLogic_Memo *memo) {
+    if (memo == NULL) {
+        return;
+    }
+
+    jsonlogic_memo_clear(memo);
+    free(memo->buckets);
+    free(memo);
+}
+
+size_t jsonlogic_memo_get_hits(const JsonLogic_Memo *memo) {
+    return memo->hits;
+}
+
+size_t jsonlogic_memo_get_misses(const JsonLogic_Memo *memo) {
+    return memo->misses;
+}
+
+size_t jsonlogic_memo_get_size(const JsonLogic_Memo *memo) {
+    return memo->size;
+}
+
+size_t jsonlogic_memo_get_max_size(const JsonLogic_Memo *memo) {
+    return memo->max_size;
+}
+
+// Estimate of the memory a value keeps alive. Shared values are counted every
+// time they are referenced.
+static size_t jsonlogic_memo_value_size(JsonLogic_Handle handle) {
+    if (JSONLOGIC_IS_NUMBER(handle)) {
+        return 0;
+    }
+
+    switch (handle & JsonLogic_TypeMask) {
+        case JsonLogic_Type_String:
+        {
+            const JsonLogic_String *string = JSONLOGIC_CAST_STRING(handle);
+            return sizeof(JsonLogic_String) + sizeof(char16_t) * string->size;
+        }
+        case JsonLogic_Type_Array:
+        {
+            const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(handle);
+            size_t size = sizeof(JsonLogic_Array) + sizeof(JsonLogic_Handle) * array->size;
+            for (size_t index = 0; index < array->size; ++ index) {
+                size += jsonlogic_memo_value_size(array->items[index]);
+            }
+            return size;
+        }
+        case JsonLogic_Type_Object:
+        {
+            const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(handle);
+            size_t size = sizeof(JsonLogic_Object) + sizeof(JsonLogic_Object_Entry) * object->size;
+            for (size_t index = object->first_index; index < object->size; ++ index) {
+                const JsonLogic_Object_Entry *entry = &object->entries[index];
+                if (!JSONLOGIC_IS_NULL(entry->key)) {
+                    size += jsonlogic_memo_value_size(entry->key);
+                    size += jsonlogic_memo_value_size(entry->value);
+                }
+            }
+            return size;
+        }
+        default:
+            return 0;
+    }
+}
+
+static void jsonlogic_memo_unlink(JsonLogic_Memo *memo, JsonLogic_MemoEntry *entry) {
+    if (entry->newer == NULL) {
+        memo->newest = entry->older;
+    } else {
+        entry->newer->older = entry->older;
+    }
+
+    if (entry->older == NULL) {
+        memo->oldest = entry->newer;
+    } else {
+        entry->older->newer = entry->newer;
+    }
+}
+
+static void jsonlogic_memo_link(JsonLogic_Memo *memo, JsonLogic_MemoEntry *entry) {
+    entry->newer = NULL;
+    entry->older = memo->newest;
+    if (memo->newest == NULL) {
+        memo->oldest = entry;
+    } else {
+        memo->newest->newer = entry;
+    }
+    memo->newest = entry;
+}
+
+static void jsonlogic_memo_evict(JsonLogic_Memo *memo) {
+    JsonLogic_MemoEntry *entry = memo->oldest;
+    assert(entry != NULL);
+
+    JsonLogic_MemoEntry **ptr = &memo->buckets[entry->hash & (memo->capacity - 1)];
+    while (*ptr != entry) {
+        ptr = &(*ptr)->chain;
+    }
+    *ptr = entry->chain;
+
+    jsonlogic_memo_unlink(memo, entry);
+    memo->size -= entry->size;
+    -- memo->count;
+    jsonlogic_memo_entry_free(entry);
+}
+
+static bool jsonlogic_memo_grow(JsonLogic_Memo *memo) {
+    size_t new_capacity = memo->capacity == 0 ? JSONLOGIC_MEMO_MIN_CAPACITY : memo->capacity * 2;
+    JsonLogic_MemoEntry **new_buckets = calloc(new_capacity, sizeof(JsonLogic_MemoEntry*));
+    if (new_buckets == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return false;
+    }
+
+    for (JsonLogic_MemoEntry *entry = memo->oldest; entry != NULL; entry = entry->newer) {
+        JsonLogic_MemoEntry **bucket = &new_buckets[entry->hash & (new_capacity - 1)];
+        entry->chain = *bucket;
+        *bucket = entry;
+    }
+
+    free(memo->buckets);
+    memo->buckets  = new_buckets;
+    memo->capacity = new_capacity;
+
+    return true;
+}
+
+static JsonLogic_MemoEntry *jsonlogic_memo_find(const JsonLogic_Memo *memo, uint64_t hash, const JsonLogic_Operation *operation, const JsonLogic_Handle args[], size_t argc) {
+    if (memo->capacity == 0) {
+        return NULL;
+    }
+
+    for (JsonLogic_MemoEntry *entry = memo->buckets[hash & (memo->capacity - 1)]; entry != NULL; entry = entry->chain) {
+        if (entry->hash == hash && entry->funct == operation->funct &&
+            entry->context == operation->context && entry->argc == argc) {
+            size_t index = 0;
+            while (index < argc && jsonlogic_logic_equals(entry->args[index], args[index])) {
+                ++ index;
+            }
+            if (index == argc) {
+                return entry;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+JsonLogic_Handle jsonlogic_memo_call(JsonLogic_Memo *memo, const JsonLogic_Operation *operation, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc) {
+    uint64_t hash = (uint64_t)(uintptr_t)operation->context ^ argc;
+    for (size_t index = 0; index < argc; ++ index) {
+        hash = (hash ^ jsonlogic_logic_hash(args[index])) * UINT64_C(0x100000001b3);
+    }
+
+    JsonLogic_MemoEntry *entry = jsonlogic_memo_find(memo, hash, operation, args, argc);
+    if (entry != NULL) {
+        ++ memo->hits;
+        jsonlogic_memo_unlink(memo, entry);
+        jsonlogic_memo_link(memo, entry);
+        return jsonlogic_incref(entry->result);
+    }
+
+    ++ memo->misses;
+    JsonLogic_Handle result = operation->funct(operation->context, data, args, argc);
+
+    // errors aren't kept, they might be caused by running out of memory
+    if (JSONLOGIC_IS_ERROR(result)) {
+        return result;
+    }
+
+    size_t size = offsetof(JsonLogic_MemoEntry, args) + sizeof(JsonLogic_Handle) * argc + jsonlogic_memo_value_size(result);
+    for (size_t index = 0; index < argc && size <= memo->max_size; ++ index) {
+        size += jsonlogic_memo_value_size(args[index]);
+    }
+
+    if (size > memo->max_size) {
+        return result;
+    }
+
+    if (memo->count >= memo->capacity && !jsonlogic_memo_grow(memo)) {
+        return result;
+    }
+
+    // argc is bound by the size check above
+    entry = malloc(offsetof(JsonLogic_MemoEntry, args) + sizeof(JsonLogic_Handle) * (argc == 0 ? 1 : argc));
+    if (entry == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return result;
+    }
+
+    while (memo->size + size > memo->max_size) {
+        jsonlogic_memo_evict(memo);
+    }
+
+    entry->hash    = hash;
+    entry->funct   = operation->funct;
+    entry->context = operation->context;
+    entry->result  = jsonlogic_incref(result);
+    entry->size    = size;
+    entry->argc    = argc;
+    for (size_t index = 0; index < argc; ++ index) {
+        entry->args[index] = jsonlogic_incref(args[index]);
+    }
+
+    JsonLogic_MemoEntry **bucket = &memo->buckets[hash & (memo->capacity - 1)];
+    entry->chain = *bucket;
+    *bucket = entry;
+    jsonlogic_memo_link(memo, entry);
+    memo->size += size;
+    ++ memo->count;
+
+    return result;
+}
+
+JsonLogic_Handle jsonlogic_apply_memo(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_Memo *memo) {
+    return jsonlogic_apply_custom_memo(logic, input, &JsonLogic_Builtins, memo);
+}
+
+JsonLogic_Handle certlogic_apply_memo(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_Memo *memo) {
+    return certlogic_apply_custom_memo(logic, input, &CertLogic_Builtins, memo);
+}
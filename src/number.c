@@ -81,9 +81,7 @@ JsonLogic_Handle jsonlogic_to_number(JsonLogic_Handle handle) {
                 if (jsonlogic_utf16_equals(str, size, JSONLOGIC_NEG_INFINITY_STRING, JSONLOGIC_NEG_INFINITY_STRING_SIZE)) {
                     return JSONLOGIC_NUM_TO_HNDL(-INFINITY);
                 }
-                if (JsonLogic_C_Locale == NULL) {
-                    JsonLogic_C_Locale = JSONLOGIC_CREATE_C_LOCALE();
-                }
+                jsonlogic_init_c_locale();
 
                 char *endptr = NULL;
                 char buf[128];
@@ -12,7 +12,7 @@ JsonLogic_Handle jsonlogic_object_into_handle(JsonLogic_Object *object);
 #ifndef NDEBUG
 void jsonlogic_object_debug(const JsonLogic_Object *object) {
     fprintf(stderr, "object: refcount=%" PRIuPTR " used=%" PRIuPTR " capacity=%" PRIuPTR "\n",
-        object->refcount, object->used, object->size);
+        JSONLOGIC_GET_REFCOUNT(object->refcount), object->used, object->size);
     for (size_t index = 0; index < object->size; ++ index) {
         const JsonLogic_Object_Entry *entry = &object->entries[index];
         if (!JSONLOGIC_IS_NULL(entry->key)) {
@@ -25,19 +25,16 @@ void jsonlogic_object_debug(const JsonLogic_Object *object) {
 }
 #endif
 
-JsonLogic_Handle jsonlogic_empty_object(void) {
-    JsonLogic_Object *object = JSONLOGIC_MALLOC_EMPTY_OBJECT();
-    if (object == NULL) {
-        JSONLOGIC_ERROR_MEMORY();
-        return JsonLogic_Error_OutOfMemory;
-    }
-
-    object->refcount    = 1;
-    object->used        = 0;
-    object->size        = 0;
-    object->first_index = 0;
+static JsonLogic_Object JsonLogic_EmptyObject = {
+    .refcount    = JSONLOGIC_REFCOUNT_IMMORTAL,
+    .size        = 0,
+    .used        = 0,
+    .first_index = 0,
+    .entries     = { { JsonLogic_Type_Null, JsonLogic_Type_Null } },
+};
 
-    return jsonlogic_object_into_handle(object);
+JsonLogic_Handle jsonlogic_empty_object(void) {
+    return jsonlogic_object_into_handle(&JsonLogic_EmptyObject);
 }
 
 void jsonlogic_object_free(JsonLogic_Object *object) {
@@ -47,7 +44,7 @@ void jsonlogic_object_free(JsonLogic_Object *object) {
             jsonlogic_decref(entry->key);
             jsonlogic_decref(entry->value);
         }
-        free(object);
+        jsonlogic_free(object);
     }
 }
 
@@ -158,7 +155,7 @@ JsonLogic_Handle jsonlogic_get_utf16_sized(JsonLogic_Handle handle, const char16
         case JsonLogic_Type_Array:
         {
             if (jsonlogic_utf16_equals(key, size, JSONLOGIC_LENGTH, JSONLOGIC_LENGTH_SIZE)) {
-                return jsonlogic_number_from((double) JSONLOGIC_CAST_STRING(handle)->size);
+                return jsonlogic_number_from((double) JSONLOGIC_CAST_ARRAY(handle)->size);
             }
             size_t index = jsonlogic_utf16_to_index(key, size);
             const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(handle);
@@ -370,7 +367,7 @@ JsonLogic_Error jsonlogic_objbuf_set(JsonLogic_ObjBuf *buf, JsonLogic_Handle key
             JSONLOGIC_ERROR_MEMORY();
             return JSONLOGIC_ERROR_OUT_OF_MEMORY;
         }
-        new_object->refcount = 1;
+        JSONLOGIC_SET_REFCOUNT(new_object->refcount, 1);
         new_object->used     = 1;
         new_object->size     = new_size;
 
@@ -437,7 +434,7 @@ JsonLogic_Error jsonlogic_objbuf_set(JsonLogic_ObjBuf *buf, JsonLogic_Handle key
             JSONLOGIC_ERROR_MEMORY();
             return JSONLOGIC_ERROR_OUT_OF_MEMORY;
         }
-        new_object->refcount    = 1;
+        JSONLOGIC_SET_REFCOUNT(new_object->refcount, 1);
         new_object->used        = object->used;
         new_object->size        = new_size;
         new_object->first_index = new_size;
@@ -507,7 +504,7 @@ JsonLogic_Error jsonlogic_objbuf_set(JsonLogic_ObjBuf *buf, JsonLogic_Handle key
             new_object->first_index = index;
         }
 
-        free(object);
+        jsonlogic_free(object);
         buf->object = new_object;
         ++ new_object->used;
     }
@@ -518,15 +515,7 @@ JsonLogic_Error jsonlogic_objbuf_set(JsonLogic_ObjBuf *buf, JsonLogic_Handle key
 JsonLogic_Object *jsonlogic_objbuf_take(JsonLogic_ObjBuf *buf) {
     JsonLogic_Object *object = buf->object;
     if (object == NULL) {
-        object = JSONLOGIC_MALLOC_EMPTY_OBJECT();
-        if (object == NULL) {
-            JSONLOGIC_ERROR_MEMORY();
-        } else {
-            object->refcount    = 1;
-            object->used        = 0;
-            object->size        = 0;
-            object->first_index = 0;
-        }
+        object = &JsonLogic_EmptyObject;
     }
     buf->object = NULL;
     return object;
@@ -0,0 +1,200 @@
+#ifndef JSONLOGIC_OPERATION_NAMES_H
+#define JSONLOGIC_OPERATION_NAMES_H
+#pragma once
+
+// Names of the builtin operations and the C functions implementing them.
+// Shared by the build time tools compile_operations and compile_logic.
+
+#include <uchar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Op {
+    const char16_t *name;
+    const char *ident;
+} Op;
+
+static const Op bultin_names[] = {
+    { u"!",            "jsonlogic_op_NOT"          },
+    { u"!!",           "jsonlogic_op_TO_BOOL"      },
+    { u"!=",           "jsonlogic_op_NE"           },
+    { u"!==",          "jsonlogic_op_STRICT_NE"    },
+    { u"%",            "jsonlogic_op_MOD"          },
+    { u"*",            "jsonlogic_op_MUL"          },
+    { u"+",            "jsonlogic_op_ADD"          },
+    { u"-",            "jsonlogic_op_SUB"          },
+    { u"/",            "jsonlogic_op_DIV"          },
+    { u"<",            "jsonlogic_op_LT"           },
+    { u"<=",           "jsonlogic_op_LE"           },
+    { u"==",           "jsonlogic_op_EQ"           },
+    { u"===",          "jsonlogic_op_STRICT_EQ"    },
+    { u">",            "jsonlogic_op_GT"           },
+    { u">=",           "jsonlogic_op_GE"           },
+    { u"cat",          "jsonlogic_op_CAT"          },
+    { u"in",           "jsonlogic_op_IN"           },
+    { u"log",          "jsonlogic_op_LOG"          },
+    { u"max",          "jsonlogic_op_MAX"          },
+    { u"merge",        "jsonlogic_op_MERGE"        },
+    { u"min",          "jsonlogic_op_MIN"          },
+    { u"missing",      "jsonlogic_op_MISSING"      },
+    { u"missing_some", "jsonlogic_op_MISSING_SOME" },
+    { u"substr",       "jsonlogic_op_SUBSTR"       },
+    { u"var",          "jsonlogic_op_VAR"          },
+    { NULL,            NULL                        },
+};
+
+static const Op extra_names[] = {
+    { u"add-years",       "jsonlogic_extra_ADD_YEARS"         },
+    { u"after",           "jsonlogic_extra_AFTER"             },
+    { u"before",          "jsonlogic_extra_BEFORE"            },
+    { u"combinations",    "jsonlogic_extra_COMBINATIONS"      },
+    { u"days",            "jsonlogic_extra_DAYS"              },
+    { u"extractFromUVCI", "jsonlogic_extra_EXTRACT_FROM_UVCI" },
+    { u"format-time",     "jsonlogic_extra_FORMAT_TIME"       },
+    { u"hours",           "jsonlogic_extra_HOURS"             },
+    { u"not-after",       "jsonlogic_extra_NOT_AFTER"         },
+    { u"not-before",      "jsonlogic_extra_NOT_BEFORE"        },
+    { u"now",             "jsonlogic_extra_NOW"               },
+    { u"timestamp",       "jsonlogic_extra_PARSE_TIME"        },
+    { u"plusTime",        "jsonlogic_extra_PLUS_TIME"         },
+    { u"time-since",      "jsonlogic_extra_TIME_SINCE"        },
+    { u"to-array",        "jsonlogic_extra_TO_ARRAY"          },
+    { u"zip",             "jsonlogic_extra_ZIP"               },
+    { NULL,               NULL                                },
+};
+
+static const Op certlogic_names[] = {
+    { u"!",               "certlogic_op_NOT"                  },
+    { u"+",               "jsonlogic_op_ADD"                  },
+    { u"<",               "jsonlogic_op_LT"                   },
+    { u">",               "jsonlogic_op_GT"                   },
+    { u"<=",              "jsonlogic_op_LE"                   },
+    { u">=",              "jsonlogic_op_GE"                   },
+    { u"===",             "jsonlogic_op_STRICT_EQ"            },
+    { u"var",             "jsonlogic_op_VAR"                  },
+    { u"in",              "jsonlogic_op_IN"                   },
+    { u"after",           "jsonlogic_extra_AFTER"             },
+    { u"before",          "jsonlogic_extra_BEFORE"            },
+    { u"extractFromUVCI", "jsonlogic_extra_EXTRACT_FROM_UVCI" },
+    { u"not-after",       "jsonlogic_extra_NOT_AFTER"         },
+    { u"not-before",      "jsonlogic_extra_NOT_BEFORE"        },
+    { u"plusTime",        "jsonlogic_extra_PLUS_TIME"         },
+    { NULL,               NULL                                },
+};
+
+static const Op certlogic_extra_names[] = {
+    { u"!",               "certlogic_op_NOT"                  },
+    { u"!!",              "certlogic_op_TO_BOOL"              },
+    { u"!=",              "jsonlogic_op_NE"                   },
+    { u"!==",             "jsonlogic_op_STRICT_NE"            },
+    { u"%",               "jsonlogic_op_MOD"                  },
+    { u"*",               "jsonlogic_op_MUL"                  },
+    { u"+",               "jsonlogic_op_ADD"                  },
+    { u"-",               "jsonlogic_op_SUB"                  },
+    { u"/",               "jsonlogic_op_DIV"                  },
+    { u"<",               "jsonlogic_op_LT"                   },
+    { u"<=",              "jsonlogic_op_LE"                   },
+    { u"==",              "jsonlogic_op_EQ"                   },
+    { u"===",             "jsonlogic_op_STRICT_EQ"            },
+    { u">",               "jsonlogic_op_GT"                   },
+    { u">=",              "jsonlogic_op_GE"                   },
+    { u"cat",             "jsonlogic_op_CAT"                  },
+    { u"in",              "jsonlogic_op_IN"                   },
+    { u"log",             "jsonlogic_op_LOG"                  },
+    { u"max",             "jsonlogic_op_MAX"                  },
+    { u"merge",           "jsonlogic_op_MERGE"                },
+    { u"min",             "jsonlogic_op_MIN"                  },
+    { u"missing",         "jsonlogic_op_MISSING"              },
+    { u"missing_some",    "jsonlogic_op_MISSING_SOME"         },
+    { u"substr",          "jsonlogic_op_SUBSTR"               },
+    { u"var",             "jsonlogic_op_VAR"                  },
+    { u"add-years",       "jsonlogic_extra_ADD_YEARS"         },
+    { u"after",           "jsonlogic_extra_AFTER"             },
+    { u"before",          "jsonlogic_extra_BEFORE"            },
+    { u"combinations",    "jsonlogic_extra_COMBINATIONS"      },
+    { u"days",            "jsonlogic_extra_DAYS"              },
+    { u"extractFromUVCI", "jsonlogic_extra_EXTRACT_FROM_UVCI" },
+    { u"format-time",     "jsonlogic_extra_FORMAT_TIME"       },
+    { u"hours",           "jsonlogic_extra_HOURS"             },
+    { u"not-after",       "jsonlogic_extra_NOT_AFTER"         },
+    { u"not-before",      "jsonlogic_extra_NOT_BEFORE"        },
+    { u"now",             "jsonlogic_extra_NOW"               },
+    { u"timestamp",       "jsonlogic_extra_PARSE_TIME"        },
+    { u"plusTime",        "jsonlogic_extra_PLUS_TIME"         },
+    { u"time-since",      "jsonlogic_extra_TIME_SINCE"        },
+    { u"to-array",        "jsonlogic_extra_TO_ARRAY"          },
+    { u"zip",             "jsonlogic_extra_ZIP"               },
+    { NULL,               NULL                                },
+};
+
+// JSONLOGIC_OPERATION_* flags of the C functions above, see jsonlogic.h.
+typedef struct OpFlags {
+    const char *ident;
+    const char *flags;
+} OpFlags;
+
+#define PURE            "JSONLOGIC_OPERATION_PURE"
+#define PURE_EXPENSIVE  "JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE"
+#define READS_DATA      "JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC"
+#define READS_CLOCK     "JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_IGNORES_DATA"
+
+static const OpFlags operation_flags[] = {
+    { "jsonlogic_op_NOT",                  PURE           },
+    { "jsonlogic_op_TO_BOOL",              PURE           },
+    { "jsonlogic_op_NE",                   PURE           },
+    { "jsonlogic_op_STRICT_NE",            PURE           },
+    { "jsonlogic_op_MOD",                  PURE           },
+    { "jsonlogic_op_MUL",                  PURE           },
+    { "jsonlogic_op_ADD",                  PURE           },
+    { "jsonlogic_op_SUB",                  PURE           },
+    { "jsonlogic_op_DIV",                  PURE           },
+    { "jsonlogic_op_LT",                   PURE           },
+    { "jsonlogic_op_LE",                   PURE           },
+    { "jsonlogic_op_EQ",                   PURE           },
+    { "jsonlogic_op_STRICT_EQ",            PURE           },
+    { "jsonlogic_op_GT",                   PURE           },
+    { "jsonlogic_op_GE",                   PURE           },
+    { "jsonlogic_op_CAT",                  PURE           },
+    { "jsonlogic_op_IN",                   PURE           },
+    // writes to stdout
+    { "jsonlogic_op_LOG",                  "JSONLOGIC_OPERATION_DETERMINISTIC | JSONLOGIC_OPERATION_IGNORES_DATA" },
+    { "jsonlogic_op_MAX",                  PURE           },
+    { "jsonlogic_op_MERGE",                PURE           },
+    { "jsonlogic_op_MIN",                  PURE           },
+    { "jsonlogic_op_MISSING",              READS_DATA     },
+    { "jsonlogic_op_MISSING_SOME",         READS_DATA     },
+    { "jsonlogic_op_SUBSTR",               PURE           },
+    { "jsonlogic_op_VAR",                  READS_DATA     },
+    { "jsonlogic_extra_ADD_YEARS",         PURE_EXPENSIVE },
+    { "jsonlogic_extra_AFTER",             PURE_EXPENSIVE },
+    { "jsonlogic_extra_BEFORE",            PURE_EXPENSIVE },
+    { "jsonlogic_extra_COMBINATIONS",      PURE_EXPENSIVE },
+    { "jsonlogic_extra_DAYS",              PURE           },
+    { "jsonlogic_extra_EXTRACT_FROM_UVCI", PURE_EXPENSIVE },
+    { "jsonlogic_extra_FORMAT_TIME",       PURE_EXPENSIVE },
+    { "jsonlogic_extra_HOURS",             PURE           },
+    { "jsonlogic_extra_NOT_AFTER",         PURE_EXPENSIVE },
+    { "jsonlogic_extra_NOT_BEFORE",        PURE_EXPENSIVE },
+    { "jsonlogic_extra_NOW",               READS_CLOCK    },
+    { "jsonlogic_extra_PARSE_TIME",        PURE_EXPENSIVE },
+    { "jsonlogic_extra_PLUS_TIME",         PURE_EXPENSIVE },
+    { "jsonlogic_extra_TIME_SINCE",        READS_CLOCK " | JSONLOGIC_OPERATION_EXPENSIVE" },
+    { "jsonlogic_extra_TO_ARRAY",          PURE           },
+    { "jsonlogic_extra_ZIP",               PURE_EXPENSIVE },
+    { "certlogic_op_NOT",                  PURE           },
+    { "certlogic_op_TO_BOOL",              PURE           },
+    { NULL,                                NULL           },
+};
+
+#undef PURE
+#undef PURE_EXPENSIVE
+#undef READS_DATA
+#undef READS_CLOCK
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
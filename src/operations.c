@@ -47,7 +47,7 @@ const JsonLogic_Operation *jsonlogic_operations_get_with_hash(const JsonLogic_Op
     return NULL;
 }
 
-JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operations, uint64_t hash, const char16_t *key, size_t key_size, void *context, JsonLogic_Operation_Funct funct) {
+JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operations, uint64_t hash, const char16_t *key, size_t key_size, JsonLogic_Operation operation) {
     assert(operations != NULL);
     JsonLogic_Operation_Entry *entries = operations->entries;
     if (entries == NULL) {
@@ -64,10 +64,7 @@ JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operati
             .hash      = hash,
             .key       = key,
             .key_size  = key_size,
-            .operation = {
-                .context = context,
-                .funct   = funct,
-            }
+            .operation = operation,
         };
 
         operations->entries  = new_entries;
@@ -91,10 +88,7 @@ JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operati
                     .hash      = hash,
                     .key       = key,
                     .key_size  = key_size,
-                    .operation = {
-                        .context = context,
-                        .funct   = funct,
-                    }
+                    .operation = operation,
                 };
 
                 ++ operations->used;
@@ -106,10 +100,7 @@ JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operati
                     .hash      = hash,
                     .key       = key,
                     .key_size  = key_size,
-                    .operation = {
-                        .context = context,
-                        .funct   = funct,
-                    }
+                    .operation = operation,
                 };
                 return JSONLOGIC_ERROR_SUCCESS;
             }
@@ -153,10 +144,7 @@ JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operati
                     .hash      = hash,
                     .key       = key,
                     .key_size  = key_size,
-                    .operation = {
-                        .context = context,
-                        .funct   = funct,
-                    }
+                    .operation = operation,
                 };
                 break;
             }
@@ -166,10 +154,7 @@ JsonLogic_Error jsonlogic_operations_set_with_hash(JsonLogic_Operations *operati
                     .hash      = hash,
                     .key       = key,
                     .key_size  = key_size,
-                    .operation = {
-                        .context = context,
-                        .funct   = funct,
-                    }
+                    .operation = operation,
                 };
                 break;
             }
@@ -191,7 +176,25 @@ const JsonLogic_Operation *jsonlogic_operations_get_sized(const JsonLogic_Operat
 }
 
 JsonLogic_Error jsonlogic_operations_set_sized(JsonLogic_Operations *operations, const char16_t *key, size_t key_size, void *context, JsonLogic_Operation_Funct funct) {
-    return jsonlogic_operations_set_with_hash(operations, jsonlogic_hash_fnv1a_utf16(key, key_size), key, key_size, context, funct);
+    return jsonlogic_operations_set_with_hash(operations, jsonlogic_hash_fnv1a_utf16(key, key_size), key, key_size, (JsonLogic_Operation){
+        .context    = context,
+        .funct      = funct,
+        .lazy_funct = NULL,
+        .flags      = 0,
+    });
+}
+
+JsonLogic_Error jsonlogic_operations_set_lazy_sized(JsonLogic_Operations *operations, const char16_t *key, size_t key_size, void *context, JsonLogic_LazyOperation_Funct lazy_funct) {
+    return jsonlogic_operations_set_with_hash(operations, jsonlogic_hash_fnv1a_utf16(key, key_size), key, key_size, (JsonLogic_Operation){
+        .context    = context,
+        .funct      = NULL,
+        .lazy_funct = lazy_funct,
+        .flags      = 0,
+    });
+}
+
+JsonLogic_Handle jsonlogic_evaluate(JsonLogic_Evaluator *evaluator, JsonLogic_Handle logic, JsonLogic_Handle data) {
+    return evaluator->evaluate(evaluator, logic, data);
 }
 
 JsonLogic_Error jsonlogic_operations_extend(JsonLogic_Operations *operations, const JsonLogic_Operations *more_operations) {
@@ -219,7 +222,7 @@ JsonLogic_Error jsonlogic_operations_extend(JsonLogic_Operations *operations, co
     for (size_t index = 0; index < more_operations->capacity; ++ index) {
         const JsonLogic_Operation_Entry *entry = &more_operations->entries[index];
         if (entry->key != NULL) {
-            JsonLogic_Error error = jsonlogic_operations_set_with_hash(operations, entry->hash, entry->key, entry->key_size, entry->operation.context, entry->operation.funct);
+            JsonLogic_Error error = jsonlogic_operations_set_with_hash(operations, entry->hash, entry->key, entry->key_size, entry->operation);
             if (error != JSONLOGIC_ERROR_SUCCESS) {
                 return error;
             }
@@ -234,7 +237,7 @@ JsonLogic_Error jsonlogic_operations_build(JsonLogic_Operations *operations, con
     while (entry->key != NULL) {
         size_t key_size = jsonlogic_utf16_len(entry->key);
         uint64_t hash = jsonlogic_hash_fnv1a_utf16(entry->key, key_size);
-        JsonLogic_Error error = jsonlogic_operations_set_with_hash(operations, hash, entry->key, key_size, entry->operation.context, entry->operation.funct);
+        JsonLogic_Error error = jsonlogic_operations_set_with_hash(operations, hash, entry->key, key_size, entry->operation);
         if (error != JSONLOGIC_ERROR_SUCCESS) {
             return error;
         }
@@ -0,0 +1,356 @@
+#include "jsonlogic_intern.h"
+
+#include <stdlib.h>
+#include <assert.h>
+
+typedef struct JsonLogic_Optimizer {
+    const JsonLogic_Operations *operations;
+    bool certlogic;
+} JsonLogic_Optimizer;
+
+static JsonLogic_Handle jsonlogic_optimize_node(const JsonLogic_Optimizer *optimizer, JsonLogic_Handle logic);
+
+static inline bool jsonlogic_optimizer_to_bool(const JsonLogic_Optimizer *optimizer, JsonLogic_Handle value) {
+    return optimizer->certlogic ? certlogic_to_bool(value) : jsonlogic_to_bool(value);
+}
+
+// Gets the operation key and arguments if logic is an operation.
+static bool jsonlogic_get_operation(JsonLogic_Handle logic, JsonLogic_String **opstrptr, const JsonLogic_Handle **valuesptr, size_t *countptr) {
+    if (jsonlogic_is_literal(logic) || !JSONLOGIC_IS_OBJECT(logic)) {
+        return false;
+    }
+
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+    const JsonLogic_Object_Entry *entry = NULL;
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+            entry = &object->entries[index];
+            break;
+        }
+    }
+    assert(entry != NULL);
+
+    *opstrptr = JSONLOGIC_CAST_STRING(entry->key);
+
+    if (JSONLOGIC_IS_ARRAY(entry->value)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(entry->value);
+        *countptr  = array->size;
+        *valuesptr = array->items;
+    } else {
+        *countptr  = 1;
+        *valuesptr = &entry->value;
+    }
+
+    return true;
+}
+
+// Builds { op: [args...] }, consumes args.
+static JsonLogic_Handle jsonlogic_make_operation(JsonLogic_Handle logic, JsonLogic_Array *args) {
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+    JsonLogic_Handle key = JsonLogic_Null;
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+            key = object->entries[index].key;
+            break;
+        }
+    }
+
+    JsonLogic_Handle value = jsonlogic_array_into_handle(args);
+    if (JSONLOGIC_IS_ERROR(value)) {
+        return value;
+    }
+
+    return jsonlogic_object_from_and_decref((JsonLogic_Object_Entry[]){
+        { .key = jsonlogic_incref(key), .value = value },
+    }, 1);
+}
+
+// Returns logic itself if none of the arguments changed, consumes args.
+static JsonLogic_Handle jsonlogic_rebuild_operation(JsonLogic_Handle logic, const JsonLogic_Handle values[], size_t value_count, JsonLogic_Array *args) {
+    if (args->size == value_count) {
+        bool same = true;
+        for (size_t index = 0; index < value_count; ++ index) {
+            if (args->items[index] != values[index]) {
+                same = false;
+                break;
+            }
+        }
+
+        if (same) {
+            jsonlogic_array_free(args);
+            return jsonlogic_incref(logic);
+        }
+    }
+
+    return jsonlogic_make_operation(logic, args);
+}
+
+static JsonLogic_Handle jsonlogic_optimize_if(const JsonLogic_Optimizer *optimizer, JsonLogic_Handle logic, const JsonLogic_Handle values[], size_t value_count, JsonLogic_Array *args) {
+    if (optimizer->certlogic) {
+        if (!jsonlogic_is_literal(args->items[0])) {
+            return jsonlogic_rebuild_operation(logic, values, value_count, args);
+        }
+        size_t branch = jsonlogic_optimizer_to_bool(optimizer, args->items[0]) ? 1 : 2;
+        JsonLogic_Handle result = branch < args->size ? jsonlogic_incref(args->items[branch]) : JsonLogic_Null;
+        jsonlogic_array_free(args);
+        return result;
+    }
+
+    // Drop conditions that are always false and cut off everything after a
+    // condition that is always true. What is left is written back into args.
+    size_t used  = 0;
+    size_t index = 0;
+    bool has_else = false;
+    while (index < args->size - 1) {
+        JsonLogic_Handle condition = args->items[index];
+        JsonLogic_Handle branch    = args->items[index + 1];
+        if (jsonlogic_is_literal(condition)) {
+            bool always = jsonlogic_optimizer_to_bool(optimizer, condition);
+            jsonlogic_decref(condition);
+            args->items[index] = JsonLogic_Null;
+            if (always) {
+                args->items[used ++] = branch;
+                args->items[index + 1] = JsonLogic_Null;
+                has_else = true;
+                index += 2;
+                break;
+            }
+            jsonlogic_decref(branch);
+            args->items[index + 1] = JsonLogic_Null;
+        } else {
+            args->items[used ++] = condition;
+            args->items[used ++] = branch;
+        }
+        index += 2;
+    }
+
+    if (has_else) {
+        for (; index < args->size; ++ index) {
+            jsonlogic_decref(args->items[index]);
+            args->items[index] = JsonLogic_Null;
+        }
+    } else if (index < args->size) {
+        args->items[used ++] = args->items[index];
+        has_else = true;
+    }
+
+    if (used == 0) {
+        jsonlogic_array_free(args);
+        return JsonLogic_Null;
+    }
+
+    if (used == 1 && has_else) {
+        JsonLogic_Handle result = args->items[0];
+        args->items[0] = JsonLogic_Null;
+        args->size = used;
+        jsonlogic_array_free(args);
+        return result;
+    }
+
+    for (size_t free_index = used; free_index < args->size; ++ free_index) {
+        args->items[free_index] = JsonLogic_Null;
+    }
+    args = jsonlogic_array_truncate(args, used);
+
+    return jsonlogic_rebuild_operation(logic, values, value_count, args);
+}
+
+static JsonLogic_Handle jsonlogic_optimize_and_or(const JsonLogic_Optimizer *optimizer, JsonLogic_Handle logic, const JsonLogic_Handle values[], size_t value_count, JsonLogic_Array *args, bool is_and) {
+    // Nested and/or of the same kind are flattened into this one. Empty ones
+    // evaluate to null and are kept as they are.
+    size_t flat_count = 0;
+    for (size_t index = 0; index < args->size; ++ index) {
+        JsonLogic_String *opstr = NULL;
+        const JsonLogic_Handle *nested_values = NULL;
+        size_t nested_count = 0;
+        if (jsonlogic_get_operation(args->items[index], &opstr, &nested_values, &nested_count) && nested_count > 0 &&
+                (is_and ? JSONLOGIC_IS_OP(opstr, AND) : JSONLOGIC_IS_OP(opstr, OR))) {
+            flat_count += nested_count;
+        } else {
+            flat_count += 1;
+        }
+    }
+
+    JsonLogic_Array *flat = jsonlogic_array_with_capacity(flat_count);
+    if (flat == NULL) {
+        jsonlogic_array_free(args);
+        return JsonLogic_Error_OutOfMemory;
+    }
+
+    // Operands that are constant and don't end the evaluation are dropped.
+    // The first one that does end it becomes the last operand.
+    size_t used = 0;
+    for (size_t index = 0; index < args->size; ++ index) {
+        JsonLogic_Handle item = args->items[index];
+        JsonLogic_String *opstr = NULL;
+        const JsonLogic_Handle *nested_values = &item;
+        size_t nested_count = 1;
+        if (!(jsonlogic_get_operation(item, &opstr, &nested_values, &nested_count) && nested_count > 0 &&
+                (is_and ? JSONLOGIC_IS_OP(opstr, AND) : JSONLOGIC_IS_OP(opstr, OR)))) {
+            nested_values = &item;
+            nested_count  = 1;
+        }
+
+        bool done = false;
+        for (size_t nested_index = 0; nested_index < nested_count; ++ nested_index) {
+            JsonLogic_Handle value = nested_values[nested_index];
+            bool is_last = index + 1 == args->size && nested_index + 1 == nested_count;
+            if (!is_last && jsonlogic_is_literal(value)) {
+                if (jsonlogic_optimizer_to_bool(optimizer, value) == is_and) {
+                    continue;
+                }
+                done = true;
+            }
+            flat->items[used ++] = jsonlogic_incref(value);
+            if (done) {
+                break;
+            }
+        }
+
+        if (done) {
+            break;
+        }
+    }
+
+    jsonlogic_array_free(args);
+
+    if (used == 1) {
+        JsonLogic_Handle result = flat->items[0];
+        flat->items[0] = JsonLogic_Null;
+        jsonlogic_array_free(flat);
+        return result;
+    }
+
+    flat = jsonlogic_array_truncate(flat, used);
+
+    return jsonlogic_rebuild_operation(logic, values, value_count, flat);
+}
+
+static JsonLogic_Handle jsonlogic_optimize_node(const JsonLogic_Optimizer *optimizer, JsonLogic_Handle logic) {
+    if (jsonlogic_is_literal(logic)) {
+        return jsonlogic_incref(logic);
+    }
+
+    if (JSONLOGIC_IS_ARRAY(logic)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+        JsonLogic_Array *new_array = jsonlogic_array_with_capacity(array->size);
+        if (new_array == NULL) {
+            return JsonLogic_Error_OutOfMemory;
+        }
+        bool same = true;
+        for (size_t index = 0; index < array->size; ++ index) {
+            JsonLogic_Handle item = jsonlogic_optimize_node(optimizer, array->items[index]);
+            if (JSONLOGIC_IS_ERROR(item)) {
+                jsonlogic_array_free(new_array);
+                return item;
+            }
+            new_array->items[index] = item;
+            same = same && item == array->items[index];
+        }
+        if (same) {
+            jsonlogic_array_free(new_array);
+            return jsonlogic_incref(logic);
+        }
+        return jsonlogic_array_into_handle(new_array);
+    }
+
+    JsonLogic_String *opstr = NULL;
+    const JsonLogic_Handle *values = NULL;
+    size_t value_count = 0;
+    if (!jsonlogic_get_operation(logic, &opstr, &values, &value_count)) {
+        return jsonlogic_incref(logic);
+    }
+
+    const bool certlogic = optimizer->certlogic;
+    const bool is_if     = JSONLOGIC_IS_OP(opstr, IF) || (!certlogic && JSONLOGIC_IS_OP(opstr, ALT_IF));
+    const bool is_and    = JSONLOGIC_IS_OP(opstr, AND);
+    const bool is_or     = !certlogic && JSONLOGIC_IS_OP(opstr, OR);
+    const bool is_reduce = JSONLOGIC_IS_OP(opstr, REDUCE);
+    const bool is_lambda = !certlogic && (
+        JSONLOGIC_IS_OP(opstr, FILTER) || JSONLOGIC_IS_OP(opstr, MAP) ||
+        JSONLOGIC_IS_OP(opstr, ALL) || JSONLOGIC_IS_OP(opstr, SOME) || JSONLOGIC_IS_OP(opstr, NONE));
+
+    const JsonLogic_Operation *opptr = NULL;
+    if (!is_if && !is_and && !is_or && !is_reduce && !is_lambda) {
+        uint64_t hash = opstr->hash;
+        if (hash == JSONLOGIC_HASH_UNSET) {
+            hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+        }
+
+        opptr = jsonlogic_operations_get_with_hash(
+            optimizer->operations, hash, opstr->str, opstr->size);
+
+        if (opptr == NULL) {
+            // Arguments of unknown operations are never evaluated.
+            return jsonlogic_incref(logic);
+        }
+
+        if (opptr->lazy_funct != NULL) {
+            // Lazy operations get the logic of their arguments as written.
+            return jsonlogic_incref(logic);
+        }
+    }
+
+    if (value_count == 0 && opptr == NULL) {
+        return jsonlogic_incref(logic);
+    }
+
+    JsonLogic_Array *args = jsonlogic_array_with_capacity(value_count);
+    if (args == NULL) {
+        return JsonLogic_Error_OutOfMemory;
+    }
+
+    bool all_literal = true;
+    for (size_t index = 0; index < value_count; ++ index) {
+        JsonLogic_Handle value;
+        if (is_reduce && index >= 2) {
+            // The initial value of reduce is used as is and not evaluated.
+            value = jsonlogic_incref(values[index]);
+        } else {
+            value = jsonlogic_optimize_node(optimizer, values[index]);
+            if (JSONLOGIC_IS_ERROR(value)) {
+                jsonlogic_array_free(args);
+                return value;
+            }
+        }
+        args->items[index] = value;
+        all_literal = all_literal && jsonlogic_is_literal(value);
+    }
+
+    if (is_if) {
+        return jsonlogic_optimize_if(optimizer, logic, values, value_count, args);
+    }
+
+    if (is_and || is_or) {
+        return jsonlogic_optimize_and_or(optimizer, logic, values, value_count, args, is_and);
+    }
+
+    if (opptr != NULL && all_literal && jsonlogic_is_pure_operation(opptr)) {
+        JsonLogic_Handle result = opptr->funct(opptr->context, JsonLogic_Null, args->items, args->size);
+        // Errors are left to be reported when the logic is applied. Results
+        // that would be interpreted as logic can't be inlined.
+        if (!JSONLOGIC_IS_ERROR(result) && jsonlogic_is_literal(result)) {
+            jsonlogic_array_free(args);
+            return result;
+        }
+        jsonlogic_decref(result);
+    }
+
+    return jsonlogic_rebuild_operation(logic, values, value_count, args);
+}
+
+JsonLogic_Handle jsonlogic_optimize(JsonLogic_Handle logic, const JsonLogic_Operations *operations) {
+    const JsonLogic_Optimizer optimizer = {
+        .operations = operations,
+        .certlogic  = false,
+    };
+    return jsonlogic_optimize_node(&optimizer, logic);
+}
+
+JsonLogic_Handle certlogic_optimize(JsonLogic_Handle logic, const JsonLogic_Operations *operations) {
+    const JsonLogic_Optimizer optimizer = {
+        .operations = operations,
+        .certlogic  = true,
+    };
+    return jsonlogic_optimize_node(&optimizer, logic);
+}
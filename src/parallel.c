@@ -0,0 +1,461 @@
+#include "jsonlogic_intern.h"
+
+#include <stdlib.h>
+
+#if defined(JSONLOGIC_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN 1
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+// Thread pool for the lambdas of map, filter, all, some and none. The items
+// are split into chunks and every participant (the worker threads and the
+// calling thread) starts with an even share of the chunks in its own queue.
+// A participant takes chunks from the front of its own queue and once that is
+// empty steals single chunks from the back of the queues of the others. Each
+// queue has its own lock, which is only held for taking a chunk. Results are
+// written to the slot of their item, so the output order is preserved.
+
+// Chunks per participant, so that stealing can even out uneven item costs.
+#define JSONLOGIC_PARALLEL_CHUNKS_PER_THREAD 8
+
+#if defined(JSONLOGIC_WINDOWS)
+    typedef HANDLE             JsonLogic_Thread;
+    typedef CRITICAL_SECTION   JsonLogic_Mutex;
+    typedef CONDITION_VARIABLE JsonLogic_Cond;
+
+    #define JSONLOGIC_MUTEX_INIT(MUTEX)    (InitializeCriticalSection(MUTEX), true)
+    #define JSONLOGIC_MUTEX_DESTROY(MUTEX) DeleteCriticalSection(MUTEX)
+    #define JSONLOGIC_MUTEX_LOCK(MUTEX)    EnterCriticalSection(MUTEX)
+    #define JSONLOGIC_MUTEX_UNLOCK(MUTEX)  LeaveCriticalSection(MUTEX)
+
+    #define JSONLOGIC_COND_INIT(COND)          (InitializeConditionVariable(COND), true)
+    #define JSONLOGIC_COND_DESTROY(COND)       ((void)(COND))
+    #define JSONLOGIC_COND_WAIT(COND, MUTEX)   SleepConditionVariableCS((COND), (MUTEX), INFINITE)
+    #define JSONLOGIC_COND_SIGNAL(COND)        WakeConditionVariable(COND)
+    #define JSONLOGIC_COND_BROADCAST(COND)     WakeAllConditionVariable(COND)
+#else
+    typedef pthread_t       JsonLogic_Thread;
+    typedef pthread_mutex_t JsonLogic_Mutex;
+    typedef pthread_cond_t  JsonLogic_Cond;
+
+    #define JSONLOGIC_MUTEX_INIT(MUTEX)    (pthread_mutex_init((MUTEX), NULL) == 0)
+    #define JSONLOGIC_MUTEX_DESTROY(MUTEX) pthread_mutex_destroy(MUTEX)
+    #define JSONLOGIC_MUTEX_LOCK(MUTEX)    pthread_mutex_lock(MUTEX)
+    #define JSONLOGIC_MUTEX_UNLOCK(MUTEX)  pthread_mutex_unlock(MUTEX)
+
+    #define JSONLOGIC_COND_INIT(COND)          (pthread_cond_init((COND), NULL) == 0)
+    #define JSONLOGIC_COND_DESTROY(COND)       pthread_cond_destroy(COND)
+    #define JSONLOGIC_COND_WAIT(COND, MUTEX)   pthread_cond_wait((COND), (MUTEX))
+    #define JSONLOGIC_COND_SIGNAL(COND)        pthread_cond_signal(COND)
+    #define JSONLOGIC_COND_BROADCAST(COND)     pthread_cond_broadcast(COND)
+#endif
+
+typedef struct JsonLogic_ParallelQueue {
+    JsonLogic_Mutex mutex;
+    // chunks [begin, end) are still to be done
+    size_t begin;
+    size_t end;
+} JsonLogic_ParallelQueue;
+
+typedef struct JsonLogic_ParallelJob {
+    JsonLogic_ParallelKind kind;
+    JsonLogic_Handle lambda;
+    const JsonLogic_Array *items;
+    const JsonLogic_Operations *operations;
+    size_t max_depth;
+    size_t chunk_size;
+    // map: the values of the lambda, filter: JsonLogic_True for kept items
+    JsonLogic_Handle *results;
+    // all, some, none: an item decided the result
+    bool decided;
+    // JsonLogic_Error_RecursionError of any item aborts the job
+    bool failed;
+} JsonLogic_ParallelJob;
+
+typedef struct JsonLogic_ParallelWorker {
+    JsonLogic_ThreadPool *pool;
+    size_t index;
+} JsonLogic_ParallelWorker;
+
+struct JsonLogic_ThreadPool {
+    JsonLogic_Mutex mutex;
+    JsonLogic_Cond start;
+    JsonLogic_Cond done;
+    size_t thread_count;
+    size_t min_items;
+    JsonLogic_Thread *threads;
+    JsonLogic_ParallelWorker *workers;
+    // one per worker thread and the last one for the calling thread
+    JsonLogic_ParallelQueue *queues;
+    JsonLogic_ParallelJob *job;
+    size_t generation;
+    // worker threads that didn't finish the current job yet
+    size_t running;
+    bool busy;
+    bool quit;
+};
+
+static bool jsonlogic_parallel_take(JsonLogic_ParallelQueue *queue, bool front, size_t *chunkptr) {
+    bool found = false;
+    JSONLOGIC_MUTEX_LOCK(&queue->mutex);
+    if (queue->begin < queue->end) {
+        *chunkptr = front ? queue->begin ++ : -- queue->end;
+        found = true;
+    }
+    JSONLOGIC_MUTEX_UNLOCK(&queue->mutex);
+    return found;
+}
+
+// Empties all queues. Participants finish their current chunk and are done.
+static void jsonlogic_parallel_stop(JsonLogic_ThreadPool *pool) {
+    for (size_t index = 0; index <= pool->thread_count; ++ index) {
+        JsonLogic_ParallelQueue *queue = &pool->queues[index];
+        JSONLOGIC_MUTEX_LOCK(&queue->mutex);
+        queue->begin = queue->end;
+        JSONLOGIC_MUTEX_UNLOCK(&queue->mutex);
+    }
+}
+
+static void jsonlogic_parallel_work(JsonLogic_ThreadPool *pool, JsonLogic_ParallelJob *job, size_t self) {
+    const size_t queue_count = pool->thread_count + 1;
+    const size_t size = job->items->size;
+
+    for (;;) {
+        size_t chunk = 0;
+        if (!jsonlogic_parallel_take(&pool->queues[self], true, &chunk)) {
+            bool found = false;
+            for (size_t offset = 1; offset < queue_count && !found; ++ offset) {
+                found = jsonlogic_parallel_take(&pool->queues[(self + offset) % queue_count], false, &chunk);
+            }
+            if (!found) {
+                return;
+            }
+        }
+
+        const size_t begin = chunk * job->chunk_size;
+        const size_t end = begin + job->chunk_size < size ? begin + job->chunk_size : size;
+        for (size_t index = begin; index < end; ++ index) {
+            JsonLogic_Handle value = jsonlogic_apply_custom_max_depth(
+                job->lambda, job->items->items[index], job->operations, job->max_depth);
+
+            if (value == JsonLogic_Error_RecursionError) {
+                JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+                job->failed = true;
+                JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+                jsonlogic_parallel_stop(pool);
+                return;
+            }
+
+            switch (job->kind) {
+                case JsonLogic_Parallel_Map:
+                    job->results[index] = value;
+                    break;
+
+                case JsonLogic_Parallel_Filter:
+                    job->results[index] = jsonlogic_to_bool(value) ? JsonLogic_True : JsonLogic_False;
+                    jsonlogic_decref(value);
+                    break;
+
+                default:
+                {
+                    bool condition = jsonlogic_to_bool(value);
+                    jsonlogic_decref(value);
+                    if (condition != (job->kind == JsonLogic_Parallel_All)) {
+                        JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+                        job->decided = true;
+                        JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+                        jsonlogic_parallel_stop(pool);
+                        return;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void jsonlogic_parallel_worker_main(JsonLogic_ParallelWorker *worker) {
+    JsonLogic_ThreadPool *pool = worker->pool;
+    size_t generation = 0;
+
+    JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+    for (;;) {
+        while (!pool->quit && pool->generation == generation) {
+            JSONLOGIC_COND_WAIT(&pool->start, &pool->mutex);
+        }
+        if (pool->quit) {
+            break;
+        }
+        generation = pool->generation;
+        JsonLogic_ParallelJob *job = pool->job;
+        JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+
+        jsonlogic_parallel_work(pool, job, worker->index);
+
+        JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+        if (-- pool->running == 0) {
+            JSONLOGIC_COND_SIGNAL(&pool->done);
+        }
+    }
+    JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+}
+
+#if defined(JSONLOGIC_WINDOWS)
+static DWORD WINAPI jsonlogic_parallel_thread(LPVOID arg) {
+    jsonlogic_parallel_worker_main(arg);
+    return 0;
+}
+#else
+static void *jsonlogic_parallel_thread(void *arg) {
+    jsonlogic_parallel_worker_main(arg);
+    return NULL;
+}
+#endif
+
+static void jsonlogic_thread_pool_join(JsonLogic_ThreadPool *pool, size_t thread_count) {
+    JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+    pool->quit = true;
+    JSONLOGIC_COND_BROADCAST(&pool->start);
+    JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+
+    for (size_t index = 0; index < thread_count; ++ index) {
+#if defined(JSONLOGIC_WINDOWS)
+        WaitForSingleObject(pool->threads[index], INFINITE);
+        CloseHandle(pool->threads[index]);
+#else
+        pthread_join(pool->threads[index], NULL);
+#endif
+    }
+}
+
+static void jsonlogic_thread_pool_destroy(JsonLogic_ThreadPool *pool, size_t queue_count) {
+    for (size_t index = 0; index < queue_count; ++ index) {
+        JSONLOGIC_MUTEX_DESTROY(&pool->queues[index].mutex);
+    }
+    JSONLOGIC_COND_DESTROY(&pool->done);
+    JSONLOGIC_COND_DESTROY(&pool->start);
+    JSONLOGIC_MUTEX_DESTROY(&pool->mutex);
+    free(pool->queues);
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+}
+
+JsonLogic_ThreadPool *jsonlogic_thread_pool_new(size_t thread_count, size_t min_items) {
+    // the C locale is created lazily, which isn't thread safe
+    jsonlogic_init_c_locale();
+
+    JsonLogic_ThreadPool *pool = calloc(1, sizeof(JsonLogic_ThreadPool));
+    if (pool == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    pool->thread_count = thread_count;
+    pool->min_items    = min_items == 0 ? JSONLOGIC_PARALLEL_MIN_ITEMS : min_items;
+    pool->threads      = malloc(sizeof(JsonLogic_Thread) * (thread_count > 0 ? thread_count : 1));
+    pool->workers      = malloc(sizeof(JsonLogic_ParallelWorker) * (thread_count > 0 ? thread_count : 1));
+    pool->queues       = malloc(sizeof(JsonLogic_ParallelQueue) * (thread_count + 1));
+
+    if (pool->threads == NULL || pool->workers == NULL || pool->queues == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        free(pool->queues);
+        free(pool->workers);
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+
+    size_t queue_count = 0;
+
+    if (!JSONLOGIC_MUTEX_INIT(&pool->mutex)) {
+        goto error_mutex;
+    }
+
+    if (!JSONLOGIC_COND_INIT(&pool->start)) {
+        goto error_start;
+    }
+
+    if (!JSONLOGIC_COND_INIT(&pool->done)) {
+        goto error_done;
+    }
+
+    for (; queue_count < thread_count + 1; ++ queue_count) {
+        JsonLogic_ParallelQueue *queue = &pool->queues[queue_count];
+        queue->begin = queue->end = 0;
+        if (!JSONLOGIC_MUTEX_INIT(&queue->mutex)) {
+            jsonlogic_thread_pool_destroy(pool, queue_count);
+            return NULL;
+        }
+    }
+
+    for (size_t index = 0; index < thread_count; ++ index) {
+        JsonLogic_ParallelWorker *worker = &pool->workers[index];
+        worker->pool  = pool;
+        worker->index = index;
+#if defined(JSONLOGIC_WINDOWS)
+        pool->threads[index] = CreateThread(NULL, 0, jsonlogic_parallel_thread, worker, 0, NULL);
+        bool started = pool->threads[index] != NULL;
+#else
+        bool started = pthread_create(&pool->threads[index], NULL, jsonlogic_parallel_thread, worker) == 0;
+#endif
+        if (!started) {
+            jsonlogic_thread_pool_join(pool, index);
+            jsonlogic_thread_pool_destroy(pool, queue_count);
+            return NULL;
+        }
+    }
+
+    return pool;
+
+error_done:
+    JSONLOGIC_COND_DESTROY(&pool->start);
+
+error_start:
+    JSONLOGIC_MUTEX_DESTROY(&pool->mutex);
+
+error_mutex:
+    free(pool->queues);
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+
+    return NULL;
+}
+
+void jsonlogic_thread_pool_free(JsonLogic_ThreadPool *pool) {
+    if (pool != NULL) {
+        assert(!pool->busy);
+        jsonlogic_thread_pool_join(pool, pool->thread_count);
+        jsonlogic_thread_pool_destroy(pool, pool->thread_count + 1);
+    }
+}
+
+size_t jsonlogic_thread_pool_get_thread_count(const JsonLogic_ThreadPool *pool) {
+    return pool->thread_count;
+}
+
+size_t jsonlogic_thread_pool_get_min_items(const JsonLogic_ThreadPool *pool) {
+    return pool->min_items;
+}
+
+JsonLogic_Handle jsonlogic_thread_pool_apply(
+        JsonLogic_ThreadPool *pool,
+        JsonLogic_ParallelKind kind,
+        JsonLogic_Handle lambda,
+        JsonLogic_Handle items,
+        const JsonLogic_Operations *operations,
+        size_t max_depth) {
+    assert(JSONLOGIC_IS_ARRAY(items));
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    const size_t size = array->size;
+
+    if (pool->thread_count == 0 || size < pool->min_items) {
+        return JSONLOGIC_SLOT_UNSET;
+    }
+
+    JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+    if (pool->busy) {
+        // used by another evaluation at the same time
+        JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+        return JSONLOGIC_SLOT_UNSET;
+    }
+    pool->busy = true;
+    JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+
+    JsonLogic_Array *result = NULL;
+    if (kind == JsonLogic_Parallel_Map || kind == JsonLogic_Parallel_Filter) {
+        result = jsonlogic_array_with_capacity(size);
+        if (result == NULL) {
+            JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+            pool->busy = false;
+            JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+            return JsonLogic_Error_OutOfMemory;
+        }
+        for (size_t index = 0; index < size; ++ index) {
+            result->items[index] = JsonLogic_Null;
+        }
+    }
+
+    const size_t queue_count = pool->thread_count + 1;
+    size_t chunk_count = queue_count * JSONLOGIC_PARALLEL_CHUNKS_PER_THREAD;
+    if (chunk_count > size) {
+        chunk_count = size;
+    }
+    const size_t chunk_size = (size + chunk_count - 1) / chunk_count;
+    chunk_count = (size + chunk_size - 1) / chunk_size;
+
+    JsonLogic_ParallelJob job = {
+        .kind       = kind,
+        .lambda     = lambda,
+        .items      = array,
+        .operations = operations,
+        .max_depth  = max_depth,
+        .chunk_size = chunk_size,
+        .results    = result == NULL ? NULL : result->items,
+        .decided    = false,
+        .failed     = false,
+    };
+
+    // Nobody else touches the queues while the pool isn't running a job.
+    for (size_t index = 0; index < queue_count; ++ index) {
+        pool->queues[index].begin = chunk_count *  index      / queue_count;
+        pool->queues[index].end   = chunk_count * (index + 1) / queue_count;
+    }
+
+    JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+    pool->job     = &job;
+    pool->running = pool->thread_count;
+    ++ pool->generation;
+    JSONLOGIC_COND_BROADCAST(&pool->start);
+    JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+
+    jsonlogic_parallel_work(pool, &job, pool->thread_count);
+
+    JSONLOGIC_MUTEX_LOCK(&pool->mutex);
+    while (pool->running > 0) {
+        JSONLOGIC_COND_WAIT(&pool->done, &pool->mutex);
+    }
+    pool->job  = NULL;
+    pool->busy = false;
+    JSONLOGIC_MUTEX_UNLOCK(&pool->mutex);
+
+    if (job.failed) {
+        if (result != NULL) {
+            jsonlogic_array_free(result);
+        }
+        return JsonLogic_Error_RecursionError;
+    }
+
+    switch (kind) {
+        case JsonLogic_Parallel_Map:
+            return jsonlogic_array_into_handle(result);
+
+        case JsonLogic_Parallel_Filter:
+        {
+            size_t result_size = 0;
+            for (size_t index = 0; index < size; ++ index) {
+                if (result->items[index] == JsonLogic_True) {
+                    result->items[result_size ++] = jsonlogic_incref(array->items[index]);
+                }
+            }
+            return jsonlogic_array_into_handle(jsonlogic_array_truncate(result, result_size));
+        }
+        case JsonLogic_Parallel_All:
+        case JsonLogic_Parallel_None:
+            return job.decided ? JsonLogic_False : JsonLogic_True;
+
+        case JsonLogic_Parallel_Some:
+            return job.decided ? JsonLogic_True : JsonLogic_False;
+
+        default:
+            assert(false);
+            return JsonLogic_Error_InternalError;
+    }
+}
+
+JsonLogic_Handle jsonlogic_apply_parallel(JsonLogic_Handle logic, JsonLogic_Handle input, JsonLogic_ThreadPool *pool) {
+    return jsonlogic_apply_custom_parallel(logic, input, &JsonLogic_Builtins, pool);
+}
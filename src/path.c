@@ -0,0 +1,241 @@
+#include "jsonlogic_intern.h"
+
+#include <stdlib.h>
+#include <assert.h>
+#include <math.h>
+
+// Paths of var and missing operations with literal keys are split once when
+// a program is compiled. Object lookups then use the stored segment hashes and
+// array lookups the pre-parsed indices. The results are the same as the ones
+// of jsonlogic_op_VAR().
+
+JsonLogic_Path *jsonlogic_path_compile(JsonLogic_Handle key) {
+    JsonLogic_Path *path = NULL;
+
+    if (JSONLOGIC_IS_NULL(key)) {
+        path = malloc(sizeof(JsonLogic_Path));
+        if (path == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            return NULL;
+        }
+        path->kind  = JsonLogic_PathKind_Data;
+        path->key   = key;
+        path->str   = JsonLogic_Null;
+        path->index = 0;
+        path->count = 0;
+        return path;
+    }
+
+    if (JSONLOGIC_IS_NUMBER(key)) {
+        double number = JSONLOGIC_HNDL_TO_NUM(key);
+        if (isfinite(number) && (double)(size_t)number == number) {
+            path = malloc(sizeof(JsonLogic_Path));
+            if (path == NULL) {
+                JSONLOGIC_ERROR_MEMORY();
+                return NULL;
+            }
+            path->kind  = JsonLogic_PathKind_Index;
+            path->key   = key;
+            path->str   = JsonLogic_Null;
+            path->index = (size_t)number;
+            path->count = 0;
+            return path;
+        }
+    }
+
+    JsonLogic_Handle strhandle = jsonlogic_to_string(key);
+    if (JSONLOGIC_IS_ERROR(strhandle)) {
+        return NULL;
+    }
+    const JsonLogic_String *strkey = JSONLOGIC_CAST_STRING(strhandle);
+    const char16_t *str = strkey->str;
+    const char16_t *end = str + strkey->size;
+
+    // A trailing dot doesn't add an empty segment, just like in jsonlogic_op_VAR().
+    size_t count = 0;
+    if (strkey->size > 0) {
+        count = 1;
+        for (const char16_t *ptr = str; ptr < end; ++ ptr) {
+            if (*ptr == u'.' && ptr + 1 < end) {
+                ++ count;
+            }
+        }
+    }
+
+    path = malloc(sizeof(JsonLogic_Path) - sizeof(JsonLogic_PathSegment) + sizeof(JsonLogic_PathSegment) * (count > 0 ? count : 1));
+    if (path == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        jsonlogic_decref(strhandle);
+        return NULL;
+    }
+
+    path->kind  = count == 0 ? JsonLogic_PathKind_Data : JsonLogic_PathKind_Segments;
+    path->key   = jsonlogic_incref(key);
+    path->str   = strhandle;
+    path->index = 0;
+    path->count = count;
+
+    const char16_t *pos = str;
+    for (size_t index = 0; index < count; ++ index) {
+        const char16_t *next = jsonlogic_find_char(pos, end - pos, u'.');
+        if (next == NULL) {
+            next = end;
+        }
+        JsonLogic_PathSegment *segment = &path->segments[index];
+        size_t size = next - pos;
+        segment->key   = pos;
+        segment->size  = size;
+        segment->hash  = jsonlogic_hash_fnv1a_utf16(pos, size);
+        segment->index = jsonlogic_utf16_to_index(pos, size);
+        pos = next + 1;
+    }
+
+    if (count == 0) {
+        jsonlogic_decref(strhandle);
+        path->str = JsonLogic_Null;
+    }
+
+    return path;
+}
+
+void jsonlogic_path_free(JsonLogic_Path *path) {
+    if (path != NULL) {
+        jsonlogic_decref(path->str);
+        jsonlogic_decref(path->key);
+        free(path);
+    }
+}
+
+static inline JsonLogic_Handle jsonlogic_path_get_segment(JsonLogic_Handle data, const JsonLogic_PathSegment *segment) {
+    if (JSONLOGIC_IS_OBJECT(data)) {
+        const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(data);
+        size_t index = jsonlogic_object_get_index_utf16_with_hash(object, segment->hash, segment->key, segment->size);
+        if (index >= object->size) {
+            return JsonLogic_Null;
+        }
+        return jsonlogic_incref(object->entries[index].value);
+    }
+
+    if (JSONLOGIC_IS_ARRAY(data) && segment->index != SIZE_MAX) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(data);
+        if (segment->index < array->size) {
+            return jsonlogic_incref(array->items[segment->index]);
+        }
+        return JsonLogic_Null;
+    }
+
+    return jsonlogic_get_utf16_sized(data, segment->key, segment->size);
+}
+
+static JsonLogic_Handle jsonlogic_path_get_segments(const JsonLogic_Path *path, size_t start, JsonLogic_Handle data, JsonLogic_Handle default_value) {
+    jsonlogic_incref(data);
+    for (size_t index = start; index < path->count; ++ index) {
+        JsonLogic_Handle next_data = jsonlogic_path_get_segment(data, &path->segments[index]);
+        jsonlogic_decref(data);
+        if (JSONLOGIC_IS_NULL(next_data)) {
+            return jsonlogic_incref(default_value);
+        }
+        data = next_data;
+    }
+    return data;
+}
+
+JsonLogic_Handle jsonlogic_path_get(const JsonLogic_Path *path, JsonLogic_Handle data, JsonLogic_Handle default_value) {
+    switch (path->kind) {
+        case JsonLogic_PathKind_Data:
+            return jsonlogic_incref(data);
+
+        case JsonLogic_PathKind_Index:
+            return jsonlogic_get_index(data, path->index);
+
+        case JsonLogic_PathKind_Segments:
+            return jsonlogic_path_get_segments(path, 0, data, default_value);
+
+        default:
+            assert(false);
+            return JsonLogic_Error_InternalError;
+    }
+}
+
+// The first segment names a value of the reduce scope instead of a key of the
+// reduce context object. data is JSONLOGIC_SLOT_UNSET for JsonLogic, where the
+// context has no data.
+JsonLogic_Handle jsonlogic_path_get_scoped(const JsonLogic_Path *path, JsonLogic_Handle accumulator, JsonLogic_Handle current, JsonLogic_Handle data, JsonLogic_Handle default_value) {
+    // ensured by jsonlogic_reduce_is_scoped()
+    assert(path->kind == JsonLogic_PathKind_Segments && path->count > 0);
+    const JsonLogic_PathSegment *segment = &path->segments[0];
+
+    JsonLogic_Handle value;
+    if (jsonlogic_utf16_equals(segment->key, segment->size, JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE)) {
+        value = accumulator;
+    } else if (jsonlogic_utf16_equals(segment->key, segment->size, JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE)) {
+        value = current;
+    } else if (data != JSONLOGIC_SLOT_UNSET && jsonlogic_utf16_equals(segment->key, segment->size, JSONLOGIC_DATA, JSONLOGIC_DATA_SIZE)) {
+        value = data;
+    } else {
+        return jsonlogic_incref(default_value);
+    }
+
+    if (JSONLOGIC_IS_NULL(value)) {
+        return jsonlogic_incref(default_value);
+    }
+
+    return jsonlogic_path_get_segments(path, 1, value, default_value);
+}
+
+JsonLogic_Paths *jsonlogic_paths_compile(const JsonLogic_Handle keys[], size_t count) {
+    if (count > (SIZE_MAX - sizeof(JsonLogic_Paths)) / sizeof(JsonLogic_Path*) + 1) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    JsonLogic_Paths *paths = malloc(sizeof(JsonLogic_Paths) - sizeof(JsonLogic_Path*) + sizeof(JsonLogic_Path*) * (count > 0 ? count : 1));
+    if (paths == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return NULL;
+    }
+
+    for (paths->size = 0; paths->size < count; ++ paths->size) {
+        JsonLogic_Path *path = jsonlogic_path_compile(keys[paths->size]);
+        if (path == NULL) {
+            jsonlogic_paths_free(paths);
+            return NULL;
+        }
+        paths->items[paths->size] = path;
+    }
+
+    return paths;
+}
+
+void jsonlogic_paths_free(JsonLogic_Paths *paths) {
+    if (paths != NULL) {
+        for (size_t index = 0; index < paths->size; ++ index) {
+            jsonlogic_path_free(paths->items[index]);
+        }
+        free(paths);
+    }
+}
+
+JsonLogic_Handle jsonlogic_paths_missing(const JsonLogic_Paths *paths, JsonLogic_Handle data) {
+    JsonLogic_Array *missing = jsonlogic_array_with_capacity(paths->size);
+    if (missing == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return JsonLogic_Error_OutOfMemory;
+    }
+
+    size_t missing_index = 0;
+    for (size_t index = 0; index < paths->size; ++ index) {
+        const JsonLogic_Path *path = paths->items[index];
+        JsonLogic_Handle value = jsonlogic_path_get(path, data, JsonLogic_Null);
+
+        if (JSONLOGIC_IS_NULL(value) || (JSONLOGIC_IS_STRING(value) && JSONLOGIC_CAST_STRING(value)->size == 0)) {
+            missing->items[missing_index ++] = jsonlogic_incref(path->key);
+        }
+
+        jsonlogic_decref(value);
+    }
+
+    missing = jsonlogic_array_truncate(missing, missing_index);
+
+    return jsonlogic_array_into_handle(missing);
+}
@@ -0,0 +1,1932 @@
+#include "jsonlogic_intern.h"
+
+#include <stdlib.h>
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+// A subtree of the rules of a rule set. Subtrees that are structurally equal
+// share one entry.
+typedef struct JsonLogic_SharedNode {
+    uint64_t hash;
+    JsonLogic_Handle logic;
+    size_t count;
+    size_t slot;
+    bool pure;
+} JsonLogic_SharedNode;
+
+typedef struct JsonLogic_SharedNodes {
+    size_t size;
+    size_t capacity;
+    JsonLogic_SharedNode *entries;
+} JsonLogic_SharedNodes;
+
+typedef struct JsonLogic_Compiler {
+    const JsonLogic_Operations *operations;
+    bool certlogic;
+    size_t size;
+    size_t capacity;
+    JsonLogic_Instr *code;
+    size_t depth;
+    size_t max_depth;
+    // only used when compiling rule sets
+    JsonLogic_SharedNodes *shared;
+    size_t lambda_depth;
+    size_t slot_count;
+    // compiling the lambda of a reduce that reads its scope, see
+    // JsonLogic_OpCode_ReduceScope
+    bool scope;
+} JsonLogic_Compiler;
+
+// Rules that start with a guard like {"===":[{"var":P},C]} or
+// {"in":[{"var":P},[C1,C2]]} are indexed by (P, C). Only the rules whose
+// guards match the value of P are evaluated, all others are false.
+typedef struct JsonLogic_GuardEntry {
+    uint64_t hash;
+    size_t path;
+    size_t rule;
+    JsonLogic_Handle value;
+} JsonLogic_GuardEntry;
+
+struct JsonLogic_RuleSet {
+    JsonLogic_Program program;
+    size_t slot_count;
+    size_t rule_count;
+    size_t *entries;
+    // per rule the index of the guarded path or SIZE_MAX
+    size_t *guards;
+    size_t path_count;
+    JsonLogic_Path **paths;
+    size_t guard_count;
+    size_t guard_capacity;
+    JsonLogic_GuardEntry *guard_entries;
+    // purely boolean rules, decided without the VM when possible
+    JsonLogic_Diagram *diagram;
+};
+
+static JsonLogic_Error jsonlogic_compile_node(JsonLogic_Compiler *compiler, JsonLogic_Handle logic);
+
+static void jsonlogic_compiler_push(JsonLogic_Compiler *compiler, size_t count) {
+    compiler->depth += count;
+    if (compiler->depth > compiler->max_depth) {
+        compiler->max_depth = compiler->depth;
+    }
+}
+
+static JsonLogic_Error jsonlogic_compiler_emit(JsonLogic_Compiler *compiler, JsonLogic_Instr instr) {
+    if (compiler->size == compiler->capacity) {
+        size_t new_capacity = compiler->capacity == 0 ? 32 : compiler->capacity * 2;
+        if (new_capacity > SIZE_MAX / sizeof(JsonLogic_Instr)) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        JsonLogic_Instr *new_code = realloc(compiler->code, new_capacity * sizeof(JsonLogic_Instr));
+        if (new_code == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        compiler->code     = new_code;
+        compiler->capacity = new_capacity;
+    }
+
+    if (instr.opcode == JsonLogic_OpCode_Push) {
+        jsonlogic_incref(instr.value);
+    }
+
+    compiler->code[compiler->size ++] = instr;
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static JsonLogic_Error jsonlogic_compiler_emit_push(JsonLogic_Compiler *compiler, JsonLogic_Handle value) {
+    TRY(jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+        .opcode = JsonLogic_OpCode_Push,
+        .argc   = 0,
+        .value  = value,
+    }));
+    jsonlogic_compiler_push(compiler, 1);
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static JsonLogic_Error jsonlogic_compiler_emit_jump(JsonLogic_Compiler *compiler, JsonLogic_OpCode opcode, size_t *jumpptr) {
+    *jumpptr = compiler->size;
+    return jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+        .opcode = opcode,
+        .argc   = 0,
+        .target = 0,
+    });
+}
+
+static inline void jsonlogic_compiler_patch(JsonLogic_Compiler *compiler, size_t jump) {
+    compiler->code[jump].target = compiler->size;
+}
+
+// Lambdas are compiled in-line right after the instruction that runs them.
+// The body starts on top of the items array, leaves exactly one value on the
+// stack and ends with a return. The instruction jumps over the body.
+static JsonLogic_Error jsonlogic_compile_lambda(JsonLogic_Compiler *compiler, JsonLogic_OpCode opcode, size_t argc, JsonLogic_Handle lambda) {
+    size_t instr_index = compiler->size;
+    TRY(jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+        .opcode = opcode,
+        .argc   = argc,
+        .target = 0,
+    }));
+
+    if (argc > 0) {
+        size_t depth = compiler->depth;
+        bool scope = compiler->scope;
+        compiler->scope = opcode == JsonLogic_OpCode_ReduceScope;
+        ++ compiler->lambda_depth;
+        TRY(jsonlogic_compile_node(compiler, lambda));
+        -- compiler->lambda_depth;
+        compiler->scope = scope;
+        TRY(jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+            .opcode = JsonLogic_OpCode_Return,
+            .argc   = 0,
+            .target = 0,
+        }));
+        compiler->depth = depth;
+    }
+
+    jsonlogic_compiler_patch(compiler, instr_index);
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static void jsonlogic_lazy_call_free(JsonLogic_LazyCall *lazy) {
+    for (size_t index = 0; index < lazy->argc; ++ index) {
+        jsonlogic_decref(lazy->args[index]);
+    }
+    jsonlogic_operations_free(&lazy->operations);
+    free(lazy);
+}
+
+// The arguments are compiled like lambdas, because the operation may
+// evaluate them with other data than the input.
+static JsonLogic_Error jsonlogic_compile_lazy(JsonLogic_Compiler *compiler, const JsonLogic_Operation *opptr, const JsonLogic_Handle *values, size_t value_count) {
+    size_t size = sizeof(JsonLogic_LazyCall) + (sizeof(JsonLogic_Handle) + sizeof(size_t)) * value_count;
+    JsonLogic_LazyCall *lazy = malloc(size);
+    if (lazy == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    lazy->operation  = *opptr;
+    lazy->operations = (JsonLogic_Operations)JSONLOGIC_OPERATIONS_INIT;
+    lazy->argc       = 0;
+    lazy->next       = 0;
+    lazy->args       = (JsonLogic_Handle*)(lazy + 1);
+    lazy->entries    = (size_t*)(lazy->args + value_count);
+
+    JsonLogic_Error error = jsonlogic_operations_extend(&lazy->operations, compiler->operations);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        jsonlogic_lazy_call_free(lazy);
+        return error;
+    }
+
+    error = jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+        .opcode = JsonLogic_OpCode_Lazy,
+        .argc   = value_count,
+        .lazy   = lazy,
+    });
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        jsonlogic_lazy_call_free(lazy);
+        return error;
+    }
+
+    size_t depth = compiler->depth;
+    ++ compiler->lambda_depth;
+    for (size_t index = 0; index < value_count; ++ index) {
+        lazy->args[index]    = jsonlogic_incref(values[index]);
+        lazy->entries[index] = compiler->size;
+        lazy->argc = index + 1;
+        TRY(jsonlogic_compile_node(compiler, values[index]));
+        TRY(jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+            .opcode = JsonLogic_OpCode_Return,
+            .argc   = 0,
+            .target = 0,
+        }));
+        compiler->depth = depth;
+    }
+    -- compiler->lambda_depth;
+
+    lazy->next = compiler->size;
+    jsonlogic_compiler_push(compiler, 1);
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+bool jsonlogic_is_literal(JsonLogic_Handle logic) {
+    if (JSONLOGIC_IS_ARRAY(logic)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+        for (size_t index = 0; index < array->size; ++ index) {
+            if (!jsonlogic_is_literal(array->items[index])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (!JSONLOGIC_IS_OBJECT(logic)) {
+        return true;
+    }
+
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+    if (object->used != 1) {
+        return true;
+    }
+
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        JsonLogic_Handle key = object->entries[index].key;
+        if (!JSONLOGIC_IS_NULL(key)) {
+            return !JSONLOGIC_IS_STRING(key);
+        }
+    }
+
+    return true;
+}
+
+static bool jsonlogic_all_literal(const JsonLogic_Handle values[], size_t count) {
+    for (size_t index = 0; index < count; ++ index) {
+        if (!jsonlogic_is_literal(values[index])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Upper limit of pending nodes when checking a lambda of reduce. More complex
+// lambdas just get a context object.
+#define JSONLOGIC_REDUCE_SCOPE_CHECK 64
+
+// Checks if the lambda of reduce can read accumulator and current (and
+// CertLogic's data) straight from the reduce instead of a context object.
+// That is the case if the data only reaches var with a constant key and
+// operations flagged to ignore it. Used by the interpreter, compiled programs
+// and compile_logic.
+bool jsonlogic_reduce_is_scoped(JsonLogic_Handle lambda, const JsonLogic_Operations *operations, bool certlogic) {
+    JsonLogic_Handle pending[JSONLOGIC_REDUCE_SCOPE_CHECK];
+    size_t pending_count = 0;
+
+    pending[pending_count ++] = lambda;
+
+    while (pending_count > 0) {
+        JsonLogic_Handle logic = pending[-- pending_count];
+        const JsonLogic_Handle *values;
+        size_t value_count;
+
+        if (JSONLOGIC_IS_ARRAY(logic)) {
+            const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+            values      = array->items;
+            value_count = array->size;
+        } else if (jsonlogic_is_literal(logic) || !JSONLOGIC_IS_OBJECT(logic)) {
+            continue;
+        } else {
+            const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+            const JsonLogic_Object_Entry *entry = NULL;
+            for (size_t index = object->first_index; index < object->size; ++ index) {
+                if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+                    entry = &object->entries[index];
+                    break;
+                }
+            }
+            assert(entry != NULL);
+
+            if (JSONLOGIC_IS_ARRAY(entry->value)) {
+                const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(entry->value);
+                value_count = array->size;
+                values      = array->items;
+            } else {
+                value_count = 1;
+                values      = &entry->value;
+            }
+
+            JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(entry->key);
+
+            if (certlogic && JSONLOGIC_IS_OP(opstr, REDUCE)) {
+                // the context of the inner reduce would contain the data
+                return false;
+            } else if (!certlogic && (
+                       JSONLOGIC_IS_OP(opstr, FILTER) || JSONLOGIC_IS_OP(opstr, MAP) || JSONLOGIC_IS_OP(opstr, REDUCE) ||
+                       JSONLOGIC_IS_OP(opstr, ALL) || JSONLOGIC_IS_OP(opstr, SOME) || JSONLOGIC_IS_OP(opstr, NONE))) {
+                // only the items are evaluated with the same data
+                value_count = value_count > 0 ? 1 : 0;
+            } else if (JSONLOGIC_IS_OP(opstr, IF) || JSONLOGIC_IS_OP(opstr, AND) ||
+                       (!certlogic && (JSONLOGIC_IS_OP(opstr, ALT_IF) || JSONLOGIC_IS_OP(opstr, OR)))) {
+                // all arguments are evaluated with the same data
+            } else {
+                if (opstr->hash == JSONLOGIC_HASH_UNSET) {
+                    opstr->hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+                }
+
+                const JsonLogic_Operation *opptr = jsonlogic_operations_get_with_hash(
+                    operations, opstr->hash, opstr->str, opstr->size);
+
+                if (opptr == NULL) {
+                    continue;
+                }
+
+                if (opptr->funct == jsonlogic_op_VAR) {
+                    if (value_count == 0 || !JSONLOGIC_IS_STRING(values[0]) || JSONLOGIC_CAST_STRING(values[0])->size == 0) {
+                        return false;
+                    }
+                    // the default value
+                    ++ values;
+                    -- value_count;
+                } else if (!jsonlogic_operation_has_flags(opptr, JSONLOGIC_OPERATION_IGNORES_DATA)) {
+                    return false;
+                }
+            }
+        }
+
+        if (value_count > JSONLOGIC_REDUCE_SCOPE_CHECK - pending_count) {
+            return false;
+        }
+
+        for (size_t index = 0; index < value_count; ++ index) {
+            pending[pending_count ++] = values[index];
+        }
+    }
+
+    return true;
+}
+
+// A var with a literal key has its path pre-split. The other arguments are
+// evaluated as usual, the first of them is the default value. In the lambda of
+// a scoped reduce it becomes a JsonLogic_OpCode_ScopeVar.
+static JsonLogic_Error jsonlogic_compile_var(JsonLogic_Compiler *compiler, JsonLogic_OpCode opcode, const JsonLogic_Handle values[], size_t value_count) {
+    const size_t depth = compiler->depth;
+
+    for (size_t index = 1; index < value_count; ++ index) {
+        TRY(jsonlogic_compile_node(compiler, values[index]));
+    }
+
+    JsonLogic_Path *path = jsonlogic_path_compile(values[0]);
+    if (path == NULL) {
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    JsonLogic_Error error = jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+        .opcode = opcode,
+        .argc   = value_count - 1,
+        .path   = path,
+    });
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        jsonlogic_path_free(path);
+        return error;
+    }
+
+    compiler->depth = depth;
+    jsonlogic_compiler_push(compiler, 1);
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+// missing and missing_some with literal arguments have all their key paths
+// pre-split. Only the needed count of missing_some is left on the stack.
+static JsonLogic_Error jsonlogic_compile_missing(JsonLogic_Compiler *compiler, JsonLogic_Operation_Funct funct, const JsonLogic_Handle values[], size_t value_count) {
+    JsonLogic_OpCode opcode = JsonLogic_OpCode_Missing;
+    size_t argc = 0;
+
+    if (funct == jsonlogic_op_MISSING_SOME) {
+        if (value_count < 2) {
+            // jsonlogic.js crashes if argc < 2
+            return jsonlogic_compiler_emit_push(compiler, JsonLogic_Null);
+        }
+        TRY(jsonlogic_compiler_emit_push(compiler, values[0]));
+        opcode = JsonLogic_OpCode_MissingSome;
+        argc   = 1;
+        values += 1;
+        value_count = 1;
+    }
+
+    size_t key_count;
+    const JsonLogic_Handle *keys;
+    if (value_count > 0 && JSONLOGIC_IS_ARRAY(values[0])) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(values[0]);
+        key_count = array->size;
+        keys      = array->items;
+    } else {
+        key_count = value_count;
+        keys      = values;
+    }
+
+    JsonLogic_Paths *paths = jsonlogic_paths_compile(keys, key_count);
+    if (paths == NULL) {
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    JsonLogic_Error error = jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+        .opcode = opcode,
+        .argc   = argc,
+        .paths  = paths,
+    });
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        jsonlogic_paths_free(paths);
+        return error;
+    }
+
+    compiler->depth -= argc;
+    jsonlogic_compiler_push(compiler, 1);
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static JsonLogic_Error jsonlogic_compile_unshared(JsonLogic_Compiler *compiler, JsonLogic_Handle logic) {
+    if (jsonlogic_is_literal(logic)) {
+        // Literal arrays are shared instead of being copied on every
+        // evaluation. Values are immutable, so nobody can tell.
+        return jsonlogic_compiler_emit_push(compiler, logic);
+    }
+
+    if (JSONLOGIC_IS_ARRAY(logic)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+        for (size_t index = 0; index < array->size; ++ index) {
+            TRY(jsonlogic_compile_node(compiler, array->items[index]));
+        }
+        TRY(jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+            .opcode = JsonLogic_OpCode_Array,
+            .argc   = array->size,
+            .target = 0,
+        }));
+        compiler->depth -= array->size;
+        jsonlogic_compiler_push(compiler, 1);
+        return JSONLOGIC_ERROR_SUCCESS;
+    }
+
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+    const JsonLogic_Object_Entry *entry = NULL;
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+            entry = &object->entries[index];
+            break;
+        }
+    }
+    assert(entry != NULL);
+
+    JsonLogic_Handle oparg = entry->value;
+    JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(entry->key);
+
+    size_t value_count;
+    const JsonLogic_Handle *values;
+
+    if (JSONLOGIC_IS_ARRAY(oparg)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(oparg);
+        value_count = array->size;
+        values      = array->items;
+    } else {
+        value_count = 1;
+        values      = &oparg;
+    }
+
+    const size_t depth = compiler->depth;
+
+    if (compiler->certlogic && JSONLOGIC_IS_OP(opstr, IF)) {
+        if (value_count == 0) {
+            return jsonlogic_compiler_emit_push(compiler, JsonLogic_Null);
+        }
+
+        size_t else_jump;
+        size_t end_jump;
+        TRY(jsonlogic_compile_node(compiler, values[0]));
+        TRY(jsonlogic_compiler_emit_jump(compiler, JsonLogic_OpCode_JumpIfFalse, &else_jump));
+        compiler->depth = depth;
+        TRY(value_count < 2 ?
+            jsonlogic_compiler_emit_push(compiler, JsonLogic_Null) :
+            jsonlogic_compile_node(compiler, values[1]));
+        TRY(jsonlogic_compiler_emit_jump(compiler, JsonLogic_OpCode_Jump, &end_jump));
+        jsonlogic_compiler_patch(compiler, else_jump);
+        compiler->depth = depth;
+        TRY(value_count < 3 ?
+            jsonlogic_compiler_emit_push(compiler, JsonLogic_Null) :
+            jsonlogic_compile_node(compiler, values[2]));
+        jsonlogic_compiler_patch(compiler, end_jump);
+        return JSONLOGIC_ERROR_SUCCESS;
+    } else if (!compiler->certlogic && (JSONLOGIC_IS_OP(opstr, IF) || JSONLOGIC_IS_OP(opstr, ALT_IF))) {
+        if (value_count == 0) {
+            return jsonlogic_compiler_emit_push(compiler, JsonLogic_Null);
+        }
+
+        // all the jumps to the end are chained through their targets
+        // and patched at the end
+        size_t end_jumps = SIZE_MAX;
+        size_t index = 0;
+        while (index < value_count - 1) {
+            size_t else_jump;
+            size_t end_jump;
+            TRY(jsonlogic_compile_node(compiler, values[index]));
+            TRY(jsonlogic_compiler_emit_jump(compiler, JsonLogic_OpCode_JumpIfFalse, &else_jump));
+            compiler->depth = depth;
+            TRY(jsonlogic_compile_node(compiler, values[index + 1]));
+            TRY(jsonlogic_compiler_emit_jump(compiler, JsonLogic_OpCode_Jump, &end_jump));
+            compiler->code[end_jump].target = end_jumps;
+            end_jumps = end_jump;
+            jsonlogic_compiler_patch(compiler, else_jump);
+            compiler->depth = depth;
+            index += 2;
+        }
+        if (index < value_count) {
+            TRY(jsonlogic_compile_node(compiler, values[index]));
+        } else {
+            TRY(jsonlogic_compiler_emit_push(compiler, JsonLogic_Null));
+        }
+        while (end_jumps != SIZE_MAX) {
+            size_t next = compiler->code[end_jumps].target;
+            jsonlogic_compiler_patch(compiler, end_jumps);
+            end_jumps = next;
+        }
+        return JSONLOGIC_ERROR_SUCCESS;
+    } else if (JSONLOGIC_IS_OP(opstr, AND) || (!compiler->certlogic && JSONLOGIC_IS_OP(opstr, OR))) {
+        if (value_count == 0) {
+            return jsonlogic_compiler_emit_push(compiler, JsonLogic_Null);
+        }
+        JsonLogic_OpCode opcode = JSONLOGIC_IS_OP(opstr, AND) ?
+            JsonLogic_OpCode_AndJump : JsonLogic_OpCode_OrJump;
+
+        size_t end_jumps = SIZE_MAX;
+        for (size_t index = 0; index < value_count - 1; ++ index) {
+            size_t end_jump;
+            TRY(jsonlogic_compile_node(compiler, values[index]));
+            TRY(jsonlogic_compiler_emit_jump(compiler, opcode, &end_jump));
+            compiler->code[end_jump].target = end_jumps;
+            end_jumps = end_jump;
+            compiler->depth = depth;
+        }
+        TRY(jsonlogic_compile_node(compiler, values[value_count - 1]));
+        while (end_jumps != SIZE_MAX) {
+            size_t next = compiler->code[end_jumps].target;
+            jsonlogic_compiler_patch(compiler, end_jumps);
+            end_jumps = next;
+        }
+        return JSONLOGIC_ERROR_SUCCESS;
+    } else if (!compiler->certlogic && (JSONLOGIC_IS_OP(opstr, FILTER) || JSONLOGIC_IS_OP(opstr, MAP))) {
+        if (value_count == 0) {
+            JsonLogic_Handle empty = jsonlogic_empty_array();
+            if (JSONLOGIC_IS_ERROR(empty)) {
+                return jsonlogic_get_error(empty);
+            }
+            JsonLogic_Error error = jsonlogic_compiler_emit_push(compiler, empty);
+            jsonlogic_decref(empty);
+            return error;
+        }
+
+        TRY(jsonlogic_compile_node(compiler, values[0]));
+
+        if (JSONLOGIC_IS_OP(opstr, FILTER)) {
+            // A filter with a falsy lambda never evaluates it.
+            bool has_lambda = value_count > 1 && jsonlogic_to_bool(values[1]);
+            return jsonlogic_compile_lambda(compiler, JsonLogic_OpCode_Filter,
+                has_lambda ? 1 : 0, has_lambda ? values[1] : JsonLogic_Null);
+        }
+
+        return jsonlogic_compile_lambda(compiler, JsonLogic_OpCode_Map, 1,
+            value_count < 2 ? JsonLogic_Null : values[1]);
+    } else if (JSONLOGIC_IS_OP(opstr, REDUCE)) {
+        if (value_count == 0) {
+            return jsonlogic_compiler_emit_push(compiler, JsonLogic_Null);
+        }
+        JsonLogic_Handle lambda = JsonLogic_Null;
+        JsonLogic_Handle init   = JsonLogic_Null;
+        if (value_count > 1) {
+            lambda = values[1];
+            if (value_count > 2) {
+                init = values[2];
+            }
+        }
+
+        // The initial value is used as is and not evaluated.
+        TRY(jsonlogic_compiler_emit_push(compiler, init));
+        TRY(jsonlogic_compile_node(compiler, values[0]));
+        TRY(jsonlogic_compile_lambda(compiler,
+            jsonlogic_reduce_is_scoped(lambda, compiler->operations, compiler->certlogic) ?
+                JsonLogic_OpCode_ReduceScope : JsonLogic_OpCode_Reduce,
+            1, lambda));
+        compiler->depth = depth;
+        jsonlogic_compiler_push(compiler, 1);
+        return JSONLOGIC_ERROR_SUCCESS;
+    } else if (!compiler->certlogic && (JSONLOGIC_IS_OP(opstr, ALL) || JSONLOGIC_IS_OP(opstr, SOME) || JSONLOGIC_IS_OP(opstr, NONE))) {
+        JsonLogic_OpCode opcode =
+            JSONLOGIC_IS_OP(opstr, ALL)  ? JsonLogic_OpCode_All :
+            JSONLOGIC_IS_OP(opstr, SOME) ? JsonLogic_OpCode_Some :
+                                           JsonLogic_OpCode_None;
+        if (value_count == 0) {
+            return jsonlogic_compiler_emit_push(compiler,
+                opcode == JsonLogic_OpCode_None ? JsonLogic_True : JsonLogic_False);
+        }
+
+        TRY(jsonlogic_compile_node(compiler, values[0]));
+        return jsonlogic_compile_lambda(compiler, opcode, 1,
+            value_count > 1 ? values[1] : JsonLogic_Null);
+    }
+
+    uint64_t hash = opstr->hash;
+    if (hash == JSONLOGIC_HASH_UNSET) {
+        hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+    }
+
+    const JsonLogic_Operation *opptr = jsonlogic_operations_get_with_hash(
+        compiler->operations, hash, opstr->str, opstr->size);
+
+    if (opptr == NULL) {
+        // Arguments of unknown operations are never evaluated.
+        return jsonlogic_compiler_emit_push(compiler, JsonLogic_Error_IllegalOperation);
+    }
+
+    if (opptr->lazy_funct != NULL) {
+        return jsonlogic_compile_lazy(compiler, opptr, values, value_count);
+    }
+
+    if (opptr->funct == jsonlogic_op_VAR && compiler->scope) {
+        // jsonlogic_reduce_is_scoped() ensured a string key
+        return jsonlogic_compile_var(compiler, JsonLogic_OpCode_ScopeVar, values, value_count);
+    }
+
+    if (opptr->funct == jsonlogic_op_VAR && value_count > 0 && jsonlogic_is_literal(values[0])) {
+        return jsonlogic_compile_var(compiler, JsonLogic_OpCode_Var, values, value_count);
+    }
+
+    if ((opptr->funct == jsonlogic_op_MISSING || opptr->funct == jsonlogic_op_MISSING_SOME) &&
+        jsonlogic_all_literal(values, value_count)) {
+        return jsonlogic_compile_missing(compiler, opptr->funct, values, value_count);
+    }
+
+    for (size_t index = 0; index < value_count; ++ index) {
+        TRY(jsonlogic_compile_node(compiler, values[index]));
+    }
+
+    TRY(jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+        .opcode    = JsonLogic_OpCode_Call,
+        .argc      = value_count,
+        .operation = *opptr,
+    }));
+
+    compiler->depth = depth;
+    jsonlogic_compiler_push(compiler, 1);
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+// ---- rule sets ----
+
+static JsonLogic_SharedNode *jsonlogic_shared_find(const JsonLogic_SharedNodes *shared, JsonLogic_Handle logic, uint64_t hash) {
+    if (shared->capacity == 0) {
+        return NULL;
+    }
+
+    const size_t mask = shared->capacity - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask) {
+        JsonLogic_SharedNode *node = &shared->entries[index];
+        if (JSONLOGIC_IS_NULL(node->logic)) {
+            return NULL;
+        }
+        if (node->hash == hash && jsonlogic_logic_equals(node->logic, logic)) {
+            return node;
+        }
+    }
+}
+
+static JsonLogic_Error jsonlogic_shared_insert(JsonLogic_SharedNodes *shared, JsonLogic_SharedNode node) {
+    // keep the load factor below 1/2
+    if ((shared->size + 1) * 2 > shared->capacity) {
+        size_t new_capacity = shared->capacity == 0 ? 64 : shared->capacity * 2;
+        if (new_capacity > SIZE_MAX / sizeof(JsonLogic_SharedNode)) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        JsonLogic_SharedNode *new_entries = malloc(new_capacity * sizeof(JsonLogic_SharedNode));
+        if (new_entries == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        for (size_t index = 0; index < new_capacity; ++ index) {
+            new_entries[index].logic = JsonLogic_Null;
+        }
+        for (size_t index = 0; index < shared->capacity; ++ index) {
+            const JsonLogic_SharedNode *entry = &shared->entries[index];
+            if (!JSONLOGIC_IS_NULL(entry->logic)) {
+                size_t new_index = entry->hash & (new_capacity - 1);
+                while (!JSONLOGIC_IS_NULL(new_entries[new_index].logic)) {
+                    new_index = (new_index + 1) & (new_capacity - 1);
+                }
+                new_entries[new_index] = *entry;
+            }
+        }
+        free(shared->entries);
+        shared->entries  = new_entries;
+        shared->capacity = new_capacity;
+    }
+
+    const size_t mask = shared->capacity - 1;
+    size_t index = node.hash & mask;
+    while (!JSONLOGIC_IS_NULL(shared->entries[index].logic)) {
+        index = (index + 1) & mask;
+    }
+    shared->entries[index] = node;
+    ++ shared->size;
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static JsonLogic_Error jsonlogic_count_shared(JsonLogic_Compiler *compiler, JsonLogic_Handle logic, bool in_lambda, bool *pureptr);
+
+static JsonLogic_Error jsonlogic_count_shared_args(JsonLogic_Compiler *compiler, const JsonLogic_Handle values[], size_t value_count, bool in_lambda, bool *pureptr) {
+    for (size_t index = 0; index < value_count; ++ index) {
+        bool pure;
+        TRY(jsonlogic_count_shared(compiler, values[index], in_lambda, &pure));
+        *pureptr = *pureptr && pure;
+    }
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+// Counts how often each subtree occurs outside of lambdas and whether it
+// always evaluates to the same value for the same input. The subtrees of a
+// subtree that was already seen aren't counted again, since they're only
+// evaluated once as part of it.
+static JsonLogic_Error jsonlogic_count_shared(JsonLogic_Compiler *compiler, JsonLogic_Handle logic, bool in_lambda, bool *pureptr) {
+    if (jsonlogic_is_literal(logic)) {
+        *pureptr = true;
+        return JSONLOGIC_ERROR_SUCCESS;
+    }
+
+    uint64_t hash = 0;
+    if (!in_lambda) {
+        hash = jsonlogic_logic_hash(logic);
+        JsonLogic_SharedNode *node = jsonlogic_shared_find(compiler->shared, logic, hash);
+        if (node != NULL) {
+            ++ node->count;
+            *pureptr = node->pure;
+            return JSONLOGIC_ERROR_SUCCESS;
+        }
+    }
+
+    bool pure = true;
+    if (JSONLOGIC_IS_ARRAY(logic)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(logic);
+        TRY(jsonlogic_count_shared_args(compiler, array->items, array->size, in_lambda, &pure));
+    } else {
+        const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+        const JsonLogic_Object_Entry *entry = NULL;
+        for (size_t index = object->first_index; index < object->size; ++ index) {
+            if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+                entry = &object->entries[index];
+                break;
+            }
+        }
+        assert(entry != NULL);
+
+        JsonLogic_Handle oparg = entry->value;
+        JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(entry->key);
+
+        size_t value_count;
+        const JsonLogic_Handle *values;
+
+        if (JSONLOGIC_IS_ARRAY(oparg)) {
+            const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(oparg);
+            value_count = array->size;
+            values      = array->items;
+        } else {
+            value_count = 1;
+            values      = &oparg;
+        }
+
+        // same special forms as in jsonlogic_compile_unshared()
+        if (JSONLOGIC_IS_OP(opstr, IF) || JSONLOGIC_IS_OP(opstr, AND) ||
+            (!compiler->certlogic && (JSONLOGIC_IS_OP(opstr, ALT_IF) || JSONLOGIC_IS_OP(opstr, OR)))) {
+            TRY(jsonlogic_count_shared_args(compiler, values, value_count, in_lambda, &pure));
+        } else if (JSONLOGIC_IS_OP(opstr, REDUCE) || (!compiler->certlogic && (
+                   JSONLOGIC_IS_OP(opstr, FILTER) || JSONLOGIC_IS_OP(opstr, MAP) ||
+                   JSONLOGIC_IS_OP(opstr, ALL) || JSONLOGIC_IS_OP(opstr, SOME) || JSONLOGIC_IS_OP(opstr, NONE)))) {
+            // the initial value of reduce isn't evaluated
+            TRY(jsonlogic_count_shared_args(compiler, values, value_count > 0 ? 1 : 0, in_lambda, &pure));
+            TRY(jsonlogic_count_shared_args(compiler, values + 1, value_count > 1 ? 1 : 0, true, &pure));
+        } else {
+            uint64_t ophash = opstr->hash;
+            if (ophash == JSONLOGIC_HASH_UNSET) {
+                ophash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+            }
+
+            const JsonLogic_Operation *opptr = jsonlogic_operations_get_with_hash(
+                compiler->operations, ophash, opstr->str, opstr->size);
+
+            // unknown operations are an error without evaluating anything
+            if (opptr != NULL) {
+                pure = jsonlogic_operation_has_flags(opptr,
+                    JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_DETERMINISTIC);
+                TRY(jsonlogic_count_shared_args(compiler, values, value_count, in_lambda, &pure));
+            }
+        }
+    }
+
+    *pureptr = pure;
+
+    if (in_lambda) {
+        return JSONLOGIC_ERROR_SUCCESS;
+    }
+
+    return jsonlogic_shared_insert(compiler->shared, (JsonLogic_SharedNode){
+        .hash  = hash,
+        .logic = logic,
+        .count = 1,
+        .slot  = SIZE_MAX,
+        .pure  = pure,
+    });
+}
+
+// Subtrees that occur more than once are evaluated at most once per input.
+// The first evaluation stores the value in a slot, all others (and the first
+// one of any other rule) load it from there.
+static JsonLogic_Error jsonlogic_compile_node(JsonLogic_Compiler *compiler, JsonLogic_Handle logic) {
+    if (compiler->shared == NULL || compiler->lambda_depth > 0 || jsonlogic_is_literal(logic)) {
+        return jsonlogic_compile_unshared(compiler, logic);
+    }
+
+    JsonLogic_SharedNode *node = jsonlogic_shared_find(compiler->shared, logic, jsonlogic_logic_hash(logic));
+    if (node == NULL || !node->pure || node->count < 2) {
+        return jsonlogic_compile_unshared(compiler, logic);
+    }
+
+    if (node->slot == SIZE_MAX) {
+        node->slot = compiler->slot_count ++;
+    }
+    size_t slot = node->slot;
+
+    size_t load;
+    TRY(jsonlogic_compiler_emit_jump(compiler, JsonLogic_OpCode_Load, &load));
+    compiler->code[load].argc = slot;
+    TRY(jsonlogic_compile_unshared(compiler, logic));
+    TRY(jsonlogic_compiler_emit(compiler, (JsonLogic_Instr){
+        .opcode = JsonLogic_OpCode_Store,
+        .argc   = slot,
+        .target = 0,
+    }));
+    jsonlogic_compiler_patch(compiler, load);
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static void jsonlogic_code_free(JsonLogic_Instr *code, size_t size) {
+    for (size_t index = 0; index < size; ++ index) {
+        switch (code[index].opcode) {
+            case JsonLogic_OpCode_Push:
+                jsonlogic_decref(code[index].value);
+                break;
+
+            case JsonLogic_OpCode_Var:
+            case JsonLogic_OpCode_ScopeVar:
+                jsonlogic_path_free(code[index].path);
+                break;
+
+            case JsonLogic_OpCode_Missing:
+            case JsonLogic_OpCode_MissingSome:
+                jsonlogic_paths_free(code[index].paths);
+                break;
+
+            case JsonLogic_OpCode_Lazy:
+                jsonlogic_lazy_call_free(code[index].lazy);
+                break;
+
+            default:
+                break;
+        }
+    }
+    free(code);
+}
+
+static JsonLogic_Program *jsonlogic_compile_program(JsonLogic_Handle logic, const JsonLogic_Operations *operations, bool certlogic) {
+    JsonLogic_Compiler compiler = {
+        .operations = operations,
+        .certlogic  = certlogic,
+        .size       = 0,
+        .capacity   = 0,
+        .code       = NULL,
+        .depth      = 0,
+        .max_depth  = 0,
+    };
+
+    JsonLogic_Program *program = NULL;
+    JsonLogic_Error error = jsonlogic_compile_node(&compiler, logic);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        goto error;
+    }
+
+    error = jsonlogic_compiler_emit(&compiler, (JsonLogic_Instr){
+        .opcode = JsonLogic_OpCode_Return,
+        .argc   = 0,
+        .target = 0,
+    });
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        goto error;
+    }
+
+    program = malloc(sizeof(JsonLogic_Program));
+    if (program == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        goto error;
+    }
+
+    program->to_bool    = certlogic ? certlogic_to_bool : jsonlogic_to_bool;
+    program->stack_size = compiler.max_depth;
+    program->size       = compiler.size;
+    program->code       = compiler.code;
+
+    return program;
+
+error:
+    jsonlogic_code_free(compiler.code, compiler.size);
+    errno = ENOMEM;
+    return NULL;
+}
+
+JsonLogic_Program *jsonlogic_compile(JsonLogic_Handle logic, const JsonLogic_Operations *operations) {
+    return jsonlogic_compile_program(logic, operations, false);
+}
+
+JsonLogic_Program *certlogic_compile(JsonLogic_Handle logic, const JsonLogic_Operations *operations) {
+    return jsonlogic_compile_program(logic, operations, true);
+}
+
+void jsonlogic_program_free(JsonLogic_Program *program) {
+    if (program != NULL) {
+        jsonlogic_code_free(program->code, program->size);
+        free(program);
+    }
+}
+
+static JsonLogic_Handle jsonlogic_program_run(const JsonLogic_Program *program, size_t pc, JsonLogic_Handle data, JsonLogic_Handle *stack, JsonLogic_Handle *slots);
+
+typedef struct JsonLogic_ProgramEvaluator {
+    JsonLogic_Evaluator evaluator;
+    const JsonLogic_Program *program;
+    const JsonLogic_LazyCall *lazy;
+    JsonLogic_Handle *stack;
+    JsonLogic_Handle *slots;
+} JsonLogic_ProgramEvaluator;
+
+// Arguments run their compiled code, anything else is interpreted.
+static JsonLogic_Handle jsonlogic_program_evaluate(JsonLogic_Evaluator *evaluator, JsonLogic_Handle logic, JsonLogic_Handle data) {
+    const JsonLogic_ProgramEvaluator *program_evaluator = (const JsonLogic_ProgramEvaluator*)evaluator;
+    const JsonLogic_LazyCall *lazy = program_evaluator->lazy;
+
+    for (size_t index = 0; index < lazy->argc; ++ index) {
+        if (lazy->args[index] == logic) {
+            return jsonlogic_program_run(program_evaluator->program, lazy->entries[index], data,
+                program_evaluator->stack, program_evaluator->slots);
+        }
+    }
+
+    if (program_evaluator->program->to_bool == certlogic_to_bool) {
+        return certlogic_apply_custom(logic, data, &lazy->operations);
+    }
+    return jsonlogic_apply_custom(logic, data, &lazy->operations);
+}
+
+static JsonLogic_Handle jsonlogic_program_reduce(const JsonLogic_Program *program, size_t lambda, JsonLogic_Handle data, JsonLogic_Handle init, JsonLogic_Handle items, JsonLogic_Handle *stack, JsonLogic_Handle *slots) {
+    const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+    JsonLogic_Handle str_accumulator = jsonlogic_string_from_utf16_sized(JSONLOGIC_ACCUMULATOR, JSONLOGIC_ACCUMULATOR_SIZE);
+    JsonLogic_Handle str_current     = jsonlogic_string_from_utf16_sized(JSONLOGIC_CURRENT, JSONLOGIC_CURRENT_SIZE);
+    JsonLogic_Handle reduce_context;
+    if (program->to_bool == certlogic_to_bool) {
+        JsonLogic_Handle str_data = jsonlogic_string_from_utf16_sized(JSONLOGIC_DATA, JSONLOGIC_DATA_SIZE);
+        reduce_context = jsonlogic_object_build(
+            { .key = str_accumulator, .value = JsonLogic_Null },
+            { .key = str_current,     .value = JsonLogic_Null },
+            { .key = str_data,        .value = data           },
+        );
+        jsonlogic_decref(str_data);
+    } else {
+        reduce_context = jsonlogic_object_build(
+            { .key = str_accumulator, .value = JsonLogic_Null },
+            { .key = str_current,     .value = JsonLogic_Null },
+        );
+    }
+    jsonlogic_decref(str_accumulator);
+    jsonlogic_decref(str_current);
+
+    if (JSONLOGIC_IS_ERROR(reduce_context)) {
+        jsonlogic_decref(init);
+        return reduce_context;
+    }
+    JsonLogic_Object *reduce_context_object = JSONLOGIC_CAST_OBJECT(reduce_context);
+    JsonLogic_Handle accumulator = init;
+
+    size_t accumulator_index = jsonlogic_object_get_index_utf16_with_hash(
+        reduce_context_object,
+        JSONLOGIC_ACCUMULATOR_HASH,
+        JSONLOGIC_ACCUMULATOR,
+        JSONLOGIC_ACCUMULATOR_SIZE);
+    assert(accumulator_index < reduce_context_object->size);
+
+    size_t current_index = jsonlogic_object_get_index_utf16_with_hash(
+        reduce_context_object,
+        JSONLOGIC_CURRENT_HASH,
+        JSONLOGIC_CURRENT,
+        JSONLOGIC_CURRENT_SIZE);
+    assert(current_index < reduce_context_object->size);
+
+    for (size_t index = 0; index < array->size; ++ index) {
+        reduce_context_object->entries[accumulator_index].value = accumulator;
+        reduce_context_object->entries[current_index].value     = array->items[index];
+
+        JsonLogic_Handle new_accumulator = jsonlogic_program_run(program, lambda, reduce_context, stack, slots);
+
+        jsonlogic_decref(accumulator);
+        accumulator = new_accumulator;
+
+        reduce_context_object->entries[accumulator_index].value = JsonLogic_Null;
+        reduce_context_object->entries[current_index].value     = JsonLogic_Null;
+    }
+
+    jsonlogic_decref(reduce_context);
+
+    return accumulator;
+}
+
+static JsonLogic_Handle jsonlogic_program_run(const JsonLogic_Program *program, size_t pc, JsonLogic_Handle data, JsonLogic_Handle *stack, JsonLogic_Handle *slots) {
+    const JsonLogic_Instr *code = program->code;
+    bool (*to_bool)(JsonLogic_Handle) = program->to_bool;
+    JsonLogic_Handle *sp = stack;
+
+    for (;;) {
+        const JsonLogic_Instr *instr = &code[pc ++];
+        switch (instr->opcode) {
+            case JsonLogic_OpCode_Push:
+                *sp ++ = jsonlogic_incref(instr->value);
+                break;
+
+            case JsonLogic_OpCode_Call:
+            {
+                size_t argc = instr->argc;
+                JsonLogic_Handle *args = sp - argc;
+                JsonLogic_Handle result = instr->operation.funct(instr->operation.context, data, args, argc);
+                for (size_t index = 0; index < argc; ++ index) {
+                    jsonlogic_decref(args[index]);
+                }
+                sp = args;
+                *sp ++ = result;
+                break;
+            }
+            case JsonLogic_OpCode_Var:
+            {
+                size_t argc = instr->argc;
+                JsonLogic_Handle *args = sp - argc;
+                JsonLogic_Handle result = jsonlogic_path_get(instr->path, data,
+                    argc > 0 ? args[0] : JsonLogic_Null);
+                for (size_t index = 0; index < argc; ++ index) {
+                    jsonlogic_decref(args[index]);
+                }
+                sp = args;
+                *sp ++ = result;
+                break;
+            }
+            case JsonLogic_OpCode_ScopeVar:
+            {
+                // stack is the one of the lambda of JsonLogic_OpCode_ReduceScope
+                size_t argc = instr->argc;
+                JsonLogic_Handle *args = sp - argc;
+                JsonLogic_Handle result = jsonlogic_path_get_scoped(instr->path, stack[-2], stack[-1],
+                    to_bool == certlogic_to_bool ? data : JSONLOGIC_SLOT_UNSET,
+                    argc > 0 ? args[0] : JsonLogic_Null);
+                for (size_t index = 0; index < argc; ++ index) {
+                    jsonlogic_decref(args[index]);
+                }
+                sp = args;
+                *sp ++ = result;
+                break;
+            }
+            case JsonLogic_OpCode_Missing:
+                *sp ++ = jsonlogic_paths_missing(instr->paths, data);
+                break;
+
+            case JsonLogic_OpCode_MissingSome:
+            {
+                JsonLogic_Handle need = sp[-1];
+                double need_count = jsonlogic_to_double(need);
+                jsonlogic_decref(need);
+                JsonLogic_Handle missing = jsonlogic_paths_missing(instr->paths, data);
+                if (!JSONLOGIC_IS_ERROR(missing)) {
+                    JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(missing);
+                    if (instr->paths->size - array->size >= need_count) {
+                        missing = jsonlogic_array_into_handle(jsonlogic_array_truncate(array, 0));
+                    }
+                }
+                sp[-1] = missing;
+                break;
+            }
+            case JsonLogic_OpCode_Array:
+            {
+                size_t size = instr->argc;
+                JsonLogic_Handle *items = sp - size;
+                JsonLogic_Array *array = jsonlogic_array_with_capacity(size);
+                if (array == NULL) {
+                    for (size_t index = 0; index < size; ++ index) {
+                        jsonlogic_decref(items[index]);
+                    }
+                    sp = items;
+                    *sp ++ = JsonLogic_Error_OutOfMemory;
+                    break;
+                }
+                memcpy(array->items, items, sizeof(JsonLogic_Handle) * size);
+                sp = items;
+                *sp ++ = jsonlogic_array_into_handle(array);
+                break;
+            }
+            case JsonLogic_OpCode_Jump:
+                pc = instr->target;
+                break;
+
+            case JsonLogic_OpCode_JumpIfFalse:
+            {
+                JsonLogic_Handle value = *-- sp;
+                bool condition = to_bool(value);
+                jsonlogic_decref(value);
+                if (!condition) {
+                    pc = instr->target;
+                }
+                break;
+            }
+            case JsonLogic_OpCode_AndJump:
+                if (!to_bool(sp[-1])) {
+                    pc = instr->target;
+                } else {
+                    jsonlogic_decref(*-- sp);
+                }
+                break;
+
+            case JsonLogic_OpCode_OrJump:
+                if (to_bool(sp[-1])) {
+                    pc = instr->target;
+                } else {
+                    jsonlogic_decref(*-- sp);
+                }
+                break;
+
+            case JsonLogic_OpCode_Filter:
+            {
+                JsonLogic_Handle items = sp[-1];
+                size_t lambda = pc;
+                pc = instr->target;
+                if (JSONLOGIC_IS_ERROR(items)) {
+                    break;
+                }
+                if (!JSONLOGIC_IS_ARRAY(items) || instr->argc == 0) {
+                    jsonlogic_decref(items);
+                    sp[-1] = jsonlogic_empty_array();
+                    break;
+                }
+                const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+                JsonLogic_Array *filtered = jsonlogic_array_with_capacity(array->size);
+                if (filtered == NULL) {
+                    jsonlogic_decref(items);
+                    sp[-1] = JsonLogic_Error_OutOfMemory;
+                    break;
+                }
+
+                size_t filtered_index = 0;
+                for (size_t index = 0; index < array->size; ++ index) {
+                    JsonLogic_Handle item = array->items[index];
+                    JsonLogic_Handle condition = jsonlogic_program_run(program, lambda, item, sp, slots);
+                    if (to_bool(condition)) {
+                        filtered->items[filtered_index ++] = jsonlogic_incref(item);
+                    }
+                    jsonlogic_decref(condition);
+                }
+
+                jsonlogic_decref(items);
+                filtered = jsonlogic_array_truncate(filtered, filtered_index);
+                sp[-1] = jsonlogic_array_into_handle(filtered);
+                break;
+            }
+            case JsonLogic_OpCode_Map:
+            {
+                JsonLogic_Handle items = sp[-1];
+                size_t lambda = pc;
+                pc = instr->target;
+                if (JSONLOGIC_IS_ERROR(items)) {
+                    break;
+                }
+                if (!JSONLOGIC_IS_ARRAY(items)) {
+                    jsonlogic_decref(items);
+                    sp[-1] = jsonlogic_empty_array();
+                    break;
+                }
+                const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+                JsonLogic_Array *mapped = jsonlogic_array_with_capacity(array->size);
+                if (mapped == NULL) {
+                    jsonlogic_decref(items);
+                    sp[-1] = JsonLogic_Error_OutOfMemory;
+                    break;
+                }
+
+                for (size_t index = 0; index < array->size; ++ index) {
+                    mapped->items[index] = jsonlogic_program_run(program, lambda, array->items[index], sp, slots);
+                }
+
+                jsonlogic_decref(items);
+                sp[-1] = jsonlogic_array_into_handle(mapped);
+                break;
+            }
+            case JsonLogic_OpCode_Reduce:
+            {
+                JsonLogic_Handle items = *-- sp;
+                JsonLogic_Handle init  = sp[-1];
+                size_t lambda = pc;
+                pc = instr->target;
+                if (JSONLOGIC_IS_ERROR(items)) {
+                    jsonlogic_decref(init);
+                    sp[-1] = items;
+                    break;
+                }
+                if (!JSONLOGIC_IS_ARRAY(items)) {
+                    jsonlogic_decref(items);
+                    break;
+                }
+                sp[-1] = jsonlogic_program_reduce(program, lambda, data, init, items, sp, slots);
+                jsonlogic_decref(items);
+                break;
+            }
+            case JsonLogic_OpCode_ReduceScope:
+            {
+                // The accumulator stays where the initial value is and the
+                // current item takes the place of the items. The lambda runs
+                // with the same data on the stack right above them, so no
+                // context object is needed.
+                JsonLogic_Handle items = sp[-1];
+                size_t lambda = pc;
+                pc = instr->target;
+                if (JSONLOGIC_IS_ERROR(items)) {
+                    jsonlogic_decref(sp[-2]);
+                    sp[-2] = items;
+                    -- sp;
+                    break;
+                }
+                if (!JSONLOGIC_IS_ARRAY(items)) {
+                    jsonlogic_decref(items);
+                    -- sp;
+                    break;
+                }
+                const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+                for (size_t index = 0; index < array->size; ++ index) {
+                    sp[-1] = array->items[index];
+                    JsonLogic_Handle accumulator = jsonlogic_program_run(program, lambda, data, sp, slots);
+                    jsonlogic_decref(sp[-2]);
+                    sp[-2] = accumulator;
+                }
+                -- sp;
+                jsonlogic_decref(items);
+                break;
+            }
+            case JsonLogic_OpCode_All:
+            case JsonLogic_OpCode_Some:
+            case JsonLogic_OpCode_None:
+            {
+                JsonLogic_Handle items = sp[-1];
+                size_t lambda = pc;
+                pc = instr->target;
+                if (JSONLOGIC_IS_ERROR(items)) {
+                    break;
+                }
+                // see apply.c for why all() is false for empty arrays
+                bool empty_result = instr->opcode == JsonLogic_OpCode_None;
+                if (!JSONLOGIC_IS_ARRAY(items) || JSONLOGIC_CAST_ARRAY(items)->size == 0) {
+                    jsonlogic_decref(items);
+                    sp[-1] = jsonlogic_boolean_from(empty_result);
+                    break;
+                }
+
+                // all() stops at the first falsy, some() and none() at the
+                // first truthy condition
+                bool stop_at = instr->opcode != JsonLogic_OpCode_All;
+                bool result  = instr->opcode != JsonLogic_OpCode_Some;
+                const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(items);
+                for (size_t index = 0; index < array->size; ++ index) {
+                    JsonLogic_Handle condition = jsonlogic_program_run(program, lambda, array->items[index], sp, slots);
+                    bool value = to_bool(condition);
+                    jsonlogic_decref(condition);
+                    if (value == stop_at) {
+                        result = !result;
+                        break;
+                    }
+                }
+
+                jsonlogic_decref(items);
+                sp[-1] = jsonlogic_boolean_from(result);
+                break;
+            }
+            case JsonLogic_OpCode_Lazy:
+            {
+                const JsonLogic_LazyCall *lazy = instr->lazy;
+                JsonLogic_ProgramEvaluator evaluator = {
+                    .evaluator = { .evaluate = jsonlogic_program_evaluate },
+                    .program   = program,
+                    .lazy      = lazy,
+                    .stack     = sp,
+                    .slots     = slots,
+                };
+                JsonLogic_Handle result = lazy->operation.lazy_funct(
+                    lazy->operation.context, data, lazy->args, lazy->argc, &evaluator.evaluator);
+                *sp ++ = result;
+                pc = lazy->next;
+                break;
+            }
+            case JsonLogic_OpCode_Load:
+                if (slots[instr->argc] != JSONLOGIC_SLOT_UNSET) {
+                    *sp ++ = jsonlogic_incref(slots[instr->argc]);
+                    pc = instr->target;
+                }
+                break;
+
+            case JsonLogic_OpCode_Store:
+                slots[instr->argc] = jsonlogic_incref(sp[-1]);
+                break;
+
+            case JsonLogic_OpCode_Return:
+                assert(sp == stack + 1);
+                return stack[0];
+
+            default:
+                assert(false);
+                return JsonLogic_Error_InternalError;
+        }
+    }
+}
+
+static JsonLogic_Handle *jsonlogic_program_stack(const JsonLogic_Program *program, JsonLogic_Handle *stackbuf) {
+    if (program->stack_size > JSONLOGIC_PROGRAM_STATIC_STACK) {
+        JsonLogic_Handle *stack = jsonlogic_malloc(sizeof(JsonLogic_Handle) * program->stack_size);
+        if (stack == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+        }
+        return stack;
+    }
+    return stackbuf;
+}
+
+JsonLogic_Handle jsonlogic_program_apply(const JsonLogic_Program *program, JsonLogic_Handle input) {
+    JsonLogic_Handle stackbuf[JSONLOGIC_PROGRAM_STATIC_STACK];
+    JsonLogic_Handle *stack = jsonlogic_program_stack(program, stackbuf);
+
+    if (stack == NULL) {
+        return JsonLogic_Error_OutOfMemory;
+    }
+
+    JsonLogic_Handle result = jsonlogic_program_run(program, 0, input, stack, NULL);
+
+    if (stack != stackbuf) {
+        jsonlogic_free(stack);
+    }
+
+    return result;
+}
+
+// Batches share one stack for all inputs.
+JsonLogic_Error jsonlogic_program_apply_batch(const JsonLogic_Program *program, const JsonLogic_Handle inputs[], size_t count, JsonLogic_Handle results[]) {
+    JsonLogic_Handle stackbuf[JSONLOGIC_PROGRAM_STATIC_STACK];
+    JsonLogic_Handle *stack = jsonlogic_program_stack(program, stackbuf);
+
+    if (stack == NULL) {
+        for (size_t index = 0; index < count; ++ index) {
+            results[index] = JsonLogic_Error_OutOfMemory;
+        }
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (size_t index = 0; index < count; ++ index) {
+        results[index] = jsonlogic_program_run(program, 0, inputs[index], stack, NULL);
+    }
+
+    if (stack != stackbuf) {
+        jsonlogic_free(stack);
+    }
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+JsonLogic_Error jsonlogic_program_apply_batch_bitmap(const JsonLogic_Program *program, const JsonLogic_Handle inputs[], size_t count, uint8_t bitmap[]) {
+    JsonLogic_Handle stackbuf[JSONLOGIC_PROGRAM_STATIC_STACK];
+    JsonLogic_Handle *stack = jsonlogic_program_stack(program, stackbuf);
+
+    memset(bitmap, 0, (count + 7) / 8);
+
+    if (stack == NULL) {
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    bool (*to_bool)(JsonLogic_Handle) = program->to_bool;
+    for (size_t index = 0; index < count; ++ index) {
+        JsonLogic_Handle result = jsonlogic_program_run(program, 0, inputs[index], stack, NULL);
+        if (to_bool(result)) {
+            bitmap[index / 8] |= 1 << (index % 8);
+        }
+        jsonlogic_decref(result);
+    }
+
+    if (stack != stackbuf) {
+        jsonlogic_free(stack);
+    }
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static JsonLogic_Error jsonlogic_apply_batch_program(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, JsonLogic_Handle results[], const JsonLogic_Operations *operations, bool certlogic) {
+    JsonLogic_Program *program = jsonlogic_compile_program(logic, operations, certlogic);
+    if (program == NULL) {
+        for (size_t index = 0; index < count; ++ index) {
+            results[index] = JsonLogic_Error_OutOfMemory;
+        }
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    JsonLogic_Error error = jsonlogic_program_apply_batch(program, inputs, count, results);
+    jsonlogic_program_free(program);
+
+    return error;
+}
+
+static JsonLogic_Error jsonlogic_apply_batch_bitmap_program(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, uint8_t bitmap[], const JsonLogic_Operations *operations, bool certlogic) {
+    JsonLogic_Program *program = jsonlogic_compile_program(logic, operations, certlogic);
+    if (program == NULL) {
+        memset(bitmap, 0, (count + 7) / 8);
+        return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+    }
+
+    JsonLogic_Error error = jsonlogic_program_apply_batch_bitmap(program, inputs, count, bitmap);
+    jsonlogic_program_free(program);
+
+    return error;
+}
+
+JsonLogic_Error jsonlogic_apply_batch(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, JsonLogic_Handle results[], const JsonLogic_Operations *operations) {
+    return jsonlogic_apply_batch_program(logic, inputs, count, results, operations, false);
+}
+
+JsonLogic_Error jsonlogic_apply_batch_bitmap(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, uint8_t bitmap[], const JsonLogic_Operations *operations) {
+    return jsonlogic_apply_batch_bitmap_program(logic, inputs, count, bitmap, operations, false);
+}
+
+JsonLogic_Error certlogic_apply_batch(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, JsonLogic_Handle results[], const JsonLogic_Operations *operations) {
+    return jsonlogic_apply_batch_program(logic, inputs, count, results, operations, true);
+}
+
+JsonLogic_Error certlogic_apply_batch_bitmap(JsonLogic_Handle logic, const JsonLogic_Handle inputs[], size_t count, uint8_t bitmap[], const JsonLogic_Operations *operations) {
+    return jsonlogic_apply_batch_bitmap_program(logic, inputs, count, bitmap, operations, true);
+}
+
+
+// Resolves the operation of logic like jsonlogic_compile_unshared() does for
+// operations that aren't special forms. Returns NULL for anything else.
+static const JsonLogic_Operation *jsonlogic_compiler_resolve(const JsonLogic_Compiler *compiler, JsonLogic_Handle logic, const JsonLogic_Handle **valuesptr, size_t *countptr) {
+    if (jsonlogic_is_literal(logic) || !JSONLOGIC_IS_OBJECT(logic)) {
+        return NULL;
+    }
+
+    const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(logic);
+    const JsonLogic_Object_Entry *entry = NULL;
+    for (size_t index = object->first_index; index < object->size; ++ index) {
+        if (!JSONLOGIC_IS_NULL(object->entries[index].key)) {
+            entry = &object->entries[index];
+            break;
+        }
+    }
+    assert(entry != NULL);
+
+    const JsonLogic_Handle *oparg = &entry->value;
+    JsonLogic_String *opstr = JSONLOGIC_CAST_STRING(entry->key);
+
+    if (JSONLOGIC_IS_ARRAY(*oparg)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(*oparg);
+        *countptr  = array->size;
+        *valuesptr = array->items;
+    } else {
+        *countptr  = 1;
+        *valuesptr = oparg;
+    }
+
+    uint64_t hash = opstr->hash;
+    if (hash == JSONLOGIC_HASH_UNSET) {
+        hash = jsonlogic_hash_fnv1a_utf16(opstr->str, opstr->size);
+    }
+
+    return jsonlogic_operations_get_with_hash(compiler->operations, hash, opstr->str, opstr->size);
+}
+
+// Values that can be used as keys of the guard index. jsonlogic_strict_equal()
+// compares everything else by identity.
+static inline bool jsonlogic_is_guard_value(JsonLogic_Handle value) {
+    return JSONLOGIC_IS_NUMBER(value) || JSONLOGIC_IS_STRING(value) ||
+           JSONLOGIC_IS_BOOLEAN(value) || JSONLOGIC_IS_NULL(value);
+}
+
+static uint64_t jsonlogic_guard_hash(size_t path, JsonLogic_Handle value) {
+    uint64_t hash;
+    if (JSONLOGIC_IS_NUMBER(value)) {
+        // 0 and -0 are strictly equal
+        double number = JSONLOGIC_HNDL_TO_NUM(value);
+        hash = number == 0.0 ? 0 : JSONLOGIC_NUM_TO_HNDL(number);
+    } else if (JSONLOGIC_IS_STRING(value)) {
+        const JsonLogic_String *string = JSONLOGIC_CAST_STRING(value);
+        hash = string->hash == JSONLOGIC_HASH_UNSET ?
+            jsonlogic_hash_fnv1a_utf16(string->str, string->size) :
+            string->hash;
+    } else {
+        hash = value;
+    }
+    return (hash ^ path) * UINT64_C(0x100000001b3);
+}
+
+// {"var":KEY} or {"var":[KEY]} without a default value
+static bool jsonlogic_compiler_is_plain_var(const JsonLogic_Compiler *compiler, JsonLogic_Handle logic, JsonLogic_Handle *keyptr) {
+    const JsonLogic_Handle *values;
+    size_t value_count;
+    const JsonLogic_Operation *opptr = jsonlogic_compiler_resolve(compiler, logic, &values, &value_count);
+
+    if (opptr == NULL || opptr->funct != jsonlogic_op_VAR || value_count != 1 ||
+        !(JSONLOGIC_IS_STRING(values[0]) || JSONLOGIC_IS_NUMBER(values[0]))) {
+        return false;
+    }
+
+    *keyptr = values[0];
+    return true;
+}
+
+// The guard of a rule is the rule itself or the first argument of a top
+// level and. Both evaluate to the false of the guard if it doesn't match.
+static bool jsonlogic_compiler_get_guard(const JsonLogic_Compiler *compiler, JsonLogic_Handle rule, JsonLogic_Handle *keyptr, const JsonLogic_Handle **constantsptr, size_t *countptr) {
+    if (JSONLOGIC_IS_OBJECT(rule) && !jsonlogic_is_literal(rule)) {
+        const JsonLogic_Object *object = JSONLOGIC_CAST_OBJECT(rule);
+        for (size_t index = object->first_index; index < object->size; ++ index) {
+            const JsonLogic_Object_Entry *entry = &object->entries[index];
+            if (!JSONLOGIC_IS_NULL(entry->key)) {
+                if (JSONLOGIC_IS_OP(JSONLOGIC_CAST_STRING(entry->key), AND)) {
+                    if (!JSONLOGIC_IS_ARRAY(entry->value)) {
+                        rule = entry->value;
+                    } else if (JSONLOGIC_CAST_ARRAY(entry->value)->size > 0) {
+                        rule = JSONLOGIC_CAST_ARRAY(entry->value)->items[0];
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    const JsonLogic_Handle *values;
+    size_t value_count;
+    const JsonLogic_Operation *opptr = jsonlogic_compiler_resolve(compiler, rule, &values, &value_count);
+
+    // more arguments would still be evaluated
+    if (opptr == NULL || value_count != 2) {
+        return false;
+    }
+
+    if (opptr->funct == jsonlogic_op_STRICT_EQ) {
+        size_t var_index = jsonlogic_compiler_is_plain_var(compiler, values[0], keyptr) ? 0 :
+                           jsonlogic_compiler_is_plain_var(compiler, values[1], keyptr) ? 1 : 2;
+        if (var_index == 2 || !jsonlogic_is_guard_value(values[1 - var_index])) {
+            return false;
+        }
+        *constantsptr = &values[1 - var_index];
+        *countptr     = 1;
+        return true;
+    }
+
+    if (opptr->funct == jsonlogic_op_IN && JSONLOGIC_IS_ARRAY(values[1]) &&
+        jsonlogic_compiler_is_plain_var(compiler, values[0], keyptr)) {
+        const JsonLogic_Array *array = JSONLOGIC_CAST_ARRAY(values[1]);
+        for (size_t index = 0; index < array->size; ++ index) {
+            if (!jsonlogic_is_guard_value(array->items[index])) {
+                return false;
+            }
+        }
+        *constantsptr = array->items;
+        *countptr     = array->size;
+        return true;
+    }
+
+    return false;
+}
+
+static JsonLogic_Error jsonlogic_ruleset_add_guard(JsonLogic_RuleSet *ruleset, size_t path, size_t rule, JsonLogic_Handle value) {
+    if ((ruleset->guard_count + 1) * 2 > ruleset->guard_capacity) {
+        size_t new_capacity = ruleset->guard_capacity == 0 ? 64 : ruleset->guard_capacity * 2;
+        if (new_capacity > SIZE_MAX / sizeof(JsonLogic_GuardEntry)) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        JsonLogic_GuardEntry *new_entries = malloc(new_capacity * sizeof(JsonLogic_GuardEntry));
+        if (new_entries == NULL) {
+            JSONLOGIC_ERROR_MEMORY();
+            return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        }
+        for (size_t index = 0; index < new_capacity; ++ index) {
+            new_entries[index].rule = SIZE_MAX;
+        }
+        for (size_t index = 0; index < ruleset->guard_capacity; ++ index) {
+            const JsonLogic_GuardEntry *entry = &ruleset->guard_entries[index];
+            if (entry->rule != SIZE_MAX) {
+                size_t new_index = entry->hash & (new_capacity - 1);
+                while (new_entries[new_index].rule != SIZE_MAX) {
+                    new_index = (new_index + 1) & (new_capacity - 1);
+                }
+                new_entries[new_index] = *entry;
+            }
+        }
+        free(ruleset->guard_entries);
+        ruleset->guard_entries  = new_entries;
+        ruleset->guard_capacity = new_capacity;
+    }
+
+    uint64_t hash = jsonlogic_guard_hash(path, value);
+    const size_t mask = ruleset->guard_capacity - 1;
+    size_t index = hash & mask;
+    while (ruleset->guard_entries[index].rule != SIZE_MAX) {
+        index = (index + 1) & mask;
+    }
+    ruleset->guard_entries[index] = (JsonLogic_GuardEntry){
+        .hash  = hash,
+        .path  = path,
+        .rule  = rule,
+        .value = jsonlogic_incref(value),
+    };
+    ++ ruleset->guard_count;
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static JsonLogic_Error jsonlogic_ruleset_index(JsonLogic_RuleSet *ruleset, const JsonLogic_Compiler *compiler, const JsonLogic_Handle rules[]) {
+    for (size_t rule = 0; rule < ruleset->rule_count; ++ rule) {
+        JsonLogic_Handle key;
+        const JsonLogic_Handle *constants;
+        size_t count;
+
+        ruleset->guards[rule] = SIZE_MAX;
+        if (!jsonlogic_compiler_get_guard(compiler, rules[rule], &key, &constants, &count)) {
+            continue;
+        }
+
+        size_t path = 0;
+        while (path < ruleset->path_count && !jsonlogic_logic_equals(ruleset->paths[path]->key, key)) {
+            ++ path;
+        }
+
+        if (path == ruleset->path_count) {
+            JsonLogic_Path *compiled = jsonlogic_path_compile(key);
+            if (compiled == NULL) {
+                return JSONLOGIC_ERROR_OUT_OF_MEMORY;
+            }
+            // paths has space for one path per rule
+            ruleset->paths[ruleset->path_count ++] = compiled;
+        }
+
+        ruleset->guards[rule] = path;
+        for (size_t index = 0; index < count; ++ index) {
+            TRY(jsonlogic_ruleset_add_guard(ruleset, path, rule, constants[index]));
+        }
+    }
+
+    return JSONLOGIC_ERROR_SUCCESS;
+}
+
+static JsonLogic_RuleSet *jsonlogic_ruleset_compile_program(const JsonLogic_Handle rules[], size_t rule_count, const JsonLogic_Operations *operations, bool certlogic) {
+    JsonLogic_SharedNodes shared = {
+        .size     = 0,
+        .capacity = 0,
+        .entries  = NULL,
+    };
+
+    JsonLogic_Compiler compiler = {
+        .operations   = operations,
+        .certlogic    = certlogic,
+        .size         = 0,
+        .capacity     = 0,
+        .code         = NULL,
+        .depth        = 0,
+        .max_depth    = 0,
+        .shared       = &shared,
+        .lambda_depth = 0,
+        .slot_count   = 0,
+    };
+
+    const size_t alloc_count = rule_count > 0 ? rule_count : 1;
+    JsonLogic_RuleSet *ruleset = calloc(1, sizeof(JsonLogic_RuleSet));
+    if (ruleset == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        goto error;
+    }
+
+    ruleset->program.to_bool = certlogic ? certlogic_to_bool : jsonlogic_to_bool;
+    ruleset->rule_count      = rule_count;
+    ruleset->entries         = malloc(sizeof(size_t) * alloc_count);
+    ruleset->guards          = malloc(sizeof(size_t) * alloc_count);
+    ruleset->paths           = malloc(sizeof(JsonLogic_Path*) * alloc_count);
+    if (ruleset->entries == NULL || ruleset->guards == NULL || ruleset->paths == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        goto error;
+    }
+
+    for (size_t index = 0; index < rule_count; ++ index) {
+        bool pure;
+        if (jsonlogic_count_shared(&compiler, rules[index], false, &pure) != JSONLOGIC_ERROR_SUCCESS) {
+            goto error;
+        }
+    }
+
+    // every rule is compiled into its own code path ending in a return
+    for (size_t index = 0; index < rule_count; ++ index) {
+        ruleset->entries[index] = compiler.size;
+        compiler.depth = 0;
+        if (jsonlogic_compile_node(&compiler, rules[index]) != JSONLOGIC_ERROR_SUCCESS) {
+            goto error;
+        }
+        if (jsonlogic_compiler_emit(&compiler, (JsonLogic_Instr){
+                .opcode = JsonLogic_OpCode_Return,
+                .argc   = 0,
+                .target = 0,
+            }) != JSONLOGIC_ERROR_SUCCESS) {
+            goto error;
+        }
+    }
+
+    if (jsonlogic_ruleset_index(ruleset, &compiler, rules) != JSONLOGIC_ERROR_SUCCESS) {
+        goto error;
+    }
+
+    ruleset->diagram = jsonlogic_diagram_compile(rules, rule_count, operations, certlogic);
+    if (ruleset->diagram == NULL) {
+        goto error;
+    }
+
+    ruleset->program.stack_size = compiler.max_depth;
+    ruleset->program.size       = compiler.size;
+    ruleset->program.code       = compiler.code;
+    ruleset->slot_count         = compiler.slot_count;
+
+    free(shared.entries);
+
+    return ruleset;
+
+error:
+    jsonlogic_code_free(compiler.code, compiler.size);
+    free(shared.entries);
+    jsonlogic_ruleset_free(ruleset);
+    errno = ENOMEM;
+    return NULL;
+}
+
+JsonLogic_RuleSet *jsonlogic_ruleset_compile(const JsonLogic_Handle rules[], size_t rule_count, const JsonLogic_Operations *operations) {
+    return jsonlogic_ruleset_compile_program(rules, rule_count, operations, false);
+}
+
+JsonLogic_RuleSet *certlogic_ruleset_compile(const JsonLogic_Handle rules[], size_t rule_count, const JsonLogic_Operations *operations) {
+    return jsonlogic_ruleset_compile_program(rules, rule_count, operations, true);
+}
+
+void jsonlogic_ruleset_free(JsonLogic_RuleSet *ruleset) {
+    if (ruleset != NULL) {
+        jsonlogic_code_free(ruleset->program.code, ruleset->program.size);
+        for (size_t index = 0; index < ruleset->guard_capacity; ++ index) {
+            if (ruleset->guard_entries[index].rule != SIZE_MAX) {
+                jsonlogic_decref(ruleset->guard_entries[index].value);
+            }
+        }
+        for (size_t index = 0; index < ruleset->path_count; ++ index) {
+            jsonlogic_path_free(ruleset->paths[index]);
+        }
+        jsonlogic_diagram_free(ruleset->diagram);
+        free(ruleset->guard_entries);
+        free(ruleset->paths);
+        free(ruleset->guards);
+        free(ruleset->entries);
+        free(ruleset);
+    }
+}
+
+size_t jsonlogic_ruleset_get_size(const JsonLogic_RuleSet *ruleset) {
+    return ruleset->rule_count;
+}
+
+size_t jsonlogic_ruleset_get_shared_count(const JsonLogic_RuleSet *ruleset) {
+    return ruleset->slot_count;
+}
+
+size_t jsonlogic_ruleset_get_diagram_size(const JsonLogic_RuleSet *ruleset) {
+    size_t count = 0;
+    for (size_t rule = 0; rule < ruleset->rule_count; ++ rule) {
+        if (jsonlogic_diagram_has_rule(ruleset->diagram, rule)) {
+            ++ count;
+        }
+    }
+    return count;
+}
+
+// Marks the rules that have to be evaluated for input in results with
+// JSONLOGIC_SLOT_UNSET and sets the results of all others to false.
+static void jsonlogic_ruleset_select(const JsonLogic_RuleSet *ruleset, JsonLogic_Handle input, JsonLogic_Handle results[]) {
+    for (size_t rule = 0; rule < ruleset->rule_count; ++ rule) {
+        results[rule] = ruleset->guards[rule] == SIZE_MAX ? JSONLOGIC_SLOT_UNSET : JsonLogic_False;
+    }
+
+    const size_t mask = ruleset->guard_capacity - 1;
+    for (size_t path = 0; path < ruleset->path_count; ++ path) {
+        JsonLogic_Handle value = jsonlogic_path_get(ruleset->paths[path], input, JsonLogic_Null);
+
+        if (JSONLOGIC_IS_ERROR(value)) {
+            // === and in evaluate to the error
+            for (size_t rule = 0; rule < ruleset->rule_count; ++ rule) {
+                if (ruleset->guards[rule] == path) {
+                    results[rule] = JSONLOGIC_SLOT_UNSET;
+                }
+            }
+            continue;
+        }
+
+        if (ruleset->guard_capacity > 0 && jsonlogic_is_guard_value(value)) {
+            uint64_t hash = jsonlogic_guard_hash(path, value);
+            for (size_t index = hash & mask; ruleset->guard_entries[index].rule != SIZE_MAX; index = (index + 1) & mask) {
+                const JsonLogic_GuardEntry *entry = &ruleset->guard_entries[index];
+                if (entry->hash == hash && entry->path == path &&
+                    JSONLOGIC_IS_TRUE(jsonlogic_strict_equal(entry->value, value))) {
+                    results[entry->rule] = JSONLOGIC_SLOT_UNSET;
+                }
+            }
+        }
+
+        jsonlogic_decref(value);
+    }
+}
+
+JsonLogic_Error jsonlogic_ruleset_apply(const JsonLogic_RuleSet *ruleset, JsonLogic_Handle input, JsonLogic_Handle results[]) {
+    JsonLogic_Handle stackbuf[JSONLOGIC_PROGRAM_STATIC_STACK];
+    JsonLogic_Handle slotsbuf[JSONLOGIC_PROGRAM_STATIC_STACK];
+    JsonLogic_Handle valuesbuf[JSONLOGIC_PROGRAM_STATIC_STACK];
+    uint8_t atomsbuf[JSONLOGIC_PROGRAM_STATIC_STACK];
+    JsonLogic_Handle *stack = jsonlogic_program_stack(&ruleset->program, stackbuf);
+    JsonLogic_Handle *slots = slotsbuf;
+    JsonLogic_Handle *values = valuesbuf;
+    uint8_t *atoms = atomsbuf;
+    const size_t path_count = jsonlogic_diagram_get_path_count(ruleset->diagram);
+    const size_t atom_count = jsonlogic_diagram_get_atom_count(ruleset->diagram);
+    JsonLogic_Error error = JSONLOGIC_ERROR_SUCCESS;
+
+    if (ruleset->slot_count > JSONLOGIC_PROGRAM_STATIC_STACK) {
+        slots = jsonlogic_malloc(sizeof(JsonLogic_Handle) * ruleset->slot_count);
+    }
+
+    if (path_count > JSONLOGIC_PROGRAM_STATIC_STACK) {
+        values = jsonlogic_malloc(sizeof(JsonLogic_Handle) * path_count);
+    }
+
+    if (atom_count > JSONLOGIC_PROGRAM_STATIC_STACK) {
+        atoms = jsonlogic_malloc(atom_count);
+    }
+
+    if (stack == NULL || slots == NULL || values == NULL || atoms == NULL) {
+        JSONLOGIC_ERROR_MEMORY();
+        for (size_t index = 0; index < ruleset->rule_count; ++ index) {
+            results[index] = JsonLogic_Error_OutOfMemory;
+        }
+        error = JSONLOGIC_ERROR_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+
+    for (size_t index = 0; index < ruleset->slot_count; ++ index) {
+        slots[index] = JSONLOGIC_SLOT_UNSET;
+    }
+
+    jsonlogic_diagram_reset(ruleset->diagram, atoms, values);
+    jsonlogic_ruleset_select(ruleset, input, results);
+
+    for (size_t index = 0; index < ruleset->rule_count; ++ index) {
+        if (results[index] == JSONLOGIC_SLOT_UNSET && jsonlogic_diagram_has_rule(ruleset->diagram, index)) {
+            results[index] = jsonlogic_diagram_apply(ruleset->diagram, index, input, atoms, values);
+        }
+        if (results[index] == JSONLOGIC_SLOT_UNSET) {
+            results[index] = jsonlogic_program_run(&ruleset->program, ruleset->entries[index], input, stack, slots);
+        }
+    }
+
+    jsonlogic_diagram_release(ruleset->diagram, values);
+
+    for (size_t index = 0; index < ruleset->slot_count; ++ index) {
+        if (slots[index] != JSONLOGIC_SLOT_UNSET) {
+            jsonlogic_decref(slots[index]);
+        }
+    }
+
+cleanup:
+    if (stack != stackbuf) {
+        jsonlogic_free(stack);
+    }
+
+    if (slots != slotsbuf) {
+        jsonlogic_free(slots);
+    }
+
+    if (values != valuesbuf) {
+        jsonlogic_free(values);
+    }
+
+    if (atoms != atomsbuf) {
+        jsonlogic_free(atoms);
+    }
+
+    return error;
+}
@@ -25,18 +25,15 @@ size_t jsonlogic_utf16_len(const char16_t *key) {
     return ptr - key;
 }
 
-JsonLogic_Handle jsonlogic_empty_string(void) {
-    JsonLogic_String *string = JSONLOGIC_MALLOC_EMPTY_STRING();
-    if (string == NULL) {
-        JSONLOGIC_ERROR_MEMORY();
-        return JsonLogic_Error_OutOfMemory;
-    }
+static JsonLogic_String JsonLogic_EmptyString = {
+    .refcount = JSONLOGIC_REFCOUNT_IMMORTAL,
+    .hash     = 0xcbf29ce484222325, // FNV-1a of nothing
+    .size     = 0,
+    .str      = { 0 },
+};
 
-    string->refcount = 1;
-    string->hash     = JSONLOGIC_HASH_UNSET;
-    string->size     = 0;
-
-    return ((uint64_t)(uintptr_t)string) | JsonLogic_Type_String;
+JsonLogic_Handle jsonlogic_empty_string(void) {
+    return ((uint64_t)(uintptr_t)&JsonLogic_EmptyString) | JsonLogic_Type_String;
 }
 
 JsonLogic_Handle jsonlogic_string_from_latin1(const char *str) {
@@ -49,7 +46,7 @@ JsonLogic_Handle jsonlogic_string_from_latin1_sized(const char *str, size_t size
         JSONLOGIC_ERROR_MEMORY();
         return JsonLogic_Error_OutOfMemory;
     }
-    string->refcount = 1;
+    JSONLOGIC_SET_REFCOUNT(string->refcount, 1);
     string->hash     = JSONLOGIC_HASH_UNSET;
     string->size     = size;
 
@@ -131,7 +128,7 @@ JsonLogic_Handle jsonlogic_string_from_utf8_sized(const char *str, size_t size)
         JSONLOGIC_ERROR_MEMORY();
         return JsonLogic_Error_OutOfMemory;
     }
-    string->refcount = 1;
+    JSONLOGIC_SET_REFCOUNT(string->refcount, 1);
     string->hash     = JSONLOGIC_HASH_UNSET;
     string->size     = utf16_size;
 
@@ -162,7 +159,7 @@ JsonLogic_Handle jsonlogic_string_from_utf16_sized(const char16_t *str, size_t s
         JSONLOGIC_ERROR_MEMORY();
         return JsonLogic_Error_OutOfMemory;
     }
-    string->refcount = 1;
+    JSONLOGIC_SET_REFCOUNT(string->refcount, 1);
     string->hash     = JSONLOGIC_HASH_UNSET;
     string->size     = size;
 
@@ -231,7 +228,7 @@ static JsonLogic_Handle jsonlogic_string_substr(const JsonLogic_String *string,
         return JsonLogic_Error_OutOfMemory;
     }
 
-    new_string->refcount = 1;
+    JSONLOGIC_SET_REFCOUNT(new_string->refcount, 1);
     new_string->hash     = JSONLOGIC_HASH_UNSET;
     new_string->size     = sz_size;
 
@@ -273,7 +270,8 @@ JsonLogic_Error jsonlogic_strbuf_ensure(JsonLogic_StrBuf *buf, size_t want_free_
     size_t used = buf->string == NULL ? 0 : buf->string->size;
     size_t has_free_size = buf->capacity - used;
 
-    if (has_free_size < want_free_size) {
+    // appending an empty string to an empty buffer still needs a string
+    if (has_free_size < want_free_size || buf->string == NULL) {
         size_t add_size = want_free_size - has_free_size;
         size_t new_size = buf->capacity + (add_size < JSONLOGIC_CHUNK_SIZE ? JSONLOGIC_CHUNK_SIZE : add_size);
         JsonLogic_String *new_string = JSONLOGIC_REALLOC_STRING(buf->string, new_size);
@@ -282,7 +280,7 @@ JsonLogic_Error jsonlogic_strbuf_ensure(JsonLogic_StrBuf *buf, size_t want_free_
             return JSONLOGIC_ERROR_OUT_OF_MEMORY;
         }
         if (buf->string == NULL) {
-            new_string->refcount = 1;
+            JSONLOGIC_SET_REFCOUNT(new_string->refcount, 1);
             new_string->hash     = JSONLOGIC_HASH_UNSET;
             new_string->size     = 0;
         }
@@ -340,9 +338,7 @@ JsonLogic_Error jsonlogic_strbuf_append_double(JsonLogic_StrBuf *buf, double val
     }
 
 #if defined(JSONLOGIC_WINDOWS)
-    if (JsonLogic_C_Locale == NULL) {
-        JsonLogic_C_Locale = JSONLOGIC_CREATE_C_LOCALE();
-    }
+    jsonlogic_init_c_locale();
     int count = _snwprintf_l(NULL, 0, u"%.*g", JsonLogic_C_Locale, DBL_DIG, value);
     if (count < 0) {
         JSONLOGIC_DEBUG("_snwprintf_l(NULL, 0, u\"%%.%ug\", JsonLogic_C_Locale, %.*g) error: %s",
@@ -427,13 +423,7 @@ JsonLogic_Error jsonlogic_strbuf_append(JsonLogic_StrBuf *buf, JsonLogic_Handle
 JsonLogic_String *jsonlogic_strbuf_take(JsonLogic_StrBuf *buf) {
     JsonLogic_String *string = buf->string;
     if (string == NULL) {
-        string = JSONLOGIC_MALLOC_EMPTY_STRING();
-        if (string == NULL) {
-            JSONLOGIC_ERROR_MEMORY();
-        } else {
-            string->refcount = 1;
-            string->size     = 0;
-        }
+        string = &JsonLogic_EmptyString;
     } else {
         // shrink to fit
         string = JSONLOGIC_REALLOC_STRING(string, string->size);
@@ -442,7 +432,7 @@ JsonLogic_String *jsonlogic_strbuf_take(JsonLogic_StrBuf *buf) {
             JSONLOGIC_ERROR_MEMORY();
             string = buf->string;
         }
-        assert(string->refcount == 1);
+        assert(JSONLOGIC_GET_REFCOUNT(string->refcount) == 1);
     }
     buf->capacity = 0;
     buf->string   = NULL;
@@ -515,7 +505,7 @@ int jsonlogic_utf16_compare(const char16_t *a, size_t asize, const char16_t *b,
 }
 
 void jsonlogic_string_free(JsonLogic_String *string) {
-    free(string);
+    jsonlogic_free(string);
 }
 
 size_t jsonlogic_string_to_index(const JsonLogic_String *string);
@@ -729,9 +719,7 @@ JsonLogic_Error jsonlogic_utf8buf_append_double(JsonLogic_Utf8Buf *buf, double v
     }
 
 #if defined(JSONLOGIC_WINDOWS)
-    if (JsonLogic_C_Locale == NULL) {
-        JsonLogic_C_Locale = JSONLOGIC_CREATE_C_LOCALE();
-    }
+    jsonlogic_init_c_locale();
     int count = _snprintf_l(NULL, 0, "%.*g", JsonLogic_C_Locale, DBL_DIG, value);
     if (count < 0) {
         JSONLOGIC_DEBUG("_snprintf_l(NULL, 0, \"%%.%ug\", JsonLogic_C_Locale, %.*g) error: %s",
@@ -747,9 +735,7 @@ JsonLogic_Error jsonlogic_utf8buf_append_double(JsonLogic_Utf8Buf *buf, double v
 
     return JSONLOGIC_ERROR_SUCCESS;
 #elif (defined(__APPLE__) && defined(__MACH__)) || defined(__FreeBSD__) || defined(__DragonFly__)
-    if (JsonLogic_C_Locale == NULL) {
-        JsonLogic_C_Locale = JSONLOGIC_CREATE_C_LOCALE();
-    }
+    jsonlogic_init_c_locale();
     size_t has_free = buf->capacity - buf->used;
     int count = snprintf_l(buf->string + buf->used, has_free, "%.*g", JsonLogic_C_Locale, DBL_DIG, value);
     if (count < 0) {
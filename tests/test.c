@@ -12,6 +12,7 @@
 #include <inttypes.h>
 #include <assert.h>
 #include <limits.h>
+#include <math.h>
 
 #if defined(JSONLOGIC_WINDOWS)
     #include <process.h>
@@ -98,6 +99,53 @@ typedef struct TestContext {
 
 const double MOCK_TIME = 1629205800000; // 2021-08-17T15:10:00+02:00
 
+JsonLogic_Handle apply_compiled(JsonLogic_Handle logic, JsonLogic_Handle input, const JsonLogic_Operations *operations) {
+    JsonLogic_Program *program = jsonlogic_compile(logic, operations);
+    if (program == NULL) {
+        return JsonLogic_Error_OutOfMemory;
+    }
+    JsonLogic_Handle result = jsonlogic_program_apply(program, input);
+    jsonlogic_program_free(program);
+    return result;
+}
+
+JsonLogic_Handle apply_optimized(JsonLogic_Handle logic, JsonLogic_Handle input, const JsonLogic_Operations *operations) {
+    JsonLogic_Handle optimized = jsonlogic_optimize(logic, operations);
+    if (jsonlogic_is_error(optimized)) {
+        return optimized;
+    }
+    JsonLogic_Handle result = jsonlogic_apply_custom(optimized, input, operations);
+    jsonlogic_decref(optimized);
+    return result;
+}
+
+JsonLogic_Handle certlogic_apply_optimized(JsonLogic_Handle logic, JsonLogic_Handle input, const JsonLogic_Operations *operations) {
+    JsonLogic_Handle optimized = certlogic_optimize(logic, operations);
+    if (jsonlogic_is_error(optimized)) {
+        return optimized;
+    }
+    JsonLogic_Handle result = certlogic_apply_custom(optimized, input, operations);
+    jsonlogic_decref(optimized);
+    return result;
+}
+
+// generated from tests/tests.json and tests/tests-local.json by compile_logic
+extern JsonLogic_Handle (*const jsonlogic_tests_logic[])(JsonLogic_Handle data);
+extern const size_t jsonlogic_tests_logic_count;
+
+// Lists of [logic, data, expected] tests. tests/tests.json is the upstream
+// test suite (see tests/update.sh), tests/tests-local.json has our own tests.
+typedef struct LogicTests {
+    const char *filename;
+    const char *title;
+} LogicTests;
+
+static const LogicTests LOGIC_TESTS[] = {
+    { "tests/tests.json",       "Tests from https://jsonlogic.com/tests.json" },
+    { "tests/tests-local.json", "Local tests" },
+    { NULL,                     NULL },
+};
+
 void test_bad_operator(TestContext *test_context) {
     JsonLogic_Handle logic  = jsonlogic_parse("{\"fubar\": []}", NULL);
     JsonLogic_Handle result = jsonlogic_apply(logic, JsonLogic_Null);
@@ -189,6 +237,7 @@ cleanup:
 void test_edge_cases(TestContext *test_context) {
     JsonLogic_Handle logic = jsonlogic_parse("{\"var\": \"\"}", NULL);
     JsonLogic_Handle fallback = jsonlogic_string_from_latin1("fallback");
+    JsonLogic_Handle data = JsonLogic_Null;
 
     TEST_ASSERT(jsonlogic_is_string(fallback));
 
@@ -202,8 +251,22 @@ void test_edge_cases(TestContext *test_context) {
     TEST_ASSERT_MSG(jsonlogic_deep_strict_equal(result, fallback), "Fallback works when data is a non-object");
     jsonlogic_decref(result);
 
+    jsonlogic_decref(logic);
+    logic  = jsonlogic_parse("{\"var\":\"length\"}", NULL);
+    data   = jsonlogic_parse("[1,2,3]", NULL);
+    result = jsonlogic_apply(logic, data);
+    TEST_ASSERT_MSG(result == jsonlogic_number_from(3), "Var reads the length of arrays");
+
+    jsonlogic_decref(logic);
+    jsonlogic_decref(data);
+    logic  = jsonlogic_parse("{\"var\":\"a.length\"}", NULL);
+    data   = jsonlogic_parse("{\"a\":[[],{}]}", NULL);
+    result = jsonlogic_apply(logic, data);
+    TEST_ASSERT_MSG(result == jsonlogic_number_from(2), "Var reads the length of nested arrays");
+
 cleanup:
     jsonlogic_decref(logic);
+    jsonlogic_decref(data);
     jsonlogic_decref(fallback);
 }
 
@@ -663,214 +726,2377 @@ cleanup:
     jsonlogic_operations_free(&ops);
 }
 
-void test_substr(TestContext *test_context) {
-    JsonLogic_Handle logic    = jsonlogic_parse("{\"substr\": [\"äöü\", 0, -2]}", NULL);
-    JsonLogic_Handle expected = jsonlogic_string_from_utf16(u"ä");
-    JsonLogic_Handle actual   = jsonlogic_apply(logic, JsonLogic_Null);
+void test_compiled(TestContext *test_context) {
+    JsonLogic_Handle logic = JsonLogic_Null;
+    JsonLogic_Handle data  = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    JsonLogic_Program *program = NULL;
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    TestShortCircuit context = {
+        .conditions   = JSONLOGIC_ARRAYBUF_INIT,
+        .consequences = JSONLOGIC_ARRAYBUF_INIT,
+        .list         = JSONLOGIC_ARRAYBUF_INIT,
+    };
 
-    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_build(&ops, (JsonLogic_Operations_BuildEntry[]) {
+        { u"push", { &context, push_list } },
+        { NULL,    { NULL,     NULL      } },
+    }) == JSONLOGIC_ERROR_SUCCESS);
+
+    // only the taken branch and the evaluated conditions are run
+    logic = jsonlogic_parse("{\"if\":["
+        "{\"push\":[false]}, {\"push\":[\"first\"]},"
+        "{\"or\":[{\"push\":[0]}, {\"push\":[1]}, {\"push\":[2]}]}, {\"push\":[\"second\"]},"
+        "{\"push\":[\"third\"]}"
+    "]}", NULL);
+    program = jsonlogic_compile(logic, &ops);
+    TEST_ASSERT(program != NULL);
+
+    // the program does not depend on the operations table
+    jsonlogic_operations_free(&ops);
+
+    actual = jsonlogic_program_apply(program, JsonLogic_Null);
+    expected = jsonlogic_string_from_latin1("second");
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
+
+    jsonlogic_decref(expected);
+    expected = jsonlogic_parse("[false, 0, 1, \"second\"]", NULL);
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(jsonlogic_array_into_handle(context.list.array), expected), {
         fprintf(stderr, "     error: Wrong result\n");
         fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
-        fprintf(stderr, "      data: "); jsonlogic_println(stderr, JsonLogic_Null);
         fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
-        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, jsonlogic_array_into_handle(context.list.array));
         fputc('\n', stderr);
     });
 
+    // arguments of unknown operations are not evaluated
+    jsonlogic_arraybuf_clear(&context.list);
+    jsonlogic_program_free(program);
+    jsonlogic_decref(logic);
+    logic = jsonlogic_parse("{\"fubar\": [{\"push\":[1]}]}", NULL);
+    program = jsonlogic_compile(logic, &JsonLogic_Builtins);
+    TEST_ASSERT(program != NULL);
+
     jsonlogic_decref(actual);
+    actual = jsonlogic_program_apply(program, JsonLogic_Null);
+    TEST_ASSERT(jsonlogic_get_error(actual) == JSONLOGIC_ERROR_ILLEGAL_OPERATION);
+    TEST_ASSERT(context.list.array == NULL || context.list.array->size == 0);
+
+    // nested lambdas and a program that is applied more than once
+    jsonlogic_program_free(program);
     jsonlogic_decref(logic);
-    jsonlogic_decref(expected);
+    logic = jsonlogic_parse("{\"reduce\":["
+        "{\"map\":[{\"var\":\"rows\"}, {\"reduce\":[{\"var\":\"\"}, {\"+\":[{\"var\":\"current\"}, {\"var\":\"accumulator\"}]}, 0]}]},"
+        "{\"max\":[{\"var\":\"current\"}, {\"var\":\"accumulator\"}]},"
+        "0"
+    "]}", NULL);
+    program = jsonlogic_compile(logic, &JsonLogic_Builtins);
+    TEST_ASSERT(program != NULL);
 
-    logic    = jsonlogic_parse("{\"substr\": [\"\\uD80C\\uDC00\", 1]}", NULL);
-    expected = jsonlogic_string_from_utf16((char16_t[]){ 0xdc00, 0 });
-    actual   = jsonlogic_apply(logic, JsonLogic_Null);
+    for (int count = 0; count < 3; ++ count) {
+        jsonlogic_decref(data);
+        data = jsonlogic_parse("{\"rows\":[[1,2,3],[4,5],[6]]}", NULL);
 
-    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
-        fprintf(stderr, "     error: Wrong result\n");
-        fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
-        fprintf(stderr, "      data: "); jsonlogic_println(stderr, JsonLogic_Null);
-        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
-        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
-        fputc('\n', stderr);
-    });
+        jsonlogic_decref(actual);
+        actual = jsonlogic_program_apply(program, data);
+        TEST_ASSERT(jsonlogic_deep_strict_equal(actual, jsonlogic_number_from(9)));
+    }
 
 cleanup:
+    jsonlogic_program_free(program);
     jsonlogic_decref(logic);
+    jsonlogic_decref(data);
     jsonlogic_decref(expected);
     jsonlogic_decref(actual);
-}
 
-const char *JSON_SYNTAX_ERROR[] = {
-    "{\"foo\": \"bar\" \"a\":\"b\"}",
-    "[]]",
-    "\"\\j\"",
-    "\"\\u123g\"",
-    "\"foo",
-    "\"foo\",",
-    "[,]",
-    "[123,]",
-    "{,}",
-    "{\"foo\":123,}",
-    "{\"foo\":}",
-    "{\"foo\":,}",
-    "{123:123}",
-    NULL
-};
-
-const char *VALID_JSON[] = {
-    "0",
-    "123",
-    "123.456",
-    "1.2e12",
-    "[]",
-    "{}",
-    "true",
-    "false",
-    "null",
-    "\"\"",
-    NULL
-};
+    jsonlogic_arraybuf_free(&context.conditions);
+    jsonlogic_arraybuf_free(&context.consequences);
+    jsonlogic_arraybuf_free(&context.list);
 
-void test_parsing(TestContext *test_context) {
-    const char *data = NULL;
-    JsonLogic_Handle handle = JsonLogic_Null;
+    jsonlogic_operations_free(&ops);
+}
 
-    data = "\"\xb0\"";
-    jsonlogic_decref(handle);
-    handle = jsonlogic_parse(data, NULL);
-    TEST_ASSERT_X(jsonlogic_deep_strict_equal(handle, JsonLogic_Error_UnicodeError), {
-        fprintf(stderr, "     error: Wrong result\n");
-        fprintf(stderr, "      data: %s\n", data);
-        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, JsonLogic_Error_UnicodeError);
-        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, handle);
-        fputc('\n', stderr);
-    });
+void test_freeze(TestContext *test_context) {
+    JsonLogic_Handle logic  = JsonLogic_Null;
+    JsonLogic_Handle data   = JsonLogic_Null;
+    JsonLogic_Handle actual = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_Program *program = NULL;
 
-    for (const char **ptr = JSON_SYNTAX_ERROR; *ptr; ++ ptr) {
-        data = *ptr;
-        jsonlogic_decref(handle);
-        handle = jsonlogic_parse(data, NULL);
-        TEST_ASSERT_X(jsonlogic_deep_strict_equal(handle, JsonLogic_Error_SyntaxError), {
-            fprintf(stderr, "     error: Wrong result\n");
-            fprintf(stderr, "      data: %s\n", data);
-            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, JsonLogic_Error_SyntaxError);
-            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, handle);
-            fputc('\n', stderr);
-        });
+    logic = jsonlogic_parse("{\"if\":["
+        "{\"in\":[{\"var\":\"name\"}, [\"foo\", \"bar\"]]}, {\"var\":\"items\"},"
+        "{\"cat\":[\"hello \", {\"var\":\"name\"}]}"
+    "]}", NULL);
+    data = jsonlogic_parse("{\"name\":\"bar\",\"items\":[1,2,3]}", NULL);
+    TEST_ASSERT(!jsonlogic_is_frozen(logic));
+
+    jsonlogic_freeze(logic);
+    jsonlogic_freeze(data);
+    TEST_ASSERT(jsonlogic_is_frozen(logic));
+    TEST_ASSERT(jsonlogic_is_frozen(data));
+    TEST_ASSERT(jsonlogic_is_frozen(JsonLogic_Null));
+    TEST_ASSERT(jsonlogic_get_refcount(logic) == 1);
+    TEST_ASSERT(jsonlogic_get_refcount(data) == 1);
+
+    // hashes are precomputed so nothing is written lazily later on
+    JsonLogic_Handle name = jsonlogic_get_utf16_sized(data, u"name", 4);
+    TEST_ASSERT(jsonlogic_is_string(name));
+    TEST_ASSERT(JSONLOGIC_CAST_STRING(name)->hash != JSONLOGIC_HASH_UNSET);
+    jsonlogic_decref(name);
+
+    expected = jsonlogic_parse("[1,2,3]", NULL);
+    program = jsonlogic_compile(logic, &JsonLogic_Builtins);
+    TEST_ASSERT(program != NULL);
+
+    for (int count = 0; count < 3; ++ count) {
+        actual = jsonlogic_apply(logic, data);
+        TEST_ASSERT(jsonlogic_is_frozen(actual));
+        TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
+        jsonlogic_decref(actual);
+
+        actual = jsonlogic_program_apply(program, data);
+        TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
+        jsonlogic_decref(actual);
+        actual = JsonLogic_Null;
+
+        TEST_ASSERT(jsonlogic_get_refcount(logic) == 1);
+        TEST_ASSERT(jsonlogic_get_refcount(data) == 1);
     }
 
-    for (const char **ptr = VALID_JSON; *ptr; ++ ptr) {
-        data = *ptr;
-        jsonlogic_decref(handle);
-        handle = jsonlogic_parse(data, NULL);
-        TEST_ASSERT_X(jsonlogic_get_error(handle) == JSONLOGIC_ERROR_SUCCESS, {
-            fprintf(stderr, "     error: Wrong result\n");
-            fprintf(stderr, "      data: %s\n", data);
-            fprintf(stderr, "  expected: no error\n");
-            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, handle);
-            fputc('\n', stderr);
-        });
-    }
+    // values derived from non-frozen data are not frozen
+    jsonlogic_thaw(data);
+    TEST_ASSERT(!jsonlogic_is_frozen(data));
+    jsonlogic_decref(data);
+    data = jsonlogic_parse("{\"name\":\"baz\"}", NULL);
+    actual = jsonlogic_apply(logic, data);
+    TEST_ASSERT(!jsonlogic_is_frozen(actual));
+
+    // references taken while frozen aren't counted, so release them before thawing
+    jsonlogic_program_free(program);
+    program = NULL;
+    jsonlogic_thaw(logic);
+    TEST_ASSERT(!jsonlogic_is_frozen(logic));
+    TEST_ASSERT(jsonlogic_get_refcount(logic) == 1);
+
+    // values frozen on their own may be shared, so they stay frozen when a
+    // value that contains them is thawed
+    jsonlogic_decref(actual);
+    jsonlogic_decref(expected);
+    expected = jsonlogic_parse("[\"shared\"]", NULL);
+    actual   = jsonlogic_array_from((JsonLogic_Handle[]){ expected }, 1);
+    jsonlogic_freeze(expected);
+    jsonlogic_freeze(actual);
+    jsonlogic_thaw(actual);
+    TEST_ASSERT(!jsonlogic_is_frozen(actual));
+    TEST_ASSERT(jsonlogic_is_frozen(expected));
+    TEST_ASSERT(jsonlogic_is_frozen(jsonlogic_get_index(expected, 0)));
+    jsonlogic_thaw(expected);
+    TEST_ASSERT(!jsonlogic_is_frozen(expected));
+    TEST_ASSERT(jsonlogic_get_refcount(expected) == 2);
 
 cleanup:
-    jsonlogic_decref(handle);
+    jsonlogic_program_free(program);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(data);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(expected);
 }
 
-void test_extras(TestContext *test_context) {
-    JsonLogic_Handle logic    = jsonlogic_parse("{\"zip\": [[1,2,3],[\"a\",\"b\"]]}", NULL);
-    JsonLogic_Handle expected = jsonlogic_parse("[[1,\"a\"],[2,\"b\"]]", NULL);
-    JsonLogic_Handle actual   = jsonlogic_apply_custom(logic, JsonLogic_Null, &JsonLogic_Extras);
+void test_immortal(TestContext *test_context) {
+    JsonLogic_Handle logic    = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    JsonLogic_Handle immortal = JsonLogic_Null;
+
+    // empty values are singletons
+    TEST_ASSERT(jsonlogic_empty_array()  == jsonlogic_empty_array());
+    TEST_ASSERT(jsonlogic_empty_object() == jsonlogic_empty_object());
+    TEST_ASSERT(jsonlogic_empty_string() == jsonlogic_empty_string());
+    TEST_ASSERT(jsonlogic_is_immortal(jsonlogic_empty_array()));
+    TEST_ASSERT(jsonlogic_is_immortal(jsonlogic_empty_object()));
+    TEST_ASSERT(jsonlogic_is_immortal(jsonlogic_empty_string()));
+
+    jsonlogic_thaw(jsonlogic_empty_array());
+    TEST_ASSERT(jsonlogic_is_frozen(jsonlogic_empty_array()));
+    TEST_ASSERT(jsonlogic_decref(jsonlogic_empty_array()) == jsonlogic_empty_array());
+
+    actual = jsonlogic_parse("[]", NULL);
+    TEST_ASSERT(actual == jsonlogic_empty_array());
+    actual = jsonlogic_parse("\"\"", NULL);
+    TEST_ASSERT(actual == jsonlogic_empty_string());
+    logic  = jsonlogic_parse("{\"filter\":[[1,2],{\">\":[{\"var\":\"\"},5]}]}", NULL);
+    actual = jsonlogic_apply(logic, JsonLogic_Null);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, jsonlogic_empty_array()));
+    jsonlogic_decref(actual);
+    actual = JsonLogic_Null;
 
-    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
-        fprintf(stderr, "     error: Wrong result\n");
-        fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
-        fprintf(stderr, "      data: "); jsonlogic_println(stderr, JsonLogic_Null);
-        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
-        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
-        fputc('\n', stderr);
-    });
+    immortal = jsonlogic_make_immortal(jsonlogic_string_from_latin1("immortal"));
+    TEST_ASSERT(JSONLOGIC_IS_STRING(immortal));
+    TEST_ASSERT(jsonlogic_is_immortal(immortal));
+    TEST_ASSERT(JSONLOGIC_CAST_STRING(immortal)->hash != JSONLOGIC_HASH_UNSET);
+    jsonlogic_thaw(immortal);
+    jsonlogic_decref(immortal);
+    TEST_ASSERT(jsonlogic_is_immortal(immortal));
 
     jsonlogic_decref(logic);
-    jsonlogic_decref(expected);
+    logic  = jsonlogic_parse("{\"cat\":[{\"var\":\"\"},\"!\"]}", NULL);
+    actual = jsonlogic_apply(logic, immortal);
+    TEST_ASSERT(!jsonlogic_is_frozen(actual));
+    TEST_ASSERT(JSONLOGIC_IS_STRING(actual));
+
+cleanup:
+    jsonlogic_decref(logic);
     jsonlogic_decref(actual);
+    // refcounting never frees immortal values, so release it by hand
+    if (JSONLOGIC_IS_STRING(immortal)) {
+        jsonlogic_free(JSONLOGIC_CAST_STRING(immortal));
+    }
+}
 
-    logic    = jsonlogic_parse("{\"combinations\": [[1,2,3],[\"a\",\"b\",\"c\"],[\"x\",\"y\",\"z\"]]}", NULL);
-    expected = jsonlogic_parse("[[1, \"a\", \"x\"], [1, \"a\", \"y\"], [1, \"a\", \"z\"], [1, \"b\", \"x\"], [1, \"b\", \"y\"], [1, \"b\", \"z\"], [1, \"c\", \"x\"], [1, \"c\", \"y\"], [1, \"c\", \"z\"], [2, \"a\", \"x\"], [2, \"a\", \"y\"], [2, \"a\", \"z\"], [2, \"b\", \"x\"], [2, \"b\", \"y\"], [2, \"b\", \"z\"], [2, \"c\", \"x\"], [2, \"c\", \"y\"], [2, \"c\", \"z\"], [3, \"a\", \"x\"], [3, \"a\", \"y\"], [3, \"a\", \"z\"], [3, \"b\", \"x\"], [3, \"b\", \"y\"], [3, \"b\", \"z\"], [3, \"c\", \"x\"], [3, \"c\", \"y\"], [3, \"c\", \"z\"]]", NULL);
-    actual   = jsonlogic_apply_custom(logic, JsonLogic_Null, &JsonLogic_Extras);
+static const char *ARENA_LOGIC =
+    "{\"cat\":["
+        "{\"reduce\":[{\"map\":[{\"var\":\"items\"},{\"*\":[{\"var\":\"\"},2]}]},"
+            "{\"+\":[{\"var\":\"current\"},{\"var\":\"accumulator\"}]},0]},"
+        "{\"missing\":[\"a\",\"b\",\"items\"]},"
+        "{\"filter\":[{\"var\":\"items\"},{\">\":[{\"var\":\"\"},3]}]},"
+        "{\"var\":[1]},\"a\",\"b\",\"c\",\"d\",\"e\",\"f\",\"g\","
+        "{\"inner\":[]}"
+    "]}";
+
+static JsonLogic_Handle arena_op_inner(void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc) {
+    JsonLogic_Handle logic  = jsonlogic_parse("{\"map\":[{\"var\":\"items\"},{\"cat\":[\"<\",{\"var\":\"\"},\">\"]}]}", NULL);
+    JsonLogic_Handle result = jsonlogic_apply_arena(logic, data, (JsonLogic_Arena*)context);
+    jsonlogic_decref(logic);
+    return result;
+}
 
-    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
-        fprintf(stderr, "     error: Wrong result\n");
-        fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
-        fprintf(stderr, "      data: "); jsonlogic_println(stderr, JsonLogic_Null);
-        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
-        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
-        fputc('\n', stderr);
-    });
+void test_arena(TestContext *test_context) {
+    JsonLogic_Arena *arena = jsonlogic_arena_new(64);
+    JsonLogic_Arena *inner_arena = jsonlogic_arena_new(0);
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_Program *program = NULL;
+    JsonLogic_Handle logic    = JsonLogic_Null;
+    JsonLogic_Handle data     = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+
+    TEST_ASSERT(arena != NULL);
+    TEST_ASSERT(inner_arena != NULL);
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_set(&ops, u"inner", inner_arena, arena_op_inner) == JSONLOGIC_ERROR_SUCCESS);
+
+    logic = jsonlogic_parse(ARENA_LOGIC, NULL);
+    data  = jsonlogic_parse("{\"items\":[1,2,3,4,5],\"1\":\"one\",\"a\":null}", NULL);
+    TEST_ASSERT(!jsonlogic_is_error(logic));
+    TEST_ASSERT(!jsonlogic_is_error(data));
+
+    expected = jsonlogic_apply_custom(logic, data, &ops);
+    TEST_ASSERT(jsonlogic_is_string(expected));
+
+    program = jsonlogic_compile(logic, &ops);
+    TEST_ASSERT(program != NULL);
+
+    // the arena is reused for every evaluation
+    for (int count = 0; count < 3; ++ count) {
+        actual = jsonlogic_apply_custom_arena(logic, data, &ops, arena);
+        TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
+        TEST_ASSERT(jsonlogic_get_refcount(actual) == 1);
+        jsonlogic_decref(actual);
+
+        actual = jsonlogic_program_apply_arena(program, data, arena);
+        TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
+        TEST_ASSERT(jsonlogic_get_refcount(actual) == 1);
+        jsonlogic_decref(actual);
+        actual = JsonLogic_Null;
+    }
+
+    // results that are part of the input are shared instead of copied
+    jsonlogic_decref(logic);
+    logic  = jsonlogic_parse("{\"if\":[true,{\"var\":\"items\"},null]}", NULL);
+    actual = jsonlogic_apply_arena(logic, data, arena);
+    TEST_ASSERT(actual == jsonlogic_get_utf16(data, u"items"));
+    TEST_ASSERT(jsonlogic_get_refcount(actual) == 3);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(actual);
+
+    // nested containers are copied out with the same content
+    jsonlogic_decref(logic);
+    logic  = jsonlogic_parse("{\"map\":[{\"var\":\"items\"},[{\"var\":\"\"},{\"cat\":[\"x\",{\"var\":\"\"}]}]]}", NULL);
+    jsonlogic_decref(expected);
+    expected = jsonlogic_parse("[[1,\"x1\"],[2,\"x2\"],[3,\"x3\"],[4,\"x4\"],[5,\"x5\"]]", NULL);
+    actual = jsonlogic_apply_arena(logic, data, arena);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
 
 cleanup:
+    jsonlogic_program_free(program);
+    jsonlogic_operations_free(&ops);
+    jsonlogic_arena_free(inner_arena);
+    jsonlogic_arena_free(arena);
     jsonlogic_decref(logic);
+    jsonlogic_decref(data);
     jsonlogic_decref(expected);
     jsonlogic_decref(actual);
 }
 
-const TestCase TEST_CASES[] = {
-    TEST_DECL("Unicode and JSON parsing", parsing),
-    TEST_DECL("Bad Operator", bad_operator),
-#if !defined(JSONLOGIC_WINDOWS)
-    TEST_DECL("Logging", logging),
-#endif
-    TEST_DECL("Edge Cases", edge_cases),
-    TEST_DECL("Expanding functionality with custom operators", custom_operators),
-    TEST_DECL("Control structures don't eval depth-first", short_circuit),
-    TEST_DECL("Sub-string of non-ASCII strings", substr),
-    TEST_DECL("Test extra operators", extras),
-    TEST_END,
+static const char *OPTIMIZE_TESTS[][2] = {
+    { "{\"+\":[1,2]}", "3" },
+    { "{\"cat\":[\"a\",{\"cat\":[\"b\",1]}]}", "\"ab1\"" },
+    { "{\"if\":[true,{\"var\":\"a\"},{\"var\":\"b\"}]}", "{\"var\":\"a\"}" },
+    { "{\"if\":[false,1,{\"var\":\"x\"},2,3]}", "{\"if\":[{\"var\":\"x\"},2,3]}" },
+    { "{\"if\":[{\"var\":\"x\"},1,{\"<\":[2,1]},2,{\"var\":\"y\"},3]}", "{\"if\":[{\"var\":\"x\"},1,{\"var\":\"y\"},3]}" },
+    { "{\"if\":[false,1]}", "null" },
+    { "{\"?:\":[0,1,2]}", "2" },
+    { "{\"and\":[true,{\"var\":\"a\"}]}", "{\"var\":\"a\"}" },
+    { "{\"and\":[{\"var\":\"a\"},false,{\"var\":\"b\"}]}", "{\"and\":[{\"var\":\"a\"},false]}" },
+    { "{\"and\":[{\"var\":\"a\"},{\"and\":[{\"var\":\"b\"},{\"var\":\"c\"}]}]}", "{\"and\":[{\"var\":\"a\"},{\"var\":\"b\"},{\"var\":\"c\"}]}" },
+    { "{\"or\":[{\"var\":\"a\"},0,{\"or\":[{\"var\":\"b\"},1,{\"var\":\"c\"}]}]}", "{\"or\":[{\"var\":\"a\"},{\"var\":\"b\"},1]}" },
+    { "{\"or\":[{\"var\":\"a\"},{\"and\":[]}]}", "{\"or\":[{\"var\":\"a\"},{\"and\":[]}]}" },
+    { "{\"map\":[[1,2],{\"*\":[2,3]}]}", "{\"map\":[[1,2],6]}" },
+    // the initial value of reduce isn't evaluated
+    { "{\"reduce\":[{\"var\":\"x\"},{\"+\":[1,2]},{\"+\":[1,2]}]}", "{\"reduce\":[{\"var\":\"x\"},3,{\"+\":[1,2]}]}" },
+    // arguments of unknown operations are never evaluated
+    { "{\"fubar\":[{\"+\":[1,2]}]}", "{\"fubar\":[{\"+\":[1,2]}]}" },
+    { "{\"merge\":[[1],[{\"var\":\"a\"}]]}", "{\"merge\":[[1],[{\"var\":\"a\"}]]}" },
+    { "{\"merge\":[[1],[2]]}", "[1,2]" },
+    { "[{\"+\":[1,2]},{\"var\":\"a\"}]", "[3,{\"var\":\"a\"}]" },
+    { NULL, NULL },
 };
 
-JsonLogic_Handle parse_file(const char *filename) {
-    FILE *fp = fopen(filename, "rb");
-    if (fp == NULL) {
-        perror(filename);
-        return JsonLogic_Error_IOError;
-    }
-
-    struct stat stbuf;
-    if (fstat(fileno(fp), &stbuf) != 0) {
-        fclose(fp);
-        perror(filename);
-        return JsonLogic_Error_IOError;
-    }
+static JsonLogic_Handle optimize_op_add(void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc) {
+    return jsonlogic_number_from(42);
+}
 
-    char *data = malloc(stbuf.st_size + 1);
-    if (data == NULL) {
-        fclose(fp);
-        perror(filename);
-        return JsonLogic_Error_OutOfMemory;
-    }
+void test_optimize(TestContext *test_context) {
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_Handle logic     = JsonLogic_Null;
+    JsonLogic_Handle expected  = JsonLogic_Null;
+    JsonLogic_Handle optimized = JsonLogic_Null;
+    JsonLogic_Handle data      = jsonlogic_parse("{\"a\":1,\"b\":0,\"c\":\"c\",\"x\":[1,2,3],\"y\":true}", NULL);
+
+    for (size_t index = 0; OPTIMIZE_TESTS[index][0] != NULL; ++ index) {
+        logic     = jsonlogic_parse(OPTIMIZE_TESTS[index][0], NULL);
+        expected  = jsonlogic_parse(OPTIMIZE_TESTS[index][1], NULL);
+        optimized = jsonlogic_optimize(logic, &JsonLogic_Builtins);
+
+        TEST_ASSERT_X(jsonlogic_deep_strict_equal(optimized, expected), {
+            fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, optimized);
+        });
 
-    if (fread(data, stbuf.st_size, 1, fp) != 1) {
-        free(data);
-        fclose(fp);
-        perror(filename);
-        return JsonLogic_Error_IOError;
+        // and still gives the same result
+        jsonlogic_decref(expected);
+        expected = jsonlogic_apply(logic, data);
+        JsonLogic_Handle actual = jsonlogic_apply(optimized, data);
+        bool same = jsonlogic_deep_strict_equal(actual, expected);
+        jsonlogic_decref(actual);
+        jsonlogic_decref(optimized);
+        optimized = JsonLogic_Null;
+        TEST_ASSERT(same);
+
+        jsonlogic_decref(logic);
+        jsonlogic_decref(expected);
+        logic    = JsonLogic_Null;
+        expected = JsonLogic_Null;
     }
 
-    data[stbuf.st_size] = 0;
+    // unchanged logic is shared
+    logic     = jsonlogic_parse("{\"==\":[{\"var\":\"a\"},1]}", NULL);
+    optimized = jsonlogic_optimize(logic, &JsonLogic_Builtins);
+    TEST_ASSERT(optimized == logic);
+    TEST_ASSERT(jsonlogic_get_refcount(logic) == 2);
+    jsonlogic_decref(optimized);
+    jsonlogic_decref(logic);
+    optimized = JsonLogic_Null;
+    logic     = JsonLogic_Null;
+
+    // operations with side effects aren't folded
+    logic     = jsonlogic_parse("{\"log\":{\"+\":[1,2]}}", NULL);
+    expected  = jsonlogic_parse("{\"log\":[3]}", NULL);
+    optimized = jsonlogic_optimize(logic, &JsonLogic_Builtins);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(optimized, expected));
+    jsonlogic_decref(optimized);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(logic);
+    optimized = JsonLogic_Null;
+    expected  = JsonLogic_Null;
 
-    fclose(fp);
+    // overridden operations aren't folded
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_set(&ops, u"+", NULL, optimize_op_add) == JSONLOGIC_ERROR_SUCCESS);
+    logic     = jsonlogic_parse("{\"+\":[1,2]}", NULL);
+    optimized = jsonlogic_optimize(logic, &ops);
+    TEST_ASSERT(optimized == logic);
+    jsonlogic_decref(optimized);
+    jsonlogic_decref(logic);
+    optimized = JsonLogic_Null;
+    logic     = JsonLogic_Null;
 
-    JsonLogic_LineInfo info = JSONLOGIC_LINEINFO_INIT;
-    JsonLogic_Handle handle = jsonlogic_parse(data, &info);
+    // custom operations flagged as pure are
+    TEST_ASSERT(jsonlogic_operations_build(&ops, (JsonLogic_Operations_BuildEntry[]) {
+        { u"answer", { .funct = optimize_op_add, .flags = JSONLOGIC_OPERATION_PURE } },
+        { u"random", { .funct = optimize_op_add, .flags = JSONLOGIC_OPERATION_NO_SIDE_EFFECTS | JSONLOGIC_OPERATION_IGNORES_DATA } },
+        { NULL,      { NULL, NULL } },
+    }) == JSONLOGIC_ERROR_SUCCESS);
+    logic     = jsonlogic_parse("[{\"answer\":[1,2]},{\"random\":[1,2]}]", NULL);
+    expected  = jsonlogic_parse("[42,{\"random\":[1,2]}]", NULL);
+    optimized = jsonlogic_optimize(logic, &ops);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(optimized, expected));
+    jsonlogic_decref(optimized);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(expected);
+    optimized = JsonLogic_Null;
+    logic     = JsonLogic_Null;
+    expected  = JsonLogic_Null;
+
+    // flags of the builtin tables
+    TEST_ASSERT(jsonlogic_operations_get(&JsonLogic_Builtins, u"+")->flags == JSONLOGIC_OPERATION_PURE);
+    // only the first two arguments are compared: {"==":[1,1,2]} but not {"==":[2,1,1]}
+    TEST_ASSERT(jsonlogic_operations_get(&JsonLogic_Builtins, u"===")->flags == JSONLOGIC_OPERATION_PURE);
+    TEST_ASSERT(!(jsonlogic_operations_get(&JsonLogic_Builtins, u"log")->flags & JSONLOGIC_OPERATION_NO_SIDE_EFFECTS));
+    TEST_ASSERT(!(jsonlogic_operations_get(&JsonLogic_Builtins, u"var")->flags & JSONLOGIC_OPERATION_IGNORES_DATA));
+    TEST_ASSERT(!(jsonlogic_operations_get(&JsonLogic_Extras, u"now")->flags & JSONLOGIC_OPERATION_DETERMINISTIC));
+    TEST_ASSERT(jsonlogic_operations_get(&JsonLogic_Extras, u"combinations")->flags & JSONLOGIC_OPERATION_EXPENSIVE);
+    TEST_ASSERT(jsonlogic_operations_get(&ops, u"!")->flags == JSONLOGIC_OPERATION_PURE);
+    TEST_ASSERT(jsonlogic_operations_get(&ops, u"+")->flags == 0);
+
+    // CertLogic has no "or" and an if with only one condition
+    logic     = jsonlogic_parse("{\"and\":[true,{\"or\":[{\"if\":[false,1,2,3]}]}]}", NULL);
+    expected  = jsonlogic_parse("{\"or\":[{\"if\":[false,1,2,3]}]}", NULL);
+    optimized = certlogic_optimize(logic, &CertLogic_Builtins);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(optimized, expected));
+    jsonlogic_decref(logic);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(optimized);
 
-    JsonLogic_Error error = jsonlogic_get_error(handle);
-    if (error != JSONLOGIC_ERROR_SUCCESS) {
-        jsonlogic_print_parse_error(stderr, data, error, info);
-        free(data);
-        return handle;
-    }
-    free(data);
+    logic     = jsonlogic_parse("{\"if\":[false,1,2,3]}", NULL);
+    optimized = certlogic_optimize(logic, &CertLogic_Builtins);
+    expected  = JsonLogic_Null;
+    TEST_ASSERT(jsonlogic_to_double(optimized) == 2);
 
-    return handle;
+cleanup:
+    jsonlogic_operations_free(&ops);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(data);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(optimized);
+}
+
+#define BATCH_SIZE 19
+
+void test_batch(TestContext *test_context) {
+    JsonLogic_Handle logic = JsonLogic_Null;
+    JsonLogic_Handle inputs [BATCH_SIZE];
+    JsonLogic_Handle results[BATCH_SIZE];
+    uint8_t bitmap[(BATCH_SIZE + 7) / 8 + 1];
+
+    for (size_t index = 0; index < BATCH_SIZE; ++ index) {
+        inputs [index] = JsonLogic_Null;
+        results[index] = JsonLogic_Null;
+    }
+
+    logic = jsonlogic_parse("{\"if\":[{\"<\":[{\"%\":[{\"var\":\"n\"},3]},1]},{\"var\":\"n\"},{\"var\":\"missing\"}]}", NULL);
+    for (size_t index = 0; index < BATCH_SIZE; ++ index) {
+        inputs[index] = jsonlogic_object_build_utf16(
+            { u"n", jsonlogic_number_from((double)index) },
+        );
+        TEST_ASSERT(jsonlogic_is_object(inputs[index]));
+    }
+
+    TEST_ASSERT(jsonlogic_apply_batch(logic, inputs, BATCH_SIZE, results, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    for (size_t index = 0; index < BATCH_SIZE; ++ index) {
+        JsonLogic_Handle expected = jsonlogic_apply(logic, inputs[index]);
+        bool same = jsonlogic_deep_strict_equal(results[index], expected);
+        jsonlogic_decref(expected);
+        TEST_ASSERT(same);
+    }
+
+    // bits past the end are left alone
+    bitmap[sizeof(bitmap) - 1] = 0xff;
+    TEST_ASSERT(jsonlogic_apply_batch_bitmap(logic, inputs, BATCH_SIZE, bitmap, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    for (size_t index = 0; index < BATCH_SIZE; ++ index) {
+        bool bit = (bitmap[index / 8] >> (index % 8)) & 1;
+        TEST_ASSERT(bit == (index % 3 == 0 && index != 0));
+    }
+    TEST_ASSERT(bitmap[BATCH_SIZE / 8] >> (BATCH_SIZE % 8) == 0);
+    TEST_ASSERT(bitmap[sizeof(bitmap) - 1] == 0xff);
+
+    // CertLogic truthiness
+    for (size_t index = 0; index < BATCH_SIZE; ++ index) {
+        jsonlogic_decref(results[index]);
+        results[index] = JsonLogic_Null;
+    }
+    jsonlogic_decref(logic);
+    logic = jsonlogic_parse("{\"var\":\"n\"}", NULL);
+    TEST_ASSERT(certlogic_apply_batch_bitmap(logic, inputs, BATCH_SIZE, bitmap, &CertLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    for (size_t index = 0; index < BATCH_SIZE; ++ index) {
+        bool bit = (bitmap[index / 8] >> (index % 8)) & 1;
+        TEST_ASSERT(bit == certlogic_to_bool(jsonlogic_number_from((double)index)));
+    }
+    TEST_ASSERT(certlogic_apply_batch(logic, inputs, BATCH_SIZE, results, &CertLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    for (size_t index = 0; index < BATCH_SIZE; ++ index) {
+        TEST_ASSERT(jsonlogic_to_double(results[index]) == (double)index);
+    }
+
+cleanup:
+    jsonlogic_decref(logic);
+    for (size_t index = 0; index < BATCH_SIZE; ++ index) {
+        jsonlogic_decref(inputs [index]);
+        jsonlogic_decref(results[index]);
+    }
+}
+
+static const char *COLUMNAR_TESTS[] = {
+    "{\"and\":[{\">\":[{\"var\":\"amount\"},100]},{\"==\":[{\"var\":\"country\"},\"AT\"]}]}",
+    "{\"or\":[{\"<=\":[10,{\"var\":\"amount\"},50]},{\"in\":[{\"var\":\"country\"},[\"DE\",\"CH\"]]}]}",
+    "{\"<\":[{\"+\":[{\"var\":\"amount\"},{\"*\":[{\"var\":\"tax\"},2]}]},{\"-\":[300,{\"var\":\"tax\"}]}]}",
+    "{\"===\":[{\"%\":[{\"var\":\"amount\"},7]},0]}",
+    "{\"<\":[{\"+\":[30,{\"var\":\"amount\"}]},50]}",
+    "{\">\":[{\"+\":[{\"*\":[{\"var\":\"amount\"},2]},1]},50]}",
+    "{\"<\":[{\"*\":[{\"-\":[{\"var\":\"amount\"},{\"var\":\"tax\"}]},3,{\"var\":\"tax\"}]},1000]}",
+    "{\"!=\":[{\"/\":[{\"var\":\"amount\"},{\"+\":[{\"var\":\"tax\"},1]}]},5]}",
+    "{\"!\":[{\"var\":\"active\"}]}",
+    "{\"!!\":[{\"-\":[{\"var\":\"amount\"},100]}]}",
+    "{\"!\":{\"var\":\"amount\"}}",
+    "{\"var\":\"country\"}",
+    "{\"var\":\"note\"}",
+    "{\"var\":[\"nope\",1]}",
+    "{\"var\":[\"note\",\"x\"]}",
+    "{\"if\":[{\"var\":\"active\"},{\">\":[{\"var\":\"amount\"},500]},{\"var\":\"country\"},{\"==\":[{\"var\":\"tax\"},0]},false]}",
+    "{\"==\":[{\"if\":[{\"var\":\"active\"},{\"var\":\"country\"},\"DE\"]},\"DE\"]}",
+    "{\"==\":[{\"or\":[{\"var\":\"note\"},{\"var\":\"country\"}]},\"AT\"]}",
+    "{\"==\":[{\"and\":[{\"var\":\"active\"},{\"var\":\"amount\"}]},0]}",
+    "{\"==\":[{\"cat\":[{\"var\":\"country\"},\"-\",{\"var\":\"active\"}]},\"AT-true\"]}",
+    "{\">\":[{\"var\":\"amount\"},\"100\"]}",
+    "{\"substr\":[{\"var\":\"note\"},1]}",
+    "{\"fubar\":[{\"var\":\"amount\"}]}",
+    // not supported by the columnar evaluator
+    "{\"var\":\"country.length\"}",
+    "{\"some\":[[1,2],{\"==\":[{\"var\":\"\"},2]}]}",
+    "{\"missing\":[\"note\"]}",
+    "{\"var\":\"\"}",
+    NULL,
+};
+
+#define COLUMNAR_ROWS 1000
+
+void test_columnar(TestContext *test_context) {
+    JsonLogic_Handle logic = JsonLogic_Null;
+    JsonLogic_Handle row   = JsonLogic_Null;
+    double   amount [COLUMNAR_ROWS];
+    double   tax    [COLUMNAR_ROWS];
+    bool     active [COLUMNAR_ROWS];
+    uint32_t country[COLUMNAR_ROWS];
+    uint32_t note   [COLUMNAR_ROWS];
+    uint8_t  bitmap [(COLUMNAR_ROWS + 7) / 8];
+    JsonLogic_Handle countries[] = {
+        jsonlogic_string_from_latin1("AT"),
+        jsonlogic_string_from_latin1("DE"),
+        jsonlogic_string_from_latin1("CH"),
+        jsonlogic_string_from_latin1(""),
+    };
+    JsonLogic_Handle notes[] = {
+        JsonLogic_Null,
+        jsonlogic_string_from_latin1("hello"),
+        jsonlogic_number_from(0),
+    };
+
+    for (size_t index = 0; index < COLUMNAR_ROWS; ++ index) {
+        amount [index] = index % 13 == 0 ? NAN : (double)((index * 37) % 1000) - 10.0;
+        tax    [index] = (double)(index % 5);
+        active [index] = index % 3 == 0;
+        country[index] = (uint32_t)((index * 7) % 4);
+        note   [index] = (uint32_t)(index % 3);
+    }
+
+    const JsonLogic_Column columns[] = {
+        { .name = u"amount",  .type = JsonLogic_Column_Number,     .numbers  = amount  },
+        { .name = u"tax",     .type = JsonLogic_Column_Number,     .numbers  = tax     },
+        { .name = u"active",  .type = JsonLogic_Column_Boolean,    .booleans = active  },
+        { .name = u"country", .type = JsonLogic_Column_Dictionary, .codes    = country, .dictionary = countries, .dictionary_size = 4 },
+        { .name = u"note",    .type = JsonLogic_Column_Dictionary, .codes    = note,    .dictionary = notes,     .dictionary_size = 3 },
+    };
+
+    // same results as applying the logic to one object per row
+    for (size_t test = 0; COLUMNAR_TESTS[test] != NULL; ++ test) {
+        logic = jsonlogic_parse(COLUMNAR_TESTS[test], NULL);
+        TEST_ASSERT(jsonlogic_apply_columnar(logic, columns, 5, COLUMNAR_ROWS, bitmap, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+
+        for (size_t index = 0; index < COLUMNAR_ROWS; ++ index) {
+            row = jsonlogic_object_build_utf16(
+                { u"amount",  jsonlogic_number_from(amount[index]) },
+                { u"tax",     jsonlogic_number_from(tax[index]) },
+                { u"active",  active[index] ? JsonLogic_True : JsonLogic_False },
+                { u"country", countries[country[index]] },
+                { u"note",    notes[note[index]] },
+            );
+            JsonLogic_Handle result = jsonlogic_apply(logic, row);
+            bool expected = jsonlogic_to_bool(result);
+            bool actual   = (bitmap[index / 8] >> (index % 8)) & 1;
+            jsonlogic_decref(result);
+            TEST_ASSERT_X(actual == expected, {
+                fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+                fprintf(stderr, "       row: "); jsonlogic_println(stderr, row);
+                fprintf(stderr, "  expected: %s\n", expected ? "true" : "false");
+                fprintf(stderr, "    actual: %s\n", actual   ? "true" : "false");
+            });
+            jsonlogic_decref(row);
+            row = JsonLogic_Null;
+        }
+
+        // bits past the last row are cleared
+        TEST_ASSERT(COLUMNAR_ROWS % 8 == 0 || bitmap[COLUMNAR_ROWS / 8] >> (COLUMNAR_ROWS % 8) == 0);
+
+        jsonlogic_decref(logic);
+        logic = JsonLogic_Null;
+    }
+
+cleanup:
+    jsonlogic_decref(logic);
+    jsonlogic_decref(row);
+    for (size_t index = 0; index < sizeof(countries) / sizeof(countries[0]); ++ index) {
+        jsonlogic_decref(countries[index]);
+    }
+    for (size_t index = 0; index < sizeof(notes) / sizeof(notes[0]); ++ index) {
+        jsonlogic_decref(notes[index]);
+    }
+}
+
+static const char *RULESET_RULES[] = {
+    "{\"+\":[{\"var\":\"a\"},{\"*\":[{\"var\":\"b\"},2]}]}",
+    "{\">\":[{\"+\":[{\"var\":\"a\"},{\"*\":[{\"var\":\"b\"},2]}]},10]}",
+    "{\"if\":[{\"var\":\"flag\"},{\"*\":[{\"var\":\"b\"},2]},{\"var\":\"a\"}]}",
+    "{\"some\":[{\"var\":\"list\"},{\">\":[{\"var\":\"\"},{\"var\":\"a\"}]}]}",
+    "{\"some\":[{\"var\":\"list\"},{\">\":[{\"var\":\"\"},{\"var\":\"a\"}]}]}",
+    "{\"/\":[1,0]}",
+    "{\"/\":[1,-0]}",
+    "{\"count\":[{\"var\":\"a\"}]}",
+    "{\"==\":[{\"count\":[{\"var\":\"a\"}]},1]}",
+    "{\"cat\":[{\"var\":\"name\"},\"-\",{\"missing\":[\"a\",\"zz\"]}]}",
+    "{\"missing\":[\"a\",\"zz\"]}",
+    "{\"reduce\":[{\"var\":\"list\"},{\"+\":[{\"var\":\"current\"},{\"var\":\"accumulator\"}]},0]}",
+    "{\"fubar\":[{\"var\":\"a\"}]}",
+    NULL,
+};
+
+#define RULESET_SIZE (sizeof(RULESET_RULES) / sizeof(RULESET_RULES[0]) - 1)
+
+static JsonLogic_Handle ruleset_op_count(void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc) {
+    ++ *(size_t*)context;
+    return jsonlogic_number_from((double)*(size_t*)context);
+}
+
+void test_ruleset(TestContext *test_context) {
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_RuleSet *ruleset = NULL;
+    JsonLogic_Handle rules  [RULESET_SIZE];
+    JsonLogic_Handle results[RULESET_SIZE];
+    JsonLogic_Handle input = JsonLogic_Null;
+    size_t count = 0;
+
+    for (size_t index = 0; index < RULESET_SIZE; ++ index) {
+        rules  [index] = jsonlogic_parse(RULESET_RULES[index], NULL);
+        results[index] = JsonLogic_Null;
+    }
+
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_set(&ops, u"count", &count, ruleset_op_count) == JSONLOGIC_ERROR_SUCCESS);
+
+    ruleset = jsonlogic_ruleset_compile(rules, RULESET_SIZE, &ops);
+    TEST_ASSERT(ruleset != NULL);
+    TEST_ASSERT(jsonlogic_ruleset_get_size(ruleset) == RULESET_SIZE);
+    // var a, var list, the *, the +, the some and the missing
+    TEST_ASSERT(jsonlogic_ruleset_get_shared_count(ruleset) == 6);
+
+    for (size_t step = 0; step < 4; ++ step) {
+        char json[128];
+        snprintf(json, sizeof(json), "{\"a\":%u,\"b\":%u,\"flag\":%s,\"name\":\"x\",\"list\":[1,5]}",
+            (unsigned)step * 3, (unsigned)step, step % 2 ? "true" : "false");
+        input = jsonlogic_parse(json, NULL);
+        TEST_ASSERT(jsonlogic_is_object(input));
+
+        // operations with side effects aren't shared
+        count = 0;
+        TEST_ASSERT(jsonlogic_ruleset_apply(ruleset, input, results) == JSONLOGIC_ERROR_SUCCESS);
+        TEST_ASSERT(count == 2);
+
+        for (size_t index = 0; index < RULESET_SIZE; ++ index) {
+            count = index == 8 ? 1 : 0;
+            JsonLogic_Handle expected = jsonlogic_apply_custom(rules[index], input, &ops);
+            TEST_ASSERT_X(jsonlogic_deep_strict_equal(results[index], expected), {
+                fprintf(stderr, "      rule: "); jsonlogic_println(stderr, rules[index]);
+                fprintf(stderr, "     input: "); jsonlogic_println(stderr, input);
+                fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                fprintf(stderr, "    actual: "); jsonlogic_println(stderr, results[index]);
+                jsonlogic_decref(expected);
+            });
+            jsonlogic_decref(expected);
+            jsonlogic_decref(results[index]);
+            results[index] = JsonLogic_Null;
+        }
+
+        jsonlogic_decref(input);
+        input = JsonLogic_Null;
+    }
+
+    // CertLogic semantics
+    jsonlogic_ruleset_free(ruleset);
+    ruleset = certlogic_ruleset_compile(rules, 3, &CertLogic_Builtins);
+    TEST_ASSERT(ruleset != NULL);
+    input = jsonlogic_parse("{\"a\":1,\"b\":[],\"flag\":[]}", NULL);
+    TEST_ASSERT(jsonlogic_ruleset_apply(ruleset, input, results) == JSONLOGIC_ERROR_SUCCESS);
+    for (size_t index = 0; index < 3; ++ index) {
+        JsonLogic_Handle expected = certlogic_apply(rules[index], input);
+        bool same = jsonlogic_deep_strict_equal(results[index], expected);
+        jsonlogic_decref(expected);
+        TEST_ASSERT(same);
+    }
+
+cleanup:
+    jsonlogic_ruleset_free(ruleset);
+    jsonlogic_operations_free(&ops);
+    jsonlogic_decref(input);
+    for (size_t index = 0; index < RULESET_SIZE; ++ index) {
+        jsonlogic_decref(rules  [index]);
+        jsonlogic_decref(results[index]);
+    }
+}
+
+static const char *RULESET_GUARDED_RULES[] = {
+    "{\"and\":[{\"===\":[{\"var\":\"type\"},\"v\"]},{\"count\":[]}]}",
+    "{\"and\":[{\"===\":[\"t\",{\"var\":[\"type\"]}]},{\"count\":[]}]}",
+    "{\"and\":[{\"in\":[{\"var\":\"country\"},[\"AT\",\"DE\"]]},{\"count\":[]}]}",
+    "{\"===\":[{\"var\":\"n\"},0]}",
+    "{\"and\":[{\"===\":[{\"var\":\"n\"},1]},{\"count\":[]},{\"var\":\"type\"}]}",
+    "{\"in\":[{\"var\":\"country\"},[]]}",
+    "{\"and\":[{\"===\":[{\"var\":\"type\"},null]},{\"count\":[]}]}",
+    "{\"and\":[{\"==\":[{\"var\":\"type\"},\"v\"]},{\"count\":[]}]}",
+    "{\"and\":[{\"===\":[{\"var\":\"payload.cert_type\"},\"v\"]},{\"count\":[]}]}",
+    "{\"and\":{\"===\":[{\"var\":\"type\"},\"t\"]}}",
+    NULL,
+};
+
+static const char *RULESET_GUARDED_INPUTS[] = {
+    "{\"type\":\"v\",\"country\":\"AT\",\"n\":0,\"payload\":{\"cert_type\":\"v\"}}",
+    "{\"type\":\"t\",\"country\":\"CH\",\"n\":-0}",
+    "{\"type\":\"x\",\"country\":\"DE\",\"n\":1}",
+    "{\"type\":[\"v\"],\"n\":\"0\"}",
+    "{}",
+    "null",
+    NULL,
+};
+
+#define RULESET_GUARDED_SIZE (sizeof(RULESET_GUARDED_RULES) / sizeof(RULESET_GUARDED_RULES[0]) - 1)
+
+// Rules that are skipped because of their guards have the same results as
+// evaluating them.
+void test_ruleset_index(TestContext *test_context) {
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_RuleSet *ruleset = NULL;
+    JsonLogic_Handle rules  [RULESET_GUARDED_SIZE];
+    JsonLogic_Handle results[RULESET_GUARDED_SIZE];
+    JsonLogic_Handle input = JsonLogic_Null;
+    size_t count = 0;
+
+    for (size_t index = 0; index < RULESET_GUARDED_SIZE; ++ index) {
+        rules  [index] = jsonlogic_parse(RULESET_GUARDED_RULES[index], NULL);
+        results[index] = JsonLogic_Null;
+    }
+
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_set(&ops, u"count", &count, ruleset_op_count) == JSONLOGIC_ERROR_SUCCESS);
+
+    ruleset = jsonlogic_ruleset_compile(rules, RULESET_GUARDED_SIZE, &ops);
+    TEST_ASSERT(ruleset != NULL);
+
+    for (size_t input_index = 0; RULESET_GUARDED_INPUTS[input_index] != NULL; ++ input_index) {
+        input = jsonlogic_parse(RULESET_GUARDED_INPUTS[input_index], NULL);
+        TEST_ASSERT(!jsonlogic_is_error(input));
+
+        count = 0;
+        TEST_ASSERT(jsonlogic_ruleset_apply(ruleset, input, results) == JSONLOGIC_ERROR_SUCCESS);
+        size_t ruleset_count = count;
+
+        count = 0;
+        for (size_t index = 0; index < RULESET_GUARDED_SIZE; ++ index) {
+            JsonLogic_Handle expected = jsonlogic_apply_custom(rules[index], input, &ops);
+            TEST_ASSERT_X(jsonlogic_deep_strict_equal(results[index], expected), {
+                fprintf(stderr, "      rule: "); jsonlogic_println(stderr, rules[index]);
+                fprintf(stderr, "     input: "); jsonlogic_println(stderr, input);
+                fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                fprintf(stderr, "    actual: "); jsonlogic_println(stderr, results[index]);
+                jsonlogic_decref(expected);
+            });
+            jsonlogic_decref(expected);
+            jsonlogic_decref(results[index]);
+            results[index] = JsonLogic_Null;
+        }
+        TEST_ASSERT(ruleset_count == count);
+
+        jsonlogic_decref(input);
+        input = JsonLogic_Null;
+    }
+
+cleanup:
+    jsonlogic_ruleset_free(ruleset);
+    jsonlogic_operations_free(&ops);
+    jsonlogic_decref(input);
+    for (size_t index = 0; index < RULESET_GUARDED_SIZE; ++ index) {
+        jsonlogic_decref(rules  [index]);
+        jsonlogic_decref(results[index]);
+    }
+}
+
+static const char *RULESET_BOOLEAN_RULES[] = {
+    "{\"and\":[{\"<\":[{\"var\":\"age\"},18]},{\"==\":[{\"var\":\"country\"},\"AT\"]}]}",
+    "{\"or\":[{\">=\":[{\"var\":\"age\"},65]},{\"!\":{\"<\":[{\"var\":\"age\"},18]}}]}",
+    "{\"and\":[{\"or\":[{\"<\":[{\"var\":\"age\"},18]},{\"===\":[{\"var\":\"vip\"},true]}]},{\"or\":[{\"<\":[{\"var\":[\"age\"]},18]},{\"!\":[{\"===\":[{\"var\":\"vip\"},true]}]}]}]}",
+    "{\"!\":{\"in\":[{\"var\":\"country\"},[\"AT\",\"DE\"]]}}",
+    "{\"or\":[{\"in\":[\"x\",{\"var\":\"tags\"}]},{\"!=\":[null,{\"var\":\"country\"}]}]}",
+    "{\"and\":[{\"<=\":[0,{\"var\":\"age\"}]},{\"!==\":[{\"var\":\"a.b\"},\"c\"]}]}",
+    "{\"<\":[{\"var\":\"age\"},18]}",
+    "{\"or\":[{\"<\":[{\"var\":\"age\"},18]},{\"+\":[1,2]}]}",
+    "{\"and\":[]}",
+    "{\"!\":[{\"<\":[{\"var\":\"age\"},18]},1]}",
+    "{\"<\":[{\"var\":[\"age\",0]},18]}",
+    NULL,
+};
+
+static const char *RULESET_BOOLEAN_INPUTS[] = {
+    "{\"age\":10,\"country\":\"AT\",\"vip\":true,\"tags\":[\"x\"],\"a\":{\"b\":\"c\"}}",
+    "{\"age\":70,\"country\":\"DE\",\"vip\":false}",
+    "{\"age\":\"30\",\"country\":null,\"tags\":\"xyz\"}",
+    "{\"age\":[17],\"vip\":\"true\",\"a\":{\"b\":\"d\"}}",
+    "{\"age\":null,\"a\":\"b\"}",
+    "{}",
+    "null",
+    NULL,
+};
+
+#define RULESET_BOOLEAN_SIZE (sizeof(RULESET_BOOLEAN_RULES) / sizeof(RULESET_BOOLEAN_RULES[0]) - 1)
+
+// Rules that are decided by the decision diagram have the same results as
+// evaluating them.
+void test_ruleset_diagram(TestContext *test_context) {
+    JsonLogic_RuleSet *ruleset = NULL;
+    JsonLogic_Handle rules  [RULESET_BOOLEAN_SIZE];
+    JsonLogic_Handle results[RULESET_BOOLEAN_SIZE];
+    JsonLogic_Handle input = JsonLogic_Null;
+
+    for (size_t index = 0; index < RULESET_BOOLEAN_SIZE; ++ index) {
+        rules  [index] = jsonlogic_parse(RULESET_BOOLEAN_RULES[index], NULL);
+        results[index] = JsonLogic_Null;
+    }
+
+    ruleset = jsonlogic_ruleset_compile(rules, RULESET_BOOLEAN_SIZE, &JsonLogic_Builtins);
+    TEST_ASSERT(ruleset != NULL);
+    TEST_ASSERT_X(jsonlogic_ruleset_get_diagram_size(ruleset) == 7, {
+        fprintf(stderr, "  diagram size: %zu\n", jsonlogic_ruleset_get_diagram_size(ruleset));
+    });
+
+    for (size_t input_index = 0; RULESET_BOOLEAN_INPUTS[input_index] != NULL; ++ input_index) {
+        input = jsonlogic_parse(RULESET_BOOLEAN_INPUTS[input_index], NULL);
+        TEST_ASSERT(!jsonlogic_is_error(input));
+
+        TEST_ASSERT(jsonlogic_ruleset_apply(ruleset, input, results) == JSONLOGIC_ERROR_SUCCESS);
+
+        for (size_t index = 0; index < RULESET_BOOLEAN_SIZE; ++ index) {
+            JsonLogic_Handle expected = jsonlogic_apply(rules[index], input);
+            TEST_ASSERT_X(jsonlogic_deep_strict_equal(results[index], expected), {
+                fprintf(stderr, "      rule: "); jsonlogic_println(stderr, rules[index]);
+                fprintf(stderr, "     input: "); jsonlogic_println(stderr, input);
+                fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                fprintf(stderr, "    actual: "); jsonlogic_println(stderr, results[index]);
+                jsonlogic_decref(expected);
+            });
+            jsonlogic_decref(expected);
+            jsonlogic_decref(results[index]);
+            results[index] = JsonLogic_Null;
+        }
+
+        jsonlogic_decref(input);
+        input = JsonLogic_Null;
+    }
+
+cleanup:
+    jsonlogic_ruleset_free(ruleset);
+    jsonlogic_decref(input);
+    for (size_t index = 0; index < RULESET_BOOLEAN_SIZE; ++ index) {
+        jsonlogic_decref(rules  [index]);
+        jsonlogic_decref(results[index]);
+    }
+}
+
+#define MAX_DEPTH_NESTING 10000
+
+// Nesting deeper than the C stack could handle and more arguments than fit
+// into the initial value stack.
+void test_max_depth(TestContext *test_context) {
+    JsonLogic_Handle logic  = JsonLogic_True;
+    JsonLogic_Handle result = JsonLogic_Null;
+
+    for (size_t index = 0; index < MAX_DEPTH_NESTING; ++ index) {
+        logic = jsonlogic_object_from_utf16_and_decref((JsonLogic_Object_Utf16Entry[]){
+            { .key = u"!", .value = logic },
+        }, 1);
+        TEST_ASSERT(!jsonlogic_is_error(logic));
+    }
+
+    result = jsonlogic_apply(logic, JsonLogic_Null);
+    TEST_ASSERT_X(result == JsonLogic_Error_RecursionError, {
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, result);
+    });
+
+    result = jsonlogic_apply_custom_max_depth(logic, JsonLogic_Null, &JsonLogic_Builtins, MAX_DEPTH_NESTING);
+    TEST_ASSERT_X(result == JsonLogic_True, {
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, result);
+    });
+
+    result = certlogic_apply_custom_max_depth(logic, JsonLogic_Null, &CertLogic_Builtins, MAX_DEPTH_NESTING - 1);
+    TEST_ASSERT_X(result == JsonLogic_Error_RecursionError, {
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, result);
+    });
+
+    jsonlogic_decref(logic);
+
+    // lambdas count as nesting too: map, map, + and var
+    logic = jsonlogic_parse("{\"map\":[[1,2],{\"map\":[[3],{\"+\":[{\"var\":\"\"},1]}]}]}", NULL);
+    TEST_ASSERT(!jsonlogic_is_error(logic));
+
+    result = jsonlogic_apply_custom_max_depth(logic, JsonLogic_Null, &JsonLogic_Builtins, 3);
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(result, JsonLogic_Error_RecursionError), {
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, result);
+    });
+    jsonlogic_decref(result);
+
+    result = jsonlogic_apply_custom_max_depth(logic, JsonLogic_Null, &JsonLogic_Builtins, 4);
+    TEST_ASSERT_X(jsonlogic_is_array(result), {
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, result);
+    });
+    jsonlogic_decref(result);
+    result = JsonLogic_Null;
+
+    jsonlogic_decref(logic);
+
+    logic = jsonlogic_parse(
+        "{\"+\":[1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,"
+        "1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,{\"var\":\"a\"},{\"var\":\"b\"}]}", NULL);
+    TEST_ASSERT(!jsonlogic_is_error(logic));
+
+    JsonLogic_Handle input = jsonlogic_parse("{\"a\":10,\"b\":20}", NULL);
+    result = jsonlogic_apply(logic, input);
+    jsonlogic_decref(input);
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(result, jsonlogic_number_from(100)), {
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, result);
+    });
+
+cleanup:
+    jsonlogic_decref(logic);
+    jsonlogic_decref(result);
+}
+
+// {"used":[]} is the number of bytes in use in the arena of the evaluation
+static JsonLogic_Handle arena_op_used(void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc) {
+    (void)context;
+    (void)data;
+    (void)args;
+    (void)argc;
+    return jsonlogic_number_from((double)jsonlogic_arena_used());
+}
+
+// The lambda of reduce reads accumulator and current without a context
+// object, so nothing is allocated from the arena while it is evaluated.
+void test_reduce_scope(TestContext *test_context) {
+    JsonLogic_Arena *arena = jsonlogic_arena_new(0);
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_Operations certlogic_ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_Program *program = NULL;
+    JsonLogic_Handle logic  = JsonLogic_Null;
+    JsonLogic_Handle data   = JsonLogic_Null;
+    JsonLogic_Handle actual = JsonLogic_Null;
+
+    TEST_ASSERT(arena != NULL);
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_extend(&certlogic_ops, &CertLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    const JsonLogic_Operations_BuildEntry used_op[] = {
+        { u"used", { .funct = arena_op_used, .flags = JSONLOGIC_OPERATION_IGNORES_DATA } },
+        { NULL,    { NULL, NULL } },
+    };
+    TEST_ASSERT(jsonlogic_operations_build(&ops, used_op) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_build(&certlogic_ops, used_op) == JSONLOGIC_ERROR_SUCCESS);
+
+    data  = jsonlogic_parse("{\"items\":[{\"x\":1},{\"x\":2},{\"x\":3}]}", NULL);
+    logic = jsonlogic_parse(
+        "{\"reduce\":[{\"var\":\"items\"},"
+            "{\"if\":[{\"used\":[]},\"allocated\",{\"+\":[{\"var\":\"accumulator\"},{\"var\":\"current.x\"}]}]},"
+        "0]}", NULL);
+    TEST_ASSERT(!jsonlogic_is_error(data));
+    TEST_ASSERT(!jsonlogic_is_error(logic));
+
+    actual = jsonlogic_apply_custom_arena(logic, data, &ops, arena);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, jsonlogic_number_from(6)));
+    jsonlogic_decref(actual);
+
+    actual = certlogic_apply_custom_arena(logic, data, &certlogic_ops, arena);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, jsonlogic_number_from(6)));
+    jsonlogic_decref(actual);
+
+    program = jsonlogic_compile(logic, &ops);
+    TEST_ASSERT(program != NULL);
+    actual = jsonlogic_program_apply_arena(program, data, arena);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, jsonlogic_number_from(6)));
+    jsonlogic_decref(actual);
+    jsonlogic_program_free(program);
+
+    program = certlogic_compile(logic, &certlogic_ops);
+    TEST_ASSERT(program != NULL);
+    actual = jsonlogic_program_apply_arena(program, data, arena);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, jsonlogic_number_from(6)));
+    jsonlogic_decref(actual);
+    jsonlogic_program_free(program);
+    program = NULL;
+
+    // reading the whole context still needs the object
+    jsonlogic_decref(logic);
+    logic = jsonlogic_parse(
+        "{\"reduce\":[{\"var\":\"items\"},"
+            "{\"if\":[{\"var\":\"\"},{\"used\":[]},0]},"
+        "0]}", NULL);
+    TEST_ASSERT(!jsonlogic_is_error(logic));
+
+    actual = jsonlogic_apply_custom_arena(logic, data, &ops, arena);
+    TEST_ASSERT(jsonlogic_is_number(actual) && jsonlogic_to_double(actual) > 0);
+    jsonlogic_decref(actual);
+
+    program = jsonlogic_compile(logic, &ops);
+    TEST_ASSERT(program != NULL);
+    actual = jsonlogic_program_apply_arena(program, data, arena);
+    TEST_ASSERT(jsonlogic_is_number(actual) && jsonlogic_to_double(actual) > 0);
+
+cleanup:
+    jsonlogic_program_free(program);
+    jsonlogic_operations_free(&ops);
+    jsonlogic_operations_free(&certlogic_ops);
+    jsonlogic_arena_free(arena);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(data);
+    jsonlogic_decref(actual);
+}
+
+// Errors of the items and of fused lambdas end up where they would without
+// fusion. Compiled programs don't fuse, so they are the reference.
+static const char *PIPELINE_ERROR_TESTS[] = {
+    "{\"map\":[{\"map\":[{\"var\":\"numbers\"},{\"nonsense\":[]}]},{\"var\":\"\"}]}",
+    "{\"map\":[{\"filter\":[{\"nonsense\":[]},true]},1]}",
+    "{\"reduce\":[{\"map\":[{\"nonsense\":[]},1]},{\"var\":\"current\"},\"init\"]}",
+    "{\"reduce\":[{\"map\":[{\"var\":\"numbers\"},{\"nonsense\":[]}]},{\"var\":\"current\"},0]}",
+    "{\"filter\":[{\"map\":[{\"var\":\"numbers\"},{\"if\":[{\">\":[{\"var\":\"\"},5]},{\"nonsense\":[]},{\"var\":\"\"}]}]},true]}",
+    "{\"some\":[{\"filter\":[{\"nonsense\":[]},true]},true]}",
+    "{\"some\":[{\"map\":[{\"var\":\"numbers\"},{\"nonsense\":[]}]},{\"var\":\"\"}]}",
+    "{\"all\":[{\"filter\":[{\"var\":\"numbers\"},{\"nonsense\":[]}]},{\"var\":\"\"}]}",
+    "{\"none\":[{\"map\":[{\"var\":\"numbers\"},{\"if\":[{\">\":[{\"var\":\"\"},5]},{\"nonsense\":[]},false]}]},{\"var\":\"\"}]}",
+    "{\"in\":[{\"nonsense\":[]},{\"map\":[{\"var\":\"numbers\"},1]}]}",
+    "{\"in\":[1,{\"map\":[{\"nonsense\":[]},1]}]}",
+    NULL,
+};
+
+// Chains of filter and map are evaluated element by element, so nothing is
+// allocated from the arena for the intermediate results. Compiled programs
+// still build the arrays.
+void test_pipeline(TestContext *test_context) {
+    JsonLogic_Arena *arena = jsonlogic_arena_new(0);
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_Program *program = NULL;
+    JsonLogic_Handle logic    = JsonLogic_Null;
+    JsonLogic_Handle data     = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+
+    TEST_ASSERT(arena != NULL);
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_build(&ops, (JsonLogic_Operations_BuildEntry[]) {
+        { u"used", { .funct = arena_op_used, .flags = JSONLOGIC_OPERATION_IGNORES_DATA } },
+        { NULL,    { NULL, NULL } },
+    }) == JSONLOGIC_ERROR_SUCCESS);
+
+    data  = jsonlogic_parse("{\"numbers\":[1,2,3,4,5,6,7,8,9,10]}", NULL);
+    logic = jsonlogic_parse(
+        "{\"reduce\":["
+            "{\"map\":[{\"filter\":[{\"var\":\"numbers\"},{\"%\":[{\"var\":\"\"},2]}]},{\"*\":[{\"var\":\"\"},10]}]},"
+            "{\"if\":[{\"used\":[]},\"allocated\",{\"+\":[{\"var\":\"accumulator\"},{\"var\":\"current\"}]}]},"
+        "0]}", NULL);
+    TEST_ASSERT(!jsonlogic_is_error(data));
+    TEST_ASSERT(!jsonlogic_is_error(logic));
+
+    actual = jsonlogic_apply_custom_arena(logic, data, &ops, arena);
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(actual, jsonlogic_number_from(250)), {
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+    });
+    jsonlogic_decref(actual);
+
+    program = jsonlogic_compile(logic, &ops);
+    TEST_ASSERT(program != NULL);
+    actual = jsonlogic_program_apply_arena(program, data, arena);
+    TEST_ASSERT(jsonlogic_is_string(actual));
+    jsonlogic_decref(actual);
+    jsonlogic_program_free(program);
+    program = NULL;
+
+    jsonlogic_decref(logic);
+    logic = jsonlogic_parse(
+        "{\"some\":["
+            "{\"filter\":[{\"map\":[{\"var\":\"numbers\"},{\"-\":[{\"var\":\"\"},5]}]},{\">\":[{\"var\":\"\"},0]}]},"
+            "{\"or\":[{\"used\":[]},{\"==\":[{\"var\":\"\"},10]}]}"
+        "]}", NULL);
+    TEST_ASSERT(!jsonlogic_is_error(logic));
+
+    actual = jsonlogic_apply_custom_arena(logic, data, &ops, arena);
+    TEST_ASSERT(actual == JsonLogic_False);
+
+    program = jsonlogic_compile(logic, &ops);
+    TEST_ASSERT(program != NULL);
+    actual = jsonlogic_program_apply_arena(program, data, arena);
+    TEST_ASSERT(actual == JsonLogic_True);
+    jsonlogic_program_free(program);
+    program = NULL;
+
+    for (size_t index = 0; PIPELINE_ERROR_TESTS[index] != NULL; ++ index) {
+        jsonlogic_decref(logic);
+        logic = jsonlogic_parse(PIPELINE_ERROR_TESTS[index], NULL);
+        TEST_ASSERT(!jsonlogic_is_error(logic));
+
+        program = jsonlogic_compile(logic, &JsonLogic_Builtins);
+        TEST_ASSERT(program != NULL);
+
+        actual   = jsonlogic_apply(logic, data);
+        expected = jsonlogic_program_apply(program, data);
+
+        TEST_ASSERT_X(jsonlogic_deep_strict_equal(actual, expected), {
+            fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        });
+
+        jsonlogic_program_free(program);
+        jsonlogic_decref(actual);
+        jsonlogic_decref(expected);
+        program  = NULL;
+        actual   = JsonLogic_Null;
+        expected = JsonLogic_Null;
+    }
+
+cleanup:
+    jsonlogic_program_free(program);
+    jsonlogic_operations_free(&ops);
+    jsonlogic_arena_free(arena);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(data);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(expected);
+}
+
+// {"coalesce":[a, b, ...]} is the value of the first argument that isn't null
+static JsonLogic_Handle lazy_op_coalesce(void *context, JsonLogic_Handle data, const JsonLogic_Handle args[], size_t argc, JsonLogic_Evaluator *evaluator) {
+    for (size_t index = 0; index < argc; ++ index) {
+        JsonLogic_Handle value = jsonlogic_evaluate(evaluator, args[index], data);
+        if (value != JsonLogic_Null) {
+            return value;
+        }
+    }
+    return JsonLogic_Null;
+}
+
+// {"try":[expr, fallback]} is the value of fallback if expr is an error
+static JsonLogic_Handle lazy_op_try(void *context, JsonLogic_Handle data, const JsonLogic_Handle args[], size_t argc, JsonLogic_Evaluator *evaluator) {
+    if (argc == 0) {
+        return JsonLogic_Null;
+    }
+    JsonLogic_Handle value = jsonlogic_evaluate(evaluator, args[0], data);
+    if (!jsonlogic_is_error(value) || argc < 2) {
+        return value;
+    }
+    return jsonlogic_evaluate(evaluator, args[1], data);
+}
+
+// {"switch":[[cond, value], ..., default]}
+static JsonLogic_Handle lazy_op_switch(void *context, JsonLogic_Handle data, const JsonLogic_Handle args[], size_t argc, JsonLogic_Evaluator *evaluator) {
+    for (size_t index = 0; index < argc; ++ index) {
+        if (!jsonlogic_is_array(args[index])) {
+            return jsonlogic_evaluate(evaluator, args[index], data);
+        }
+        JsonLogic_Handle cond = jsonlogic_get_index(args[index], 0);
+        JsonLogic_Handle cond_value = jsonlogic_evaluate(evaluator, cond, data);
+        bool match = jsonlogic_to_bool(cond_value);
+        jsonlogic_decref(cond_value);
+        jsonlogic_decref(cond);
+        if (match) {
+            JsonLogic_Handle value = jsonlogic_get_index(args[index], 1);
+            JsonLogic_Handle result = jsonlogic_evaluate(evaluator, value, data);
+            jsonlogic_decref(value);
+            return result;
+        }
+    }
+    return JsonLogic_Null;
+}
+
+// {"with":[data, expr]} evaluates expr with the value of data as data
+static JsonLogic_Handle lazy_op_with(void *context, JsonLogic_Handle data, const JsonLogic_Handle args[], size_t argc, JsonLogic_Evaluator *evaluator) {
+    if (argc < 2) {
+        return JsonLogic_Null;
+    }
+    JsonLogic_Handle inner = jsonlogic_evaluate(evaluator, args[0], data);
+    JsonLogic_Handle result = jsonlogic_evaluate(evaluator, args[1], inner);
+    jsonlogic_decref(inner);
+    return result;
+}
+
+static const char *LAZY_TESTS[][2] = {
+    { "{\"coalesce\":[{\"var\":\"a\"},{\"var\":\"b\"},{\"count\":[]}]}", "2" },
+    { "{\"coalesce\":[{\"var\":\"a\"},{\"var\":\"none\"}]}", "null" },
+    { "{\"coalesce\":[]}", "null" },
+    { "{\"try\":[{\"nonsense\":[]},{\"+\":[{\"var\":\"b\"},5]}]}", "7" },
+    { "{\"try\":[{\"var\":\"b\"},{\"count\":[]}]}", "2" },
+    { "{\"switch\":[[{\"==\":[{\"var\":\"b\"},1]},{\"count\":[]}],[{\"==\":[{\"var\":\"b\"},2]},\"two\"],{\"count\":[]}]}", "\"two\"" },
+    { "{\"switch\":[[false,{\"count\":[]}],\"other\"]}", "\"other\"" },
+    { "{\"map\":[[1,null,3],{\"coalesce\":[{\"var\":\"\"},0]}]}", "[1,0,3]" },
+    { "{\"if\":[{\"coalesce\":[{\"var\":\"a\"},false]},{\"count\":[]},\"no\"]}", "\"no\"" },
+    { "{\"with\":[{\"var\":\"c\"},{\"+\":[{\"var\":\"x\"},1]}]}", "11" },
+    { "{\"with\":[{\"var\":\"c\"},{\"coalesce\":[{\"var\":\"y\"},{\"var\":\"x\"}]}]}", "10" },
+    { "{\"coalesce\":[{\"try\":[{\"nonsense\":[]},null]},{\"try\":[{\"nonsense\":[]},{\"var\":\"b\"}]}]}", "2" },
+    { NULL, NULL },
+};
+
+// Lazy operations only evaluate the arguments they ask for. Arguments that
+// are evaluated would call count.
+void test_lazy_operations(TestContext *test_context) {
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_Handle logic    = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    JsonLogic_Handle compiled = JsonLogic_Null;
+    JsonLogic_Handle data     = jsonlogic_parse("{\"a\":null,\"b\":2,\"c\":{\"x\":10}}", NULL);
+    size_t count = 0;
+
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_set(&ops, u"count", &count, ruleset_op_count) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_set_lazy(&ops, u"coalesce", NULL, lazy_op_coalesce) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_set_lazy(&ops, u"try",      NULL, lazy_op_try)      == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_build(&ops, (JsonLogic_Operations_BuildEntry[]) {
+        { u"switch", { .lazy_funct = lazy_op_switch } },
+        { u"with",   { .lazy_funct = lazy_op_with   } },
+        { NULL,      { NULL, NULL } },
+    }) == JSONLOGIC_ERROR_SUCCESS);
+
+    for (size_t index = 0; LAZY_TESTS[index][0] != NULL; ++ index) {
+        logic    = jsonlogic_parse(LAZY_TESTS[index][0], NULL);
+        expected = jsonlogic_parse(LAZY_TESTS[index][1], NULL);
+        actual   = jsonlogic_apply_custom(logic, data, &ops);
+        compiled = apply_compiled(logic, data, &ops);
+
+        TEST_ASSERT_X(jsonlogic_deep_strict_equal(actual, expected) && jsonlogic_deep_strict_equal(compiled, expected), {
+            fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+            fprintf(stderr, "  compiled: "); jsonlogic_println(stderr, compiled);
+        });
+        TEST_ASSERT_FMT(count == 0, "count was called by %s", LAZY_TESTS[index][0]);
+
+        jsonlogic_decref(logic);
+        jsonlogic_decref(expected);
+        jsonlogic_decref(actual);
+        jsonlogic_decref(compiled);
+        logic    = JsonLogic_Null;
+        expected = JsonLogic_Null;
+        actual   = JsonLogic_Null;
+        compiled = JsonLogic_Null;
+    }
+
+    // nested lazy operations count towards the maximum nesting depth
+    logic  = jsonlogic_parse("{\"try\":[{\"try\":[{\"try\":[{\"try\":[1]}]}]},2]}", NULL);
+    actual = jsonlogic_apply_custom_max_depth(logic, data, &ops, 3);
+    TEST_ASSERT(jsonlogic_get_error(actual) == JSONLOGIC_ERROR_RECURSION_ERROR);
+    jsonlogic_decref(actual);
+    actual = jsonlogic_apply_custom_max_depth(logic, data, &ops, 4);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, jsonlogic_number_from(1)));
+
+    // the arguments are left as they are
+    jsonlogic_decref(actual);
+    actual = jsonlogic_optimize(logic, &ops);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, logic));
+
+cleanup:
+    jsonlogic_operations_free(&ops);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(data);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(compiled);
+}
+
+static JsonLogic_Handle memo_op_slow(void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc) {
+    ++ *(size_t*)context;
+    if (argc == 0) {
+        return JsonLogic_Error_IllegalArgument;
+    }
+    return jsonlogic_array_from((JsonLogic_Handle[]){ jsonlogic_incref(args[0]), jsonlogic_number_from(jsonlogic_to_double(args[0]) * 2) }, 2);
+}
+
+#define MEMO_MAX_SIZE 2048
+
+void test_memo(TestContext *test_context) {
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_Memo *memo = jsonlogic_memo_new(MEMO_MAX_SIZE);
+    JsonLogic_Handle logic    = JsonLogic_Null;
+    JsonLogic_Handle other    = JsonLogic_Null;
+    JsonLogic_Handle data     = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    size_t count = 0;
+
+    TEST_ASSERT(memo != NULL);
+    TEST_ASSERT(jsonlogic_memo_get_max_size(memo) == MEMO_MAX_SIZE);
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Extras) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_build(&ops, (JsonLogic_Operations_BuildEntry[]) {
+        { u"slow", { .context = &count, .funct = memo_op_slow, .flags = JSONLOGIC_OPERATION_PURE | JSONLOGIC_OPERATION_EXPENSIVE } },
+        { u"cheap", { .context = &count, .funct = memo_op_slow, .flags = JSONLOGIC_OPERATION_PURE } },
+        { NULL, { NULL, NULL } },
+    }) == JSONLOGIC_ERROR_SUCCESS);
+
+    logic    = jsonlogic_parse("{\"slow\":[{\"var\":\"x\"}]}", NULL);
+    data     = jsonlogic_parse("{\"x\":3}", NULL);
+    expected = jsonlogic_apply_custom(logic, data, &ops);
+    TEST_ASSERT(count == 1);
+
+    for (int index = 0; index < 3; ++ index) {
+        actual = jsonlogic_apply_custom_memo(logic, data, &ops, memo);
+        TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
+        jsonlogic_decref(actual);
+        actual = JsonLogic_Null;
+    }
+    TEST_ASSERT(count == 2);
+    TEST_ASSERT(jsonlogic_memo_get_misses(memo) == 1);
+    TEST_ASSERT(jsonlogic_memo_get_hits(memo) == 2);
+    TEST_ASSERT(jsonlogic_memo_get_size(memo) > 0);
+
+    // equal arguments hit the memo from other logic and other input, too
+    other  = jsonlogic_parse("{\"if\":[true,{\"slow\":[{\"+\":[{\"var\":\"y\"},1]}]},null]}", NULL);
+    jsonlogic_decref(data);
+    data   = jsonlogic_parse("{\"y\":2}", NULL);
+    actual = jsonlogic_apply_custom_memo(other, data, &ops, memo);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
+    TEST_ASSERT(count == 2);
+    TEST_ASSERT(jsonlogic_memo_get_hits(memo) == 3);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(other);
+    other = JsonLogic_Null;
+
+    // operations without JSONLOGIC_OPERATION_EXPENSIVE and errors aren't memoized
+    other  = jsonlogic_parse("[{\"cheap\":[1]},{\"cheap\":[1]},{\"slow\":[]},{\"slow\":[]}]", NULL);
+    actual = jsonlogic_apply_custom_memo(other, data, &ops, memo);
+    TEST_ASSERT(count == 6);
+    TEST_ASSERT(jsonlogic_memo_get_misses(memo) == 3);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(other);
+    other = JsonLogic_Null;
+
+    // 0 and -0 are different arguments
+    other  = jsonlogic_parse("[{\"slow\":[0]},{\"slow\":[-0]}]", NULL);
+    actual = jsonlogic_apply_custom_memo(other, data, &ops, memo);
+    TEST_ASSERT(count == 8);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(other);
+    other = JsonLogic_Null;
+
+    // the least recently used results are dropped to stay within the limit
+    jsonlogic_decref(data);
+    data = JsonLogic_Null;
+    for (int index = 0; index < 100; ++ index) {
+        data   = jsonlogic_array_from((JsonLogic_Handle[]){ jsonlogic_number_from(100 + index) }, 1);
+        other  = jsonlogic_parse("{\"slow\":[{\"var\":0}]}", NULL);
+        actual = jsonlogic_apply_custom_memo(other, data, &ops, memo);
+        TEST_ASSERT(jsonlogic_memo_get_size(memo) <= MEMO_MAX_SIZE);
+        jsonlogic_decref(actual);
+        jsonlogic_decref(other);
+        jsonlogic_decref(data);
+        actual = JsonLogic_Null;
+        other  = JsonLogic_Null;
+        data   = JsonLogic_Null;
+    }
+    TEST_ASSERT(count == 108);
+
+    // the most recent result is still there, the first one isn't
+    other  = jsonlogic_parse("[{\"slow\":[199]},{\"slow\":[3]}]", NULL);
+    actual = jsonlogic_apply_custom_memo(other, JsonLogic_Null, &ops, memo);
+    TEST_ASSERT(count == 109);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(other);
+    other = JsonLogic_Null;
+
+    jsonlogic_memo_clear(memo);
+    TEST_ASSERT(jsonlogic_memo_get_size(memo) == 0);
+    actual = jsonlogic_apply_custom_memo(logic, JsonLogic_Null, &ops, memo);
+    TEST_ASSERT(count == 110);
+    jsonlogic_decref(actual);
+
+    // expensive operations of the extras
+    jsonlogic_decref(logic);
+    jsonlogic_decref(expected);
+    logic    = jsonlogic_parse("{\"zip\":[[1,2],[\"a\",\"b\"]]}", NULL);
+    expected = jsonlogic_parse("[[1,\"a\"],[2,\"b\"]]", NULL);
+    size_t hits = jsonlogic_memo_get_hits(memo);
+    for (int index = 0; index < 2; ++ index) {
+        actual = jsonlogic_apply_custom_memo(logic, JsonLogic_Null, &JsonLogic_Extras, memo);
+        TEST_ASSERT(jsonlogic_deep_strict_equal(actual, expected));
+        jsonlogic_decref(actual);
+        actual = JsonLogic_Null;
+    }
+    TEST_ASSERT(jsonlogic_memo_get_hits(memo) == hits + 1);
+
+cleanup:
+    jsonlogic_memo_free(memo);
+    jsonlogic_operations_free(&ops);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(other);
+    jsonlogic_decref(data);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(actual);
+}
+
+static const char *PARALLEL_TESTS[] = {
+    "{\"map\":[{\"var\":\"items\"},{\"*\":[{\"var\":\"\"},2]}]}",
+    "{\"filter\":[{\"var\":\"items\"},{\"==\":[{\"%\":[{\"var\":\"\"},3]},0]}]}",
+    "{\"all\":[{\"var\":\"items\"},{\">=\":[{\"var\":\"\"},0]}]}",
+    "{\"all\":[{\"var\":\"items\"},{\"<\":[{\"var\":\"\"},500]}]}",
+    "{\"some\":[{\"var\":\"items\"},{\"===\":[{\"var\":\"\"},999]}]}",
+    "{\"some\":[{\"var\":\"items\"},{\"<\":[{\"var\":\"\"},0]}]}",
+    "{\"none\":[{\"var\":\"items\"},{\">\":[{\"var\":\"\"},1000]}]}",
+    "{\"none\":[{\"var\":\"items\"},{\"==\":[{\"var\":\"\"},10]}]}",
+    "{\"map\":[{\"var\":\"words\"},{\"cat\":[{\"var\":\"\"},\"!\"]}]}",
+    "{\"filter\":[{\"var\":\"words\"},{\"in\":[\"99\",{\"var\":\"\"}]}]}",
+    "{\"map\":[{\"var\":\"pairs\"},{\"reduce\":[{\"var\":\"\"},{\"+\":[{\"var\":\"current\"},{\"var\":\"accumulator\"}]},0]}]}",
+    "{\"map\":[{\"var\":\"pairs\"},{\"map\":[{\"var\":\"\"},{\"if\":[{\">\":[{\"var\":\"\"},500]},\"big\",{\"var\":\"\"}]}]}]}",
+    "{\"map\":[{\"var\":\"items\"},{\"missing\":[\"a\"]}]}",
+    "{\"map\":[{\"var\":\"items\"}]}",
+    "{\"map\":[{\"var\":\"few\"},{\"+\":[{\"var\":\"\"},1]}]}",
+    "{\"all\":[[],{\"var\":\"\"}]}",
+    NULL,
+};
+
+#define PARALLEL_ITEMS 1000
+
+void test_parallel(TestContext *test_context) {
+    JsonLogic_Handle logic  = JsonLogic_Null;
+    JsonLogic_Handle input  = JsonLogic_Null;
+    JsonLogic_Handle actual = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_Handle items[PARALLEL_ITEMS];
+    JsonLogic_Handle words[PARALLEL_ITEMS];
+    JsonLogic_Handle pairs[PARALLEL_ITEMS];
+    size_t item_count = 0;
+    JsonLogic_ThreadPool *pool = NULL;
+
+    for (; item_count < PARALLEL_ITEMS; ++ item_count) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "word%zu", item_count);
+        items[item_count] = jsonlogic_number_from((double)item_count);
+        words[item_count] = jsonlogic_string_from_latin1(buf);
+        pairs[item_count] = jsonlogic_array_from((JsonLogic_Handle[]){
+            items[item_count],
+            jsonlogic_number_from((double)(PARALLEL_ITEMS - item_count)),
+        }, 2);
+    }
+
+    input = jsonlogic_object_build_utf16_and_decref(
+        { u"items", jsonlogic_array_from(items, item_count) },
+        { u"words", jsonlogic_array_from_and_decref(words, item_count) },
+        { u"pairs", jsonlogic_array_from_and_decref(pairs, item_count) },
+        { u"few",   jsonlogic_array_from(items, 8) },
+    );
+    item_count = 0;
+    TEST_ASSERT(!jsonlogic_is_error(input));
+
+    pool = jsonlogic_thread_pool_new(4, 16);
+    TEST_ASSERT(pool != NULL);
+    TEST_ASSERT(jsonlogic_thread_pool_get_thread_count(pool) == 4);
+    TEST_ASSERT(jsonlogic_thread_pool_get_min_items(pool) == 16);
+
+    // unfrozen values are evaluated on the calling thread
+    for (int frozen = 0; frozen < 2; ++ frozen) {
+        if (frozen) {
+            jsonlogic_freeze(input);
+        }
+
+        for (size_t index = 0; PARALLEL_TESTS[index] != NULL; ++ index) {
+            logic = jsonlogic_parse(PARALLEL_TESTS[index], NULL);
+            TEST_ASSERT(!jsonlogic_is_error(logic));
+            if (frozen) {
+                jsonlogic_freeze(logic);
+            }
+
+            expected = jsonlogic_apply(logic, input);
+            actual   = jsonlogic_apply_parallel(logic, input, pool);
+
+            TEST_ASSERT_X(jsonlogic_deep_strict_equal(actual, expected), {
+                fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+                fprintf(stderr, "    frozen: %s\n", frozen ? "true" : "false");
+                fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+            });
+
+            jsonlogic_decref(actual);
+            jsonlogic_decref(expected);
+            actual   = JsonLogic_Null;
+            expected = JsonLogic_Null;
+
+            jsonlogic_thaw(logic);
+            jsonlogic_decref(logic);
+            logic = JsonLogic_Null;
+        }
+    }
+
+cleanup:
+    for (size_t index = 0; index < item_count; ++ index) {
+        jsonlogic_decref(words[index]);
+        jsonlogic_decref(pairs[index]);
+    }
+    jsonlogic_thread_pool_free(pool);
+    jsonlogic_thaw(logic);
+    jsonlogic_decref(logic);
+    jsonlogic_thaw(input);
+    jsonlogic_decref(input);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(expected);
+}
+
+static const char *VAR_PATH_TESTS[] = {
+    "{\"var\":\"payload.v.0.dt\"}",
+    "{\"var\":[\"payload.v.1.dt\",\"none\"]}",
+    "{\"var\":[\"payload.v.x\",{\"var\":\"a\"}]}",
+    "{\"var\":\"payload.v.length\"}",
+    "{\"var\":\"payload.s.length\"}",
+    "{\"var\":\"payload.s.1\"}",
+    "{\"var\":\"payload.\"}",
+    "{\"var\":\".\"}",
+    "{\"var\":\"a..b\"}",
+    "{\"var\":\"list.\"}",
+    "{\"var\":[\"\",1]}",
+    "{\"var\":[null,1]}",
+    "{\"var\":[1,\"default\"]}",
+    "{\"var\":1.5}",
+    "{\"var\":\"x.y\"}",
+    "{\"var\":[\"a\",1,2]}",
+    "{\"missing\":[\"a\",\"b\",\"payload.v.0.dt\",\"payload.v.1.dt\",\"e\",0]}",
+    "{\"missing\":[[\"a\",\"x\"],\"y\"]}",
+    "{\"missing\":[]}",
+    "{\"missing_some\":[1,[\"a\",\"x\"]]}",
+    "{\"missing_some\":[2,[\"a\",\"x\",\"y\"]]}",
+    "{\"missing_some\":[1,\"x\"]}",
+    "{\"missing_some\":[1]}",
+    NULL,
+};
+
+static JsonLogic_Handle var_path_op_var(void *context, JsonLogic_Handle data, JsonLogic_Handle args[], size_t argc) {
+    return jsonlogic_number_from(42);
+}
+
+void test_var_paths(TestContext *test_context) {
+    JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
+    JsonLogic_Handle logic    = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    JsonLogic_Handle data     = jsonlogic_parse(
+        "{\"a\":1,\"e\":\"\",\"\":{\"\":\"empty\"},\"list\":[5],"
+        "\"payload\":{\"v\":[{\"dt\":\"2021-05-29\"}],\"s\":\"abc\"}}", NULL);
+
+    // compiled paths give the same results as the interpreter
+    for (size_t index = 0; VAR_PATH_TESTS[index] != NULL; ++ index) {
+        logic    = jsonlogic_parse(VAR_PATH_TESTS[index], NULL);
+        expected = jsonlogic_apply(logic, data);
+        actual   = apply_compiled(logic, data, &JsonLogic_Builtins);
+
+        TEST_ASSERT_X(jsonlogic_deep_strict_equal(actual, expected), {
+            fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        });
+
+        jsonlogic_decref(logic);
+        jsonlogic_decref(expected);
+        jsonlogic_decref(actual);
+        logic    = JsonLogic_Null;
+        expected = JsonLogic_Null;
+        actual   = JsonLogic_Null;
+    }
+
+    // an overridden var is still called
+    TEST_ASSERT(jsonlogic_operations_extend(&ops, &JsonLogic_Builtins) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_operations_set(&ops, u"var", NULL, var_path_op_var) == JSONLOGIC_ERROR_SUCCESS);
+    logic  = jsonlogic_parse("{\"var\":\"a\"}", NULL);
+    actual = apply_compiled(logic, data, &ops);
+    TEST_ASSERT(jsonlogic_to_double(actual) == 42);
+
+cleanup:
+    jsonlogic_operations_free(&ops);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(data);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(actual);
+}
+
+void test_substr(TestContext *test_context) {
+    JsonLogic_Handle logic    = jsonlogic_parse("{\"substr\": [\"äöü\", 0, -2]}", NULL);
+    JsonLogic_Handle expected = jsonlogic_string_from_utf16(u"ä");
+    JsonLogic_Handle actual   = jsonlogic_apply(logic, JsonLogic_Null);
+
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
+        fprintf(stderr, "     error: Wrong result\n");
+        fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+        fprintf(stderr, "      data: "); jsonlogic_println(stderr, JsonLogic_Null);
+        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        fputc('\n', stderr);
+    });
+
+    jsonlogic_decref(actual);
+    jsonlogic_decref(logic);
+    jsonlogic_decref(expected);
+
+    logic    = jsonlogic_parse("{\"substr\": [\"\\uD80C\\uDC00\", 1]}", NULL);
+    expected = jsonlogic_string_from_utf16((char16_t[]){ 0xdc00, 0 });
+    actual   = jsonlogic_apply(logic, JsonLogic_Null);
+
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
+        fprintf(stderr, "     error: Wrong result\n");
+        fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+        fprintf(stderr, "      data: "); jsonlogic_println(stderr, JsonLogic_Null);
+        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        fputc('\n', stderr);
+    });
+
+cleanup:
+    jsonlogic_decref(logic);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(actual);
+}
+
+const char *JSON_SYNTAX_ERROR[] = {
+    "{\"foo\": \"bar\" \"a\":\"b\"}",
+    "[]]",
+    "\"\\j\"",
+    "\"\\u123g\"",
+    "\"foo",
+    "\"foo\",",
+    "[,]",
+    "[123,]",
+    "{,}",
+    "{\"foo\":123,}",
+    "{\"foo\":}",
+    "{\"foo\":,}",
+    "{123:123}",
+    NULL
+};
+
+const char *VALID_JSON[] = {
+    "0",
+    "123",
+    "123.456",
+    "1.2e12",
+    "[]",
+    "{}",
+    "true",
+    "false",
+    "null",
+    "\"\"",
+    NULL
+};
+
+void test_parsing(TestContext *test_context) {
+    const char *data = NULL;
+    JsonLogic_Handle handle = JsonLogic_Null;
+
+    data = "\"\xb0\"";
+    jsonlogic_decref(handle);
+    handle = jsonlogic_parse(data, NULL);
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(handle, JsonLogic_Error_UnicodeError), {
+        fprintf(stderr, "     error: Wrong result\n");
+        fprintf(stderr, "      data: %s\n", data);
+        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, JsonLogic_Error_UnicodeError);
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, handle);
+        fputc('\n', stderr);
+    });
+
+    for (const char **ptr = JSON_SYNTAX_ERROR; *ptr; ++ ptr) {
+        data = *ptr;
+        jsonlogic_decref(handle);
+        handle = jsonlogic_parse(data, NULL);
+        TEST_ASSERT_X(jsonlogic_deep_strict_equal(handle, JsonLogic_Error_SyntaxError), {
+            fprintf(stderr, "     error: Wrong result\n");
+            fprintf(stderr, "      data: %s\n", data);
+            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, JsonLogic_Error_SyntaxError);
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, handle);
+            fputc('\n', stderr);
+        });
+    }
+
+    for (const char **ptr = VALID_JSON; *ptr; ++ ptr) {
+        data = *ptr;
+        jsonlogic_decref(handle);
+        handle = jsonlogic_parse(data, NULL);
+        TEST_ASSERT_X(jsonlogic_get_error(handle) == JSONLOGIC_ERROR_SUCCESS, {
+            fprintf(stderr, "     error: Wrong result\n");
+            fprintf(stderr, "      data: %s\n", data);
+            fprintf(stderr, "  expected: no error\n");
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, handle);
+            fputc('\n', stderr);
+        });
+    }
+
+cleanup:
+    jsonlogic_decref(handle);
+}
+
+// suffixes that end the run of plain ASCII that is scanned in blocks
+static const char *SCAN_SUFFIXES[][2] = {
+    { "\"",                   ""             },
+    { "\\n\"",                "\n"           },
+    { "\\u00e9x\"",           "\xc3\xa9x"    },
+    { "\xc3\xa9\"",           "\xc3\xa9"     },
+    { "\xf0\x9f\x98\x80 \"",  "\xf0\x9f\x98\x80 " },
+    { NULL, NULL },
+};
+
+#define SCAN_MAX_RUN 200
+
+void test_parsing_blocks(TestContext *test_context) {
+    char json[SCAN_MAX_RUN * 3 + 32];
+    char utf8[SCAN_MAX_RUN + 16];
+    JsonLogic_Handle handle   = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_LineInfo info;
+
+    for (size_t run = 0; run <= SCAN_MAX_RUN; ++ run) {
+        // strings with runs of plain ASCII of every length
+        for (size_t index = 0; SCAN_SUFFIXES[index][0] != NULL; ++ index) {
+            json[0] = '"';
+            memset(json + 1, 'a' + (char)(run % 26), run);
+            size_t size = 1 + run;
+            size_t suffix_size = strlen(SCAN_SUFFIXES[index][0]);
+            memcpy(json + size, SCAN_SUFFIXES[index][0], suffix_size);
+            size += suffix_size;
+
+            memset(utf8, 'a' + (char)(run % 26), run);
+            size_t utf8_size = strlen(SCAN_SUFFIXES[index][1]);
+            memcpy(utf8 + run, SCAN_SUFFIXES[index][1], utf8_size);
+
+            handle   = jsonlogic_parse_sized(json, size, NULL);
+            expected = jsonlogic_string_from_utf8_sized(utf8, run + utf8_size);
+            TEST_ASSERT_FMT(jsonlogic_deep_strict_equal(handle, expected), "string run of %zu followed by %s", run, SCAN_SUFFIXES[index][0]);
+            jsonlogic_decref(handle);
+            jsonlogic_decref(expected);
+            handle   = JsonLogic_Null;
+            expected = JsonLogic_Null;
+
+            // unterminated
+            handle = jsonlogic_parse_sized(json, size - 1, &info);
+            TEST_ASSERT_FMT(handle == JsonLogic_Error_SyntaxError && info.index == size - 1, "unterminated string run of %zu followed by %s", run, SCAN_SUFFIXES[index][0]);
+        }
+
+        // control characters end a string run with an error after them
+        json[0] = '"';
+        memset(json + 1, 'x', run);
+        json[run + 1] = '\t';
+        json[run + 2] = '"';
+        handle = jsonlogic_parse_sized(json, run + 3, &info);
+        TEST_ASSERT_FMT(handle == JsonLogic_Error_SyntaxError && info.index == run + 2, "control character after %zu bytes", run);
+
+        // runs of whitespace of every length
+        memset(json, ' ', run);
+        for (size_t index = 0; index < run; index += 7) {
+            json[index] = "\n\r\t "[index % 4];
+        }
+        memcpy(json + run, "[1,", 3);
+        memset(json + run + 3, '\n', run);
+        memcpy(json + run * 2 + 3, "2 ]", 3);
+        memset(json + run * 2 + 6, '\t', run);
+
+        handle   = jsonlogic_parse_sized(json, run * 3 + 6, NULL);
+        expected = jsonlogic_array_from((JsonLogic_Handle[]){ jsonlogic_number_from(1), jsonlogic_number_from(2) }, 2);
+        TEST_ASSERT_FMT(jsonlogic_deep_strict_equal(handle, expected), "whitespace run of %zu", run);
+        jsonlogic_decref(handle);
+        jsonlogic_decref(expected);
+        handle   = JsonLogic_Null;
+        expected = JsonLogic_Null;
+
+        handle = jsonlogic_parse_sized(json, run * 2 + 3, &info);
+        TEST_ASSERT_FMT(handle == JsonLogic_Error_SyntaxError && info.index == run * 2 + 3, "whitespace run of %zu before the end", run);
+    }
+
+cleanup:
+    jsonlogic_decref(handle);
+    jsonlogic_decref(expected);
+}
+
+static const char *PUSH_PARSER_TESTS[] = {
+    "{\"a\": [1, -2.5e+3, 0, true, false, null], \"b\\u00e9\\\"\": {\"c\": \"x\\\\y\\n\\ud83d\\ude00\"}}",
+    "  \n[\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\", 123456789012345678901234567890, {}, [], \"\"]\n\t ",
+    "12.5e-7",
+    "\"\\\\\\\"\"",
+    "[1,\n2,\n\"a\" \"b\"]",
+    "[1\"a\"]",
+    "[1-2]",
+    "{\"a\":1\"b\":2}",
+    "nul",
+    "[tru]",
+    "[falsy]",
+    "\"\\x\"",
+    "\"\xb0\"",
+    // invalid UTF-8: a lead byte takes the bytes after it, even a quote
+    "[\"abcdef\xf3\", 1]",
+    "[\"a\xc3\", \"b\"]",
+    "[\"\xe2\x82\", 1]",
+    "[\"\xf0\x9f\x98\", \"x\"]",
+    "[\"\xbf\", 1]",
+    "[\"\xf8\", 1]",
+    "\"\\\xc3\xa9\"",
+    "[1,\n\"\n\"]",
+    "{\"a\":{\"b\":[1,2,{\"c\":null}]}} x",
+    "",
+    NULL,
+};
+
+// tests/*.json fed in chunks of these sizes
+static const char *PUSH_PARSER_FILES[] = {
+    "tests/rule.json",
+    "tests/valid.json",
+    "tests/invalid.json",
+    NULL,
+};
+
+static const size_t PUSH_PARSER_CHUNK_SIZES[] = { 1, 3, 7, 0 };
+
+static char *read_file(const char *filename, size_t *sizeptr) {
+    FILE *fp = fopen(filename, "rb");
+    if (fp == NULL) {
+        perror(filename);
+        return NULL;
+    }
+
+    struct stat stbuf;
+    if (fstat(fileno(fp), &stbuf) != 0) {
+        fclose(fp);
+        perror(filename);
+        return NULL;
+    }
+
+    char *data = malloc(stbuf.st_size + 1);
+    if (data == NULL) {
+        fclose(fp);
+        perror(filename);
+        return NULL;
+    }
+
+    if (stbuf.st_size > 0 && fread(data, stbuf.st_size, 1, fp) != 1) {
+        free(data);
+        fclose(fp);
+        perror(filename);
+        return NULL;
+    }
+
+    data[stbuf.st_size] = 0;
+
+    fclose(fp);
+
+    if (sizeptr != NULL) {
+        *sizeptr = stbuf.st_size;
+    }
+
+    return data;
+}
+
+static bool push_parser_equals(JsonLogic_Handle expected, JsonLogic_LineInfo expected_info, JsonLogic_Handle actual, JsonLogic_LineInfo actual_info) {
+    if (!jsonlogic_deep_strict_equal(expected, actual)) {
+        return false;
+    }
+    if (jsonlogic_is_error(expected)) {
+        return expected_info.index  == actual_info.index &&
+               expected_info.lineno == actual_info.lineno &&
+               expected_info.column == actual_info.column;
+    }
+    return true;
+}
+
+void test_push_parser(TestContext *test_context) {
+    JsonLogic_Parser *parser = jsonlogic_parser_new();
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    JsonLogic_LineInfo expected_info = JSONLOGIC_LINEINFO_INIT;
+    JsonLogic_LineInfo actual_info   = JSONLOGIC_LINEINFO_INIT;
+    char *data = NULL;
+
+    TEST_ASSERT(parser != NULL);
+
+    for (size_t test_index = 0; PUSH_PARSER_TESTS[test_index] != NULL; ++ test_index) {
+        const char *json = PUSH_PARSER_TESTS[test_index];
+        size_t size = strlen(json);
+        expected = jsonlogic_parse_sized(json, size, &expected_info);
+
+        // two chunks split at every position
+        for (size_t split = 0; split <= size; ++ split) {
+            jsonlogic_parser_feed(parser, json, split);
+            jsonlogic_parser_feed(parser, json + split, size - split);
+            actual_info = JSONLOGIC_LINEINFO_INIT;
+            actual = jsonlogic_parser_finish(parser, &actual_info);
+            TEST_ASSERT_X(push_parser_equals(expected, expected_info, actual, actual_info), {
+                fprintf(stderr, "      json: %s\n", json);
+                fprintf(stderr, "     split: %zu\n", split);
+                fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+                fprintf(stderr, "     index: %zu, %zu\n", expected_info.index, actual_info.index);
+            });
+            jsonlogic_decref(actual);
+            actual = JsonLogic_Null;
+        }
+
+        // one byte at a time
+        for (size_t index = 0; index < size; ++ index) {
+            jsonlogic_parser_feed(parser, json + index, 1);
+        }
+        actual_info = JSONLOGIC_LINEINFO_INIT;
+        actual = jsonlogic_parser_finish(parser, &actual_info);
+        TEST_ASSERT_X(push_parser_equals(expected, expected_info, actual, actual_info), {
+            fprintf(stderr, "      json: %s\n", json);
+            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+            fprintf(stderr, "     index: %zu, %zu\n", expected_info.index, actual_info.index);
+        });
+
+        jsonlogic_decref(expected);
+        jsonlogic_decref(actual);
+        expected = JsonLogic_Null;
+        actual   = JsonLogic_Null;
+    }
+
+    for (const char **filename = PUSH_PARSER_FILES; *filename != NULL; ++ filename) {
+        size_t size = 0;
+        data = read_file(*filename, &size);
+        TEST_ASSERT(data != NULL);
+        expected = jsonlogic_parse_sized(data, size, &expected_info);
+
+        for (const size_t *chunk_size = PUSH_PARSER_CHUNK_SIZES; *chunk_size != 0; ++ chunk_size) {
+            for (size_t index = 0; index < size; index += *chunk_size) {
+                size_t rest = size - index;
+                jsonlogic_parser_feed(parser, data + index, rest < *chunk_size ? rest : *chunk_size);
+            }
+            actual_info = JSONLOGIC_LINEINFO_INIT;
+            actual = jsonlogic_parser_finish(parser, &actual_info);
+            TEST_ASSERT_X(push_parser_equals(expected, expected_info, actual, actual_info), {
+                fprintf(stderr, "      file: %s\n", *filename);
+                fprintf(stderr, "chunk size: %zu\n", *chunk_size);
+                fprintf(stderr, "     index: %zu, %zu\n", expected_info.index, actual_info.index);
+            });
+            jsonlogic_decref(actual);
+            actual = JsonLogic_Null;
+        }
+
+        jsonlogic_decref(expected);
+        expected = JsonLogic_Null;
+        free(data);
+        data = NULL;
+    }
+
+    // the error is reported as soon as it is fed
+    TEST_ASSERT(jsonlogic_parser_feed(parser, "[1,", 3) == JSONLOGIC_ERROR_SUCCESS);
+    TEST_ASSERT(jsonlogic_parser_feed(parser, "]", 1) == JSONLOGIC_ERROR_SYNTAX_ERROR);
+    TEST_ASSERT(jsonlogic_parser_feed(parser, "2]", 2) == JSONLOGIC_ERROR_SYNTAX_ERROR);
+    actual = jsonlogic_parser_finish(parser, &actual_info);
+    TEST_ASSERT(actual == JsonLogic_Error_SyntaxError && actual_info.index == 3);
+
+cleanup:
+    jsonlogic_parser_free(parser);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(actual);
+    free(data);
+}
+
+static const char *PROJECTION_DOC =
+    "{\"user\": {\"name\": \"Ann\", \"address\": {\"city\": \"Graz\", \"zip\": \"8010\"}, \"tags\": [\"a\", \"b\"]},\n"
+    " \"items\": [{\"id\": 1, \"price\": 2.5}, {\"id\": 2, \"price\": 3}, {\"id\": 3}],\n"
+    " \"list\": [10, [20], {\"x\": 30}, \"40\"],\n"
+    " \"big\": {\"deep\": [[1, 2, {\"x\": \"\\u00e9\"}], \"y\"], \"n\": -1.5e3, \"t\": true},\n"
+    " \"k\\u00e9y\": true, \"str\": \"hello\", \"0\": \"zero\"}";
+
+static const char *PROJECTION_PATHS[] = {
+    "user.address.city",
+    "user.tags",
+    "items.1.price",
+    "list.length",
+    "k\xc3\xa9y",
+    "str.1",
+    "missing.path",
+    NULL,
+};
+
+static const char *PROJECTION_ERRORS[] = {
+    "{\"big\": {\"deep\": [1, {\"x\" 2}]}}",
+    "{\"big\": [1, ]}",
+    "{\"user\": {\"tags\": [\"a\", }}",
+    "{\"items\": [{}, {\"price\": 1, \"id\": tru}]}",
+    "{\"k\\u00e9y\": \"\\ud83d\\u\"}",
+    "{\"big\": {}} {}",
+    "{\"big\": {]}",
+    NULL,
+};
+
+static const char *PROJECTION_EXPECTED =
+    "{\"user\": {\"address\": {\"city\": \"Graz\"}, \"tags\": [\"a\", \"b\"]},"
+    " \"items\": [null, {\"price\": 3}],"
+    " \"list\": [null, null, null, null],"
+    " \"k\\u00e9y\": true, \"str\": \"hello\", \"0\": \"zero\"}";
+
+void test_projected_parsing(TestContext *test_context) {
+    JsonLogic_Handle paths[16];
+    size_t path_count = 0;
+    JsonLogic_Projection *projection = NULL;
+    JsonLogic_Projection *whole = NULL;
+    JsonLogic_Projection *empty = NULL;
+    JsonLogic_Handle whole_path = JsonLogic_Null;
+    JsonLogic_Handle full     = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_LineInfo expected_info = JSONLOGIC_LINEINFO_INIT;
+    JsonLogic_LineInfo actual_info   = JSONLOGIC_LINEINFO_INIT;
+
+    for (; PROJECTION_PATHS[path_count] != NULL; ++ path_count) {
+        paths[path_count] = jsonlogic_string_from_utf8(PROJECTION_PATHS[path_count]);
+    }
+    // numbers index objects by their string
+    paths[path_count ++] = jsonlogic_number_from(0);
+
+    projection = jsonlogic_projection_new(paths, path_count);
+    TEST_ASSERT(projection != NULL);
+
+    full     = jsonlogic_parse(PROJECTION_DOC, NULL);
+    expected = jsonlogic_parse(PROJECTION_EXPECTED, NULL);
+    actual   = jsonlogic_parse_projected(PROJECTION_DOC, strlen(PROJECTION_DOC), projection, NULL);
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
+        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+    });
+
+    // var of the paths reads the same values
+    for (size_t index = 0; index < path_count; ++ index) {
+        JsonLogic_Handle logic = jsonlogic_object_from_utf16((JsonLogic_Object_Utf16Entry[]){
+            { u"var", paths[index] },
+        }, 1);
+        JsonLogic_Handle full_result      = jsonlogic_apply(logic, full);
+        JsonLogic_Handle projected_result = jsonlogic_apply(logic, actual);
+        bool equal = jsonlogic_deep_strict_equal(full_result, projected_result);
+        jsonlogic_decref(full_result);
+        jsonlogic_decref(projected_result);
+        jsonlogic_decref(logic);
+        TEST_ASSERT_FMT(equal, "var of path %zu", index);
+    }
+
+    jsonlogic_decref(actual);
+    actual = JsonLogic_Null;
+
+    // "" is the whole document, no paths keep nothing of it
+    whole_path = jsonlogic_string_from_latin1("");
+    whole = jsonlogic_projection_new(&whole_path, 1);
+    TEST_ASSERT(whole != NULL);
+    actual = jsonlogic_parse_projected(PROJECTION_DOC, strlen(PROJECTION_DOC), whole, NULL);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(full, actual));
+    jsonlogic_decref(actual);
+    actual = JsonLogic_Null;
+
+    empty = jsonlogic_projection_new(NULL, 0);
+    TEST_ASSERT(empty != NULL);
+    actual = jsonlogic_parse_projected(PROJECTION_DOC, strlen(PROJECTION_DOC), empty, NULL);
+    TEST_ASSERT(jsonlogic_is_object(actual) && jsonlogic_get_utf16(actual, u"user") == JsonLogic_Null);
+    jsonlogic_decref(actual);
+    actual = JsonLogic_Null;
+
+    // skipped values are validated just the same
+    const char **tests[] = { PUSH_PARSER_TESTS, PROJECTION_ERRORS };
+    const JsonLogic_Projection *projections[] = { projection, empty };
+    for (size_t tests_index = 0; tests_index < sizeof(tests) / sizeof(tests[0]); ++ tests_index) {
+        for (size_t test_index = 0; tests[tests_index][test_index] != NULL; ++ test_index) {
+            const char *json = tests[tests_index][test_index];
+            size_t size = strlen(json);
+            JsonLogic_Handle error = jsonlogic_parse_sized(json, size, &expected_info);
+            for (size_t projection_index = 0; projection_index < sizeof(projections) / sizeof(projections[0]); ++ projection_index) {
+                actual = jsonlogic_parse_projected(json, size, projections[projection_index], &actual_info);
+                if (jsonlogic_is_error(error)) {
+                    TEST_ASSERT_X(push_parser_equals(error, expected_info, actual, actual_info), {
+                        fprintf(stderr, "      json: %s\n", json);
+                        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, error);
+                        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+                        fprintf(stderr, "     index: %zu, %zu\n", expected_info.index, actual_info.index);
+                        jsonlogic_decref(error);
+                    });
+                } else {
+                    TEST_ASSERT_X(!jsonlogic_is_error(actual), {
+                        fprintf(stderr, "      json: %s\n", json);
+                        jsonlogic_decref(error);
+                    });
+                }
+                jsonlogic_decref(actual);
+                actual = JsonLogic_Null;
+            }
+            jsonlogic_decref(error);
+        }
+    }
+
+cleanup:
+    for (size_t index = 0; index < path_count; ++ index) {
+        jsonlogic_decref(paths[index]);
+    }
+    jsonlogic_decref(whole_path);
+    jsonlogic_projection_free(projection);
+    jsonlogic_projection_free(whole);
+    jsonlogic_projection_free(empty);
+    jsonlogic_decref(full);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(expected);
+}
+
+static const char *TAPE_PATHS[] = {
+    "big.deep.0.2.x",
+    "big.deep.1",
+    "big.deep.0.length",
+    "big.n",
+    "big.t.x",
+    "items.length",
+    "items.2",
+    "items.7.id",
+    "user.name.0",
+    "user.name.length",
+    "user.tags.1.length",
+    "list.1.0",
+    "list.3.1",
+    "list.x",
+    "big",
+    "",
+    NULL,
+};
+
+void test_tape(TestContext *test_context) {
+    JsonLogic_Handle paths[32];
+    size_t path_count = 0;
+    JsonLogic_Tape *tape = jsonlogic_tape_new();
+    JsonLogic_Projection *projection = NULL;
+    JsonLogic_Handle full     = JsonLogic_Null;
+    JsonLogic_Handle actual   = JsonLogic_Null;
+    JsonLogic_Handle expected = JsonLogic_Null;
+    JsonLogic_LineInfo expected_info = JSONLOGIC_LINEINFO_INIT;
+    JsonLogic_LineInfo actual_info   = JSONLOGIC_LINEINFO_INIT;
+
+    for (size_t index = 0; PROJECTION_PATHS[index] != NULL; ++ index) {
+        paths[path_count ++] = jsonlogic_string_from_utf8(PROJECTION_PATHS[index]);
+    }
+    for (size_t index = 0; TAPE_PATHS[index] != NULL; ++ index) {
+        paths[path_count ++] = jsonlogic_string_from_utf8(TAPE_PATHS[index]);
+    }
+    paths[path_count ++] = jsonlogic_number_from(0);
+    paths[path_count ++] = JsonLogic_Null;
+
+    TEST_ASSERT(tape != NULL);
+    TEST_ASSERT(jsonlogic_tape_materialize(tape, NULL) == JsonLogic_Error_IllegalArgument);
+
+    TEST_ASSERT(jsonlogic_tape_parse(tape, PROJECTION_DOC, strlen(PROJECTION_DOC), NULL) == JSONLOGIC_ERROR_SUCCESS);
+    full   = jsonlogic_parse(PROJECTION_DOC, NULL);
+    actual = jsonlogic_tape_materialize(tape, NULL);
+    TEST_ASSERT(jsonlogic_deep_strict_equal(full, actual));
+    jsonlogic_decref(actual);
+    actual = JsonLogic_Null;
+
+    // the paths read the same values as var
+    for (size_t index = 0; index < path_count; ++ index) {
+        JsonLogic_Handle logic = jsonlogic_object_from_utf16((JsonLogic_Object_Utf16Entry[]){
+            { u"var", paths[index] },
+        }, 1);
+        expected = jsonlogic_apply(logic, full);
+        actual   = jsonlogic_tape_get(tape, paths[index]);
+        jsonlogic_decref(logic);
+        TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
+            fprintf(stderr, "      path: "); jsonlogic_println(stderr, paths[index]);
+            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        });
+        jsonlogic_decref(expected);
+        jsonlogic_decref(actual);
+        expected = JsonLogic_Null;
+        actual   = JsonLogic_Null;
+    }
+
+    // the same tape materializes the projections of different rules
+    for (size_t count = 1; count <= path_count; ++ count) {
+        projection = jsonlogic_projection_new(paths + path_count - count, count);
+        TEST_ASSERT(projection != NULL);
+        expected = jsonlogic_parse_projected(PROJECTION_DOC, strlen(PROJECTION_DOC), projection, NULL);
+        actual   = jsonlogic_tape_materialize(tape, projection);
+        TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
+            fprintf(stderr, "     paths: %zu\n", count);
+            fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+            fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        });
+        jsonlogic_decref(expected);
+        jsonlogic_decref(actual);
+        jsonlogic_projection_free(projection);
+        expected   = JsonLogic_Null;
+        actual     = JsonLogic_Null;
+        projection = NULL;
+    }
+
+    // the last of duplicate keys wins, like when parsed
+    {
+        const char *json = "{\"a\": 1, \"a\": {\"b\": [2]}, \"c\": 3}";
+        TEST_ASSERT(jsonlogic_tape_parse(tape, json, strlen(json), NULL) == JSONLOGIC_ERROR_SUCCESS);
+        expected = jsonlogic_parse(json, NULL);
+        actual   = jsonlogic_tape_materialize(tape, NULL);
+        TEST_ASSERT(jsonlogic_deep_strict_equal(expected, actual));
+        jsonlogic_decref(expected);
+        jsonlogic_decref(actual);
+        expected = JsonLogic_Null;
+        JsonLogic_Handle path = jsonlogic_string_from_latin1("a.b.0");
+        actual   = jsonlogic_tape_get(tape, path);
+        jsonlogic_decref(path);
+        TEST_ASSERT(actual == jsonlogic_number_from(2));
+    }
+
+    // a tape is reused for the next document and has the same errors
+    const char **tests[] = { PUSH_PARSER_TESTS, PROJECTION_ERRORS };
+    for (size_t tests_index = 0; tests_index < sizeof(tests) / sizeof(tests[0]); ++ tests_index) {
+        for (size_t test_index = 0; tests[tests_index][test_index] != NULL; ++ test_index) {
+            const char *json = tests[tests_index][test_index];
+            size_t size = strlen(json);
+            expected = jsonlogic_parse_sized(json, size, &expected_info);
+            JsonLogic_Error error = jsonlogic_tape_parse(tape, json, size, &actual_info);
+            actual = jsonlogic_tape_materialize(tape, NULL);
+            if (jsonlogic_is_error(expected)) {
+                TEST_ASSERT_X(push_parser_equals(expected, expected_info, error, actual_info) && actual == JsonLogic_Error_IllegalArgument, {
+                    fprintf(stderr, "      json: %s\n", json);
+                    fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                    fprintf(stderr, "    actual: "); jsonlogic_println(stderr, error);
+                    fprintf(stderr, "     index: %zu, %zu\n", expected_info.index, actual_info.index);
+                });
+            } else {
+                TEST_ASSERT_X(error == JSONLOGIC_ERROR_SUCCESS && jsonlogic_deep_strict_equal(expected, actual), {
+                    fprintf(stderr, "      json: %s\n", json);
+                    fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                    fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+                });
+            }
+            jsonlogic_decref(expected);
+            jsonlogic_decref(actual);
+            expected = JsonLogic_Null;
+            actual   = JsonLogic_Null;
+        }
+    }
+
+cleanup:
+    for (size_t index = 0; index < path_count; ++ index) {
+        jsonlogic_decref(paths[index]);
+    }
+    jsonlogic_tape_free(tape);
+    jsonlogic_projection_free(projection);
+    jsonlogic_decref(full);
+    jsonlogic_decref(actual);
+    jsonlogic_decref(expected);
+}
+
+void test_extras(TestContext *test_context) {
+    JsonLogic_Handle logic    = jsonlogic_parse("{\"zip\": [[1,2,3],[\"a\",\"b\"]]}", NULL);
+    JsonLogic_Handle expected = jsonlogic_parse("[[1,\"a\"],[2,\"b\"]]", NULL);
+    JsonLogic_Handle actual   = jsonlogic_apply_custom(logic, JsonLogic_Null, &JsonLogic_Extras);
+
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
+        fprintf(stderr, "     error: Wrong result\n");
+        fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+        fprintf(stderr, "      data: "); jsonlogic_println(stderr, JsonLogic_Null);
+        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        fputc('\n', stderr);
+    });
+
+    jsonlogic_decref(logic);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(actual);
+
+    logic    = jsonlogic_parse("{\"combinations\": [[1,2,3],[\"a\",\"b\",\"c\"],[\"x\",\"y\",\"z\"]]}", NULL);
+    expected = jsonlogic_parse("[[1, \"a\", \"x\"], [1, \"a\", \"y\"], [1, \"a\", \"z\"], [1, \"b\", \"x\"], [1, \"b\", \"y\"], [1, \"b\", \"z\"], [1, \"c\", \"x\"], [1, \"c\", \"y\"], [1, \"c\", \"z\"], [2, \"a\", \"x\"], [2, \"a\", \"y\"], [2, \"a\", \"z\"], [2, \"b\", \"x\"], [2, \"b\", \"y\"], [2, \"b\", \"z\"], [2, \"c\", \"x\"], [2, \"c\", \"y\"], [2, \"c\", \"z\"], [3, \"a\", \"x\"], [3, \"a\", \"y\"], [3, \"a\", \"z\"], [3, \"b\", \"x\"], [3, \"b\", \"y\"], [3, \"b\", \"z\"], [3, \"c\", \"x\"], [3, \"c\", \"y\"], [3, \"c\", \"z\"]]", NULL);
+    actual   = jsonlogic_apply_custom(logic, JsonLogic_Null, &JsonLogic_Extras);
+
+    TEST_ASSERT_X(jsonlogic_deep_strict_equal(expected, actual), {
+        fprintf(stderr, "     error: Wrong result\n");
+        fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+        fprintf(stderr, "      data: "); jsonlogic_println(stderr, JsonLogic_Null);
+        fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+        fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+        fputc('\n', stderr);
+    });
+
+cleanup:
+    jsonlogic_decref(logic);
+    jsonlogic_decref(expected);
+    jsonlogic_decref(actual);
+}
+
+const TestCase TEST_CASES[] = {
+    TEST_DECL("Unicode and JSON parsing", parsing),
+    TEST_DECL("JSON parsing across scan blocks", parsing_blocks),
+    TEST_DECL("Parsing JSON in chunks", push_parser),
+    TEST_DECL("Projected parsing", projected_parsing),
+    TEST_DECL("Lazily materialized tapes", tape),
+    TEST_DECL("Bad Operator", bad_operator),
+#if !defined(JSONLOGIC_WINDOWS)
+    TEST_DECL("Logging", logging),
+#endif
+    TEST_DECL("Edge Cases", edge_cases),
+    TEST_DECL("Expanding functionality with custom operators", custom_operators),
+    TEST_DECL("Control structures don't eval depth-first", short_circuit),
+    TEST_DECL("Compiled programs", compiled),
+    TEST_DECL("Frozen values", freeze),
+    TEST_DECL("Immortal values", immortal),
+    TEST_DECL("Arena allocation", arena),
+    TEST_DECL("Optimizing logic", optimize),
+    TEST_DECL("Compiled var paths", var_paths),
+    TEST_DECL("Applying logic to many inputs", batch),
+    TEST_DECL("Columnar evaluation", columnar),
+    TEST_DECL("Rule sets", ruleset),
+    TEST_DECL("Rule set guard index", ruleset_index),
+    TEST_DECL("Rule set decision diagram", ruleset_diagram),
+    TEST_DECL("Maximum nesting depth", max_depth),
+    TEST_DECL("Reduce without context object", reduce_scope),
+    TEST_DECL("Parallel lambda operations", parallel),
+    TEST_DECL("Fused filter and map pipelines", pipeline),
+    TEST_DECL("Lazy custom operations", lazy_operations),
+    TEST_DECL("Memoized operations", memo),
+    TEST_DECL("Sub-string of non-ASCII strings", substr),
+    TEST_DECL("Test extra operators", extras),
+    TEST_END,
+};
+
+JsonLogic_Handle parse_file(const char *filename) {
+    char *data = read_file(filename, NULL);
+    if (data == NULL) {
+        return JsonLogic_Error_IOError;
+    }
+
+    JsonLogic_LineInfo info = JSONLOGIC_LINEINFO_INIT;
+    JsonLogic_Handle handle = jsonlogic_parse(data, &info);
+
+    JsonLogic_Error error = jsonlogic_get_error(handle);
+    if (error != JSONLOGIC_ERROR_SUCCESS) {
+        jsonlogic_print_parse_error(stderr, data, error, info);
+        free(data);
+        return handle;
+    }
+    free(data);
+
+    return handle;
 }
 
 const char *CertLogicTests[] = {
@@ -886,6 +3112,7 @@ const char *CertLogicTests[] = {
     "tests/certlogic/JsonLogic-testSuite.json",
     "tests/certlogic/patched-reduce.json",
     "tests/certlogic/var.json",
+    "tests/certlogic-local.json",
     NULL,
 };
 
@@ -928,6 +3155,8 @@ int main(int argc, char *argv[]) {
     JsonLogic_Handle rule  = JsonLogic_Null;
     JsonLogic_Handle valid_examples   = JsonLogic_Null;
     JsonLogic_Handle invalid_examples = JsonLogic_Null;
+    JsonLogic_Program *rule_program = NULL;
+    JsonLogic_Arena *arena = NULL;
 
     JsonLogic_Operations ops = JSONLOGIC_OPERATIONS_INIT;
     JsonLogic_Error error = jsonlogic_operations_extend(&ops, &JsonLogic_Extras);
@@ -962,11 +3191,6 @@ int main(int argc, char *argv[]) {
         goto error;
     }
 
-    tests = parse_file("tests/tests.json");
-    if (jsonlogic_is_error(tests)) {
-        goto error;
-    }
-
     rule = parse_file("tests/rule.json");
     if (jsonlogic_is_error(rule)) {
         goto error;
@@ -982,6 +3206,19 @@ int main(int argc, char *argv[]) {
         goto error;
     }
 
+    rule_program = jsonlogic_compile(rule, &ops);
+    if (rule_program == NULL) {
+        fprintf(stderr, "*** error: compiling tests/rule.json: %s\n", strerror(errno));
+        goto error;
+    }
+
+    // small blocks so evaluations span several blocks
+    arena = jsonlogic_arena_new(256);
+    if (arena == NULL) {
+        fprintf(stderr, "*** error: creating arena: %s\n", strerror(errno));
+        goto error;
+    }
+
     TestContext test_context = {
         .test_case = NULL,
         .newline   = false,
@@ -1032,90 +3269,171 @@ int main(int argc, char *argv[]) {
         test_context.passed = false; \
         fprintf(stderr, "      test: %" PRIuPTR "\n", test_count);
 
-    JsonLogic_Iterator iter = jsonlogic_iter(tests);
-
-    putchar('\n');
-    puts("Tests from https://jsonlogic.com/tests.json");
-    for (;;) {
-        JsonLogic_Handle test = jsonlogic_iter_next(&iter);
-        JsonLogic_Error error = jsonlogic_get_error(test);
+    JsonLogic_Iterator iter;
+    size_t tests_logic_index = 0;
 
-        if (error == JSONLOGIC_ERROR_STOP_ITERATION) {
-            if (!test_context.newline) {
-                print_ok();
-                fflush(stdout);
-                test_context.newline = false;
-            }
-            break;
-        } else if (error != JSONLOGIC_ERROR_SUCCESS) {
-            FAIL();
-            fprintf(stderr, "     error: in tests/tests.json: %s\n", jsonlogic_get_error_message(error));
-            break;
+    for (const LogicTests *logic_tests = LOGIC_TESTS; logic_tests->filename; ++ logic_tests) {
+        tests = parse_file(logic_tests->filename);
+        if (jsonlogic_is_error(tests)) {
+            goto error;
         }
 
-        if (jsonlogic_is_string(test)) {
-            if (!test_context.newline) {
-                print_ok();
-            }
-            size_t size = 0;
-            const char16_t *str = jsonlogic_get_string_content(test, &size);
-            printf(" - "); jsonlogic_print_utf16(stdout, str, size); printf(" ... ");
-            fflush(stdout);
-            test_context.newline = false;
-        } else {
-            ++ test_count;
+        iter = jsonlogic_iter(tests);
 
-            JsonLogic_Handle logic    = jsonlogic_get_index(test, 0);
-            JsonLogic_Handle data     = jsonlogic_get_index(test, 1);
-            JsonLogic_Handle expected = jsonlogic_get_index(test, 2);
-            JsonLogic_Handle actual   = JsonLogic_Null;
+        putchar('\n');
+        puts(logic_tests->title);
+        test_context.newline = true;
+        for (;;) {
+            JsonLogic_Handle test = jsonlogic_iter_next(&iter);
+            JsonLogic_Error error = jsonlogic_get_error(test);
 
-            if (jsonlogic_is_error(logic)) {
+            if (error == JSONLOGIC_ERROR_STOP_ITERATION) {
+                if (!test_context.newline) {
+                    print_ok();
+                    fflush(stdout);
+                    test_context.newline = false;
+                }
+                break;
+            } else if (error != JSONLOGIC_ERROR_SUCCESS) {
                 FAIL();
-                fprintf(stderr, "     error: in tests/tests.json: %s\n", jsonlogic_get_error_message(jsonlogic_get_error(logic)));
-                goto test_cleanup;
+                fprintf(stderr, "     error: in %s: %s\n", logic_tests->filename, jsonlogic_get_error_message(error));
+                break;
             }
 
-            if (jsonlogic_is_error(data)) {
-                FAIL();
-                fprintf(stderr, "     error: in tests/tests.json: %s\n", jsonlogic_get_error_message(jsonlogic_get_error(data)));
-                goto test_cleanup;
-            }
+            if (jsonlogic_is_string(test)) {
+                if (!test_context.newline) {
+                    print_ok();
+                }
+                size_t size = 0;
+                const char16_t *str = jsonlogic_get_string_content(test, &size);
+                printf(" - "); jsonlogic_print_utf16(stdout, str, size); printf(" ... ");
+                fflush(stdout);
+                test_context.newline = false;
+            } else {
+                ++ test_count;
 
-            if (jsonlogic_is_error(expected)) {
-                FAIL();
-                fprintf(stderr, "     error: in tests/tests.json: %s\n", jsonlogic_get_error_message(jsonlogic_get_error(expected)));
-                goto test_cleanup;
-            }
+                JsonLogic_Handle logic    = jsonlogic_get_index(test, 0);
+                JsonLogic_Handle data     = jsonlogic_get_index(test, 1);
+                JsonLogic_Handle expected = jsonlogic_get_index(test, 2);
+                JsonLogic_Handle actual   = JsonLogic_Null;
 
-            actual = jsonlogic_apply(logic, data);
+                if (jsonlogic_is_error(logic)) {
+                    FAIL();
+                    fprintf(stderr, "     error: in %s: %s\n", logic_tests->filename, jsonlogic_get_error_message(jsonlogic_get_error(logic)));
+                    goto test_cleanup;
+                }
 
-            if (!jsonlogic_deep_strict_equal(expected, actual)) {
-                FAIL();
-                fprintf(stderr, "     error: Wrong result\n");
-                fprintf(stderr, "      test: "); jsonlogic_println(stderr, test);
-                fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
-                fprintf(stderr, "      data: "); jsonlogic_println(stderr, data);
-                fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
-                fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
-                fputc('\n', stderr);
-                goto test_cleanup;
-            }
+                if (jsonlogic_is_error(data)) {
+                    FAIL();
+                    fprintf(stderr, "     error: in %s: %s\n", logic_tests->filename, jsonlogic_get_error_message(jsonlogic_get_error(data)));
+                    goto test_cleanup;
+                }
 
-            ++ pass_count;
+                if (jsonlogic_is_error(expected)) {
+                    FAIL();
+                    fprintf(stderr, "     error: in %s: %s\n", logic_tests->filename, jsonlogic_get_error_message(jsonlogic_get_error(expected)));
+                    goto test_cleanup;
+                }
 
-        test_cleanup:
-            jsonlogic_decref(logic);
-            jsonlogic_decref(data);
-            jsonlogic_decref(expected);
-            jsonlogic_decref(actual);
+                actual = jsonlogic_apply(logic, data);
+
+                if (!jsonlogic_deep_strict_equal(expected, actual)) {
+                    FAIL();
+                    fprintf(stderr, "     error: Wrong result\n");
+                    fprintf(stderr, "      test: "); jsonlogic_println(stderr, test);
+                    fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+                    fprintf(stderr, "      data: "); jsonlogic_println(stderr, data);
+                    fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                    fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+                    fputc('\n', stderr);
+                    goto test_cleanup;
+                }
+
+                jsonlogic_decref(actual);
+                actual = apply_compiled(logic, data, &JsonLogic_Builtins);
+
+                if (!jsonlogic_deep_strict_equal(expected, actual)) {
+                    FAIL();
+                    fprintf(stderr, "     error: Wrong result of compiled program\n");
+                    fprintf(stderr, "      test: "); jsonlogic_println(stderr, test);
+                    fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+                    fprintf(stderr, "      data: "); jsonlogic_println(stderr, data);
+                    fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                    fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+                    fputc('\n', stderr);
+                    goto test_cleanup;
+                }
+
+                jsonlogic_decref(actual);
+                actual = jsonlogic_apply_arena(logic, data, arena);
+
+                if (!jsonlogic_deep_strict_equal(expected, actual)) {
+                    FAIL();
+                    fprintf(stderr, "     error: Wrong result with arena\n");
+                    fprintf(stderr, "      test: "); jsonlogic_println(stderr, test);
+                    fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+                    fprintf(stderr, "      data: "); jsonlogic_println(stderr, data);
+                    fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                    fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+                    fputc('\n', stderr);
+                    goto test_cleanup;
+                }
+
+                jsonlogic_decref(actual);
+                actual = apply_optimized(logic, data, &JsonLogic_Builtins);
+
+                if (!jsonlogic_deep_strict_equal(expected, actual)) {
+                    FAIL();
+                    fprintf(stderr, "     error: Wrong result of optimized logic\n");
+                    fprintf(stderr, "      test: "); jsonlogic_println(stderr, test);
+                    fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+                    fprintf(stderr, "      data: "); jsonlogic_println(stderr, data);
+                    fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                    fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+                    fputc('\n', stderr);
+                    goto test_cleanup;
+                }
+
+                jsonlogic_decref(actual);
+                actual = JsonLogic_Null;
+
+                if (tests_logic_index >= jsonlogic_tests_logic_count) {
+                    FAIL();
+                    fprintf(stderr, "     error: %s has more tests than the generated code\n", logic_tests->filename);
+                    goto test_cleanup;
+                }
+
+                actual = jsonlogic_tests_logic[tests_logic_index ++](data);
+
+                if (!jsonlogic_deep_strict_equal(expected, actual)) {
+                    FAIL();
+                    fprintf(stderr, "     error: Wrong result of generated C code\n");
+                    fprintf(stderr, "      test: "); jsonlogic_println(stderr, test);
+                    fprintf(stderr, "     logic: "); jsonlogic_println(stderr, logic);
+                    fprintf(stderr, "      data: "); jsonlogic_println(stderr, data);
+                    fprintf(stderr, "  expected: "); jsonlogic_println(stderr, expected);
+                    fprintf(stderr, "    actual: "); jsonlogic_println(stderr, actual);
+                    fputc('\n', stderr);
+                    goto test_cleanup;
+                }
+
+                ++ pass_count;
+
+            test_cleanup:
+                jsonlogic_decref(logic);
+                jsonlogic_decref(data);
+                jsonlogic_decref(expected);
+                jsonlogic_decref(actual);
+            }
+
+            jsonlogic_decref(test);
         }
 
-        jsonlogic_decref(test);
+        jsonlogic_iter_free(&iter);
+        jsonlogic_decref(tests);
+        tests = JsonLogic_Null;
     }
 
-    jsonlogic_iter_free(&iter);
-
     iter = jsonlogic_iter(valid_examples);
 
     putchar('\n');
@@ -1159,6 +3477,21 @@ int main(int argc, char *argv[]) {
         JsonLogic_Handle code   = jsonlogic_get_utf16(test, u"code");
         JsonLogic_Handle result = jsonlogic_apply_custom(rule, code, &ops);
 
+        if (jsonlogic_is_true(result) && rule_program != NULL) {
+            jsonlogic_decref(result);
+            result = jsonlogic_program_apply(rule_program, code);
+        }
+
+        if (jsonlogic_is_true(result)) {
+            jsonlogic_decref(result);
+            result = jsonlogic_apply_custom_arena(rule, code, &ops, arena);
+        }
+
+        if (jsonlogic_is_true(result)) {
+            jsonlogic_decref(result);
+            result = apply_optimized(rule, code, &ops);
+        }
+
         if (jsonlogic_is_true(result)) {
             print_ok();
             ++ pass_count;
@@ -1224,6 +3557,21 @@ int main(int argc, char *argv[]) {
         JsonLogic_Handle code   = jsonlogic_get_utf16(test, u"code");
         JsonLogic_Handle result = jsonlogic_apply_custom(rule, code, &ops);
 
+        if (jsonlogic_is_false(result) && rule_program != NULL) {
+            jsonlogic_decref(result);
+            result = jsonlogic_program_apply(rule_program, code);
+        }
+
+        if (jsonlogic_is_false(result)) {
+            jsonlogic_decref(result);
+            result = jsonlogic_apply_custom_arena(rule, code, &ops, arena);
+        }
+
+        if (jsonlogic_is_false(result)) {
+            jsonlogic_decref(result);
+            result = apply_optimized(rule, code, &ops);
+        }
+
         if (jsonlogic_is_false(result)) {
             print_ok();
             ++ pass_count;
@@ -1340,6 +3688,19 @@ int main(int argc, char *argv[]) {
                 JsonLogic_Handle used_logic = JSONLOGIC_IS_NULL(assert_logic) ? logic : assert_logic;
                 JsonLogic_Handle actual = certlogic_apply(used_logic, data);
 
+                if (jsonlogic_deep_strict_equal(actual, expected)) {
+                    JsonLogic_Program *program = certlogic_compile(used_logic, &CertLogic_Builtins);
+                    jsonlogic_decref(actual);
+                    actual = program == NULL ? JsonLogic_Error_OutOfMemory :
+                        jsonlogic_program_apply(program, data);
+                    jsonlogic_program_free(program);
+                }
+
+                if (jsonlogic_deep_strict_equal(actual, expected)) {
+                    jsonlogic_decref(actual);
+                    actual = certlogic_apply_optimized(used_logic, data, &CertLogic_Builtins);
+                }
+
                 if (!jsonlogic_deep_strict_equal(actual, expected)) {
                     FAIL();
                     fprintf(stderr, "     error: Wrong result\n");
@@ -1404,6 +3765,8 @@ cleanup:
     jsonlogic_decref(rule);
     jsonlogic_decref(valid_examples);
     jsonlogic_decref(invalid_examples);
+    jsonlogic_program_free(rule_program);
+    jsonlogic_arena_free(arena);
     jsonlogic_operations_free(&ops);
 
     return status;
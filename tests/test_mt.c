@@ -0,0 +1,362 @@
+// for clock_gettime()
+#define _GNU_SOURCE 1
+
+#include "jsonlogic_intern.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <time.h>
+
+// Stress tests for sharing values between threads. Frozen values can be
+// shared with any build, handing over ownership of values to another thread
+// needs atomic reference counts (make MT=ON test_mt). The printed times can be
+// compared between both builds.
+
+#define THREAD_COUNT 8
+#define ITERATIONS   20000
+#define SHARE_COUNT  4
+#define QUEUE_SIZE   64
+
+#if defined(JSONLOGIC_WINDOWS)
+    #define COL_RED
+    #define COL_GREEN
+    #define COL_NORMAL
+#else
+    #define COL_RED    "\x1B[31m"
+    #define COL_GREEN  "\x1B[32m"
+    #define COL_NORMAL "\x1B[0m"
+#endif
+
+#define CHECK(EXPR) \
+    if (!(EXPR)) { \
+        fprintf(stderr, "%s:%u: Assertion failed: %s\n", __FILE__, __LINE__, #EXPR); \
+        goto cleanup; \
+    }
+
+static const char *LOGIC =
+    "{\"map\":[{\"var\":\"items\"},{\"cat\":[{\"var\":\"\"},\"-\",{\"var\":\"\"}]}]}";
+
+static const char *DATA =
+    "{\"items\":[1,2,3,4,5,6,7,8]}";
+
+static const char *EXPECTED =
+    "[\"1-1\",\"2-2\",\"3-3\",\"4-4\",\"5-5\",\"6-6\",\"7-7\",\"8-8\"]";
+
+typedef struct Shared {
+    JsonLogic_Handle logic;
+    JsonLogic_Handle data;
+    JsonLogic_Handle expected;
+    JsonLogic_Program *program;
+} Shared;
+
+typedef struct Worker {
+    pthread_t thread;
+    const Shared *shared;
+    struct Queue *queue;
+    JsonLogic_Handle value;
+    size_t count;
+    bool ok;
+} Worker;
+
+static double elapsed_ms(const struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - start->tv_sec) * 1000.0 +
+           (double)(now.tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+static void *apply_frozen(void *arg) {
+    Worker *worker = arg;
+    const Shared *shared = worker->shared;
+    JsonLogic_Handle result = JsonLogic_Null;
+
+    for (size_t index = 0; index < ITERATIONS; ++ index) {
+        result = index % 2 == 0 ?
+            jsonlogic_apply(shared->logic, shared->data) :
+            jsonlogic_program_apply(shared->program, shared->data);
+        CHECK(jsonlogic_deep_strict_equal(result, shared->expected));
+        jsonlogic_decref(result);
+        result = JsonLogic_Null;
+    }
+
+    worker->ok = true;
+
+cleanup:
+    jsonlogic_decref(result);
+    return NULL;
+}
+
+#if defined(JSONLOGIC_ATOMIC_REFCOUNT)
+typedef struct Queue {
+    pthread_mutex_t mutex;
+    pthread_cond_t  not_empty;
+    pthread_cond_t  not_full;
+    JsonLogic_Handle items[QUEUE_SIZE];
+    size_t head;
+    size_t size;
+} Queue;
+
+static void queue_push(Queue *queue, JsonLogic_Handle value) {
+    pthread_mutex_lock(&queue->mutex);
+    while (queue->size == QUEUE_SIZE) {
+        pthread_cond_wait(&queue->not_full, &queue->mutex);
+    }
+    queue->items[(queue->head + queue->size) % QUEUE_SIZE] = value;
+    ++ queue->size;
+    pthread_cond_signal(&queue->not_empty);
+    pthread_mutex_unlock(&queue->mutex);
+}
+
+static JsonLogic_Handle queue_pop(Queue *queue) {
+    pthread_mutex_lock(&queue->mutex);
+    while (queue->size == 0) {
+        pthread_cond_wait(&queue->not_empty, &queue->mutex);
+    }
+    JsonLogic_Handle value = queue->items[queue->head];
+    queue->head = (queue->head + 1) % QUEUE_SIZE;
+    -- queue->size;
+    pthread_cond_signal(&queue->not_full);
+    pthread_mutex_unlock(&queue->mutex);
+    return value;
+}
+
+// Every result is handed to SHARE_COUNT consumers, the last one frees it.
+static void *produce(void *arg) {
+    Worker *worker = arg;
+    const Shared *shared = worker->shared;
+
+    for (size_t index = 0; index < ITERATIONS; ++ index) {
+        JsonLogic_Handle result = jsonlogic_program_apply(worker->shared->program, shared->data);
+        for (size_t share = 1; share < SHARE_COUNT; ++ share) {
+            jsonlogic_incref(result);
+        }
+        for (size_t share = 0; share < SHARE_COUNT; ++ share) {
+            queue_push(worker->queue, result);
+        }
+    }
+
+    worker->ok = true;
+    return NULL;
+}
+
+static void *consume(void *arg) {
+    Worker *worker = arg;
+    bool ok = true;
+
+    // keep popping on errors, otherwise the producers would block forever
+    for (size_t index = 0; index < worker->count; ++ index) {
+        JsonLogic_Handle result = queue_pop(worker->queue);
+        if (!jsonlogic_deep_strict_equal(result, worker->shared->expected)) {
+            fprintf(stderr, "%s:%u: wrong result\n", __FILE__, __LINE__);
+            ok = false;
+        }
+
+        // keep a part of the result alive for a bit longer than the result
+        JsonLogic_Handle item = jsonlogic_get_index(result, index % 8);
+        jsonlogic_decref(result);
+        if (!jsonlogic_is_string(item)) {
+            fprintf(stderr, "%s:%u: wrong item\n", __FILE__, __LINE__);
+            ok = false;
+        }
+        jsonlogic_decref(item);
+    }
+
+    worker->ok = ok;
+    return NULL;
+}
+
+// All threads reference the same value that isn't frozen.
+static void *share_value(void *arg) {
+    Worker *worker = arg;
+
+    for (size_t index = 0; index < ITERATIONS; ++ index) {
+        JsonLogic_Handle value = jsonlogic_incref(worker->value);
+        JsonLogic_Handle item  = jsonlogic_get_index(value, index % 8);
+        jsonlogic_decref(value);
+        jsonlogic_decref(item);
+    }
+
+    worker->ok = true;
+    return NULL;
+}
+#endif
+
+static bool run_workers(Worker workers[], size_t count, void *(*func)(void *)) {
+    size_t started = 0;
+    bool ok = true;
+    for (; started < count; ++ started) {
+        if (pthread_create(&workers[started].thread, NULL, func, &workers[started]) != 0) {
+            perror("pthread_create");
+            ok = false;
+            break;
+        }
+    }
+    for (size_t index = 0; index < started; ++ index) {
+        pthread_join(workers[index].thread, NULL);
+        ok = ok && workers[index].ok;
+    }
+    return ok;
+}
+
+static bool test_frozen(const Shared *shared) {
+    Worker workers[THREAD_COUNT];
+    memset(workers, 0, sizeof(workers));
+    for (size_t index = 0; index < THREAD_COUNT; ++ index) {
+        workers[index].shared = shared;
+    }
+
+    return run_workers(workers, THREAD_COUNT, apply_frozen);
+}
+
+#if defined(JSONLOGIC_ATOMIC_REFCOUNT)
+static bool test_handover(const Shared *shared) {
+    Queue queue = { .head = 0, .size = 0 };
+    pthread_mutex_init(&queue.mutex, NULL);
+    pthread_cond_init(&queue.not_empty, NULL);
+    pthread_cond_init(&queue.not_full, NULL);
+
+    // producers and consumers have to run at the same time
+    Worker producers[THREAD_COUNT / 2];
+    Worker consumers[THREAD_COUNT / 2];
+    pthread_t threads[THREAD_COUNT];
+    size_t started = 0;
+    bool ok = true;
+
+    memset(producers, 0, sizeof(producers));
+    memset(consumers, 0, sizeof(consumers));
+    for (size_t index = 0; index < THREAD_COUNT / 2; ++ index) {
+        producers[index].shared = shared;
+        producers[index].queue  = &queue;
+        consumers[index].shared = shared;
+        consumers[index].queue  = &queue;
+        consumers[index].count  = ITERATIONS * SHARE_COUNT;
+    }
+
+    for (size_t index = 0; index < THREAD_COUNT / 2; ++ index) {
+        if (pthread_create(&threads[started ++], NULL, consume, &consumers[index]) != 0 ||
+            pthread_create(&threads[started ++], NULL, produce, &producers[index]) != 0) {
+            // a consumer without its producer would wait forever
+            perror("pthread_create");
+            exit(1);
+        }
+    }
+
+    for (size_t index = 0; index < started; ++ index) {
+        pthread_join(threads[index], NULL);
+    }
+
+    for (size_t index = 0; index < THREAD_COUNT / 2; ++ index) {
+        ok = ok && producers[index].ok && consumers[index].ok;
+    }
+
+    pthread_cond_destroy(&queue.not_full);
+    pthread_cond_destroy(&queue.not_empty);
+    pthread_mutex_destroy(&queue.mutex);
+
+    return ok && queue.size == 0;
+}
+
+static bool test_shared_refcount(const Shared *shared) {
+    Worker workers[THREAD_COUNT];
+    JsonLogic_Handle value = jsonlogic_program_apply(shared->program, shared->data);
+    JsonLogic_Handle item  = jsonlogic_get_index(value, 0);
+    bool ok = false;
+
+    memset(workers, 0, sizeof(workers));
+    for (size_t index = 0; index < THREAD_COUNT; ++ index) {
+        workers[index].value = value;
+    }
+
+    CHECK(run_workers(workers, THREAD_COUNT, share_value));
+    CHECK(jsonlogic_get_refcount(value) == 1);
+    CHECK(jsonlogic_get_refcount(item) == 2);
+
+    ok = true;
+
+cleanup:
+    jsonlogic_decref(value);
+    jsonlogic_decref(item);
+    return ok;
+}
+#endif
+
+typedef struct TestCase {
+    const char *name;
+    bool (*func)(const Shared *shared);
+} TestCase;
+
+static const TestCase TEST_CASES[] = {
+    { "Apply frozen logic to frozen data", test_frozen },
+#if defined(JSONLOGIC_ATOMIC_REFCOUNT)
+    { "Hand over results to other threads", test_handover },
+    { "Reference the same value from all threads", test_shared_refcount },
+#endif
+    { NULL, NULL },
+};
+
+int main(void) {
+    int status = 0;
+    Shared shared = {
+        .logic    = JsonLogic_Null,
+        .data     = JsonLogic_Null,
+        .expected = JsonLogic_Null,
+        .program  = NULL,
+    };
+    size_t test_count = 0;
+    size_t pass_count = 0;
+
+    shared.logic    = jsonlogic_freeze(jsonlogic_parse(LOGIC, NULL));
+    shared.data     = jsonlogic_freeze(jsonlogic_parse(DATA, NULL));
+    shared.expected = jsonlogic_freeze(jsonlogic_parse(EXPECTED, NULL));
+    shared.program  = jsonlogic_compile(shared.logic, &JsonLogic_Builtins);
+
+    if (jsonlogic_is_error(shared.logic) || jsonlogic_is_error(shared.data) ||
+        jsonlogic_is_error(shared.expected) || shared.program == NULL) {
+        fprintf(stderr, "*** error: preparing shared values\n");
+        goto error;
+    }
+
+#if defined(JSONLOGIC_ATOMIC_REFCOUNT)
+    puts("Multi-threaded Tests (atomic refcount)");
+#else
+    puts("Multi-threaded Tests");
+#endif
+    for (const TestCase *test = TEST_CASES; test->func; ++ test) {
+        ++ test_count;
+        printf(" - %s ... ", test->name);
+        fflush(stdout);
+
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        bool ok = test->func(&shared);
+        double ms = elapsed_ms(&start);
+
+        if (ok) {
+            ++ pass_count;
+            printf(COL_GREEN "OK" COL_NORMAL " (%.3f ms)\n", ms);
+        } else {
+            puts(COL_RED "FAILED" COL_NORMAL);
+        }
+    }
+
+    printf("\ntests: %" PRIuPTR ", failed: %" PRIuPTR ", passed: %" PRIuPTR "\n",
+        test_count, test_count - pass_count, pass_count);
+
+    status = test_count == pass_count ? 0 : 1;
+
+    goto cleanup;
+
+error:
+    status = 1;
+
+cleanup:
+    jsonlogic_program_free(shared.program);
+    jsonlogic_decref(jsonlogic_thaw(shared.logic));
+    jsonlogic_decref(jsonlogic_thaw(shared.data));
+    jsonlogic_decref(jsonlogic_thaw(shared.expected));
+
+    return status;
+}